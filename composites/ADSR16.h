@@ -37,6 +37,15 @@ public:
 
     float_4 get(int bank) const;
 
+    /**
+     * Puts the bank where it ends up after a long release with the gate off.
+     * For when the voices go to sleep.
+     */
+    void setSilent(int bank) {
+        env[bank] = float_4::zero();
+        attacking[bank] = float_4::mask();
+    }
+
 private:
     // 0..1
     float_4 env[4] = {0.f};
@@ -33,6 +33,19 @@ public:
      */
     float_4 step(const float_4& gates, float sampleTime);
 
+    float_4 get() const {
+        return env;
+    }
+
+    /**
+     * Puts the envelope where it ends up after a long release with the gate off.
+     * For when the voices go to sleep.
+     */
+    void setSilent() {
+        env = float_4::zero();
+        attacking = float_4::mask();
+    }
+
 private:
     // 0..1
     float_4 env = 0;
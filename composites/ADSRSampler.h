@@ -25,6 +25,27 @@ public:
      */
     float_4 step(const float_4& gates, float sampleTime);
 
+    float_4 get() const {
+        return env;
+    }
+
+    /**
+     * Puts the envelope where it ends up after a long release with the gate off.
+     * For when the voices go to sleep.
+     */
+    void setSilent() {
+        env = float_4::zero();
+        attacking = float_4::mask();
+    }
+
+    // for the SimdDispatch sampleStep kernel
+    float* _envData() { return &env[0]; }
+    float* _attackingData() { return &attacking[0]; }
+    const float* _attackLambdaData() const { return &attackLambda[0]; }
+    const float* _decayLambdaData() const { return &decayLambda[0]; }
+    const float* _releaseLambdaData() const { return &releaseLambda[0]; }
+    const float* _sustainData() const { return &sustain[0]; }
+
 private:
     // 0..1
     float_4 env = 0;
@@ -103,6 +103,7 @@ public:
         PW_PARAM,
         PWM_PARAM,
         WAVEFORM_PARAM,
+        LITE_PARAM,
         NUM_PARAMS
     };
 
@@ -146,11 +147,11 @@ private:
     BasicVCO::processFunction pProcess = nullptr;
     std::shared_ptr<LookupTableParams<float>> bipolarAudioLookup = ObjectCache<float>::getBipolarAudioTaper();
 
-    Divider divn;
-    Divider divm;
-
     void stepn();
     void stepm();
+
+    FixedDivider<4, DividerCallback<Basic, &Basic::stepn>> divn;
+    FixedDivider<16, DividerCallback<Basic, &Basic::stepm>> divm;
     void nullFunc() {}
 
     using processFunction = void (Basic<TBase>::*)();
@@ -193,12 +194,8 @@ inline std::string Basic<TBase>::getLabel(Waves wf) {
 
 template <class TBase>
 inline void Basic<TBase>::init() {
-    divn.setup(4, [this]() {
-        this->stepn();
-    });
-    divm.setup(16, [this]() {
-        this->stepm();
-    });
+    divn.setup(this);
+    divm.setup(this);
 
     simd_assertEQ(lastPitches[3], float_4(-100));
     simd_assertEQ(lastPitches[0], float_4(-100));
@@ -213,7 +210,8 @@ inline void Basic<TBase>::stepm() {
     numBanks_m += ((numChannels_m % 4) == 0) ? 0 : 1;
 
     auto wf = BasicVCO::Waveform((int)std::round(TBase::params[WAVEFORM_PARAM].value));
-    pProcess = vcos[0].getProcPointer(wf);
+    const bool lite = TBase::params[LITE_PARAM].value > .5f;
+    pProcess = vcos[0].getProcPointer(wf, lite);
     updateBasePitch();
     updateBasePwm();
 }
@@ -320,6 +318,12 @@ inline void Basic<TBase>::process(const typename TBase::ProcessArgs& args) {
     divn.step();
     divm.step();
 
+    // There is no gate or envelope, so the only time we know we are silent
+    // is when no one is listening.
+    if (!Basic<TBase>::outputs[MAIN_OUTPUT].isConnected()) {
+        return;
+    }
+
     for (int bank = 0; bank < numBanks_m; ++bank) {
         float_4 output = ((&vcos[bank])->*pProcess)(args.sampleTime);
         Basic<TBase>::outputs[MAIN_OUTPUT].setVoltageSimd(output, bank * 4);
@@ -358,6 +362,9 @@ inline IComposite::Config BasicDescription<TBase>::getParamValue(int i) {
         case Basic<TBase>::PWM_PARAM:
             ret = {-100.0f, 100, 0, "pulse width modulation depth"};
             break;
+        case Basic<TBase>::LITE_PARAM:
+            ret = {0, 1, 0, "Lite quality (wavetable)"};
+            break;
         default:
             assert(false);
     }
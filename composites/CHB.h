@@ -8,6 +8,7 @@
 #include "LookupTableFactory.h"
 #include "MultiLag.h"
 #include "ObjectCache.h"
+#include "ParamScalers.h"
 #include "SinOscillator.h"
 #include "poly.h"
 
@@ -161,7 +162,7 @@ private:
      * maps freq multiple to "octave".
      * In other words, log base 12.
      */
-    float _octave[polyOrder];
+    float _octave[12] = {0};     // padded like _volume
     float getOctave(int mult) const;
     void init();
 
@@ -177,7 +178,7 @@ private:
     // just maps 0..1 to 0..1
     std::shared_ptr<LookupTableParams<float>> audioTaper = {ObjectCache<float>::getAudioTaper()};
 
-    AudioMath::ScaleFun<float> gainCombiner = AudioMath::makeLinearScaler(0.f, 1.f);
+    LinearScaler gainCombiner = {0, 1};
 
     std::function<float(float)> expLookup = ObjectCache<float>::getExp2Ex();
     std::shared_ptr<LookupTableParams<float>> db2gain = ObjectCache<float>::getDb2Gain();
@@ -186,8 +187,7 @@ private:
     /**
      * Audio taper for the slope.
      */
-    AudioMath::ScaleFun<float> slopeScale =
-        {AudioMath::makeLinearScaler<float>(-18, 0)};
+    LinearScaler slopeScale = {-18, 0};
 
     /**
      * do one-time calculations when sample rate changes
@@ -215,7 +215,7 @@ private:
         return LookupTable<float>::lookup(*audioTaper, raw, false);
     }
 
-    AudioMath::ScaleFun<float> lin = AudioMath::makeLinearScaler<float>(0, 1);
+    LinearScaler lin = {0, 1};
 };
 
 template <class TBase>
@@ -365,18 +365,14 @@ inline void CHB<TBase>::calcVolumes(float *volumes) {
 
     // Second: apply the even and odd knobs
     {
-        const float evenCombined = gainCombiner(
-            TBase::inputs[EVEN_INPUT].getVoltage(0),
-            TBase::params[PARAM_MAG_EVEN].value,
-            TBase::params[PARAM_EVEN_TRIM].value);
-
-        const float oddCombined = gainCombiner(
-            TBase::inputs[ODD_INPUT].getVoltage(0),
-            TBase::params[PARAM_MAG_ODD].value,
-            TBase::params[PARAM_ODD_TRIM].value);
-
-        const float even = taper(evenCombined);
-        const float odd = taper(oddCombined);
+        // even in [0], odd in [1]
+        const float_4 combined = gainCombiner(
+            float_4(TBase::inputs[EVEN_INPUT].getVoltage(0), TBase::inputs[ODD_INPUT].getVoltage(0), 0, 0),
+            float_4(TBase::params[PARAM_MAG_EVEN].value, TBase::params[PARAM_MAG_ODD].value, 0, 0),
+            float_4(TBase::params[PARAM_EVEN_TRIM].value, TBase::params[PARAM_ODD_TRIM].value, 0, 0));
+
+        const float even = taper(combined[0]);
+        const float odd = taper(combined[1]);
         for (int i = 1; i < polyOrder; ++i) {
             const float mul = (i & 1) ? even : odd;  // 0 = fundamental, 1=even, 2=odd....
             volumes[i] *= mul;
@@ -390,10 +386,11 @@ inline void CHB<TBase>::calcVolumes(float *volumes) {
             TBase::params[PARAM_SLOPE].value,
             TBase::params[PARAM_SLOPE_TRIM].value);
 
-        for (int i = 0; i < polyOrder; ++i) {
-            float slopeAttenDb = slope * getOctave(i);
-            float slopeAtten = LookupTable<float>::lookup(*db2gain, slopeAttenDb);
-            volumes[i] *= slopeAtten;
+        // volumes are padded to 12, so do four at a time
+        for (int i = 0; i < 12; i += 4) {
+            const float_4 slopeAttenDb = slope * float_4::load(_octave + i);
+            const float_4 slopeAtten = LookupTable<float>::lookupSimd(*db2gain, slopeAttenDb);
+            (float_4::load(volumes + i) * slopeAtten).store(volumes + i);
         }
     }
 }
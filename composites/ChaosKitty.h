@@ -14,6 +14,7 @@
 #include "FractionalDelay.h"
 #include "IComposite.h"
 #include "ObjectCache.h"
+#include "ParamScalers.h"
 
 namespace rack {
 namespace engine {
@@ -97,15 +98,15 @@ private:
     Types type = Types::SimpleChaoticNoise;
     SimpleChaoticNoise simpleChaoticNoise;
     ResonantNoise resonantNoise;
-    AudioMath::ScaleFun<float> scaleChaos;
+    LinearScaler scaleChaos = {3.5, 4};
 
     CircleMap circleMap;
-    AudioMath::ScaleFun<float> scaleKCircleMap;
+    LinearScaler scaleKCircleMap = {1.2f, 75};
 
-    Divider divn;
-    Divider divm;
     void stepn(int);
     void stepm(int);
+    FixedDivider<4, DividerCallbackN<ChaosKitty, &ChaosKitty::stepn, 4>> divn;
+    FixedDivider<16, DividerCallbackN<ChaosKitty, &ChaosKitty::stepm, 16>> divm;
     void updatePitch();
     float gainAdjust = 1;
 
@@ -123,15 +124,8 @@ inline void ChaosKitty<TBase>::onSampleRateChange(float rate, float time) {
 
 template <class TBase>
 inline void ChaosKitty<TBase>::init() {
-    divn.setup(4, [this] {
-        this->stepn(divn.getDiv());
-    });
-    divm.setup(16, [this] {
-        this->stepm(divm.getDiv());
-    });
-
-    scaleChaos = AudioMath::makeLinearScaler<float>(3.5, 4);
-    scaleKCircleMap = AudioMath::makeLinearScaler<float>(1.2, 75);
+    divn.setup(this);
+    divm.setup(this);
 }
 
 template <class TBase>
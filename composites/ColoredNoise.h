@@ -3,6 +3,7 @@
 #include <memory>
 
 #include "AudioMath.h"
+#include "CounterRandom.h"
 #include "FFT.h"
 #include "FFTCrossFader.h"
 #include "FFTData.h"
@@ -164,7 +165,8 @@ protected:
         NoiseMessage* noiseMessage = static_cast<NoiseMessage*>(msg);
         reallocSpectrum(noiseMessage);
         FFT::makeNoiseSpectrum(noiseSpectrum.get(),
-                               noiseMessage->noiseSpec);
+                               noiseMessage->noiseSpec,
+                               &random);
 
         // Now inverse FFT to time domain noise in client's buffer
         FFT::inverse(noiseMessage->dataBuffer.get(), *noiseSpectrum.get());
@@ -174,6 +176,7 @@ protected:
 
 private:
     std::unique_ptr<FFTDataCpx> noiseSpectrum;
+    CounterRandom random;
 
     // may do nothing, may create the first buffer,
     // may delete the old buffer and make a new one.
@@ -231,7 +231,7 @@ private:
     float_4 enabled[4] = {0};
     float_4 makeupGain[4] = {1};
 
-    Divider divn;
+    FixedDivider<32, DividerCallback<Compressor2, &Compressor2::stepn>> divn;
 
     // we could unify this stuff with the ui stuff, above.
     LookupTableParams<float> attackFunctionParams;
@@ -271,9 +271,7 @@ inline const std::vector<std::string>& Compressor2<TBase>::ratiosLong() {
 template <class TBase>
 inline void Compressor2<TBase>::init() {
     setupLimiter();
-    divn.setup(32, [this]() {
-        this->stepn();
-    });
+    divn.setup(this);
 
     LookupTableFactory<float>::makeGenericExpTaper(64, attackFunctionParams, 0, 1, MIN_ATTACK, MAX_ATTACK);
     LookupTableFactory<float>::makeGenericExpTaper(64, releaseFunctionParams, 0, 1, MIN_RELEASE, MAX_RELEASE);
@@ -677,18 +675,10 @@ inline void Compressor2<TBase>::updateBypassed(int bank) {
 
 template <class TBase>
 inline void Compressor2<TBase>::updateAttackAndRelease(int bank) {
-    float_4 a, r;
-
-    float_4 rawA_4 = compParams.getAttacks(bank);
-    float_4 rawR_4 = compParams.getReleases(bank);
-    for (int i = 0; i < 4; ++i) {
-        const float rawAttack = rawA_4[i];
-        const float rawRelease = rawR_4[i];
-        const float attack = LookupTable<float>::lookup(attackFunctionParams, rawAttack);
-        const float release = LookupTable<float>::lookup(releaseFunctionParams, rawRelease);
-        a[i] = attack;
-        r[i] = release;
-    }
+    const float_4 rawA_4 = compParams.getAttacks(bank);
+    const float_4 rawR_4 = compParams.getReleases(bank);
+    const float_4 a = LookupTable<float>::lookupSimd(attackFunctionParams, rawA_4);
+    const float_4 r = LookupTable<float>::lookupSimd(releaseFunctionParams, rawR_4);
 
     compressors[bank].setTimesPoly(
         a,
@@ -759,13 +749,11 @@ inline void Compressor2<TBase>::pollWetDry() {
 template <class TBase>
 inline void Compressor2<TBase>::updateThresholdAndRatio(int bank) {
     auto rawRatios_4 = compParams.getRatios(bank);
-    float_4 rawThresholds_4 = compParams.getThresholds(bank);
-    float_4 th;
+    const float_4 rawThresholds_4 = compParams.getThresholds(bank);
+    const float_4 th = LookupTable<float>::lookupSimd(thresholdFunctionParams, rawThresholds_4);
     Cmprsr::Ratios r[4];
 
     for (int i = 0; i < 4; ++i) {
-        const float threshold = LookupTable<float>::lookup(thresholdFunctionParams, rawThresholds_4[i]);
-        th[i] = threshold;
         r[i] = Cmprsr::Ratios(rawRatios_4[i]);
     }
 
@@ -776,14 +764,10 @@ inline void Compressor2<TBase>::updateThresholdAndRatio(int bank) {
 template <class TBase>
 inline void Compressor2<TBase>::updateWetDry(int bank) {
     float_4 rawWetDry = compParams.getWetDryMixs(bank);
-    float_4 w = 0;
-    float_4 d = 0;
-    for (int i = 0; i < 4; ++i) {
-        w[i] = LookupTable<float>::lookup(*panR, rawWetDry[i], true);
-        d[i] = LookupTable<float>::lookup(*panL, rawWetDry[i], true);
-        w[i] *= w[i];
-        d[i] *= d[i];
-    }
+    float_4 w = LookupTable<float>::lookupSimd(*panR, rawWetDry, true);
+    float_4 d = LookupTable<float>::lookupSimd(*panL, rawWetDry, true);
+    w *= w;
+    d *= d;
     wetLevel[bank] = w;
     dryLevel[bank] = d;
 }
@@ -796,6 +780,12 @@ inline void Compressor2<TBase>::process(const typename TBase::ProcessArgs& args)
     SqOutput& outPort = TBase::outputs[LAUDIO_OUTPUT];
     SqInput& scPort = TBase::inputs[SIDECHAIN_INPUT];
 
+    // First gather up all the banks that are not bypassed,
+    // so their envelope detectors can run in one kernel.
+    SimdDispatch::EnvelopeBank envelopeBanks[4];
+    int activeBanks[4];
+    int numActive = 0;
+
     // TODO: bypassed per channel - need to completely re-do
     for (int bank = 0; bank < numBanks_m; ++bank) {
         const int baseChannel = bank * 4;
@@ -813,16 +803,29 @@ inline void Compressor2<TBase>::process(const typename TBase::ProcessArgs& args)
             const float_4 scIn = scPort.getPolyVoltageSimd<float_4>(baseChannel);
             const float_4 scEnabled = compParams.getSidechainEnableds(bank);
             const float_4 detectorInput = SimdBlocks::ifelse(scEnabled, scIn, input);
-            const float_4 wetOutput = compressors[bank].stepPoly(input, detectorInput) * makeupGain[bank];
-            const float_4 mixedOutput = wetOutput * wetLevel[bank] + input * dryLevel[bank];
-
-            const float_4 out = SimdBlocks::ifelse(en, mixedOutput, input);
-            //SQINFO("\nbank=%d input=%s wet=%s", bank, toStr(input).c_str(), toStr(wetOutput).c_str());
-            //SQINFO("en=%s, true=%s", toStr(en).c_str(), toStr(SimdBlocks::maskTrue()).c_str());
-            //SQINFO("output=%s", toStr(out).c_str());
-            outPort.setVoltageSimd(out, baseChannel);
+            compressors[bank].prepareEnvelopeBlock(envelopeBanks[numActive], detectorInput);
+            activeBanks[numActive++] = bank;
         }
     }
+
+    if (numActive) {
+        SimdDispatch::kernels().detectEnvelope(envelopeBanks, numActive);
+    }
+
+    for (int i = 0; i < numActive; ++i) {
+        const int bank = activeBanks[i];
+        const int baseChannel = bank * 4;
+        const float_4 en = compParams.getEnableds(bank);
+        const float_4 input = inPort.getVoltageSimd<float_4>(baseChannel);
+        const float_4 wetOutput = compressors[bank].finishEnvelopeBlock(input) * makeupGain[bank];
+        const float_4 mixedOutput = wetOutput * wetLevel[bank] + input * dryLevel[bank];
+
+        const float_4 out = SimdBlocks::ifelse(en, mixedOutput, input);
+        //SQINFO("\nbank=%d input=%s wet=%s", bank, toStr(input).c_str(), toStr(wetOutput).c_str());
+        //SQINFO("en=%s, true=%s", toStr(en).c_str(), toStr(SimdBlocks::maskTrue()).c_str());
+        //SQINFO("output=%s", toStr(out).c_str());
+        outPort.setVoltageSimd(out, baseChannel);
+    }
 }
 
 // TODO: do we still need this old init function? combine with other?
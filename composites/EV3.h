@@ -88,6 +88,8 @@ public:
         PW3_PARAM,
         PWM3_PARAM,
 
+        LITE_PARAM,
+
         NUM_PARAMS
     };
 
@@ -183,6 +185,11 @@ inline void EV3<TBase>::processWaveforms() {
     vcos[0].setWaveform((MinBLEPVCO::Waveform)(int)TBase::params[WAVE1_PARAM].value);
     vcos[1].setWaveform((MinBLEPVCO::Waveform)(int)TBase::params[WAVE2_PARAM].value);
     vcos[2].setWaveform((MinBLEPVCO::Waveform)(int)TBase::params[WAVE3_PARAM].value);
+
+    const bool lite = TBase::params[LITE_PARAM].value > .5f;
+    for (int i = 0; i < 3; ++i) {
+        vcos[i].setLite(lite);
+    }
 }
 
 template <class TBase>
@@ -404,6 +411,9 @@ inline IComposite::Config EV3Description<TBase>::getParamValue(int i) {
         case EV3<TBase>::PWM3_PARAM:
             ret = {-1.0f, 1.0f, 0, "Pulse width modulation (VCO 3)"};
             break;
+        case EV3<TBase>::LITE_PARAM:
+            ret = {0, 1, 0, "Lite quality (wavetable)"};
+            break;
         default:
             assert(false);
     }
@@ -14,6 +14,7 @@
 #include "ObjectCache.h"
 #include "PeakDetector.h"
 #include "SimdBlocks.h"
+#include "SimdDispatch.h"
 #include "SqLog.h"
 #include "SqMath.h"
 #include "SqPort.h"
@@ -215,6 +216,7 @@ private:
     StateVariableFilterState2<T> state2[4];
     Limiter limiter;
     StateVariableFilter2<T>::processFunction filterFunc = nullptr;
+    StateVariableFilter2<T>::Mode filterMode_m = StateVariableFilter2<T>::Mode::LowPass;
     std::shared_ptr<LookupTableParams<float>> audioTaperLookupParams = ObjectCache<float>::getAudioTaper();
     const int oversample = 4;
 
@@ -282,6 +284,8 @@ private:
     // void processOneBank24_lim(const typename TBase::ProcessArgs& args);
     void processOneBank12_nolim(const typename TBase::ProcessArgs& args);
     void processGeneric(const typename TBase::ProcessArgs& args);
+    void runFilterBanks(const float_4* input, StateVariableFilterState2<T>* state,
+                        const StateVariableFilterParams2<T>* params, float_4* output);
 
     AudioMath_4::ScaleFun scaleFc = AudioMath_4::makeScalerWithBipolarAudioTrim(0, 10, 0, 10);
 };
@@ -556,8 +560,8 @@ inline void F2_Poly<TBase>::setupFreq() {
 template <class TBase>
 inline void F2_Poly<TBase>::setupModes() {
     const int modeParam = int(std::round(F2_Poly<TBase>::params[MODE_PARAM].value));
-    auto mode = StateVariableFilter2<T>::Mode(modeParam);
-    filterFunc = StateVariableFilter2<T>::getProcPointer(mode, oversample);
+    filterMode_m = StateVariableFilter2<T>::Mode(modeParam);
+    filterFunc = StateVariableFilter2<T>::getProcPointer(filterMode_m, oversample);
 
     const int topologyInt = int(std::round(F2_Poly<TBase>::params[TOPOLOGY_PARAM].value));
     topology_m = Topology(topologyInt);
@@ -667,32 +671,71 @@ inline void F2_Poly<TBase>::processOneBank12_nolim(const typename TBase::Process
     ENDPROC(0);
 }
 
+/**
+ * Runs one filter on every bank, using the fastest kernel we have.
+ * Same results as calling filterFunc on each bank.
+ */
+template <class TBase>
+inline void F2_Poly<TBase>::runFilterBanks(const float_4* input, StateVariableFilterState2<T>* state,
+                                           const StateVariableFilterParams2<T>* params, float_4* output) {
+    SimdDispatch::SvfBank banks[4];
+    for (int bank = 0; bank < numBanks_m; bank++) {
+        banks[bank].input = &input[bank][0];
+        banks[bank].z1 = &state[bank].z1[0];
+        banks[bank].z2 = &state[bank].z2[0];
+        banks[bank].fcGain = &params[bank]._fcGain()[0];
+        banks[bank].qGain = &params[bank]._qGain()[0];
+        banks[bank].output = &output[bank][0];
+    }
+    SimdDispatch::kernels().svf4x(banks, numBanks_m, int(filterMode_m));
+}
+
 template <class TBase>
 inline void F2_Poly<TBase>::processGeneric(const typename TBase::ProcessArgs& args) {
     SqInput& inPort = TBase::inputs[AUDIO_INPUT];
+    float_4 input[4];
+    for (int bank = 0; bank < numBanks_m; bank++) {
+        input[bank] = inPort.getPolyVoltageSimd<float_4>(4 * bank);
+    }
+
+    float_4 output1[4];
+    float_4 output2[4];
+    runFilterBanks(input, state1, params1, output1);
+    switch (topology_m) {
+        case Topology::SERIES:
+            runFilterBanks(output1, state2, params2, output2);
+            break;
+        case Topology::PARALLEL:
+        case Topology::PARALLEL_INV:
+            runFilterBanks(input, state2, params2, output2);
+            break;
+        case Topology::SINGLE:
+            break;
+        default:
+            assert(false);
+    }
+
     for (int bank = 0; bank < numBanks_m; bank++) {
         const int baseChannel = 4 * bank;
-        const float_4 input = inPort.getPolyVoltageSimd<float_4>(baseChannel);
         T output;
         switch (topology_m) {
-            case Topology::SERIES: {
-                const T temp = (*filterFunc)(input, state1[bank], params1[bank]);
-                output = (*filterFunc)(temp, state2[bank], params2[bank]);
-            } break;
-            case Topology::PARALLEL: {
+            case Topology::SERIES:
+                output = output2[bank];
+                break;
+            case Topology::PARALLEL:
                 // parallel add
-                output = (*filterFunc)(input, state1[bank], params1[bank]);
-                output += (*filterFunc)(input, state2[bank], params2[bank]);
-            } break;
-            case Topology::PARALLEL_INV: {
+                output = output1[bank];
+                output += output2[bank];
+                break;
+            case Topology::PARALLEL_INV:
                 // parallel sub
-                output = (*filterFunc)(input, state1[bank], params1[bank]);
-                output -= (*filterFunc)(input, state2[bank], params2[bank]);
-            } break;
-            case Topology::SINGLE: {
+                output = output1[bank];
+                output -= output2[bank];
+                break;
+            case Topology::SINGLE:
                 // one filter 4X
-                output = (*filterFunc)(input, state1[bank], params1[bank]);
-            } break;
+                output = output1[bank];
+                break;
             default:
                 assert(false);
         }
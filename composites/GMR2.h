@@ -6,6 +6,7 @@
 
 #include <memory>
 
+#include "CounterRandom.h"
 #include "GenerativeTriggerGenerator2.h"
 #include "IComposite.h"
 #include "ObjectCache.h"
@@ -44,6 +45,14 @@ public:
     void init();
     void setGrammar(StochasticGrammarPtr gmr);
 
+    /**
+     * Same seed, same grammar, same clock -> same triggers.
+     * Must be called before the first setGrammar.
+     */
+    void setRandomSeed(uint64_t seed) {
+        randomSeed = seed;
+    }
+
     enum ParamIds {
         CLOCK_INPUT_PARAM,
         RUNNING_PARAM,
@@ -92,6 +101,7 @@ private:
     float reciprocalSampleRate = 0;
     bool runStopRequested = false;
     std::shared_ptr<GenerativeTriggerGenerator2> gtg;
+    uint64_t randomSeed = CounterRandom::nextDefaultSeed();
     // GateTrigger inputClockProcessing;
     SeqClock2 clock;
 
@@ -110,7 +120,7 @@ inline void GMR2<TBase>::setGrammar(StochasticGrammarPtr grammar) {
     //SQINFO("GMR2::setGrammar in");
     if (!gtg) {
         gtg = std::make_shared<GenerativeTriggerGenerator2>(
-            AudioMath::random(),
+            CounterRandom::makeUniformFunc(randomSeed),
             grammar);
     } else {
         gtg->setGrammar(grammar);
@@ -1,100 +1,238 @@
 #pragma once
 
-#include "FunVCO3.h"
+#include "Divider.h"
+#include "IComposite.h"
+#include "PluckedStringBank.h"
+#include "SqSchmidtTrigger.h"
 
+#include <assert.h>
+#include <memory>
+
+namespace rack {
+namespace engine {
+struct Module;
+}
+}  // namespace rack
+using Module = ::rack::engine::Module;
+
+template <class TBase>
+class KSDescription : public IComposite {
+public:
+    Config getParamValue(int i) override;
+    int getNumParams() override;
+};
+
+/**
+ * Polyphonic Karplus-Strong plucked strings. Up to 16 voices.
+ *
+ * Each rising edge on the gate input plucks the string for that channel.
+ * The excite input is added into the strings, so they can also be
+ * used as a waveguide resonator for external sounds.
+ *
+ * The channel count follows the V/Oct input. All the DSP is in
+ * PluckedStringBank, four voices at a time.
+ */
 template <class TBase>
 class KSComposite : public TBase {
 public:
-    KSComposite() {
-        init();
-    }
     KSComposite(Module* module) : TBase(module) {
-        init();
     }
+    KSComposite() : TBase() {
+    }
+
+    /**
+     * Allocates the delay lines, big enough for the lowest note
+     * at the highest sample rate.
+     */
+    void init();
+
+    /**
+     * Fits the delay lines to the new sample rate.
+     * Doesn't allocate, so it's fine on the audio thread.
+     */
+    void onSampleRateChange() override;
 
     enum ParamIds {
         OCTAVE_PARAM,
-        SEMI_PARAM,
+        SEMITONE_PARAM,
         FINE_PARAM,
-        FM_PARAM,
-        PW_PARAM,
-        PWM_PARAM,
+        DECAY_PARAM,
+        DAMPING_PARAM,
         NUM_PARAMS
     };
     enum InputIds {
-        PITCH_INPUT,
-        FM_INPUT,
-        SYNC_INPUT,
-        PW_INPUT,
+        VOCT_INPUT,
+        GATE_INPUT,
+        EXCITE_INPUT,
         NUM_INPUTS
     };
     enum OutputIds {
-        SIN_OUTPUT,
-        TRI_OUTPUT,
-        SAW_OUTPUT,
-        SQR_OUTPUT,
+        AUDIO_OUTPUT,
         NUM_OUTPUTS
     };
     enum LightIds {
         NUM_LIGHTS
     };
 
-    void step() override;
-    void init() {
-        oscillator.init();
+    /** Implement IComposite
+     */
+    static std::shared_ptr<IComposite> getDescription() {
+        return std::make_shared<KSDescription<TBase>>();
     }
-#if 0
-    void setSampleRate(float rate)
-    {
-        oscillator.sampleTime = 1.f / rate;
-    }
-#endif
+
+    /**
+     * Main processing entry point. Called every sample
+     */
+    void process(const typename TBase::ProcessArgs& args) override;
+
+    // lowest note we can play, in Hz
+    static constexpr float minFreq = 20;
+
+    // the highest sample rate VCV offers
+    static constexpr float maxSampleRate = 768000;
 
 private:
-    KSOscillator<16, 16> oscillator;
+    PluckedStringBank strings[4];
+    SqSchmittTrigger gates[4];
+    int lastGateMask[4] = {0xf, 0xf, 0xf, 0xf};
+    float_4 lastPitches[4] = {-100, -100, -100, -100};
+
+    int numChannels_m = 1;  // 1..16
+    int numBanks_m = 0;
+    float basePitch_m = 0;
+    float decaySeconds_m = 0;
+    float damping_m = 0;
+
+    void stepn();
+    void stepm();
+
+    FixedDivider<4, DividerCallback<KSComposite, &KSComposite::stepn>> divn;
+    FixedDivider<16, DividerCallback<KSComposite, &KSComposite::stepm>> divm;
 };
 
 template <class TBase>
-inline void KSComposite<TBase>::step() {
-    // TODO: tune these
-
-    /* from functional
-    float pitchFine = 3.0f * quadraticBipolar(TBase::params[FINE_PARAM].value);
-    float pitchCv = 12.0f * TBase::inputs[PITCH_INPUT].value;
-    if (TBase::inputs[FM_INPUT].active) {
-        pitchCv += quadraticBipolar(TBase::params[FM_PARAM].value) * 12.0f * TBase::inputs[FM_INPUT].value;
+inline void KSComposite<TBase>::init() {
+    const int maxDelay = int(maxSampleRate / minFreq) + 1;
+    for (int bank = 0; bank < 4; ++bank) {
+        strings[bank].reserve(maxDelay);
+    }
+    onSampleRateChange();
+    divn.setup(this);
+    divm.setup(this);
+}
+
+template <class TBase>
+inline void KSComposite<TBase>::onSampleRateChange() {
+    const int maxDelay = int(TBase::engineGetSampleRate() / minFreq) + 1;
+    for (int bank = 0; bank < 4; ++bank) {
+        strings[bank].setMaxDelay(maxDelay);
+    }
+    // force stepn to re-tune all the strings
+    for (int bank = 0; bank < 4; ++bank) {
+        lastPitches[bank] = float_4(-100);
+    }
+}
+
+template <class TBase>
+inline void KSComposite<TBase>::stepm() {
+    numChannels_m = std::max<int>(1, TBase::inputs[VOCT_INPUT].channels);
+    TBase::outputs[AUDIO_OUTPUT].setChannels(numChannels_m);
+    numBanks_m = (numChannels_m / 4);
+    numBanks_m += ((numChannels_m % 4) == 0) ? 0 : 1;
+
+    basePitch_m =
+        TBase::params[OCTAVE_PARAM].value +
+        TBase::params[SEMITONE_PARAM].value / 12.f +
+        TBase::params[FINE_PARAM].value / 12 - 4;
+    const float decaySeconds = std::exp2(TBase::params[DECAY_PARAM].value);
+    // 0..100 -> 0..1/2
+    const float damping = TBase::params[DAMPING_PARAM].value / 200.f;
+    if (decaySeconds != decaySeconds_m || damping != damping_m) {
+        decaySeconds_m = decaySeconds;
+        damping_m = damping;
+        // force stepn to re-tune all the strings
+        for (int bank = 0; bank < 4; ++bank) {
+            lastPitches[bank] = float_4(-100);
+        }
+    }
+}
+
+template <class TBase>
+inline void KSComposite<TBase>::stepn() {
+    const float sampleTime = TBase::engineGetSampleTime();
+    for (int bank = 0; bank < numBanks_m; ++bank) {
+        const int baseIndex = bank * 4;
+        Port& pVoct = TBase::inputs[VOCT_INPUT];
+        const float_4 pitch = pVoct.getVoltageSimd<float_4>(baseIndex) + basePitch_m;
+        const int pitchChangeMask = rack::simd::movemask(pitch != lastPitches[bank]);
+        if (!pitchChangeMask) {
+            continue;
+        }
+        lastPitches[bank] = pitch;
+        const float_4 freq = rack::dsp::FREQ_C4 * rack::dsp::approxExp2_taylor5(pitch + 30) / 1073741824;
+
+        // feedback is the gain for one period that gives -60 db after decaySeconds_m
+        const float_4 feedback = rack::simd::exp(float_4(-6.9078f) / (freq * decaySeconds_m));
+
+        strings[bank].setDamping(float_4(damping_m));
+        strings[bank].setFeedback(feedback);
+        strings[bank].setFreq(freq * sampleTime);
+    }
+}
+
+template <class TBase>
+inline void KSComposite<TBase>::process(const typename TBase::ProcessArgs& args) {
+    divn.step();
+    divm.step();
+
+    Port& pGate = TBase::inputs[GATE_INPUT];
+    Port& pExcite = TBase::inputs[EXCITE_INPUT];
+    for (int bank = 0; bank < numBanks_m; ++bank) {
+        const int baseIndex = bank * 4;
+        const int gateMask = rack::simd::movemask(gates[bank].process(pGate.getPolyVoltageSimd<float_4>(baseIndex)));
+        const int risingMask = gateMask & ~lastGateMask[bank];
+        lastGateMask[bank] = gateMask;
+        if (risingMask) {
+            for (int lane = 0; lane < 4; ++lane) {
+                if (risingMask & (1 << lane)) {
+                    strings[bank].pluck(lane, 1);
+                }
+            }
+        }
+
+        const float_4 excite = pExcite.getPolyVoltageSimd<float_4>(baseIndex) * float_4(.2f);
+        const float_4 output = strings[bank].process(excite);
+        TBase::outputs[AUDIO_OUTPUT].setVoltageSimd(output * float_4(5), baseIndex);
+    }
+}
+
+template <class TBase>
+int KSDescription<TBase>::getNumParams() {
+    return KSComposite<TBase>::NUM_PARAMS;
+}
+
+template <class TBase>
+inline IComposite::Config KSDescription<TBase>::getParamValue(int i) {
+    Config ret(0, 1, 0, "");
+    switch (i) {
+        case KSComposite<TBase>::OCTAVE_PARAM:
+            ret = {0, 10, 4, "Octave"};
+            break;
+        case KSComposite<TBase>::SEMITONE_PARAM:
+            ret = {-11.f, 11.0f, 0.f, "Semitone transpose"};
+            break;
+        case KSComposite<TBase>::FINE_PARAM:
+            ret = {-1.0f, 1, 0, "fine tune"};
+            break;
+        case KSComposite<TBase>::DECAY_PARAM:
+            // log2 of the decay time in seconds
+            ret = {-3.f, 3.f, 1.f, "Decay"};
+            break;
+        case KSComposite<TBase>::DAMPING_PARAM:
+            ret = {0.f, 100.f, 50.f, "Damping"};
+            break;
+        default:
+            assert(false);
     }
-    */
-
-    // const float cv = getInput(osc, CV1_INPUT, CV2_INPUT, CV3_INPUT);
-    const float cv = TBase::inputs[PITCH_INPUT].getVoltage(0);
-    const float finePitch = TBase::params[FINE_PARAM].value / 12.0f;
-    const float semiPitch = TBase::params[SEMI_PARAM].value / 12.0f;
-    // const float fm = getInput(osc, FM1_INPUT, FM2_INPUT, FM3_INPUT);
-
-    float pitch = 1.0f + roundf(TBase::params[OCTAVE_PARAM].value) +
-                  semiPitch +
-                  finePitch;
-    pitch += cv;
-
-    oscillator.setPitch(pitch);
-
-    oscillator.setPulseWidth(TBase::params[PW_PARAM].value + TBase::params[PWM_PARAM].value * TBase::inputs[PW_INPUT].getVoltage(0) / 10.0f);
-    oscillator.syncEnabled = TBase::inputs[SYNC_INPUT].isConnected();
-
-    oscillator.sawEnabled = TBase::outputs[SAW_OUTPUT].isConnected();
-    oscillator.sinEnabled = TBase::outputs[SIN_OUTPUT].isConnected();
-    oscillator.sqEnabled = TBase::outputs[SQR_OUTPUT].isConnected();
-    oscillator.triEnabled = TBase::outputs[TRI_OUTPUT].isConnected();
-
-    oscillator.process(TBase::engineGetSampleTime(), TBase::inputs[SYNC_INPUT].getVoltage(0), TBase::engineGetSampleTime());
-    // Set output
-    if (TBase::outputs[SIN_OUTPUT].isConnected())
-        TBase::outputs[SIN_OUTPUT].setVoltage(5.0f * oscillator.sin(), 0);
-    if (TBase::outputs[TRI_OUTPUT].isConnected())
-        TBase::outputs[TRI_OUTPUT].setVoltage(5.0f * oscillator.tri(), 0);
-    if (TBase::outputs[SAW_OUTPUT].isConnected())
-        TBase::outputs[SAW_OUTPUT].setVoltage(5.0f * oscillator.saw(), 0);
-    if (TBase::outputs[SQR_OUTPUT].isConnected())
-        TBase::outputs[SQR_OUTPUT].setVoltage(5.0f * oscillator.sqr(), 0);
-}
\ No newline at end of file
+    return ret;
+}
@@ -1,12 +1,11 @@
 
 #pragma once
 
-#include <random>
-
 #include "BiquadFilter.h"
 #include "BiquadParams.h"
 #include "BiquadState.h"
 #include "ButterworthFilterDesigner.h"
+#include "CounterRandom.h"
 #include "Decimator.h"
 #include "GraphicEq.h"
 #include "IComposite.h"
@@ -176,11 +175,11 @@ private:
     float lastBaseFrequencyParamValue = -100;
     float lastXLFMParamValue = -1;
 
-    std::default_random_engine generator{57};
-    std::normal_distribution<double> distribution{-1.0, 1.0};
+    CounterRandom random;
 
     float noise() {
-        return (float)distribution(generator);
+        // mean of -1, like the std::normal_distribution{-1, 1} this used to be
+        return random.gaussian() - 1;
     }
 
     int controlUpdateCount = 0;
@@ -1,17 +1,17 @@
 
 #pragma once
 
-#include <random>
-
 #include "BiquadFilter.h"
 #include "BiquadParams.h"
 #include "BiquadState.h"
 #include "ButterworthFilterDesigner.h"
+#include "CounterRandom.h"
 #include "Decimator.h"
 #include "Divider.h"
 #include "IComposite.h"
 #include "LowpassFilter.h"
 #include "ObjectCache.h"
+#include "ParamScalers.h"
 #include "StateVariableFilter.h"
 
 /**
@@ -96,10 +96,10 @@ private:
     BiquadParams<TButter, 2> lpfParams;
     BiquadState<TButter, 2> lpfState;
 
-    std::default_random_engine generator{57};
-    std::normal_distribution<double> distribution{-1.0, 1.0};
+    CounterRandom random;
     float noise() {
-        return (float)distribution(generator);
+        // mean of -1, like the std::normal_distribution{-1, 1} this used to be
+        return random.gaussian() - 1;
     }
     float _fc = .1f;
 };
@@ -228,13 +228,12 @@ private:
  * Audio taper for the EQ gains. Arbitrary max value selected
  * to give "good" output level.
  */
-    AudioMath::SimpleScaleFun<float> gainScale =
-        {AudioMath::makeSimpleScalerAudioTaper(0, 35)};
+    AudioTaperScaler gainScale = {0, 35};
 
     // new stuff
     std::shared_ptr<LookupTableParams<float>> expLookup = ObjectCache<float>::getExp2();
-    AudioMath::ScaleFun<float> cvLinearScalar = AudioMath::makeLinearScaler(2.f, 14.f);
-    AudioMath::ScaleFun<float> qLinearScalar = AudioMath::makeLinearScaler(1.f, 30.f);
+    LinearScaler cvLinearScalar = {2, 14};
+    LinearScaler qLinearScalar = {1, 30};
 };
 
 template <class TBase>
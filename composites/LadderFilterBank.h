@@ -1,5 +1,6 @@
 #pragma once
 #include "LadderFilter.h"
+#include "ParamScalers.h"
 #include "PeakDetector.h"
 #include "SqPort.h"
 #include "SqStream.h"
@@ -52,13 +53,13 @@ private:
     LadderFilter<T> filterR[16];
 
     std::shared_ptr<LookupTableParams<T>> expLookup = ObjectCache<T>::getExp2();  // Do we need more precision?
-    AudioMath::ScaleFun<float> scaleGain = AudioMath::makeLinearScaler<float>(0, 1);
+    LinearScaler scaleGain = {0, 1};
     std::shared_ptr<LookupTableParams<float>> audioTaper = {ObjectCache<float>::getAudioTaper()};
 
-    AudioMath::ScaleFun<float> scaleFc = AudioMath::makeScalerWithBipolarAudioTrim(-5, 5);
-    AudioMath::ScaleFun<float> scaleQ = AudioMath::makeScalerWithBipolarAudioTrim(0, 4);
-    AudioMath::ScaleFun<float> scaleSlope = AudioMath::makeScalerWithBipolarAudioTrim(0, 3);
-    AudioMath::ScaleFun<float> scaleEdge = AudioMath::makeScalerWithBipolarAudioTrim(0, 1);
+    BipolarAudioTrimScaler scaleFc = {-5, 5};
+    BipolarAudioTrimScaler scaleQ = {0, 4};
+    BipolarAudioTrimScaler scaleSlope = {0, 3};
+    BipolarAudioTrimScaler scaleEdge = {0, 1};
 };
 
 template <typename T>
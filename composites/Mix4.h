@@ -181,7 +181,8 @@ public:
     void _disableAntiPop();
 
 private:
-    Divider divider;
+    static const int divRate = 4;
+    FixedDivider<divRate, DividerCallbackN<Mix4, &Mix4::stepn, divRate>> divider;
 
     /**
      *      0..3 for smoothed input gain * channel mute
@@ -310,10 +311,7 @@ inline void Mix4<TBase>::stepn(int div) {
 
 template <class TBase>
 inline void Mix4<TBase>::init() {
-    const int divRate = 4;
-    divider.setup(divRate, [this, divRate] {
-        this->stepn(divRate);
-    });
+    divider.setup(this);
     setupFilters();
 }
 
@@ -236,7 +236,8 @@ public:
     float buf_auxReturnGain = 0;
 
 private:
-    Divider divider;
+    static const int divRate = 4;
+    FixedDivider<divRate, DividerCallbackN<Mix8, &Mix8::stepn, divRate>> divider;
 
     /**
      * 8 input channels and one master
@@ -335,10 +336,7 @@ inline void Mix8<TBase>::stepn(int div) {
 
 template <class TBase>
 inline void Mix8<TBase>::init() {
-    const int divRate = 4;
-    divider.setup(divRate, [this, divRate] {
-        this->stepn(divRate);
-    });
+    divider.setup(this);
 
     // 400 was smooth, 100 popped
     antiPop.setCutoff(1.0f / 100.f);
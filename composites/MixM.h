@@ -212,7 +212,8 @@ public:
     void _disableAntiPop();
 
 private:
-    Divider divider;
+    static const int divRate = 4;
+    FixedDivider<divRate, DividerCallbackN<MixM, &MixM::stepn, divRate>> divider;
 
     /**
      *      0..3 for smoothed input gain * channel mute
@@ -240,10 +241,7 @@ private:
 
 template <class TBase>
 inline void MixM<TBase>::init() {
-    const int divRate = 4;
-    divider.setup(divRate, [this, divRate] {
-        this->stepn(divRate);
-    });
+    divider.setup(this);
 
     setupFilters();
 }
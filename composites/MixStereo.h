@@ -181,7 +181,8 @@ public:
     void _disableAntiPop();
 
 private:
-    Divider divider;
+    static const int divRate = 4;
+    FixedDivider<divRate, DividerCallbackN<MixStereo, &MixStereo::stepn, divRate>> divider;
 
     MultiLPF<cvFilterSize> filteredCV;
 
@@ -331,10 +332,7 @@ inline void MixStereo<TBase>::stepn(int div) {
 
 template <class TBase>
 inline void MixStereo<TBase>::init() {
-    const int divRate = 4;
-    divider.setup(divRate, [this, divRate] {
-        this->stepn(divRate);
-    });
+    divider.setup(this);
     setupFilters();
 }
 
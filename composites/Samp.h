@@ -5,6 +5,7 @@
 
 #include <memory>
 
+#include "BankActivity.h"
 #include "CompiledInstrument.h"
 #include "Divider.h"
 #include "GateDelay.h"
@@ -18,12 +19,14 @@
 #include "SamplerErrorContext.h"
 #include "SamplerSharedState.h"
 #include "SimdBlocks.h"
+#include "SimdDispatch.h"
 #include "SqLog.h"
 #include "SqPort.h"
 #include "SqSchmidtTrigger.h"
 #include "ThreadClient.h"
 #include "ThreadServer.h"
 #include "ThreadSharedState.h"
+#include "VoicePool.h"
 #include "WaveLoader.h"
 
 #if defined(_MSC_VER)
@@ -70,6 +73,12 @@ public:
     CompiledInstrumentPtr instrument;
     WaveLoaderPtr waves;
 
+    /**
+     * plugin->server: if true, don't wait for all the samples before returning the patch.
+     * They will be loaded in the background, as they are needed.
+     */
+    bool lazyLoad = false;
+
     /**
      * A thread safe way to communicate
      * with the other threads
@@ -124,6 +133,13 @@ public:
     */
     void init();
 
+    /**
+     * Each note gets its own voice, so release tails can overlap.
+     * Voices are run in banks of four.
+     */
+    static const int numVoices = 32;
+    static const int numVoiceBanks = numVoices / 4;
+
     enum ParamIds {
         DUMMYKS_PARAM,  // need to make this real
 #ifdef _SAMPFM
@@ -135,6 +151,7 @@ public:
         SCHEMA_PARAM,
         TRIGGERDELAY_PARAM,
         OCTAVE_PARAM,
+        LAZYLOAD_PARAM,
         NUM_PARAMS
     };
 
@@ -180,6 +197,14 @@ public:
         return ret;
     }
 
+    /**
+     * @returns true, and the error, if a sample failed to load after the instrument
+     * was ready. Only happens when loading samples as they are played.
+     */
+    bool getNewLoadError_UI(std::string& err) {
+        return sharedState->ui_getNewLoadError(err);
+    }
+
     void setNewSamples_UI(const std::string& s) {
         std::string* newValue = new std::string(s);
         std::string* oldValue = patchRequestFromUI.exchange(newValue);
@@ -203,7 +228,17 @@ public:
 
     static int quantize(float pitchCV);
 
-    float _getTranspose(int voice) const;
+    /**
+     * @returns the transpose of the voice that channel most recently played.
+     */
+    float _getTranspose(int channel) const;
+
+    /**
+     * For tests. True if this bank of voices is asleep.
+     */
+    bool _isAsleep(int bank) const {
+        return activity.isAsleep(bank);
+    }
 
     void _setupPerfTest();
 
@@ -212,9 +247,8 @@ public:
     // static std::pair<float, float> pitchToOctaveAndSemi(float pitch);
 
 private:
-    Sampler4vx playback[4];  // 16 voices of polyphony
-                             // SInstrumentPtr instrument;
-                             // WaveLoaderPtr waves;
+    Sampler4vx playback[numVoiceBanks];
+    VoicePool<numVoices> voices;
     GateDelay<5> gateDelays;
     SqSchmittTrigger trig[4];
 
@@ -239,6 +273,14 @@ private:
     float taperedVolume_n = 0;
 
     float_4 lastGate4[4];
+    BankActivityN<numVoiceBanks> activity;
+
+    // scratch for process, so we don't have to initialize it every sample.
+    SimdDispatch::SampleBank sampleBanks[numVoiceBanks];
+
+    // Exp FM for each input channel, and for each voice (from the channel that owns it)
+    float_4 channelFM_n[4];
+    float_4 voiceFM_n[numVoiceBanks];
     Divider divn;
 
     // I think this goes ins sSampler4vx
@@ -275,6 +317,8 @@ private:
     void serviceFMMod();
 
     void updateKeySwitch(int midiPitch);
+    void startNote(int channel, float sampleRate);
+    float_4 getLFM(int voiceBank);
     void serviceSchema();
 
     // server thread stuff
@@ -292,7 +336,11 @@ inline void Samp<TBase>::init() {
 
     for (int i = 0; i < 4; ++i) {
         lastGate4[i] = float_4(0);
+        channelFM_n[i] = float_4(0);
+    }
+    for (int i = 0; i < numVoiceBanks; ++i) {
         playback[i].setIndex(i);
+        voiceFM_n[i] = float_4(0);
     }
 }
 
@@ -303,10 +351,9 @@ inline float Samp<TBase>::getProgressPct() const {
 
 template <class TBase>
 inline void Samp<TBase>::suppressErrors() {
-    playback[0].suppressErrors();
-    playback[1].suppressErrors();
-    playback[2].suppressErrors();
-    playback[3].suppressErrors();
+    for (int i = 0; i < numVoiceBanks; ++i) {
+        playback[i].suppressErrors();
+    }
 }
 
 template <class TBase>
@@ -345,7 +392,7 @@ inline void Samp<TBase>::setNewPatch(SampMessage* newMessage) {
     } else {
         _isSampleLoaded = true;
     }
-    for (int i = 0; i < 4; ++i) {
+    for (int i = 0; i < numVoiceBanks; ++i) {
         playback[i].setPatch(_isSampleLoaded ? newMessage->instrument : nullptr);
         playback[i].setLoader(_isSampleLoaded ? newMessage->waves : nullptr);
         playback[i].setNumVoices(4);
@@ -367,6 +414,12 @@ inline void Samp<TBase>::step_n() {
     SqInput& inPort = TBase::inputs[PITCH_INPUT];
     SqOutput& outPort = TBase::outputs[AUDIO_OUTPUT];
 
+    // Release anything held by channels that went away.
+    for (int channel = inPort.channels; channel < numChannels_n; ++channel) {
+        voices.noteOff(channel);
+        lastGate4[channel / 4][channel % 4] = 0;
+    }
+
     numChannels_n = inPort.channels;
     outPort.setChannels(numChannels_n);
     numBanks_n = numChannels_n / 4;
@@ -443,34 +496,40 @@ inline void Samp<TBase>::serviceFMMod() {
     const float scaledPitchCVTrim = LookupTable<float>::lookup(*bipolarAudioTaperLookupParams, pitchCVTrimRaw);
     const float_4 pitchCVTrim(scaledPitchCVTrim);
     Port& fmInput = TBase::inputs[FM_INPUT];
-    for (int bank = 0; bank < numBanks_n; ++bank) {
-        float_4 rawInput = fmInput.getPolyVoltageSimd<float_4>(bank * 4);
+    for (int bank = 0; bank < 4; ++bank) {
+        float_4 rawInput = (bank < numBanks_n) ? fmInput.getPolyVoltageSimd<float_4>(bank * 4) : float_4::zero();
         float_4 scaledInput = rawInput * pitchCVTrim;
-        float_4 finalBankFM = scaledInput + expPitchOffset;
-        playback[bank].setExpFM(finalBankFM);
-#if 0
-        if (bank == 0) {
-            float_4 x = fmInput.getVoltageSimd<float_4>(bank * 4);
-            //SQINFO("p0=%f, trim=%f cv=%f x=%f res=%f", expPitchOffset[0], expPitchCVTrim[0], rawInput[0], x[0], finalBankFM[0]);
-            //SQINFO("  simdin=%s", toStr(rawInput).c_str());
-            
+        channelFM_n[bank] = scaledInput + expPitchOffset;
+    }
+
+    // Each voice follows the FM of the channel that played it.
+    // Sleeping banks get theirs when they play a note.
+    for (int bank = 0; bank < numVoiceBanks; ++bank) {
+        if (activity.isAsleep(bank)) {
+            continue;
         }
-#endif
+        for (int i = 0; i < 4; ++i) {
+            const int channel = voices.getChannel(bank * 4 + i);
+            voiceFM_n[bank][i] = (channel >= 0) ? channelFM_n[channel / 4][channel % 4] : expPitchOffset[0];
+        }
+        playback[bank].setExpFM(voiceFM_n[bank]);
     }
 }
 
 template <class TBase>
-inline float Samp<TBase>::_getTranspose(int voice) const {
-    const int bank = voice / 4;
-    const int subChannel = voice - bank * 4;
-    return playback[bank]._transAmt(subChannel);
+inline float Samp<TBase>::_getTranspose(int channel) const {
+    const int voice = voices.getVoice(channel);
+    if (voice < 0) {
+        return 1;
+    }
+    return playback[voice / 4]._transAmt(voice % 4);
 }
 
 template <class TBase>
 inline void Samp<TBase>::serviceSampleReloadRequest() {
 #ifdef _ATOM
     if (sharedState->au_isSampleReloadRequested()) {
-        for (int i = 0; i < 4; ++i) {
+        for (int i = 0; i < numVoiceBanks; ++i) {
             playback[i].clearSamples();
         }
         sharedState->au_grantSampleReloadRequest();
@@ -485,6 +544,51 @@ inline int Samp<TBase>::quantize(float pitchCV) {
 }
 
 #if 1  // new version with gate delat
+template <class TBase>
+inline void Samp<TBase>::startNote(int channel, float sampleRate) {
+    const float pitchCV = TBase::inputs[PITCH_INPUT].getVoltage(channel);
+    const int midiPitch = quantize(pitchCV);
+
+    // if velocity not patched, use 64
+    int midiVelocity = 64;
+    if (TBase::inputs[VELOCITY_INPUT].isConnected()) {
+        // if it's mono, just get first chan. otherwise get poly
+        midiVelocity = int(TBase::inputs[VELOCITY_INPUT].getPolyVoltage(channel) * 12.7f);
+        if (midiVelocity < 1) {
+            midiVelocity = 1;
+        }
+    }
+
+    const int voice = voices.noteOn(channel);
+    const int bank = voice / 4;
+    const int subChannel = voice % 4;
+
+    // the voice may have been playing for a different channel, so give it this one's FM
+    voiceFM_n[bank][subChannel] = channelFM_n[channel / 4][channel % 4];
+    playback[bank].setExpFM(voiceFM_n[bank]);
+
+    const bool isKs = playback[bank].note_on(subChannel, midiPitch, midiVelocity, sampleRate);
+    if (isKs) {
+        updateKeySwitch(midiPitch);
+    }
+}
+
+template <class TBase>
+inline float_4 Samp<TBase>::getLFM(int voiceBank) {
+    Port& pIn = TBase::inputs[LFM_INPUT];
+    Port& pDepth = TBase::inputs[LFMDEPTH_INPUT];
+    const bool depthConnected = pDepth.isConnected();
+    float_4 fm = float_4::zero();
+    for (int i = 0; i < 4; ++i) {
+        const int channel = voices.getChannel(voiceBank * 4 + i);
+        if (channel >= 0) {
+            const float depth = depthConnected ? pDepth.getPolyVoltage(channel) : 10.f;
+            fm[i] = pIn.getPolyVoltage(channel) * depth;
+        }
+    }
+    return fm * lfmGain_n * .1f;
+}
+
 template <class TBase>
 inline void Samp<TBase>::process(const typename TBase::ProcessArgs& args) {
     //SQINFO("pin");
@@ -493,9 +597,9 @@ inline void Samp<TBase>::process(const typename TBase::ProcessArgs& args) {
     // is there some "off by one error" here?
     assert(numBanks_n <= 4);
 
-    // Loop for all channels. Does gate detections, runs audio
+    // Step 1: gate processing. Starts and releases notes in the voice pool.
     for (int bank = 0; bank < numBanks_n; ++bank) {
-        // Step 1: gate processing. This doesn't have to run every sample, btw.
+        // This doesn't have to run every sample, btw.
         // prepare 4 gates. note that ADSR / Sampler4vx must see simd mask (0 or nan)
         // but our logic needs to see numbers (we use 1 and 0).
         Port& pGate = TBase::inputs[GATE_INPUT];
@@ -509,60 +613,67 @@ inline void Samp<TBase>::process(const typename TBase::ProcessArgs& args) {
         } else {
             gmaskOut = gmaskIn;
         }
-        // float_4 gmask = (g > float_4(1));
-        float_4 gate4 = SimdBlocks::ifelse(gmaskOut, float_4(1), float_4(0));  // isn't this pointless?
+        float_4 gate4 = SimdBlocks::ifelse(gmaskOut, float_4(1), float_4(0));
         float_4 lgate4 = lastGate4[bank];
 
-        if (bank == 0) {
-            //      printf("samp, g4 = %s\n", toStr(gate4).c_str());
-        }
-
-        // main loop that processes gates and runs audio
         for (int iSub = 0; iSub < 4; ++iSub) {
             if (gate4[iSub] != lgate4[iSub]) {
+                const int channel = iSub + bank * 4;
                 if (gate4[iSub]) {
-                    assert(bank < 4);
-                    const int channel = iSub + bank * 4;
-                    const float pitchCV = TBase::inputs[PITCH_INPUT].getVoltage(channel);
-                    const int midiPitch = quantize(pitchCV);
-
-                    // if velocity not patched, use 64
-                    int midiVelocity = 64;
-                    if (TBase::inputs[VELOCITY_INPUT].isConnected()) {
-                        // if it's mono, just get first chan. otherwise get poly
-                        midiVelocity = int(TBase::inputs[VELOCITY_INPUT].getPolyVoltage(channel) * 12.7f);
-                        if (midiVelocity < 1) {
-                            midiVelocity = 1;
-                        }
-                    }
-                    const bool isKs = playback[bank].note_on(iSub, midiPitch, midiVelocity, args.sampleRate);
-                    if (isKs) {
-                        updateKeySwitch(midiPitch);
-                    }
-                    // printf("send note on to bank %d sub%d pitch %d\n", bank, iSub, midiPitch); fflush(stdout);
+                    startNote(channel, args.sampleRate);
+                } else {
+                    voices.noteOff(channel);
                 }
             }
         }
+        lastGate4[bank] = gate4;
+    }
+    gateDelays.commit();
 
-        // Step 2: LFM processing
-        float_4 fm = float_4::zero();
-        if (lfmConnected_n) {
-            Port& pIn = TBase::inputs[LFM_INPUT];
-            Port& pDepth = TBase::inputs[LFMDEPTH_INPUT];
-            float_4 depth = pDepth.isConnected() ? pDepth.getPolyVoltageSimd<float_4>(bank * 4) : 10.f;
-            depth *= .1f;
-            float_4 rawInput = pIn.getPolyVoltageSimd<float_4>(bank * 4);
-            fm = rawInput * lfmGain_n * depth;
-            //SQINFO("read fm=%s, raw=%s", toStr(fm).c_str(), toStr(rawInput).c_str());
+    // Step 2: run the voices, and mix each one into the channel that played it.
+    // Voices are allocated from the bottom, so usually only the first few banks are awake.
+    // All the awake banks share one call to the sampleStep kernel.
+    float_4 gates[numVoiceBanks];
+    int awakeBanks[numVoiceBanks];
+    int numAwake = 0;
+    int numPlaying = 0;
+    for (int bank = 0; bank < numVoiceBanks; ++bank) {
+        gates[bank] = voices.getGates(bank);
+        if (!activity.run(bank, gates[bank])) {
+            continue;
         }
+        awakeBanks[numAwake++] = bank;
 
-        // Step 3: run the audio
-        auto output = playback[bank].step(gmaskOut, args.sampleTime, fm, lfmConnected_n);
-        output *= taperedVolume_n;
-        TBase::outputs[AUDIO_OUTPUT].setVoltageSimd(output, bank * 4);
-        lastGate4[bank] = gate4;
+        const float_4 fm = lfmConnected_n ? getLFM(bank) : float_4::zero();
+        if (playback[bank].prepareBlock(sampleBanks[numPlaying], gates[bank], args.sampleTime, fm)) {
+            numPlaying++;
+        }
+    }
+
+    if (numPlaying) {
+        SimdDispatch::kernels().sampleStep(sampleBanks, numPlaying, Sampler4vx::_outputGain()[0], args.sampleTime);
+    }
+
+    float_4 mix[4] = {float_4::zero(), float_4::zero(), float_4::zero(), float_4::zero()};
+    for (int awake = 0; awake < numAwake; ++awake) {
+        const int bank = awakeBanks[awake];
+        const float_4 output = playback[bank].finishBlock();
+        const float_4 level = playback[bank].getLevel();
+        voices.setLevels(bank, level);
+        for (int i = 0; i < 4; ++i) {
+            const int channel = voices.getChannel(bank * 4 + i);
+            if (channel >= 0) {
+                mix[channel / 4][channel % 4] += output[i];
+            }
+        }
+        if (activity.update(bank, gates[bank], level)) {
+            playback[bank].sleep();
+        }
+    }
+
+    for (int bank = 0; bank < numBanks_n; ++bank) {
+        TBase::outputs[AUDIO_OUTPUT].setVoltageSimd(mix[bank] * taperedVolume_n, bank * 4);
     }
-    gateDelays.commit();
 }
 
 #else  // Original version here
@@ -675,6 +786,9 @@ inline IComposite::Config SampDescription<TBase>::getParamValue(int i) {
         case Samp<TBase>::OCTAVE_PARAM:
             ret = {0, 10, 4, "Octave"};
             break;
+        case Samp<TBase>::LAZYLOAD_PARAM:
+            ret = {0, 1, 0, "Load samples when played"};
+            break;
         default:
             assert(false);
     }
@@ -700,11 +814,15 @@ public:
         //SQINFO("worker about to wait for sample access");
         assert(smsg->sharedState);
         smsg->sharedState->uiw_requestAndWaitForSampleReload();
+        smsg->sharedState->w_clearLoadError();
         //SQINFO("worker got sample access");
 #endif
 
         // First thing we do it throw away the old patch data.
-        // We couldn't do that on the audio thread, since mem allocation will block the thread
+        // We couldn't do that on the audio thread, since mem allocation will block the thread.
+        // Hang on to the old waves until the new ones are loaded, though, so we can re-use
+        // the ones that haven't changed.
+        WaveLoaderPtr oldWaves = smsg->waves;
         smsg->waves.reset();
         smsg->instrument.reset();
 
@@ -731,6 +849,11 @@ public:
             assert(cinst->getInfo());
             samplePath.concat(cinst->getDefaultPath());
             cinst->setWaves(waves, samplePath);
+            waves->setLazy(smsg->lazyLoad);
+            if (oldWaves) {
+                waves->reuseFrom(*oldWaves);
+                oldWaves.reset();
+            }
 
             if (waves->empty()) {
                 loadedState = WaveLoader::LoaderState::Error;
@@ -750,6 +873,18 @@ public:
                             assert(false);
                     }
                 }
+                if (smsg->lazyLoad && loadedState == WaveLoader::LoaderState::Done) {
+                    std::vector<int> pitches;
+                    cinst->getSamplePitches(pitches);
+#ifdef _ATOM
+                    SamplerSharedStatePtr state = smsg->sharedState;
+                    waves->startPrefetch(pitches, [state](const std::string& err) {
+                        state->w_setLoadError(err);
+                    });
+#else
+                    waves->startPrefetch(pitches);
+#endif
+                }
             }
         }
 
@@ -844,6 +979,7 @@ void Samp<TBase>::servicePendingPatchRequest() {
     msg->pathToSfz = patchRequestFromUI;
     msg->instrument = this->gcInstrument;
     msg->waves = this->gcWaveLoader;
+    msg->lazyLoad = TBase::params[LAZYLOAD_PARAM].value > .5;
 
     // Now that we have put together our patch request,
     // and memory deletion request, we can let go
@@ -855,7 +991,7 @@ void Samp<TBase>::servicePendingPatchRequest() {
 
     gcInstrument.reset();
     gcWaveLoader.reset();
-    for (int i = 0; i < 4; ++i) {
+    for (int i = 0; i < numVoiceBanks; ++i) {
         playback[i].setPatch(nullptr);
         playback[i].setLoader(nullptr);
     }
@@ -6,11 +6,11 @@
 #include <cmath>
 #include <memory>
 
-#include "Divider.h"
 #include "GateTrigger.h"
 #include "IComposite.h"
 #include "IMidiPlayerHost.h"
 #include "MidiPlayer4.h"
+#include "MidiPlayerEventBuffer.h"
 #include "MidiSong4.h"
 #include "SeqClock.h"
 
@@ -170,11 +170,17 @@ public:
      */
     MidiTrackPlayerPtr getTrackPlayer(int track);
 
+    /**
+     * The player runs once every blockSize samples.
+     * Gates and CV come out exactly one block after the
+     * sample that caused them.
+     */
+    static const int blockSize = 4;
+
 private:
     GateTrigger runStopProcessor;
     std::shared_ptr<MidiPlayer4> player;
     SeqClock clock;
-    Divider div;
     bool runStopRequested = false;
     bool wasRunning = false;
 
@@ -185,11 +191,31 @@ private:
     void resetClock();
     void serviceSelCV();
     /**
-     * called by the divider every 'n' step calls
+     * called at the end of every block of n samples
      */
     void stepn(int n);
 
+    /**
+     * write out all the buffered events for the current sample
+     */
+    void playEvents();
+
     bool lastGate[16] = {false};
+
+    /**
+     * The player puts all its gate and CV changes for a block in here,
+     * then we play them back over the next block.
+     */
+    MidiPlayerEventBuffer eventBuffer;
+    int nextEvent = 0;
+
+    /**
+     * Where we are in the current block, and the clock
+     * and reset inputs at each sample of it.
+     */
+    int sampleInBlock = 0;
+    float clockInputs[blockSize] = {0};
+    float resetInputs[blockSize] = {0};
 };
 
 template <class TBase>
@@ -207,6 +233,9 @@ public:
         else    
             seq->outputs[Seq4<TBase>::EOC_OUTPUT].setVoltage(0.f);
     }
+    MidiPlayerEventBuffer* getEventBuffer() override {
+        return &seq->eventBuffer;
+    }
     void setGate(int track, int voice, bool gate) override {
         assert(track >= 0 && track < 4);
 #if defined(_MLOG)
@@ -248,9 +277,6 @@ void Seq4<TBase>::init(MidiSong4Ptr song) {
     player = std::make_shared<MidiPlayer4>(host, song);
     // audition = std::make_shared<MidiAudition>(host);
 
-    div.setup(4, [this] {
-        this->stepn(div.getDiv());
-    });
     onSampleRateChange();
     player->setPorts(TBase::inputs.data() + MOD0_INPUT, TBase::params.data() + TRIGGER_IMMEDIATE_PARAM);
 }
@@ -307,23 +333,30 @@ void Seq4<TBase>::stepn(int n) {
     const SeqClock::ClockRate clockRate = SeqClock::ClockRate((int)std::round(TBase::params[CLOCK_INPUT_PARAM].value));
     clock.setup(clockRate, 0, TBase::engineGetSampleTime());
 
-    // and the clock input
-    const float extClock = TBase::inputs[CLOCK_INPUT].getVoltage(0);
-
-    // now call the clock
-    const float reset = TBase::inputs[RESET_INPUT].getVoltage(0);
     const bool running = isRunning();
-    int samplesElapsed = n;
+    const float quantizationInterval = float(clock.getMetricTimePerClock());
+
+    // Clock each sample of the block, so every clock edge is seen on the sample it came in.
+    // Anything the player does gets stamped with that sample.
+    eventBuffer.clear();
+    double lastTime = clock.getCurMetricTime();
+    for (int i = 0; i < n; ++i) {
+        // Our level sensitive reset will get turned into an edge in here
+        SeqClock::ClockResults results = clock.update(1, clockInputs[i], running, resetInputs[i]);
+        if (results.didReset) {
+            player->reset(true, true);
+            allGatesOff();  // turn everything off on reset, just in case of stuck notes.
+        }
+        eventBuffer.setSampleOffset(i);
 
-    // Our level sensitive reset will get turned into an edge in here
-    SeqClock::ClockResults results = clock.update(samplesElapsed, extClock, running, reset);
-    if (results.didReset) {
-        player->reset(true, true);
-        allGatesOff();  // turn everything off on reset, just in case of stuck notes.
+        // The player only does anything when the time changes, but call it at the end of
+        // every block anyway, so it keeps servicing the lock and the section requests.
+        if (results.didReset || (results.totalElapsedTime != lastTime) || (i == n - 1)) {
+            player->updateToMetricTime(results.totalElapsedTime, quantizationInterval, running);
+        }
+        lastTime = results.totalElapsedTime;
     }
 
-    player->updateToMetricTime(results.totalElapsedTime, float(clock.getMetricTimePerClock()), running);
-
     // copy the current voice number to the poly ports
     for (int i = 0; i < MidiSong4::numTracks; ++i) {
         const int numVoices = (int)std::round(TBase::params[NUM_VOICES0_PARAM + i].value + 1);
@@ -350,7 +383,22 @@ void Seq4<TBase>::stepn(int n) {
     TBase::lights[GATE_LIGHT].value = isGate;
 #endif
 
+    eventBuffer.setSampleOffset(n - 1);
     player->updateSampleCount(n);
+    eventBuffer.sort();
+    nextEvent = 0;
+}
+
+template <class TBase>
+inline void Seq4<TBase>::playEvents() {
+    while (nextEvent < eventBuffer.size() && eventBuffer[nextEvent].sampleOffset == sampleInBlock) {
+        const MidiPlayerEventBuffer::Event& event = eventBuffer[nextEvent++];
+        if (event.type == MidiPlayerEventBuffer::Type::Gate) {
+            TBase::outputs[GATE0_OUTPUT + event.track].voltages[event.voice] = event.value ? 10.f : 0.f;
+        } else {
+            TBase::outputs[CV0_OUTPUT + event.track].voltages[event.voice] = event.value;
+        }
+    }
 }
 
 template <class TBase>
@@ -372,7 +420,15 @@ void Seq4<TBase>::serviceRunStop() {
 
 template <class TBase>
 inline void Seq4<TBase>::step() {
-    div.step();
+    // play back what the player did in the last block, one sample at a time
+    playEvents();
+
+    clockInputs[sampleInBlock] = TBase::inputs[CLOCK_INPUT].getVoltage(0);
+    resetInputs[sampleInBlock] = TBase::inputs[RESET_INPUT].getVoltage(0);
+    if (++sampleInBlock == blockSize) {
+        stepn(blockSize);
+        sampleInBlock = 0;
+    }
 }
 
 template <class TBase>
@@ -412,6 +468,9 @@ inline void Seq4<TBase>::allGatesOff() {
             TBase::outputs[GATE0_OUTPUT + output].voltages[i] = 0;
         }
     }
+    // and don't let any notes we already have queued up turn them back on.
+    eventBuffer.clear();
+    nextEvent = 0;
 }
 
 template <class TBase>
@@ -7,6 +7,7 @@
 #include <memory>
 
 #include "ADSR4.h"
+#include "BankActivity.h"
 #include "Divider.h"
 #include "IComposite.h"
 #include "PitchUtils.h"
@@ -128,6 +129,13 @@ public:
      */
     void process(const typename TBase::ProcessArgs& args) override;
 
+    /**
+     * For tests. True if this bank of voices is asleep.
+     */
+    bool _isAsleep(int bank) const {
+        return activity.isAsleep(bank);
+    }
+
 private:
     static const int numVoices = 16;
     static const int numDrawbars = 9;
@@ -140,15 +148,16 @@ private:
     SinesVCO<T> sines[numSines];
     ADSR4 normAdsr[numEgNorm];
     ADSR4 percAdsr[numEgPercussion];
+    BankActivity activity;
 
     int numChannels_m = 1;  // 1..16
     float volumeNorm_m = 1;
 
-    Divider divn;
-    Divider divm;
-
     void stepn();
     void stepm();
+
+    FixedDivider<4, DividerCallback<Sines, &Sines::stepn>> divn;
+    FixedDivider<16, DividerCallback<Sines, &Sines::stepm>> divm;
     void computeBaseDrawbars_m();
     void computeFinalDrawbars_n();
 
@@ -170,12 +179,8 @@ private:
 
 template <class TBase>
 inline void Sines<TBase>::init() {
-    divn.setup(4, [this]() {
-        this->stepn();
-    });
-    divm.setup(16, [this]() {
-        this->stepm();
-    });
+    divn.setup(this);
+    divm.setup(this);
 
     for (int i = 0; i < NUM_LIGHTS; ++i) {
         Sines<TBase>::lights[i].setBrightness(3.f);
@@ -381,11 +386,27 @@ inline void Sines<TBase>::process(const typename TBase::ProcessArgs& args) {
         toStr(finalPercussionVolumes_n[0]).c_str()
         ); fflush(stdout);
 #endif
+    const bool gateConnected = TBase::inputs[GATE_INPUT].isConnected();
+    float_4 gate4 = 0;
     for (int vx = 0; vx < numChannels_m; ++vx) {
         const int adsrBank = vx / 4;
         const int adsrBankOffset = vx - (adsrBank * 4);
         const int baseSineIndex = numSinesPerVoices * vx;
 
+        // At the start of each bank, read the gates. If all the voices in the bank
+        // have finished, skip them.
+        if (adsrBankOffset == 0 && gateConnected) {
+            Port& p = TBase::inputs[GATE_INPUT];
+            float_4 g = p.getVoltageSimd<float_4>(adsrBank * 4);
+            gate4 = (g > float_4(1));
+            simd_assertMask(gate4);
+            if (!activity.run(adsrBank, gate4)) {
+                Sines<TBase>::outputs[MAIN_OUTPUT].setVoltageSimd(float_4::zero(), adsrBank * 4);
+                vx += 3;
+                continue;
+            }
+        }
+
         // for each voice we must compute all the sines for that voice.
         // Add them all together into sum, which will be the non-percussion
         //mix of all drawbars.
@@ -406,8 +427,6 @@ inline void Sines<TBase>::process(const typename TBase::ProcessArgs& args) {
         bool outputNow = false;
         int bankToOutput = 0;
 
-        const bool gateConnected = TBase::inputs[GATE_INPUT].isConnected();
-
         // If we fill up a whole block, output it now - it's the voltages from the
         // previous bank.
         if (adsrBankOffset == 3) {
@@ -422,21 +441,19 @@ inline void Sines<TBase>::process(const typename TBase::ProcessArgs& args) {
             bankToOutput = adsrBank;
         }
 
-        float_4 gate4 = 0;
         if (outputNow) {
             if (gateConnected) {
-                Port& p = TBase::inputs[GATE_INPUT];
-                float_4 g = p.getVoltageSimd<float_4>(bankToOutput * 4);
-                gate4 = (g > float_4(1));
-                simd_assertMask(gate4);
                 float_4 normEnv = normAdsr[bankToOutput].step(gate4, args.sampleTime);
                 sines4 *= normEnv;
-            }
 
-            if (gateConnected) {
                 float_4 percEnv = percAdsr[bankToOutput].step(gate4, args.sampleTime);
                 percSines4 *= percEnv;
                 percSines4 *= float_4(6.f);
+
+                if (activity.update(bankToOutput, gate4, SimdBlocks::max(normEnv, percEnv))) {
+                    normAdsr[bankToOutput].setSilent();
+                    percAdsr[bankToOutput].setSilent();
+                }
             }
 
             sines4 += percSines4;
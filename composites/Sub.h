@@ -121,6 +121,7 @@ public:
         PULSEWIDTH1_TRIM_PARAM,
         PULSEWIDTH2_TRIM_PARAM,
         AGC_PARAM,
+        LITE_PARAM,
         NUM_PARAMS
     };
 
@@ -190,8 +191,8 @@ private:
 
     bool agcEnabled_m = false;
 
-    Divider divn;
-    Divider divm;
+    FixedDivider<4, DividerCallback<Sub, &Sub::stepn>> divn;
+    FixedDivider<16, DividerCallback<Sub, &Sub::stepm>> divm;
 
     int activeChannels_m[4] = {0};
     void computeGains(bool doOne, bool doTwo, bool agc);
@@ -207,13 +208,8 @@ private:
 template <class TBase>
 inline void Sub<TBase>::init() {
     LookupTableFactory<float>::makeAudioTaper(audioTaper);
-    divn.setup(4, [this]() {
-        this->stepn();
-    });
-
-    divm.setup(16, [this]() {
-        this->stepm();
-    });
+    divn.setup(this);
+    divm.setup(this);
 
     for (int i = 0; i < 4; ++i) {
         oscillators[i].index = i;
@@ -447,8 +443,10 @@ inline void Sub<TBase>::setupWaveforms() {
     float_4 mainIsSawMask = bitfieldToMask(mainIsSawBitMask);
     float_4 subIsSawMask = bitfieldToMask(subIsSawBitMask);
     // printf("in setup waveform main is saw mask: %s\n subIsSawMask: %s\n",    toStr(mainIsSawMask).c_str(),toStr(subIsSawMask).c_str());
+    const bool lite = Sub<TBase>::params[Sub<TBase>::LITE_PARAM].value > .5f;
     for (int bank = 0; bank < 4; ++bank) {
         oscillators[bank].setWaveform(mainIsSawMask, subIsSawMask);
+        oscillators[bank].setLite(lite);
     }
 }
 
@@ -797,6 +795,9 @@ inline IComposite::Config SubDescription<TBase>::getParamValue(int i) {
         case Sub<TBase>::AGC_PARAM:
             ret = {0, 1, 0, "agc"};
             break;
+        case Sub<TBase>::LITE_PARAM:
+            ret = {0, 1, 0, "Lite quality (wavetable)"};
+            break;
         default:
             assert(false);
     }
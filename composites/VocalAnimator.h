@@ -137,8 +137,9 @@ public:
     typename osc::State modulatorState;
     typename osc::Params modulatorParams;
 
-    StateVariableFilterState<T> filterStates[numFilters];
-    StateVariableFilterParams<T> filterParams[numFilters];
+    // All four formant filters run together, one in each lane.
+    StateVariableFilterState<float_4> filterState;
+    StateVariableFilterParams<float_4> filterParams;
 
     std::shared_ptr<LookupTableParams<T>> expLookup;
 
@@ -152,15 +153,14 @@ public:
 
 template <class TBase>
 inline void VocalAnimator<TBase>::init() {
+    static_assert(numFilters == 4, "filter bank is one float_4");
+    filterParams.setMode(StateVariableFilterParams<float_4>::Mode::BandPass);
+    filterParams.setQ(15);  // or should it be 5?
     for (int i = 0; i < numFilters; ++i) {
-        filterParams[i].setMode(StateVariableFilterParams<T>::Mode::BandPass);
-        filterParams[i].setQ(15);  // or should it be 5?
-
-        filterParams[i].setFreq(nominalFilterCenterHz[i] * reciprocalSampleRate);
         filterFrequencyLog[i] = nominalFilterCenterLog2[i];
-
         normalizedFilterFreq[i] = nominalFilterCenterHz[i] * reciprocalSampleRate;
     }
+    filterParams.setFreq(float_4::load(normalizedFilterFreq));
     scale0_1 = AudioMath::makeScalerWithBipolarAudioTrim(0, 1);    // full CV range -> 0..1
     scalem2_2 = AudioMath::makeScalerWithBipolarAudioTrim(-2, 2);  // full CV range -> -2..2
     scaleQ = AudioMath::makeScalerWithBipolarAudioTrim(.71f, 21);
@@ -182,9 +182,8 @@ inline void VocalAnimator<TBase>::step() {
     T filterMix = 0;  // Sum the folder outputs here
     const T input = TBase::inputs[AUDIO_INPUT].getVoltage(0);
 
-    for (int i = 0; i < numFilters; ++i) {
-        filterMix += StateVariableFilter<T>::run(input, filterStates[i], filterParams[i]);
-    }
+    const float_4 bands = StateVariableFilter<float_4>::run(input, filterState, filterParams);
+    filterMix += bands[0] + bands[1] + bands[2] + bands[3];
 #ifdef _ANORM
     filterMix *= filterNormalizedBandwidth * 2;
 #else
@@ -197,11 +196,8 @@ template <class TBase>
 inline void VocalAnimator<TBase>::stepModulation() {
     // printf("step mod\n");
     const bool bass = TBase::params[BASS_EXP_PARAM].value > .5;
-    const auto mode = bass ? StateVariableFilterParams<T>::Mode::LowPass : StateVariableFilterParams<T>::Mode::BandPass;
-
-    for (int i = 0; i < numFilters + 1 - 1; ++i) {
-        filterParams[i].setMode(mode);
-    }
+    const auto mode = bass ? StateVariableFilterParams<float_4>::Mode::LowPass : StateVariableFilterParams<float_4>::Mode::BandPass;
+    filterParams.setMode(mode);
 
     // Run the modulators, hold onto their output.
     // Raw Modulator outputs put in modulatorOutputs[].
@@ -304,10 +300,9 @@ inline void VocalAnimator<TBase>::stepModulation() {
         normFreq = std::min(normFreq, T(.2));
 
         normalizedFilterFreq[i] = normFreq;
-        filterParams[i].setFreq(normFreq);
-
-        filterParams[i].setNormalizedBandwidth(filterNormalizedBandwidth);
     }
+    filterParams.setFreq(float_4::load(normalizedFilterFreq));
+    filterParams.setNormalizedBandwidth(filterNormalizedBandwidth);
 
     int matrixMode;
     float mmParam = TBase::params[LFO_MIX_PARAM].value;
@@ -27,12 +27,19 @@ public:
 /**
  * original version CPU usage = 84
  * update filters less often => 28.4
+ *
+ * The formant bands are packed into float_4, so all of them run in one pass.
+ * The audio input may be polyphonic, in which case each voice gets its own
+ * filter bank. If any of the CV inputs are polyphonic each voice also
+ * gets its own vowel, fc, Q and brightness.
  */
 template <class TBase>
 class VocalFilter : public TBase {
 public:
     typedef float T;
     static const int numFilters = FormantTables2::numFormantBands;
+    static const int numBanks = (numFilters + 3) / 4;  // float_4 per voice
+    static const int maxChannels = 16;
 
     VocalFilter(Module* module) : TBase(module) {
     }
@@ -91,13 +98,12 @@ public:
 
     float reciprocalSampleRate;
 
-    // The frequency inputs to the filters, exposed for testing.
+    // Bands are packed four to a float_4. Unused lanes have zero gain.
+    StateVariableFilterState<float_4> filterStates[maxChannels][numBanks];
+    StateVariableFilterParams<float_4> filterParams[maxChannels][numBanks];
+    float_4 m_gain[maxChannels][numBanks];
 
-    T filterFrequencyLog[numFilters];
-
-    StateVariableFilterState<T> filterStates[numFilters];
-    StateVariableFilterParams<T> filterParams[numFilters];
-    float m_gain[numFilters] = {0};
+    int numChannels = 1;
 
     FormantTables2 formantTables;
     std::shared_ptr<LookupTableParams<T>> expLookup;
@@ -109,15 +115,25 @@ public:
     AudioMath::ScaleFun<T> scaleBrightness;
 
     int cycleCount = 1;
+
+private:
+    /**
+     * Set up the filters for one voice.
+     * returns the vowel, for the lights.
+     */
+    T stepFilters(int channel, int model);
 };
 
 template <class TBase>
 inline void VocalFilter<TBase>::init() {
-    for (int i = 0; i < numFilters; ++i) {
-        filterParams[i].setMode(StateVariableFilterParams<T>::Mode::BandPass);
-        filterParams[i].setQ(15);  // or should it be 5?
+    for (int ch = 0; ch < maxChannels; ++ch) {
+        for (int bank = 0; bank < numBanks; ++bank) {
+            filterParams[ch][bank].setMode(StateVariableFilterParams<float_4>::Mode::BandPass);
+            filterParams[ch][bank].setQ(15);  // or should it be 5?
 
-        filterParams[i].setFreq(T(.1));
+            filterParams[ch][bank].setFreq(float_4(.1f));
+            m_gain[ch][bank] = 0;
+        }
     }
     scaleCV_to_formant = AudioMath::makeLinearScaler<T>(0, formantTables.numVowels - 1);
     scaleFc = AudioMath::makeLinearScaler<T>(-2, 2);
@@ -152,11 +168,28 @@ inline void VocalFilter<TBase>::stepFilters() {
         assert(switchVal < 4.5);
     }
 
-    const T fVowel = scaleCV_to_formant(
-        TBase::inputs[FILTER_VOWEL_CV_INPUT].getVoltage(0),
-        TBase::params[FILTER_VOWEL_PARAM].value,
-        TBase::params[FILTER_VOWEL_TRIM_PARAM].value);
+    numChannels = std::max(1, TBase::inputs[AUDIO_INPUT].getChannels());
+    TBase::outputs[AUDIO_OUTPUT].setChannels(numChannels);
+
+    // Only work out the filter params for every voice if the CV is polyphonic.
+    int numParamChannels = 1;
+    for (int input : {FILTER_Q_CV_INPUT, FILTER_FC_CV_INPUT, FILTER_VOWEL_CV_INPUT, FILTER_BRIGHTNESS_INPUT}) {
+        numParamChannels = std::max(numParamChannels, TBase::inputs[input].getChannels());
+    }
+    numParamChannels = std::min(numParamChannels, numChannels);
 
+    const T fVowel = stepFilters(0, model);
+    for (int ch = 1; ch < numParamChannels; ++ch) {
+        stepFilters(ch, model);
+    }
+    for (int ch = numParamChannels; ch < numChannels; ++ch) {
+        for (int bank = 0; bank < numBanks; ++bank) {
+            filterParams[ch][bank] = filterParams[0][bank];
+            m_gain[ch][bank] = m_gain[0][bank];
+        }
+    }
+
+    // lights follow the first voice
     int iVowel = (int)std::floor(fVowel);
 
     assert(iVowel >= 0);
@@ -173,46 +206,66 @@ inline void VocalFilter<TBase>::stepFilters() {
             TBase::lights[i].value = 0;
         }
     }
+}
+
+template <class TBase>
+inline typename VocalFilter<TBase>::T VocalFilter<TBase>::stepFilters(int channel, int model) {
+    const T fVowel = scaleCV_to_formant(
+        TBase::inputs[FILTER_VOWEL_CV_INPUT].getPolyVoltage(channel),
+        TBase::params[FILTER_VOWEL_PARAM].value,
+        TBase::params[FILTER_VOWEL_TRIM_PARAM].value);
 
     const T bwMultiplier = scaleQ(
-        TBase::inputs[FILTER_Q_CV_INPUT].getVoltage(0),
+        TBase::inputs[FILTER_Q_CV_INPUT].getPolyVoltage(channel),
         TBase::params[FILTER_Q_PARAM].value,
         TBase::params[FILTER_Q_TRIM_PARAM].value);
 
     const T fPara = scaleFc(
-        TBase::inputs[FILTER_FC_CV_INPUT].getVoltage(0),
+        TBase::inputs[FILTER_FC_CV_INPUT].getPolyVoltage(channel),
         TBase::params[FILTER_FC_PARAM].value,
         TBase::params[FILTER_FC_TRIM_PARAM].value);
     // fNow -5..5, log
 
     const T brightness = scaleBrightness(
-        TBase::inputs[FILTER_BRIGHTNESS_INPUT].getVoltage(0),
+        TBase::inputs[FILTER_BRIGHTNESS_INPUT].getPolyVoltage(channel),
         TBase::params[FILTER_BRIGHTNESS_PARAM].value,
         TBase::params[FILTER_BRIGHTNESS_TRIM_PARAM].value);
 
-    //   T filterMix = 0;
+    // Fill in the bands one at a time, then do the lookups and hand them to the filters
+    // four at a time. The padding at the end is a silent band at 1k.
+    float gainDB[numBanks * 4] = {0};
+    float gainBw[numBanks * 4] = {0};
+    float fcLog[numBanks * 4];
+    float bw[numBanks * 4];
+    std::fill(fcLog, fcLog + numBanks * 4, std::log2(T(1000)));
+    std::fill(bw, bw + numBanks * 4, T(1));
+
     for (int i = 0; i < numFilters; ++i) {
-        const T fcLog = formantTables.getLogFrequency(model, i, fVowel);
         const T normalizedBw = bwMultiplier * formantTables.getNormalizedBandwidth(model, i, fVowel);
 
         // Get the filter gain from the table, but scale by BW to counteract the filters
         // gain that tracks Q
-        T gainDB = formantTables.getGain(model, i, fVowel);
+        const T rawGainDB = formantTables.getGain(model, i, fVowel);
 
         // blend the table with full gain depending on brightness
-        T modifiedGainDB = (1 - gainDB) * brightness + gainDB;
+        gainDB[i] = (1 - rawGainDB) * brightness + rawGainDB;
 
         // TODO: why is normalizedBW in this equation?
-        m_gain[i] = LookupTable<T>::lookup(*db2GainLookup, modifiedGainDB) * normalizedBw;
+        gainBw[i] = normalizedBw;
+
+        fcLog[i] = formantTables.getLogFrequency(model, i, fVowel) + fPara;
+        bw[i] = normalizedBw;
+    }
 
-        T fcFinalLog = fcLog + fPara;
-        T fcFinal = LookupTable<T>::lookup(*expLookup, fcFinalLog);
+    for (int bank = 0; bank < numBanks; ++bank) {
+        const float_4 gain = LookupTable<T>::lookupSimd(*db2GainLookup, float_4::load(gainDB + bank * 4));
+        m_gain[channel][bank] = gain * float_4::load(gainBw + bank * 4);
 
-        filterParams[i].setFreq(fcFinal * reciprocalSampleRate);
-        filterParams[i].setNormalizedBandwidth(normalizedBw);
-        //  filterMix += gain * StateVariableFilter<T>::run(input, filterStates[i], filterParams[i]);
+        const float_4 fcFinal = LookupTable<T>::lookupSimd(*expLookup, float_4::load(fcLog + bank * 4));
+        filterParams[channel][bank].setFreq(fcFinal * reciprocalSampleRate);
+        filterParams[channel][bank].setNormalizedBandwidth(float_4::load(bw + bank * 4));
     }
-    // TBase::outputs[AUDIO_OUTPUT].value = 3 * filterMix;
+    return fVowel;
 }
 
 template <class TBase>
@@ -225,12 +278,15 @@ inline void VocalFilter<TBase>::step() {
         stepFilters();
     }
 
-    T filterMix = 0;
-    const T input = TBase::inputs[AUDIO_INPUT].getVoltage(0);
-    for (int i = 0; i < numFilters; ++i) {
-        filterMix += m_gain[i] * StateVariableFilter<T>::run(input, filterStates[i], filterParams[i]);
+    for (int ch = 0; ch < numChannels; ++ch) {
+        const float_4 input = TBase::inputs[AUDIO_INPUT].getVoltage(ch);
+        float_4 filterMix = 0;  // Each lane has the sum of some bands
+        for (int bank = 0; bank < numBanks; ++bank) {
+            filterMix += m_gain[ch][bank] * StateVariableFilter<float_4>::run(input, filterStates[ch][bank], filterParams[ch][bank]);
+        }
+        const T output = filterMix[0] + filterMix[1] + filterMix[2] + filterMix[3];
+        TBase::outputs[AUDIO_OUTPUT].setVoltage(3 * output, ch);
     }
-    TBase::outputs[AUDIO_OUTPUT].setVoltage(3 * filterMix, 0);
 }
 
 template <class TBase>
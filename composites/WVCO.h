@@ -78,6 +78,7 @@ float -> float_4 isn't free.
 //#ifndef _MSC_VER
 #if 1
 #include "ADSR16.h"
+#include "BankActivity.h"
 #include "Divider.h"
 #include "IComposite.h"
 #include "LookupTable.h"
@@ -211,11 +212,17 @@ public:
 
     float convertOldShapeGain(float old) const;
 
+    /**
+     * For tests. True if this bank of voices is asleep.
+     */
+    bool _isAsleep(int bank) const {
+        return activity.isAsleep(bank);
+    }
+
 private:
-    Divider divn;
-    Divider divm;
     WVCODsp dsp[4];
     ADSR16 adsr;
+    BankActivity activity;
 
     std::function<float(float)> expLookup = ObjectCache<float>::getExp2Ex();
     std::shared_ptr<LookupTableParams<float>> audioTaperLookupParams = ObjectCache<float>::getAudioTaper();
@@ -266,17 +273,16 @@ private:
      */
     void updateFreq_n();
     void updateShapes_n();
+
+    FixedDivider<4, DividerCallback<WVCO, &WVCO::stepn_lowerRate>> divn;
+    FixedDivider<16, DividerCallback<WVCO, &WVCO::stepm>> divm;
 };
 
 template <class TBase>
 inline void WVCO<TBase>::init() {
     adsr.setNumChannels(1);  // just to prime the pump, will write true value later
-    divn.setup(4, [this]() {
-        stepn_lowerRate();
-    });
-    divm.setup(16, [this]() {
-        stepm();
-    });
+    divn.setup(this);
+    divm.setup(this);
 }
 
 template <class TBase>
@@ -408,6 +414,11 @@ inline void WVCO<TBase>::stepm() {
     enableAdsrFM = TBase::params[ADSR_LFM_DEPTH_PARAM].value > .5;
     enableAdsrShape = TBase::params[ADSR_SHAPE_PARAM].value > .5;
     oversampleFM = TBase::params[OVERSAMPLE_FM].value > .5;
+
+    // the banks can only go silent when the ADSR sets the level.
+    if (!enableAdsrLevel) {
+        activity.wakeAll();
+    }
 }
 
 template <class TBase>
@@ -521,6 +532,15 @@ inline void WVCO<TBase>::stepn_fullRate()
         }
 
         adsr.step(gates, TBase::engineGetSampleTime());
+
+        if (enableAdsrLevel) {
+            for (int bank = 0; bank < numBanks_m; ++bank) {
+                activity.run(bank, gates[bank]);
+                if (activity.update(bank, gates[bank], adsr.get(bank))) {
+                    adsr.setSilent(bank);
+                }
+            }
+        }
     }
 
     // ----------------------------------------------------------------------------
@@ -562,9 +582,35 @@ inline void WVCO<TBase>::step()
     assert(numBanks_m > 0);
 
     // this could even be moves out of the "every sample" loop
-    if (!syncInputConnected_m && !fmInputConnected_m) {
+    if (!syncInputConnected_m && !fmInputConnected_m && dsp[0].canUseSinBlock(this->oversampleFM)) {
+        // all the banks have the same waveform, so we can run them all through one kernel
+        // only the awake banks go to the kernel
+        SimdDispatch::SinDecimateBank banks[4];
+        int awake[4];
+        int numAwake = 0;
+        for (int bank = 0; bank < numBanks_m; ++bank) {
+            if (activity.isAsleep(bank)) {
+                WVCO<TBase>::outputs[MAIN_OUTPUT].setVoltageSimd(float_4::zero(), 4 * bank);
+                continue;
+            }
+            dsp[bank].fmInput = 0;
+            dsp[bank].prepareSinBlock(banks[numAwake], float_4::zero());
+            awake[numAwake++] = bank;
+        }
+        if (numAwake) {
+            SimdDispatch::kernels().sinDecimate(banks, numAwake, dsp[0].getSinBlockTaps(), WVCODsp::oversampleRate);
+        }
+        for (int i = 0; i < numAwake; ++i) {
+            const int bank = awake[i];
+            WVCO<TBase>::outputs[MAIN_OUTPUT].setVoltageSimd(dsp[bank].finishSinBlock(), 4 * bank);
+        }
+    } else if (!syncInputConnected_m && !fmInputConnected_m) {
         for (int bank = 0; bank < numBanks_m; ++bank) {
             const int baseChannel = 4 * bank;
+            if (activity.isAsleep(bank)) {
+                WVCO<TBase>::outputs[MAIN_OUTPUT].setVoltageSimd(float_4::zero(), baseChannel);
+                continue;
+            }
             dsp[bank].fmInput = 0;
             float_4 v = dsp[bank].step(float_4::zero(),  this->oversampleFM);
             WVCO<TBase>::outputs[MAIN_OUTPUT].setVoltageSimd(v, baseChannel);
@@ -573,6 +619,10 @@ inline void WVCO<TBase>::step()
         // TODO: don't do this if fm input port not connected. sync also
         for (int bank = 0; bank < numBanks_m; ++bank) {
             const int baseChannel = 4 * bank;
+            if (activity.isAsleep(bank)) {
+                WVCO<TBase>::outputs[MAIN_OUTPUT].setVoltageSimd(float_4::zero(), baseChannel);
+                continue;
+            }
             Port& fmInputPort = WVCO<TBase>::inputs[LINEAR_FM_INPUT];
             float_4 fmInput = fmInputPort.getPolyVoltageSimd<float_4>(baseChannel);
 
@@ -1,5 +1,6 @@
 
 #include "AudioMath.h"
+#include "CounterRandom.h"
 #include "FFT.h"
 #include "FFTData.h"
 
@@ -94,15 +95,14 @@ double FFT::bin2Freq(int bin, double sampleRate, int numBins)
     return  sampleRate * double(bin) / double(numBins);
 }
 
-static float randomPhase()
+static float randomPhase(CounterRandom& random)
 {
-    float phase = (float) rand();
-    phase = phase / (float) RAND_MAX;   // 0..1
+    float phase = random.uniform();     // 0..1
     phase = (float) (phase * (2 * AudioMath::Pi));
     return phase;
 }
 
-static void makeNegSlope(FFTDataCpx* output, const ColoredNoiseSpec& spec)
+static void makeNegSlope(FFTDataCpx* output, const ColoredNoiseSpec& spec, CounterRandom& random)
 {
     const int numBins = int(output->size());
     const float lowFreqCorner = 40;
@@ -112,7 +112,7 @@ static void makeNegSlope(FFTDataCpx* output, const ColoredNoiseSpec& spec)
  
     // fill bottom bins with 1.0 mag
     for (int i = 0; i <= bin40; ++i) {
-        output->set(i, std::polar(1.f, randomPhase()));
+        output->set(i, std::polar(1.f, randomPhase(random)));
     }
 
     // now go to the end and at slope
@@ -122,7 +122,7 @@ static void makeNegSlope(FFTDataCpx* output, const ColoredNoiseSpec& spec)
             const double f = FFT::bin2Freq(i, spec.sampleRate, numBins);
             const double gainDb = std::log2(f) * spec.slope + k;
             const float gain = float(AudioMath::gainFromDb(gainDb));
-            output->set(i, std::polar(gain, randomPhase()));
+            output->set(i, std::polar(gain, randomPhase(random)));
         } else {
             output->set(i, cpx(0, 0));
         }
@@ -130,7 +130,7 @@ static void makeNegSlope(FFTDataCpx* output, const ColoredNoiseSpec& spec)
     output->set(0, 0);          // make sure dc bin zero
 }
 
-static void makePosSlope(FFTDataCpx* output, const ColoredNoiseSpec& spec)
+static void makePosSlope(FFTDataCpx* output, const ColoredNoiseSpec& spec, CounterRandom& random)
 {
     const int numBins = int(output->size());
 
@@ -146,7 +146,7 @@ static void makePosSlope(FFTDataCpx* output, const ColoredNoiseSpec& spec)
             const double gainDb = std::log2(f) * spec.slope + k;
             const float gain = float(AudioMath::gainFromDb(gainDb));
             gainMax = std::max(gain, gainMax);
-            output->set(i, std::polar(gain, randomPhase()));
+            output->set(i, std::polar(gain, randomPhase(random)));
         } else {
             output->set(i, cpx(0, 0));
         }
@@ -155,7 +155,7 @@ static void makePosSlope(FFTDataCpx* output, const ColoredNoiseSpec& spec)
     // fill top bins with mag mag
     for (int i = numBins - 1; i >= binHigh; --i) {
         if (i < numBins / 2) {
-            output->set(i, std::polar(gainMax, randomPhase()));
+            output->set(i, std::polar(gainMax, randomPhase(random)));
         } else {
             output->set(i, cpx(0.0));
         }
@@ -164,8 +164,13 @@ static void makePosSlope(FFTDataCpx* output, const ColoredNoiseSpec& spec)
     output->set(0, 0);          // make sure dc bin zero
 }
 
-void FFT::makeNoiseSpectrum(FFTDataCpx* output, const ColoredNoiseSpec& spec)
+void FFT::makeNoiseSpectrum(FFTDataCpx* output, const ColoredNoiseSpec& spec, CounterRandom* random)
 {
+    CounterRandom defaultRandom(0);
+    if (!random) {
+        random = &defaultRandom;
+    }
+
     // for now, zero all first.
     const int frameSize = (int) output->size();
     for (int i = 0; i < frameSize; ++i) {
@@ -173,9 +178,9 @@ void FFT::makeNoiseSpectrum(FFTDataCpx* output, const ColoredNoiseSpec& spec)
         output->set(i, x);
     }
     if (spec.slope < 0) {
-        makeNegSlope(output, spec);
+        makeNegSlope(output, spec, *random);
     } else {
-        makePosSlope(output, spec);
+        makePosSlope(output, spec, *random);
     }
 }
 
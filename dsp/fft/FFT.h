@@ -5,6 +5,8 @@
 
 #include "FFTData.h"
 
+class CounterRandom;
+
 class ColoredNoiseSpec
 {
 public:
@@ -31,8 +33,10 @@ public:
 
     /**
      * Fills a complex FFT frame with frequency domain data describing noise
+     * The phases come from random. If random is null, a fixed seed is used,
+     * so the same spec always makes the same spectrum.
      */
-    static void makeNoiseSpectrum(FFTDataCpx* output, const ColoredNoiseSpec&);
+    static void makeNoiseSpectrum(FFTDataCpx* output, const ColoredNoiseSpec&, CounterRandom* random = nullptr);
 
     static void normalize(FFTDataReal*, float maxValue);
     static double bin2Freq(int bin, double sampleRate, int numBins);
@@ -22,6 +22,15 @@ public:
      */
     T& z0(int stage);
     T& z1(int stage);
+
+    /**
+     * Direct access to the delay memory as a contiguous array,
+     * z0 and z1 for stage 0, then stage 1...
+     */
+    T* data()
+    {
+        return _state;
+    }
 private:
     T _state[N * 2];
 };
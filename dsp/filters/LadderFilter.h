@@ -182,11 +182,29 @@ private:
     AsymWaveShaper shaper;
     T _lastInput = 0;
 
-    void runBufferClassic(float* buffer, int);
-    void runBufferClip2(float* buffer, int);
-    void runBufferFold(float* buffer, int);
-    void runBufferFold2(float* buffer, int);
-    void runBufferClean(float* buffer, int);
+    /**
+     * There is a specialized process function for every type and voicing.
+     * It gets picked when the type or voicing changes, so the oversampled
+     * loop doesn't have to switch on them.
+     */
+    using processFunction = void (LadderFilter<T>::*)(float* buffer);
+    processFunction procFun = nullptr;
+
+    template <Voicing V, Types TY>
+    void runBuffer(float* buffer);
+
+    template <Voicing V>
+    T shape(T x, int stage) const;
+
+    template <Voicing V>
+    static processFunction getProcFun(Types);
+    static processFunction getProcFun(Types, Voicing);
+
+    /**
+     * Output mixer gain for each stage, for each type.
+     * For 4PLP these will be overridden by the slope.
+     */
+    static T getStageTap(Types, int stage);
 
     void updateFilter();
     void updateSlope();
@@ -204,6 +222,7 @@ template <typename T>
 LadderFilter<T>::LadderFilter()
 {
     initQLookup();
+    procFun = getProcFun(type, voicing);
     // fix at 4X oversample
     up.setup(oversampleRate);
     down.setup(oversampleRate);
@@ -410,7 +429,74 @@ void LadderFilter<T>::updateStageGains()
 template <typename T>
 void LadderFilter<T>::setVoicing(Voicing v)
 {
+    if (v == voicing) {
+        return;
+    }
     voicing = v;
+    procFun = getProcFun(type, voicing);
+}
+
+template <typename T>
+inline T LadderFilter<T>::getStageTap(Types type, int stage)
+{
+    // Taps for stages 0..3
+    switch (type) {
+        case Types::_4PLP:
+            return (stage == 3) ? T(1) : T(0);
+        case Types::_3PLP:
+            return (stage == 2) ? T(1) : T(0);
+        case Types::_2PLP:
+            return (stage == 1) ? T(1) : T(0);
+        case Types::_1PLP:
+            return (stage == 0) ? T(1) : T(0);
+        case Types::_2PBP: {
+            const T taps[] = {T(.68) * 2, T(-.68) * 2, 0, 0};
+            return taps[stage];
+        }
+        case Types::_2HP1LP: {
+            const T taps[] = {T(.68) * 2, T(-1.36) * 2, T(.68) * 2, 0};
+            return taps[stage];
+        }
+        case Types::_3HP1LP: {
+            const T taps[] = {T(.68) * 4, T(-2.05) * 4, T(2.05) * 4, T(-.68) * 4};
+            return taps[stage];
+        }
+        case Types::_3PHP: {
+            const T taps[] = {1, -3, 3, -1};
+            return taps[stage];
+        }
+        case Types::_2PHP: {
+            const T taps[] = {1, -2, 1, 0};
+            return taps[stage];
+        }
+        case Types::_1PHP: {
+            const T taps[] = {1, -1, 0, 0};
+            return taps[stage];
+        }
+        case Types::_4PBP: {
+            const T taps[] = {0, T(-.68) * 4, T(1.36) * 4, T(-.68) * 4};
+            return taps[stage];
+        }
+        case Types::_1LPNotch: {
+            const T taps[] = {T(.68), T(-1.36), T(1.36), 0};
+            return taps[stage];
+        }
+        case Types::_3AP1LP: {
+            const T taps[] = {T(.68), T(-2.05), T(4.12), T(-2.73)};
+            return taps[stage];
+        }
+        case Types::_NOTCH: {
+            const T taps[] = {1, -2, 2, 0};
+            return taps[stage];
+        }
+        case Types::_PHASER: {
+            const T taps[] = {1, -3, 6, -4};
+            return taps[stage];
+        }
+        default:
+            assert(false);
+    }
+    return 0;
 }
 
 template <typename T>
@@ -419,107 +505,22 @@ void LadderFilter<T>::setType(Types t)
     if (t == type)
         return;
 
-    bypassFirstStage = false;
     type = t;
     switch (type) {
-        case Types::_4PLP:
-            stageTaps[3] = 1;
-            stageTaps[2] = 0;
-            stageTaps[1] = 0;
-            stageTaps[0] = 0;
-            break;
-        case Types::_3PLP:
-            stageTaps[3] = 0;
-            stageTaps[2] = 1;
-            stageTaps[1] = 0;
-            stageTaps[0] = 0;
-            break;
-        case Types::_2PLP:
-            stageTaps[3] = 0;
-            stageTaps[2] = 0;
-            stageTaps[1] = 1;
-            stageTaps[0] = 0;
-            break;
-        case Types::_1PLP:
-            stageTaps[3] = 0;
-            stageTaps[2] = 0;
-            stageTaps[1] = 0;
-            stageTaps[0] = 1;
-            break;
-        case Types::_2PBP:
-            stageTaps[3] = 0;
-            stageTaps[2] = 0;
-            stageTaps[1] = T(-.68) * 2;
-            stageTaps[0] = T(.68) * 2;
-            break;
-        case Types::_2HP1LP:
-            stageTaps[3] = 0;
-            stageTaps[2] = T(.68) * 2;
-            stageTaps[1] = T(-1.36) * 2;
-            stageTaps[0] = T(.68) * 2;
-            break;
-        case Types::_3HP1LP:
-            stageTaps[3] = T(-.68) * 4;
-            stageTaps[2] = T(2.05) * 4;
-            stageTaps[1] = T(-2.05) * 4;
-            stageTaps[0] = T(.68) * 4;
-            break;
         case Types::_3PHP:
-            bypassFirstStage = true;
-            stageTaps[3] = -1;
-            stageTaps[2] = 3;
-            stageTaps[1] = -3;
-            stageTaps[0] = 1;
-            break;
         case Types::_2PHP:
-            bypassFirstStage = true;
-            stageTaps[3] = 0;
-            stageTaps[2] = 1;
-            stageTaps[1] = -2;
-            stageTaps[0] = 1;
-            break;
         case Types::_1PHP:
-            bypassFirstStage = true;
-            stageTaps[3] = 0;
-            stageTaps[2] = 0;
-            stageTaps[1] = -1;
-            stageTaps[0] = 1;
-            break;
-        case Types::_4PBP:
-            stageTaps[3] = T(-.68) * 4;
-            stageTaps[2] = T(1.36) * 4;
-            stageTaps[1] = T(-.68) * 4;
-            stageTaps[0] = 0;
-            break;
-        case Types::_1LPNotch:
-            stageTaps[3] = 0;
-            stageTaps[2] = T(1.36);
-            stageTaps[1] = T(-1.36);
-            stageTaps[0] = T(.68);
-            break;
-        case Types::_3AP1LP:
-            stageTaps[3] = T(-2.73);
-            stageTaps[2] = T(4.12);
-            stageTaps[1] = T(-2.05);
-            stageTaps[0] = T(.68);
-            break;
         case Types::_NOTCH:
-            bypassFirstStage = true;
-            stageTaps[3] = 0;
-            stageTaps[2] = 2;
-            stageTaps[1] = -2;
-            stageTaps[0] = 1;
-            break;
         case Types::_PHASER:
             bypassFirstStage = true;
-            stageTaps[3] = -4;
-            stageTaps[2] = 6;
-            stageTaps[1] = -3;
-            stageTaps[0] = 1;
             break;
         default:
-            assert(false);
+            bypassFirstStage = false;
+    }
+    for (int i = 0; i < 4; ++i) {
+        stageTaps[i] = getStageTap(type, i);
     }
+    procFun = getProcFun(type, voicing);
     updateFilter();
     updateSlope();
     updateStageGains();         // many filter types turn off the edge
@@ -602,106 +603,147 @@ inline void LadderFilter<T>::run(T input)
     input *= gain;
     float buffer[oversampleRate];
     up.process(buffer, (float) input);
+    (this->*procFun)(buffer);
+    mixedOutput = down.process(buffer) * finalVolume;
+}
 
-    switch (voicing) {
+/**************************************************************************************
+ *
+ * The distortion for each voicing. stage is always a constant,
+ * so once this is inlined into runBuffer all the switching goes away.
+ */
+template <typename T>
+template <typename LadderFilter<T>::Voicing V>
+inline T LadderFilter<T>::shape(T temp, int stage) const
+{
+    switch (V) {
         case Voicing::Classic:
-            runBufferClassic(buffer, oversampleRate);
-            break;
+            return T(2) * LookupTable<T>::lookup(*tanhLookup.get(), T(.5) * temp, true);
         case Voicing::Clip2:
-            runBufferClip2(buffer, oversampleRate);
-            break;
+            // asymmetric: clip top on even stages, bottom on odd
+            return (stage & 1) ? std::max<T>(temp, -1.f) : std::min<T>(temp, 1.f);
         case Voicing::Fold:
-            runBufferFold(buffer, oversampleRate);
-            break;
+            // first stage attenuates before the fold
+            return (stage == 0) ? T(AudioMath::fold(float(temp) * .5f)) : T(AudioMath::fold(float(temp)));
         case Voicing::Fold2:
-            runBufferFold2(buffer, oversampleRate);
-            break;
+            // asymmetric: fold top on even stages, bottom on odd
+            if (stage & 1) {
+                return (temp < 0) ? (T)AudioMath::fold(float(temp)) : temp;
+            } else {
+                return (temp > 0) ? (T)AudioMath::fold(float(temp)) : temp;
+            }
         case Voicing::Clean:
-            runBufferClean(buffer, oversampleRate);
-            break;
+            return temp;
         default:
             assert(false);
+            return temp;
     }
-    mixedOutput = down.process(buffer) * finalVolume;
 }
 
-/**************************************************************************************
- *
- * A set of macros for (ugh) building up process functions for different distortion functions
- */
-#define PROC_PREAMBLE(name) template <typename T> \
-    inline void  LadderFilter<T>::name(float* buffer, int numSamples) { \
-        for (int i = 0; i < numSamples; ++i) { \
-            const T input = buffer[i]; \
-            T temp = input - adjustedFeedback * stageOutputs[3]; \
-            temp = std::max(T(-3), temp); \
-            temp = std::min(T(3), temp);
-
-#define PROC_END \
-        temp = 0; \
-        for (int i = 0; i < 4; ++i) { \
-            temp += stageOutputs[i] * stageTaps[i]; \
-        } \
-        temp = std::max(T(-1.7), temp); \
-        temp = std::min(T(1.7), temp); \
-        buffer[i] = float(temp); \
-     } \
-}
-
-#define ONETAP(func, index) \
-    temp *= stageGain[index]; \
-    func(); \
-    temp = lpfs[index].run(temp, stageG[index]); \
-    stageOutputs[index] = temp;
-
-#define BODY( func0, func1, func2, func3) \
-    ONETAP(func0, 0) \
-    ONETAP(func1, 1) \
-    ONETAP(func2, 2) \
-    ONETAP(func3, 3)
-
-#define TANH() temp = T(2) * LookupTable<T>::lookup(*tanhLookup.get(), T(.5) * temp, true)
-
-#define CLIP() temp = std::max<T>(temp, -1.f); temp = std::min<T>(temp, 1.f)
-#define CLIP_TOP()  temp = std::min<T>(temp, 1.f)
-#define CLIP_BOTTOM()  temp = std::max<T>(temp, -1.f)
-
-#define FOLD() temp = AudioMath::fold(float(temp))
-#define FOLD_ATTEN() temp = AudioMath::fold(float(temp) * .5f)
-//#define FOLD_ATTEN() temp = AudioMath::fold(float(temp) * 1)
-#define FOLD_BOOST() temp = 2 * AudioMath::fold(float(temp))
-
-#define FOLD_TOP() temp = (temp > 0) ? (T) AudioMath::fold(float(temp)) : temp
-#define FOLD_BOTTOM() temp = (temp < 0) ? (T) AudioMath::fold(float(temp)) : temp
-#define NOPROC()
-
-//#define TRIODE1() temp = T(1.4) * shaper.lookup(float(temp * .4f), 7)
-//#define TRIODE2_ATTEN() temp = T(.1) * shaper.lookup(float(temp), 5)
-//#define TRIODE2() temp = 1.1 * shaper.lookup(float(temp * .4f), 5)
-//#define TRIODE2g() temp = 3 * shaper.lookup(float(temp * .4f), 5)
-//#define TRIODE2b() temp = 1.1 * -shaper.lookup(float(-temp * .4f), 5)
-
-PROC_PREAMBLE(runBufferClassic)
-BODY(TANH, TANH, TANH, TANH)
-PROC_END
-
-PROC_PREAMBLE(runBufferClip2)
-BODY(CLIP_TOP, CLIP_BOTTOM, CLIP_TOP, CLIP_BOTTOM)
-PROC_END
-
-PROC_PREAMBLE(runBufferFold)
-BODY(FOLD_ATTEN, FOLD, FOLD, FOLD)
-PROC_END
-
-PROC_PREAMBLE(runBufferFold2)
-BODY(FOLD_TOP, FOLD_BOTTOM, FOLD_TOP, FOLD_BOTTOM)
-PROC_END
-
-#if 1
-PROC_PREAMBLE(runBufferClean)
-BODY(NOPROC, NOPROC, NOPROC, NOPROC)
-PROC_END
-#endif
+template <typename T>
+template <typename LadderFilter<T>::Voicing V, typename LadderFilter<T>::Types TY>
+inline void LadderFilter<T>::runBuffer(float* buffer)
+{
+    // 4PLP is the only type with variable taps (slope)
+    const bool variableTaps = (TY == Types::_4PLP);
+    const T tap0 = variableTaps ? stageTaps[0] : getStageTap(TY, 0);
+    const T tap1 = variableTaps ? stageTaps[1] : getStageTap(TY, 1);
+    const T tap2 = variableTaps ? stageTaps[2] : getStageTap(TY, 2);
+    const T tap3 = variableTaps ? stageTaps[3] : getStageTap(TY, 3);
+
+    for (int i = 0; i < oversampleRate; ++i) {
+        const T input = buffer[i];
+        T temp = input - adjustedFeedback * stageOutputs[3];
+        temp = std::max(T(-3), temp);
+        temp = std::min(T(3), temp);
+
+        for (int stage = 0; stage < 4; ++stage) {
+            temp *= stageGain[stage];
+            temp = shape<V>(temp, stage);
+            temp = lpfs[stage].run(temp, stageG[stage]);
+            stageOutputs[stage] = temp;
+        }
+
+        // Skip the taps that are always zero
+        temp = 0;
+        if (variableTaps || getStageTap(TY, 0) != 0) {
+            temp += stageOutputs[0] * tap0;
+        }
+        if (variableTaps || getStageTap(TY, 1) != 0) {
+            temp += stageOutputs[1] * tap1;
+        }
+        if (variableTaps || getStageTap(TY, 2) != 0) {
+            temp += stageOutputs[2] * tap2;
+        }
+        if (variableTaps || getStageTap(TY, 3) != 0) {
+            temp += stageOutputs[3] * tap3;
+        }
+        temp = std::max(T(-1.7), temp);
+        temp = std::min(T(1.7), temp);
+        buffer[i] = float(temp);
+    }
+}
+
+template <typename T>
+template <typename LadderFilter<T>::Voicing V>
+inline typename LadderFilter<T>::processFunction LadderFilter<T>::getProcFun(Types type)
+{
+    switch (type) {
+        case Types::_4PLP:
+            return &LadderFilter<T>::runBuffer<V, Types::_4PLP>;
+        case Types::_3PLP:
+            return &LadderFilter<T>::runBuffer<V, Types::_3PLP>;
+        case Types::_2PLP:
+            return &LadderFilter<T>::runBuffer<V, Types::_2PLP>;
+        case Types::_1PLP:
+            return &LadderFilter<T>::runBuffer<V, Types::_1PLP>;
+        case Types::_2PBP:
+            return &LadderFilter<T>::runBuffer<V, Types::_2PBP>;
+        case Types::_2HP1LP:
+            return &LadderFilter<T>::runBuffer<V, Types::_2HP1LP>;
+        case Types::_3HP1LP:
+            return &LadderFilter<T>::runBuffer<V, Types::_3HP1LP>;
+        case Types::_4PBP:
+            return &LadderFilter<T>::runBuffer<V, Types::_4PBP>;
+        case Types::_1LPNotch:
+            return &LadderFilter<T>::runBuffer<V, Types::_1LPNotch>;
+        case Types::_3AP1LP:
+            return &LadderFilter<T>::runBuffer<V, Types::_3AP1LP>;
+        case Types::_3PHP:
+            return &LadderFilter<T>::runBuffer<V, Types::_3PHP>;
+        case Types::_2PHP:
+            return &LadderFilter<T>::runBuffer<V, Types::_2PHP>;
+        case Types::_1PHP:
+            return &LadderFilter<T>::runBuffer<V, Types::_1PHP>;
+        case Types::_NOTCH:
+            return &LadderFilter<T>::runBuffer<V, Types::_NOTCH>;
+        case Types::_PHASER:
+            return &LadderFilter<T>::runBuffer<V, Types::_PHASER>;
+        default:
+            assert(false);
+    }
+    return nullptr;
+}
+
+template <typename T>
+inline typename LadderFilter<T>::processFunction LadderFilter<T>::getProcFun(Types type, Voicing voicing)
+{
+    switch (voicing) {
+        case Voicing::Classic:
+            return getProcFun<Voicing::Classic>(type);
+        case Voicing::Clip2:
+            return getProcFun<Voicing::Clip2>(type);
+        case Voicing::Fold:
+            return getProcFun<Voicing::Fold>(type);
+        case Voicing::Fold2:
+            return getProcFun<Voicing::Fold2>(type);
+        case Voicing::Clean:
+            return getProcFun<Voicing::Clean>(type);
+        default:
+            assert(false);
+    }
+    return nullptr;
+}
 
 template <typename T>
 inline  std::vector<std::string> LadderFilter<T>::getTypeNames()
@@ -24,6 +24,13 @@ public:
 
     float_4 _getL() const { return l; }
 
+    /**
+     * For SIMD kernels that run the filter themselves.
+     */
+    float* _memoryData() { return &memory[0]; }
+    const float* _lData() const { return &l[0]; }
+    const float* _kData() const { return &k[0]; }
+
 private:
     float_4 l = 0;
     float_4 k = 0;
@@ -50,12 +57,8 @@ inline void MultiLPF2::setCutoff(float fs) {
 }
 
 inline void MultiLPF2::setCutoffPoly(float_4 fs) {
-    for (int i = 0; i < 4; ++i) {
-        float ls = NonUniformLookupTable<float>::lookup(*lookup, fs[i]);
-        float ks = LowpassFilter<float>::computeKfromL(ls);
-        k[i] = ks;
-        l[i] = ls;
-    }
+    l = NonUniformLookupTable<float>::lookupSimd(*lookup, fs);
+    k = float_4(1) - l;  // LowpassFilter::computeKfromL
 }
 
 ///////////////////////////////////////////////////////////////////
@@ -85,6 +88,16 @@ public:
     float_4 _memory() const;
     float_4 _getLRelease() const { return lRelease; }
 
+    /**
+     * For SIMD kernels that run the lag themselves.
+     * Only valid while enabled.
+     */
+    float* _memoryData() { return &memory[0]; }
+    const float* _attackData() const { return &lAttack[0]; }
+    const float* _releaseData() const { return &lRelease[0]; }
+    const float* _instantData() const { return &instant[0]; }
+    bool _isEnabled() const { return enabled; }
+
 private:
     float_4 memory = 0;
     float_4 lAttack = 0;
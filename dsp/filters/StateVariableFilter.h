@@ -1,6 +1,7 @@
 #pragma once
 
 #include "AudioMath.h"
+#include "SimdBlocks.h"
 #include <assert.h>
 
 template <typename T> class StateVariableFilterState;
@@ -133,6 +134,13 @@ inline void StateVariableFilterParams<T>::setQ(T q)
     qGain = 1 / q;
 }
 
+template <>
+inline void StateVariableFilterParams<float_4>::setQ(float_4 q)
+{
+    q = SimdBlocks::ifelse(q < float_4(.49f), float_4(.6f), q);
+    qGain = 1 / q;
+}
+
 template <typename T>
 inline void StateVariableFilterParams<T>::setNormalizedBandwidth(T bw)
 {
@@ -153,6 +161,13 @@ inline void StateVariableFilterParams<T>::setFreq(T fc)
     fcGain = T(AudioMath::Pi) * T(2) * fc;
 }
 
+template <>
+inline void StateVariableFilterParams<float_4>::setFreq(float_4 fc)
+{
+    fc = SimdBlocks::min(fc, float_4(.3f));
+    fcGain = float_4(float(AudioMath::Pi) * 2.f) * fc;
+}
+
 template <typename T>
 inline void StateVariableFilterParams<T>::setFreqAccurate(T fc)
 {
@@ -168,3 +183,46 @@ public:
     T z1 = 0;		// the delay line buffer
     T z2 = 0;		// the delay line buffer
 };
+
+/*******************************************************************************************/
+
+/**
+ * float_4 version runs four independent filters at once,
+ * for example the formant bands of a vocal filter.
+ * All four share the same mode.
+ */
+template <>
+inline float_4 StateVariableFilter<float_4>::run(float_4 input, StateVariableFilterState<float_4>& state, const StateVariableFilterParams<float_4>& params)
+{
+    const float_4 dLow = state.z2 + params.fcGain * state.z1;
+    const float_4 dHi = input - (state.z1 * params.qGain + dLow);
+    float_4 dBand = dHi * params.fcGain + state.z1;
+
+    // same clipping as the scalar version
+    dBand = SimdBlocks::ifelse(dBand >= float_4(1000), float_4(999), dBand);
+    dBand = SimdBlocks::ifelse(dBand < float_4(-1000), float_4(-999), dBand);
+
+    float_4 d;
+    switch (params.mode) {
+        case StateVariableFilterParams<float_4>::Mode::LowPass:
+            d = dLow;
+            break;
+        case StateVariableFilterParams<float_4>::Mode::HiPass:
+            d = dHi;
+            break;
+        case StateVariableFilterParams<float_4>::Mode::BandPass:
+            d = dBand;
+            break;
+        case StateVariableFilterParams<float_4>::Mode::Notch:
+            d = dLow + dHi;
+            break;
+        default:
+            assert(false);
+            d = 0.0;
+    }
+
+    state.z1 = dBand;
+    state.z2 = dLow;
+
+    return d;
+}
@@ -293,8 +293,8 @@ public:
     }
     #endif
 
-    T _fcGain() const { return fcGain; }
-    T _qGain() const { return qGain; }
+    const T& _fcGain() const { return fcGain; }
+    const T& _qGain() const { return qGain; }
 private:
     T qGain = 1.;		// internal amp gains
     T fcGain = T(.001f);
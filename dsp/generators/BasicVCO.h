@@ -4,6 +4,7 @@
 #include "SimdBlocks.h"
 #include "SqPort.h"
 
+#include "MipMapWaveTables.h"
 #include "ObjectCache.h"
 #include "simd.h"
 
@@ -29,7 +30,13 @@ public:
 
   //  using  processFunction = float_4 (BasicVCO:: *)(float deltaTime);
     using  processFunction = float_4 (BasicVCO::*)(float deltaTime);
-    processFunction getProcPointer(Waveform);
+
+    /**
+     * if lite is true, saw, square, even and tri clean come from
+     * band-limited wavetables instead of MinBLEP. Cheaper, but
+     * not quite as bright at some pitches.
+     */
+    processFunction getProcPointer(Waveform, bool lite = false);
 
 private:
     using MinBlep = rack::dsp::MinBlepGenerator<16, 16, float_4>; 
@@ -49,6 +56,8 @@ private:
     * Destructor will free them automatically.
     */
     std::shared_ptr<LookupTableParams<float>> sinLookup = {ObjectCache<float>::getSinLookup()};
+    std::shared_ptr<MipMapWaveTables> waveTables = {MipMapWaveTables::get()};
+    int32_4 tableLevel = 0;
 
     float_4 processSaw(float deltaTime);
     float_4 processSin(float deltaTime);
@@ -58,6 +67,11 @@ private:
     float_4 processSinClean(float deltaTime);
     float_4 processTriClean(float deltaTime);
 
+    float_4 processSawLite(float deltaTime);
+    float_4 processPulseLite(float deltaTime);
+    float_4 processEvenLite(float deltaTime);
+    float_4 processTriCleanLite(float deltaTime);
+
     void doSquareLowToHighMinblep(float_4 samplePoint, float_4 crossingThreshold, float_4 deltaPhase);
     void doSquareHighToLowMinblep(float_4 samplePoint, float_4 crossingThreshold, float_4 deltaPhase);
 };
@@ -80,10 +94,26 @@ inline void BasicVCO::setPitch(float_4 pitch, float sampleTime, float sampleRate
     const float sawCorrect = -5.698f;
     const float_4 normalizedFreq = float_4(sampleTime) * freq;
     sawOffsetDCComp = normalizedFreq * float_4(sawCorrect);
+    tableLevel = MipMapWaveTables::levelFor(normalizedFreq);
 }
 
-inline  BasicVCO::processFunction BasicVCO::getProcPointer(Waveform wf)
+inline  BasicVCO::processFunction BasicVCO::getProcPointer(Waveform wf, bool lite)
 {
+    if (lite) {
+        switch(wf) {
+            case Waveform::SAW:
+                return &BasicVCO::processSawLite;
+            case Waveform::SQUARE:
+                return &BasicVCO::processPulseLite;
+            case Waveform::EVEN:
+                return &BasicVCO::processEvenLite;
+            case Waveform::TRI_CLEAN:
+                return &BasicVCO::processTriCleanLite;
+            default:
+                break;      // the rest don't use MinBLEP, so they are the same either way
+        }
+    }
+
     BasicVCO::processFunction ret = &BasicVCO::processSaw;
     switch(wf) {
         case Waveform::SIN:
@@ -324,11 +354,7 @@ inline float_4 BasicVCO::processSinClean(float deltaTime)
     const float_4 deltaPhase = freq * deltaTime;
     phase += deltaPhase;
     phase = SimdBlocks::ifelse( (phase > 1), (phase - 1), phase);
-    float_4 output;
-  
-    for (int i=0; i<4; ++i) {
-        output[i] = LookupTable<float>::lookup(*sinLookup, phase[i], true);
-    }
+    const float_4 output = LookupTable<float>::lookupSimd(*sinLookup, phase, true);
     return 5 * output;
 }
 
@@ -340,3 +366,44 @@ inline float_4 BasicVCO::processTri(float deltaTime)
     float_4 temp = 1 - 4 * rack::simd::fmin(rack::simd::fabs(phase - 0.25f), rack::simd::fabs(phase - 1.25f));
     return 5 * temp;
 }
+
+// The lite versions match the levels and phase of the MinBLEP ones above,
+// but don't need any DC correction, since there is no blep delay.
+inline float_4 BasicVCO::processSawLite(float deltaTime)
+{
+    const float_4 deltaPhase = freq * deltaTime;
+    phase += deltaPhase;
+    phase -= rack::simd::floor(phase);
+    return 5 * waveTables->lookup(MipMapWaveTables::Waveform::SAW, tableLevel, phase + .5f);
+}
+
+inline float_4 BasicVCO::processPulseLite(float deltaTime)
+{
+    const float_4 deltaPhase = freq * deltaTime;
+    phase += deltaPhase;
+    currentPulseWidth = SimdBlocks::ifelse( phase >= 1, nextPulseWidth, currentPulseWidth);
+    phase -= rack::simd::floor(phase);
+
+    // the difference of two saws is a pulse, with no DC
+    const float_4 saw1 = waveTables->lookup(MipMapWaveTables::Waveform::SAW, tableLevel, phase);
+    const float_4 saw2 = waveTables->lookup(MipMapWaveTables::Waveform::SAW, tableLevel, phase - currentPulseWidth);
+    return 5 * .8f * (saw1 - saw2);
+}
+
+inline float_4 BasicVCO::processEvenLite(float deltaTime)
+{
+    const float_4 deltaPhase = freq * deltaTime;
+    phase += deltaPhase;
+    phase -= rack::simd::floor(phase);
+    return float_4(4 * 0.55f * 1.4f) * waveTables->lookup(MipMapWaveTables::Waveform::EVEN, tableLevel, phase);
+}
+
+inline float_4 BasicVCO::processTriCleanLite(float deltaTime)
+{
+    const float_4 deltaPhase = freq * deltaTime;
+    phase += deltaPhase;
+    phase -= rack::simd::floor(phase);
+
+    // the integrated square peaks at phase zero
+    return 5.0f * 1.25f * waveTables->lookup(MipMapWaveTables::Waveform::TRI, tableLevel, phase + .25f);
+}
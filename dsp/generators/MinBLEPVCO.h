@@ -23,6 +23,7 @@ namespace std {
 #include "SqMath.h"
 
 #include "AudioMath.h"
+#include "MipMapWaveTables.h"
 #include "ObjectCache.h"
 
 #include <functional>
@@ -69,6 +70,7 @@ public:
         const float sawCorrect = -4.6125;
         sawDCComp = normalizedFreq * sawCorrect;
         evenDCComp = 2 * sawDCComp;
+        tableLevel = MipMapWaveTables::levelFor(normalizedFreq);
     }
 
     void setWaveform(Waveform);
@@ -90,6 +92,15 @@ public:
         syncEnabled = f;
     }
 
+    /**
+     * In lite mode saw, square, tri and even come from band-limited
+     * wavetables instead of MinBLEP. Sync is not band-limited in this mode.
+     */
+    void setLite(bool f)
+    {
+        lite = f;
+    }
+
 private:
     using MinBlep = ::rack::dsp::MinBlepGenerator<16, 32>;
 
@@ -112,6 +123,9 @@ private:
     */
 
     std::shared_ptr<LookupTableParams<float>> sinLookup = {ObjectCache<float>::getSinLookup()};
+    std::shared_ptr<MipMapWaveTables> waveTables = {MipMapWaveTables::get()};
+    int tableLevel = 0;
+    bool lite = false;
 
     /** Whether we are past the pulse width already */
     bool halfPhase = false;
@@ -134,6 +148,7 @@ private:
     void step_sq();
     void step_sin();
     void step_tri();
+    void step_lite();
 
     /**
      * input = phase, 0..1
@@ -188,10 +203,10 @@ inline void MinBLEPVCO::step()
     // call the dedicated dispatch routines for the special case waveforms.
     switch (waveform) {
         case  Waveform::Saw:
-            step_saw();
+            lite ? step_lite() : step_saw();
             break;
         case  Waveform::Square:
-            step_sq();
+            lite ? step_lite() : step_sq();
             break;
         case  Waveform::Sin:
             step_sin();
@@ -201,11 +216,11 @@ inline void MinBLEPVCO::step()
             if (syncEnabled) {
                 step_sin();
             } else {
-                step_tri();
+                lite ? step_lite() : step_tri();
             }
             break;
         case  Waveform::Even:
-            step_even();
+            lite ? step_lite() : step_even();
             break;
         case Waveform::END:
             output = 0;
@@ -514,6 +529,55 @@ inline void MinBLEPVCO::step_even()
     gotSyncCallback = false;
 }
 
+inline void MinBLEPVCO::step_lite()
+{
+    phase += normalizedFreq;
+
+    // sync and wrap are the same as the MinBLEP versions, but
+    // without the bleps there is nothing to do at the edges.
+    bool sendSync = false;
+    float crossing = 0;
+    if (gotSyncCallback) {
+        const float excess = -syncCallbackCrossing * normalizedFreq;
+        phase = (waveform == Waveform::Even) ? .5f + excess : excess;
+        crossing = syncCallbackCrossing;
+        sendSync = true;
+    }
+    if (phase >= 1.0f) {
+        phase -= 1.0f;
+        if (!sendSync) {
+            crossing = -phase / normalizedFreq;
+            sendSync = true;
+        }
+    }
+    if (sendSync && syncCallback) {
+        syncCallback(crossing);
+    }
+    gotSyncCallback = false;
+
+    using Wave = MipMapWaveTables::Waveform;
+    switch (waveform) {
+        case Waveform::Saw:
+            output = 5.0f * waveTables->lookup(Wave::SAW, tableLevel, phase);
+            break;
+        case Waveform::Square:
+            // difference of two saws is a pulse with no DC, so it doesn't need pulseDCComp like step_sq
+            output = 5.0f * (waveTables->lookup(Wave::SAW, tableLevel, phase) -
+                waveTables->lookup(Wave::SAW, tableLevel, phase - pulseWidth));
+            break;
+        case Waveform::Tri:
+            // step_tri peaks at phase zero
+            output = 5.0f * waveTables->lookup(Wave::TRI, tableLevel, phase + .25f);
+            break;
+        case Waveform::Even:
+            // shifted by half a cycle, since evenLook uses -cos
+            output = 5.0f * 0.55f * waveTables->lookup(Wave::EVEN, tableLevel, phase + .5f);
+            break;
+        default:
+            assert(false);
+    }
+}
+
 #if defined(_MSC_VER)
 #pragma warning (pop)
 #endif
@@ -0,0 +1,92 @@
+
+#include "MipMapWaveTables.h"
+
+std::weak_ptr<MipMapWaveTables> MipMapWaveTables::instance;
+
+std::shared_ptr<MipMapWaveTables> MipMapWaveTables::get()
+{
+    std::shared_ptr<MipMapWaveTables> ret = instance.lock();
+    if (!ret) {
+        ret = std::make_shared<MipMapWaveTables>();
+        instance = ret;
+    }
+    return ret;
+}
+
+MipMapWaveTables::MipMapWaveTables() : data(int(Waveform::END) * numLevels * tableSize * 2)
+{
+    for (int i = 0; i < int(Waveform::END); ++i) {
+        make(Waveform(i));
+    }
+}
+
+/**
+ * Fourier series of each waveform.
+ * Returns the amplitude of harmonic h, and sets isCos if it's a cosine term.
+ */
+static double getHarmonic(MipMapWaveTables::Waveform wf, int h, bool& isCos)
+{
+    const double pi = 3.141592653589793238;
+    const bool isOdd = (h % 2) != 0;
+    isCos = false;
+    switch (wf) {
+        case MipMapWaveTables::Waveform::SAW:
+            return -2 / (pi * h);
+        case MipMapWaveTables::Waveform::SQUARE:
+            return isOdd ? 4 / (pi * h) : 0;
+        case MipMapWaveTables::Waveform::TRI:
+            if (!isOdd) {
+                return 0;
+            }
+            return ((h % 4) == 1 ? 8 : -8) / (pi * pi * h * h);
+        case MipMapWaveTables::Waveform::EVEN:
+            // fundamental is a cosine, the rest is a saw at 2X
+            if (h == 1) {
+                isCos = true;
+                return 1.27;
+            }
+            return isOdd ? 0 : -4 / (pi * h);
+        case MipMapWaveTables::Waveform::END:
+        default:
+            assert(false);
+            return 0;
+    }
+}
+
+void MipMapWaveTables::make(Waveform wf)
+{
+    // Add the harmonics in one at a time, saving a copy at the end of each octave.
+    // Integer phase indexing into a sine table keeps this exact and fast.
+    std::vector<double> sinTable(tableSize);
+    for (int i = 0; i < tableSize; ++i) {
+        sinTable[i] = std::sin(2 * 3.141592653589793238 * i / tableSize);
+    }
+
+    std::vector<double> accumulator(tableSize, 0.0);
+    int harmonic = 1;
+    for (int level = 0; level < numLevels; ++level) {
+        const int topHarmonic = 1 << level;
+        for (; harmonic <= topHarmonic; ++harmonic) {
+            bool isCos = false;
+            const double amplitude = getHarmonic(wf, harmonic, isCos);
+            if (amplitude == 0) {
+                continue;
+            }
+            int index = isCos ? tableSize / 4 : 0;
+            for (int i = 0; i < tableSize; ++i) {
+                accumulator[i] += amplitude * sinTable[index];
+                index += harmonic;
+                if (index >= tableSize) {
+                    index -= tableSize;
+                }
+            }
+        }
+
+        float* table = getTable(wf, level);
+        for (int i = 0; i < tableSize; ++i) {
+            const double next = accumulator[(i + 1) % tableSize];
+            table[2 * i] = float(accumulator[i]);
+            table[2 * i + 1] = float(next - accumulator[i]);
+        }
+    }
+}
@@ -0,0 +1,140 @@
+#pragma once
+
+#include "simd.h"
+#include "SimdBlocks.h"
+
+#include <assert.h>
+#include <algorithm>
+#include <cmath>
+#include <smmintrin.h>
+#include <memory>
+#include <vector>
+
+/**
+ * Band-limited wavetables for the "lite" quality mode of the VCOs.
+ *
+ * Each waveform is stored at several mip levels, one per octave. Level n
+ * holds the first 2**n harmonics, so at any pitch we can pick a table
+ * whose top harmonic is still below Nyquist. This is much cheaper than
+ * MinBLEP - no discontinuity detection, no blep buffers, just an
+ * interpolated table lookup. The price is that the top octave of the
+ * spectrum is missing for some pitches, and hard sync will alias.
+ *
+ * All the waveforms are -1..1 and have a period of 1:
+ *      SAW is the ramp 2 * frac(x) - 1, falling at x == 0.
+ *      SQUARE is +1 for the first half of the cycle, -1 for the second.
+ *      TRI is in sine phase, +1 at .25 and -1 at .75.
+ *      EVEN is the EvenVCO even waveform: a saw at twice the frequency, plus 1.27 * cos.
+ *
+ * The tables are shared by all the oscillators. Like ObjectCache, we only
+ * hold a weak pointer, so they go away when the last VCO using them does.
+ */
+class MipMapWaveTables
+{
+public:
+    enum class Waveform
+    {
+        SAW,
+        SQUARE,
+        TRI,
+        EVEN,
+        END     // just a marker
+    };
+
+    static const int tableSize = 2048;
+    static const int numLevels = 10;
+
+    static std::shared_ptr<MipMapWaveTables> get();
+
+    /**
+     * Which mip level to use at normalizedFreq (freq / sampleRate).
+     * Picks the level with the most harmonics that will not alias.
+     */
+    static int levelFor(float normalizedFreq);
+    static int32_4 levelFor(float_4 normalizedFreq);
+
+    /**
+     * phase may be anywhere. Only the fractional part is used.
+     */
+    float lookup(Waveform, int level, float phase) const;
+    float_4 lookup(Waveform, int32_4 level, float_4 phase) const;
+
+    /**
+     * Returns the table for one waveform at one level.
+     * It's tableSize (value, slope) pairs, like LookupTableParams.
+     */
+    const float* _getTable(Waveform wf, int level) const;
+
+    MipMapWaveTables();
+private:
+    std::vector<float> data;
+
+    static std::weak_ptr<MipMapWaveTables> instance;
+
+    void make(Waveform);
+    float* getTable(Waveform wf, int level);
+};
+
+inline int MipMapWaveTables::levelFor(float normalizedFreq)
+{
+    // top harmonic at level n is 2**n, we need 2**n * freq <= .5
+    int exponent = 0;
+    std::frexp(.5f / std::max(normalizedFreq, 1e-6f), &exponent);
+    return std::max(0, std::min(numLevels - 1, exponent - 1));
+}
+
+inline int32_4 MipMapWaveTables::levelFor(float_4 normalizedFreq)
+{
+    // same as the scalar version, but get the exponent from the float bits
+    const float_4 ratio = float_4(.5f) / SimdBlocks::max(normalizedFreq, float_4(1e-6f));
+    __m128i exponent = _mm_sub_epi32(_mm_srli_epi32(_mm_castps_si128(ratio.v), 23), _mm_set1_epi32(127));
+    exponent = _mm_min_epi32(exponent, _mm_set1_epi32(numLevels - 1));
+    exponent = _mm_max_epi32(exponent, _mm_setzero_si128());
+    return exponent;
+}
+
+inline const float* MipMapWaveTables::_getTable(Waveform wf, int level) const
+{
+    assert(wf < Waveform::END);
+    assert(level >= 0 && level < numLevels);
+    return data.data() + (int(wf) * numLevels + level) * tableSize * 2;
+}
+
+inline float* MipMapWaveTables::getTable(Waveform wf, int level)
+{
+    return const_cast<float*>(_getTable(wf, level));
+}
+
+inline float MipMapWaveTables::lookup(Waveform wf, int level, float phase) const
+{
+    phase -= std::floor(phase);
+    const float x = phase * tableSize;
+    const int index = std::min(int(x), tableSize - 1);
+    const float frac = x - index;
+    const float* entry = _getTable(wf, level) + 2 * index;
+    return entry[0] + frac * entry[1];
+}
+
+inline float_4 MipMapWaveTables::lookup(Waveform wf, int32_4 level, float_4 phase) const
+{
+    phase -= rack::simd::floor(phase);
+    const float_4 x = phase * float(tableSize);
+    const __m128i index = _mm_cvttps_epi32(rack::simd::fmin(x, float_4(tableSize - 1)).v);
+    const float_4 frac = x - float_4(_mm_cvtepi32_ps(index));
+
+    // offset of each entry from the start of level zero, in floats
+    static_assert(tableSize == (1 << 11), "shifts below assume table size");
+    alignas(16) int32_t offset[4];
+    _mm_store_si128((__m128i*)offset, _mm_slli_epi32(_mm_add_epi32(_mm_slli_epi32(level.v, 11), index), 1));
+
+    // Gather two floats for each lane, same as LookupTable<float>::lookupSimd
+    const float* entries = _getTable(wf, 0);
+    __m128 e01 = _mm_loadl_pi(_mm_setzero_ps(), (const __m64*)(entries + offset[0]));
+    e01 = _mm_loadh_pi(e01, (const __m64*)(entries + offset[1]));
+    __m128 e23 = _mm_loadl_pi(_mm_setzero_ps(), (const __m64*)(entries + offset[2]));
+    e23 = _mm_loadh_pi(e23, (const __m64*)(entries + offset[3]));
+
+    const float_4 y = _mm_shuffle_ps(e01, e23, _MM_SHUFFLE(2, 0, 2, 0));
+    const float_4 slope = _mm_shuffle_ps(e01, e23, _MM_SHUFFLE(3, 1, 3, 1));
+    return y + frac * slope;
+}
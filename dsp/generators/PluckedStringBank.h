@@ -0,0 +1,264 @@
+#pragma once
+
+#include "AudioMath.h"
+#include "simd.h"
+#include "SimdBlocks.h"
+
+#include <assert.h>
+#include <algorithm>
+#include <functional>
+#include <vector>
+
+/**
+ * Four Karplus-Strong plucked strings, one in each float_4 lane.
+ *
+ * This does the same job as four RecirculatingFractionalDelays, but:
+ *      The delay lines are a power of two long, so wrapping is just a mask.
+ *      Each line has a few guard samples after the end that mirror the start,
+ *          so the four taps for the interpolator are always one unaligned load.
+ *      The cubic (Lagrange) interpolation is done in float, for four strings at once.
+ *      The damping filter is inlined - there is no virtual processFeedback.
+ *
+ * The loop filter is a two point weighted average, then the feedback gain:
+ *      y = feedback * ((1 - damping) * x + damping * x[n-1])
+ * damping of zero does nothing, .5 is the classic Karplus-Strong average.
+ * The averager adds damping samples of delay to the loop, so we take that
+ * out of the delay line to keep the string in tune.
+ */
+class PluckedStringBank
+{
+public:
+    /**
+     * maxDelaySamples is the longest period we need to play, in samples.
+     * It gets rounded up to a power of two.
+     */
+    PluckedStringBank(int maxDelaySamples = 2048)
+    {
+        setMaxDelay(maxDelaySamples);
+    }
+
+    /**
+     * Allocates room for strings up to maxDelaySamples long,
+     * so later calls to setMaxDelay that fit don't allocate.
+     * Don't call it from the audio thread.
+     */
+    void reserve(int maxDelaySamples);
+
+    /**
+     * Clears out all the strings.
+     * Only allocates if maxDelaySamples doesn't fit in what was reserved.
+     */
+    void setMaxDelay(int maxDelaySamples);
+
+    /**
+     * Tune all four strings. normalizedFreq is freq / sampleRate.
+     * Since the damping filter affects tuning, call this after setDamping.
+     */
+    void setFreq(float_4 normalizedFreq);
+
+    /**
+     * 0 (bright) .. .5 (classic KS)
+     */
+    void setDamping(float_4);
+
+    /**
+     * Loop gain for one trip around the delay line. 0..1
+     */
+    void setFeedback(float_4);
+
+    /**
+     * Fill one string with a noise burst one period long.
+     * Like the original Karplus-Strong, this replaces whatever was in the string.
+     */
+    void pluck(int lane, float level);
+
+    /**
+     * excitation is added into the delay lines. It's fine to leave it at zero and
+     * only use pluck. Returns the output of each string.
+     */
+    float_4 process(float_4 excitation);
+
+    int _getLength() const
+    {
+        return length;
+    }
+
+    float_4 _getDelay() const
+    {
+        return delay;
+    }
+
+    const float* _getMemory() const
+    {
+        return memory.data();
+    }
+
+private:
+    // enough to let the four tap load run past the end of a line
+    static const int guardSamples = 4;
+
+    int length = 0;
+    int mask = 0;
+    int writeIndex = 0;
+
+    /**
+     * Four delay lines, one after the other. Each is length + guardSamples long.
+     */
+    std::vector<float> memory;
+
+    // scratch for pluck, so it doesn't allocate
+    std::vector<float> burst;
+
+    float_4 delay = 2;
+    float_4 damping = 0;
+    float_4 feedback = 0;
+    float_4 lastOutput = 0;
+
+    AudioMath::RandomUniformFunc random = AudioMath::random();
+
+    float* line(int lane)
+    {
+        return memory.data() + lane * (length + guardSamples);
+    }
+    void write(int lane, int index, float value);
+    static int lineLength(int maxDelaySamples);
+};
+
+inline int PluckedStringBank::lineLength(int maxDelaySamples)
+{
+    // room for the cubic interpolator taps on either side
+    const int needed = maxDelaySamples + 4;
+    int ret = 1;
+    while (ret < needed) {
+        ret *= 2;
+    }
+    return ret;
+}
+
+inline void PluckedStringBank::reserve(int maxDelaySamples)
+{
+    const int maxLength = lineLength(maxDelaySamples);
+    const size_t size = 4 * (maxLength + guardSamples);
+    if (memory.size() < size) {
+        memory.resize(size);
+    }
+    if (int(burst.size()) < maxLength) {
+        burst.resize(maxLength);
+    }
+}
+
+inline void PluckedStringBank::setMaxDelay(int maxDelaySamples)
+{
+    length = lineLength(maxDelaySamples);
+    mask = length - 1;
+    writeIndex = 0;
+    reserve(maxDelaySamples);
+
+    // the lines are packed at the start of memory, whatever was reserved
+    std::fill(memory.begin(), memory.begin() + 4 * (length + guardSamples), 0.f);
+    lastOutput = 0;
+    setFreq(float_4(0));
+}
+
+inline void PluckedStringBank::setDamping(float_4 x)
+{
+    damping = rack::simd::clamp(x, float_4(0), float_4(.5f));
+}
+
+inline void PluckedStringBank::setFeedback(float_4 x)
+{
+    feedback = rack::simd::clamp(x, float_4(0), float_4(1));
+}
+
+inline void PluckedStringBank::setFreq(float_4 normalizedFreq)
+{
+    // The longest period we can play - leave room for the taps past the end.
+    const float maxDelay = float(length - 3);
+    const float_4 period = float_4(1) / SimdBlocks::max(normalizedFreq, float_4(1.f / maxDelay));
+
+    // we need one sample in front of the interpolator
+    delay = rack::simd::clamp(period - damping, float_4(2), float_4(maxDelay));
+}
+
+inline void PluckedStringBank::write(int lane, int index, float value)
+{
+    float* p = line(lane);
+    p[index] = value;
+    if (index < guardSamples) {
+        p[index + length] = value;
+    }
+}
+
+inline void PluckedStringBank::pluck(int lane, float level)
+{
+    assert(lane >= 0 && lane < 4);
+    // Everything the interpolator will read for the next period.
+    // The averager passes DC forever, so take the mean of the part that
+    // recirculates out of the burst. Otherwise short strings can
+    // end up sitting on an offset.
+    const int period = int(delay[lane]);
+    const int samples = period + 3;
+    float* noise = burst.data();
+    float mean = 0;
+    for (int i = 0; i < samples; ++i) {
+        noise[i] = 2 * float(random()) - 1;
+        if (i < period) {
+            mean += noise[i];
+        }
+    }
+    mean /= period;
+    for (int i = 0; i < samples; ++i) {
+        write(lane, (writeIndex - 1 - i) & mask, level * (noise[i] - mean));
+    }
+}
+
+inline float_4 PluckedStringBank::process(float_4 excitation)
+{
+    const __m128i delayInt = _mm_cvttps_epi32(delay.v);
+    const float_4 x = delay - float_4(_mm_cvtepi32_ps(delayInt));
+
+    // The sample at writeIndex - n is n samples old. We need samples
+    // delayInt - 1 .. delayInt + 2 old, and the oldest comes first in memory.
+    alignas(16) int32_t start[4];
+    const __m128i first = _mm_sub_epi32(_mm_set1_epi32(writeIndex - 2), delayInt);
+    _mm_store_si128((__m128i*)start, _mm_and_si128(first, _mm_set1_epi32(mask)));
+
+    // each load is the four taps for one string, so transpose
+    // to get each tap for all four strings
+    __m128 y3 = _mm_loadu_ps(line(0) + start[0]);
+    __m128 y2 = _mm_loadu_ps(line(1) + start[1]);
+    __m128 y1 = _mm_loadu_ps(line(2) + start[2]);
+    __m128 y0 = _mm_loadu_ps(line(3) + start[3]);
+    _MM_TRANSPOSE4_PS(y3, y2, y1, y0);
+
+    // same Lagrange cubic as FractionalDelay::getOutput: y0 at x = -1 .. y3 at x = 2
+    const float_4 xm1 = x - float_4(1);
+    const float_4 xm2 = x - float_4(2);
+    const float_4 xp1 = x + float_4(1);
+    const float_4 a = x * xm1;
+    const float_4 b = xp1 * xm2;
+    const float_4 output =
+        float_4(y0) * a * xm2 * float_4(-1.f / 6.f) +
+        float_4(y1) * b * xm1 * float_4(.5f) +
+        float_4(y2) * b * x * float_4(-.5f) +
+        float_4(y3) * a * xp1 * float_4(1.f / 6.f);
+
+    const float_4 filtered = feedback * (output + damping * (lastOutput - output));
+    lastOutput = output;
+
+    alignas(16) float input[4];
+    _mm_store_ps(input, (filtered + excitation).v);
+    const int stride = length + guardSamples;
+    float* p = memory.data() + writeIndex;
+    p[0] = input[0];
+    p[stride] = input[1];
+    p[2 * stride] = input[2];
+    p[3 * stride] = input[3];
+    if (writeIndex < guardSamples) {
+        for (int lane = 0; lane < 4; ++lane) {
+            p[lane * stride + length] = input[lane];
+        }
+    }
+    writeIndex = (writeIndex + 1) & mask;
+    return output;
+}
@@ -9,6 +9,7 @@
 #if 1
 #include "simd.h"
 #include "SimdBlocks.h"
+#include "MipMapWaveTables.h"
 
 using namespace rack;		// normally I don't like "using", but this is third party code...
 extern bool _logvco;
@@ -37,6 +38,15 @@ public:
 	void setupSub(int channels, T pitch, I subDivisorA, I subDivisorB);
 
 	void process(float deltaTime, T syncValue);
+
+	/**
+	 * In lite mode the waveforms come from band-limited wavetables
+	 * instead of MinBLEP. Call computeOffsetCorrection after changing it.
+	 */
+	void setLite(bool b) {
+		lite = b;
+	}
+
 	T main() const {
 		//printf("main=%f off=%f, comb=%f\n", mainValue, mainDCOffset, mainValue + mainDCOffset);
 		return mainValue + mainDCOffset;
@@ -83,6 +93,11 @@ private:
 	T subDCOffset[2] = {};
 
 	bool syncEnabled = false;
+	bool lite = false;
+
+	std::shared_ptr<MipMapWaveTables> waveTables = {MipMapWaveTables::get()};
+	I mainLevel = 0;
+	I subLevel[2] = {I(0), I(0)};
 
 	T lastSyncValue = 0.f;
 	T mainPhase = 0.f;
@@ -93,6 +108,9 @@ private:
 
 	static T saw(T phase, T minBlepValue);
 	static T sqr(T phase, T minBlepValue, T pwValue);
+	T tableValue(T isSaw, I level, T phase) const;
+	void processLite(float deltaTime);
+	bool stepSubCounter(int subIndex, int channelNumber);
 	void doSquareLowToHighMinblep(T deltaPhase, T phase, T notSaw, MinBlep& minBlep, int id) const;
 };
 
@@ -150,6 +168,17 @@ inline void VoltageControlledOscillator<OV, Q, T, I>::setWaveform(T mainSaw, T s
 template <int OV, int Q, typename T, typename I>
 inline void VoltageControlledOscillator<OV, Q, T, I>::computeOffsetCorrection(float sampleTime)
 {
+	mainLevel = MipMapWaveTables::levelFor(freq * sampleTime);
+	subLevel[0] = MipMapWaveTables::levelFor(subFreq[0] * sampleTime);
+	subLevel[1] = MipMapWaveTables::levelFor(subFreq[1] * sampleTime);
+	if (lite) {
+		// wavetables have no blep delay, and the pulse is already DC free
+		mainDCOffset = 0;
+		subDCOffset[0] = 0;
+		subDCOffset[1] = 0;
+		return;
+	}
+
 	const float sawCorrect = 5.698f * sampleTime * -1;
 	const T pwCorrect((pulseWidth * 2)- 1);
 	mainDCOffset = SimdBlocks::ifelse(mainIsSaw, sawCorrect * freq, pwCorrect );
@@ -188,6 +217,10 @@ template <int OV, int Q, typename T, typename I>
 inline void VoltageControlledOscillator<OV, Q, T, I>::process(float deltaTime, T syncValue)
 {
 	assert(_channels > 0);
+	if (lite) {
+		processLite(deltaTime);
+		return;
+	}
 
 	// compute delta phase for this processing tick
 	// TODO: do we need to do all this clamping every time?
@@ -271,27 +304,12 @@ inline void VoltageControlledOscillator<OV, Q, T, I>::process(float deltaTime, T
 				mainMinBlep.insertDiscontinuity(p, x);
 
 				for (int subIndex = 0; subIndex <= 1; ++subIndex) {
-					assertGT(subCounter[subIndex][channelNumber], 0);
-					subCounter[subIndex][channelNumber]--;
-					if (subCounter[subIndex][channelNumber] == 0) {
-						subCounter[subIndex][channelNumber] = subDivisionAmount[subIndex][channelNumber];
-
+					if (stepSubCounter(subIndex, channelNumber)) {
 						// note: this value of "2" is a little inaccurate for subs.
 						// almost the same at low-normal freq
 						// this is perfect for saw
 						//	T xs = crossingMask & ((-2.f ) * subPhase[subIndex]);
 					 	T xs = crossingMask & T(-2.f);
-#if 1	// new, clean way
-						{
-							const float temp = mainPhase[channelNumber];
-							const float divisor = float(subDivisionAmount[subIndex][channelNumber]);
-							const float newPhase = temp / divisor;
-							subPhase[subIndex][channelNumber] = newPhase;
-
-						} 
-#else
-						subPhase[subIndex][channelNumber] = 0;
-#endif
 						subMinBlep[subIndex].insertDiscontinuity(p, xs);
 					}
 				}
@@ -330,6 +348,71 @@ inline void VoltageControlledOscillator<OV, Q, T, I>::process(float deltaTime, T
 	simd_assertLT(mainPhase, float_4(1.5));
 }
 
+/**
+ * Called when the main VCO wraps. Counts down the sub divider, and
+ * re-syncs the sub phase when it runs out.
+ * returns true if the sub re-synced.
+ */
+template <int OV, int Q, typename T, typename I>
+inline bool VoltageControlledOscillator<OV, Q, T, I>::stepSubCounter(int subIndex, int channelNumber)
+{
+	assertGT(subCounter[subIndex][channelNumber], 0);
+	subCounter[subIndex][channelNumber]--;
+	if (subCounter[subIndex][channelNumber] != 0) {
+		return false;
+	}
+	subCounter[subIndex][channelNumber] = subDivisionAmount[subIndex][channelNumber];
+
+	const float temp = mainPhase[channelNumber];
+	const float divisor = float(subDivisionAmount[subIndex][channelNumber]);
+	const float newPhase = temp / divisor;
+	subPhase[subIndex][channelNumber] = newPhase;
+	return true;
+}
+
+/**
+ * Same as process, but everything comes from the wavetables.
+ * No bleps, so no need to find where the edges are.
+ */
+template <int OV, int Q, typename T, typename I>
+inline void VoltageControlledOscillator<OV, Q, T, I>::processLite(float deltaTime)
+{
+	const T deltaPhase = simd::clamp(freq * deltaTime, 1e-6f, 0.35f);
+	mainPhase += deltaPhase;
+	subPhase[0] += simd::clamp(subFreq[0] * deltaTime, 1e-6f, 0.35f);
+	subPhase[1] += simd::clamp(subFreq[1] * deltaTime, 1e-6f, 0.35f);
+
+	const int wrapMask = simd::movemask(mainPhase >= T(1));
+	mainPhase -= simd::floor(mainPhase);
+	if (wrapMask) {
+		for (int channelNumber = 0; channelNumber < _channels; channelNumber++) {
+			if (wrapMask & (1 << channelNumber)) {
+				stepSubCounter(0, channelNumber);
+				stepSubCounter(1, channelNumber);
+			}
+		}
+	}
+	wrapVCOPhase<T>(subPhase[0]);
+	wrapVCOPhase<T>(subPhase[1]);
+
+	mainValue = tableValue(mainIsSaw, mainLevel, mainPhase);
+	subValue[0] = tableValue(subIsSaw, subLevel[0], subPhase[0]);
+	subValue[1] = tableValue(subIsSaw, subLevel[1], subPhase[1]);
+}
+
+template <int OV, int Q, typename T, typename I>
+inline T VoltageControlledOscillator<OV, Q, T, I>::tableValue(T isSaw, I level, T phase) const
+{
+	// The difference of two saws is a pulse. Both saws have no DC, so neither
+	// does the pulse. That's why computeOffsetCorrection zeroes the offsets here.
+	const T saw = waveTables->lookup(MipMapWaveTables::Waveform::SAW, level, phase);
+	if (simd::movemask(isSaw) == 0xf) {
+		return saw;
+	}
+	const T saw2 = waveTables->lookup(MipMapWaveTables::Waveform::SAW, level, phase - pulseWidth);
+	return SimdBlocks::ifelse(isSaw, saw, saw - saw2);
+}
+
 template <int OV, int Q, typename T, typename I>
 inline T VoltageControlledOscillator<OV, Q, T, I>::saw(T phase, T blepValue)
 {
@@ -4,6 +4,7 @@
 #include "IIRDecimator.h"
 #include "IIRUpsampler.h"
 #include "SimdBlocks.h"
+#include "SimdDispatch.h"
 #include "simd.h"
 #include "asserts.h"
 
@@ -87,6 +88,20 @@ public:
         }
 #endif
        // WARN("in dsp step, ove=%d",  oversampleFM);
+        if (canUseSinBlock(oversampleFM)) {
+            SimdDispatch::SinDecimateBank bank;
+            prepareSinBlock(bank, syncValue);
+            SimdDispatch::kernels().sinDecimate(&bank, 1, getSinBlockTaps(), oversampleRate);
+            return finishSinBlock();
+        }
+        return stepGeneric(syncValue, oversampleFM);
+    }
+
+    /**
+     * The float_4 path that step() uses for everything the sin block can't do.
+     * Works for any waveform, so tests use it as the reference for the sin block kernels.
+     */
+    inline float_4 stepGeneric(float_4 syncValue, bool oversampleFM) {
         int32_4 syncIndex = int32_t(-1);  // Index in the oversample loop where sync occurs [0, OVERSAMPLE)
         doSync(syncValue, syncIndex);
 
@@ -119,6 +134,59 @@ public:
         }
     }
 
+    /**
+     * Sine and fold without oversampled FM don't depend on the previous
+     * oversampled output, so we can generate all the phases first, then let
+     * the fastest available kernel do the sin, fold, and decimation.
+     * A composite may gather up all its banks and run the kernel once.
+     * Same results as step().
+     */
+    bool canUseSinBlock(bool oversampleFM) const {
+        return !oversampleFM && (waveform == WaveForm::Sine || waveform == WaveForm::Fold);
+    }
+
+    void prepareSinBlock(SimdDispatch::SinDecimateBank& bank, float_4 syncValue) {
+        int32_4 syncIndex = int32_t(-1);
+        doSync(syncValue, syncIndex);
+
+        const float_4 modulation = (feedback * lastOutput) + fmInput;
+        const float_4 twoPi(2 * 3.141592653589793238f);
+        for (int i = 0; i < oversampleRate; ++i) {
+            const float_4 syncNow = float_4(syncIndex) == float_4::zero();
+            simd_assertMask(syncNow);
+            if (!this->setFZero) {
+                phaseAcc += normalizedFreq;
+            }
+            if (this->doFMEnabled) {
+                phaseAcc += (modulation * float_4(.01));
+            }
+            phaseAcc = SimdBlocks::wrapPhase01(phaseAcc);
+            phaseAcc = SimdBlocks::ifelse(syncNow, float_4::zero(), phaseAcc);
+
+            float_4 phase = phaseAcc;
+            if (!this->doFMEnabled) {
+                phase = SimdBlocks::wrapPhase01(phaseAcc + modulation);
+            }
+            buffer[i] = phase * twoPi;
+            syncIndex -= int32_t(1);
+        }
+
+        bank.buffer = &buffer[0][0];
+        bank.foldGain = (waveform == WaveForm::Fold) ? &correctedWaveShapeMultiplier[0] : nullptr;
+        bank.state = &downsampler._getState().data()[0][0];
+        bank.output = &sinBlockOutput[0];
+    }
+
+    float_4 finishSinBlock() {
+        float_4 finalSample = sinBlockOutput + waveformOffset;
+        lastOutput = finalSample;
+        return finalSample * outputLevel;
+    }
+
+    const float* getSinBlockTaps() const {
+        return &downsampler._getParams().taps()[0][0];
+    }
+
     // Modulation may be phase modulation or freq modulation
     // but if oversampled will not include feedback.
     inline void stepOversampled(int bufferIndex, const float_4 baseModulation, float_4 syncNow, bool oversampledFM) {
@@ -186,7 +254,7 @@ public:
     float_4 normalizedFreq = float_4::zero();
     float_4 fmInput = float_4::zero();
 
-    WaveForm waveform;
+    WaveForm waveform = WaveForm::Sine;
     float_4 correctedWaveShapeMultiplier = 1;
 
     float_4 aRight = 0;  // y = ax + b for second half of tri
@@ -198,6 +266,7 @@ public:
 
 private:
     float_4 phaseAcc = float_4::zero();
+    float_4 sinBlockOutput = float_4::zero();
     float_4 lastSyncValue = float_4::zero();
     IIRDecimator<float_4> downsampler;
     IIRUpsampler<float_4> upsampler;
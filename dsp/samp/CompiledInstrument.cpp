@@ -177,8 +177,20 @@ void CompiledInstrument::getGain(VoicePlayInfo& info, int midiVelocity, float re
     info.gain = velToGain(midiVelocity, regionVeltrack) * regionGainMult;
 }
 
+void CompiledInstrument::getPlayPitch(VoicePlayInfo& info, int midiPitch, const CompiledRegion* region, WaveLoader* loader, float sampleRate) {
+    if (region->loopData.oscillator) {
+        getPlayPitchOsc(info, midiPitch, region->tune, loader, sampleRate);
+    } else {
+        getPlayPitchNorm(info, midiPitch, region->keycenter, region->tune, loader, sampleRate);
+    }
+}
+
 void CompiledInstrument::getPlayPitchOsc(VoicePlayInfo& info, int midiPitch, int tuneCents, WaveLoader* loader, float sampleRate) {
     //   float transpose = 261.626f * waveInfo->getTotalFrameCount() / sampleRate;
+    if (!loader || !loader->isReady(info.sampleIndex)) {
+        info.transposeV = 0;
+        return;
+    }
     auto waveInfo = loader->getInfo(info.sampleIndex);
     const float baseFreq = sampleRate / waveInfo->getTotalFrameCount();
 
@@ -215,7 +227,8 @@ void CompiledInstrument::getPlayPitchNorm(VoicePlayInfo& info, int midiPitch, in
 #endif
     }
 
-    if (!loader) {
+    // if the sample isn't loaded yet we don't know its sample rate. It won't play this time, anyway.
+    if (!loader || !loader->isReady(info.sampleIndex)) {
         return;
     }
 
@@ -240,7 +253,7 @@ bool CompiledInstrument::play(VoicePlayInfo& info, const VoicePlayParameter& par
         return playTestMode(info, params, loader, sampleRate);
     }
     info.valid = false;
-    float r = rand();
+    float r = random.uniform();
 
     bool didKS = false;
     const CompiledRegion* region = regionPool.play(params, r, didKS);
@@ -250,11 +263,8 @@ bool CompiledInstrument::play(VoicePlayInfo& info, const VoicePlayParameter& par
         info.sampleIndex = region->sampleIndex;
         info.valid = true;
         info.ampeg_release = region->ampeg_release;
-        if (region->loopData.oscillator) {
-            getPlayPitchOsc(info, params.midiPitch, region->tune, loader, sampleRate);
-        } else {
-            getPlayPitchNorm(info, params.midiPitch, region->keycenter, region->tune, loader, sampleRate);
-        }
+        info.region = region;
+        getPlayPitch(info, params.midiPitch, region, loader, sampleRate);
         getGain(info, params.midiVelocity, region->amp_veltrack, region->volume);
         info.loopData = region->loopData;
     } else {
@@ -322,6 +332,23 @@ void CompiledInstrument::setWaves(WaveLoaderPtr loader, const FilePath& rootPath
     }
 }
 
+void CompiledInstrument::getSamplePitches(std::vector<int>& pitches) {
+    pitches.assign(relativeFilePaths.size(), -1);
+    regionPool.visitRegions([&pitches](CompiledRegion* region) {
+        const int index = region->sampleIndex - 1;
+        if (index >= 0 && index < int(pitches.size()) && pitches[index] < 0) {
+            pitches[index] = (region->lokey + region->hikey) / 2;
+        }
+    });
+
+    // samples that no region plays go last
+    for (int& pitch : pitches) {
+        if (pitch < 0) {
+            pitch = 1000;
+        }
+    }
+}
+
 void CompiledInstrument::expandAllKV(SamplerErrorContext& err, SInstrumentPtr inst) {
     assert(!inst->wasExpanded);
 
@@ -5,6 +5,7 @@
 #include <string>
 #include <vector>
 
+#include "CounterRandom.h"
 #include "FilePath.h"
 //#include "PitchSwitch.h"
 #include "RegionPool.h"
@@ -87,6 +88,12 @@ public:
      */
     void setWaves(WaveLoaderPtr waveLoader, const FilePath& rootPath);
 
+    /**
+     * For each wave (in the order setWaves added them), the middle of the key range
+     * of a region that plays it. So a lazy WaveLoader knows what to load first.
+     */
+    void getSamplePitches(std::vector<int>& pitches);
+
     FilePath getDefaultPath() const { return defaultPath; }
 
     /**
@@ -104,12 +111,23 @@ public:
 
     bool isInError() const { return _isInError; }
 
+    /**
+     * The part of play() that depends on the sample data (its sample rate, or length for oscillators).
+     * When loading lazily play() may run before the sample is here, so the voice
+     * calls this again once it has loaded.
+     */
+    static void getPlayPitch(VoicePlayInfo& info, int midiPitch, const CompiledRegion* region, WaveLoader* loader, float sampleRate);
+
 private:
     RegionPool regionPool;
     Tests ciTestMode = Tests::None;
     InstrumentInfoPtr info;
 
-    AudioMath::RandomUniformFunc rand = AudioMath::random();
+    /**
+     * picks random regions. Each instrument has its own,
+     * so playing one does not change what another one picks.
+     */
+    CounterRandom random;
 
     FilePath defaultPath;
     bool _isInError = false;
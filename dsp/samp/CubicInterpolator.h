@@ -14,8 +14,6 @@ public:
     static T interpolate(const T* data, T offset);
     static T interpolate(T offset, T y0, T y1, T y2, T y3);
     static unsigned int getIntegerPart(T);
-
-private:
     static T getFloatPart(T);
 };
 
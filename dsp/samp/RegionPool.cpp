@@ -2,6 +2,9 @@
 
 #include "RegionPool.h"
 
+#include <algorithm>
+#include <map>
+
 #include "CompiledRegion.h"
 #include "HeadingTracker.h"
 #include "SInstrument.h"
@@ -11,22 +14,25 @@
 //#define _LOGOV
 
 // checks to see if the region is playable
-bool RegionPool::shouldRegionPlayNow(const VoicePlayParameter& params, const CompiledRegion* region, float random) {
-    bool passesCheck = false;
-#ifdef _SFZ_RANDOM
-    if ((params.midiVelocity >= region->lovel) &&
-        (params.midiVelocity <= region->hivel) &&
-        (random >= region->lorand) &&
-        (random <= region->hirand)) {
-        passesCheck = true;
+inline bool RegionPool::candidateMatches(const Candidate& candidate, float random) const {
+    if (!keySwitched_[candidate.region]) {
+        return false;
     }
-#else
-    if ((params.midiVelocity >= region->lovel) &&
-        (params.midiVelocity <= region->hivel)) {
-        passesCheck = true;
+    if (candidate.sequenceLength > 1 &&
+        ((sequenceCounters_[candidate.region] % candidate.sequenceLength) != candidate.sequencePosition - 1)) {
+        return false;
+    }
+#ifdef _SFZ_RANDOM
+    if ((random < candidate.lorand) || (random > candidate.hirand)) {
+        return false;
     }
 #endif
-    return passesCheck;
+    return true;
+}
+
+void RegionPool::setKeySwitched(int region, bool on) {
+    keySwitched_[region] = on;
+    regions[region]->keySwitched = on;
 }
 
 const CompiledRegion* RegionPool::play(const VoicePlayParameter& params, float random, bool& didKS) {
@@ -38,13 +44,12 @@ const CompiledRegion* RegionPool::play(const VoicePlayParameter& params, float r
     }
 
     // First the keyswitch logic from sfizz
-    if (!lastKeyswitchLists_[params.midiPitch].empty()) {
-        // printf("!lastKeyswitchLists_[%d].empty()\n", params.midiPitch);
-
+    const std::vector<int>& switchedOn = lastKeyswitchLists_[params.midiPitch];
+    if (!switchedOn.empty()) {
         if (currentSwitch_ >= 0 && currentSwitch_ != params.midiPitch) {
-            for (auto& region : lastKeyswitchLists_[currentSwitch_]) {
-                //SQINFO("setting region->keySwitched = false (turning off regions from the old keyswitch set) r=%p", region);
-                region->keySwitched = false;
+            for (int region : lastKeyswitchLists_[currentSwitch_]) {
+                //SQINFO("turning off regions from the old keyswitch set) r=%d", region);
+                setKeySwitched(region, false);
             }
         }
         currentSwitch_ = params.midiPitch;
@@ -54,32 +59,30 @@ const CompiledRegion* RegionPool::play(const VoicePlayParameter& params, float r
         didKS = false;
     }
 
-    for (auto& region : lastKeyswitchLists_[params.midiPitch]) {
-        //SQINFO("setting region keyswitched true because in lastKeySwitches");
-        region->keySwitched = true;
+    for (int region : switchedOn) {
+        setKeySwitched(region, true);
     }
 
-    // now the region search logic we always had
-    CompiledRegion* foundRegion = nullptr;
-    const CompiledRegionList& regions = noteActivationLists_[params.midiPitch];
-    for (CompiledRegion* region : regions) {
-        assert(params.midiPitch >= region->lokey);
-        assert(params.midiPitch <= region->hikey);
-        assert(region->lovel >= 0);
-        assert(region->hivel <= 127);
-
-        bool sequenceMatch = true;
-        if (region->sequenceLength > 1) {
-            sequenceMatch =
-                ((region->sequenceCounter++ % region->sequenceLength) == region->sequencePosition - 1);
-            // fprintf(stderr, "result: sw=%d ctr=%d\n", sequenceMatch, region->sequenceCounter);
-        }
+    if (velocityRows_.empty()) {
+        return nullptr;
+    }
 
-        const bool keyswitched = region->isKeyswitched();
-        if (sequenceMatch && !foundRegion && keyswitched && shouldRegionPlayNow(params, region, random)) {
-            foundRegion = region;
+    // now find the first candidate for this pitch and velocity that can play now
+    const CompiledRegion* foundRegion = nullptr;
+    const Span& span = velocityRows_[pitchToRow_[params.midiPitch]][params.midiVelocity];
+    for (int i = span.first; i < span.first + span.count; ++i) {
+        const Candidate& candidate = candidates_[i];
+        if (candidateMatches(candidate, random)) {
+            foundRegion = regions[candidate.region].get();
+            break;
         }
     }
+
+    // the round robin counter of every region at this pitch advances, whether it played or not.
+    const Span& sequences = sequenceSpans_[params.midiPitch];
+    for (int i = sequences.first; i < sequences.first + sequences.count; ++i) {
+        ++sequenceCounters_[sequenceRegions_[i]];
+    }
 #if 0
     if (foundRegion) {
         //SQINFO("play found region");
@@ -152,7 +155,6 @@ bool RegionPool::buildCompiledTree(const SInstrumentPtr in) {
         //
         if (!cReg->shouldIgnore()) {
             //SQINFO("not ignoring");
-            maybeAddToKeyswitchList(cReg);
             if (cReg->sw_default >= 0) {
                 currentSwitch_ = cReg->sw_default;
 #else
@@ -169,7 +171,6 @@ bool RegionPool::buildCompiledTree(const SInstrumentPtr in) {
                 // actually we should do our ignoreing on the region
                 if (!cReg->shouldIgnore()) {
                     //  auto cReg = std::make_shared<CompiledRegion>(reg, cGroup, group);
-                    maybeAddToKeyswitchList(cReg);
                     if (cReg->sw_default >= 0) {
                         currentSwitch_ = cReg->sw_default;
                     }
@@ -197,32 +198,104 @@ bool RegionPool::buildCompiledTree(const SInstrumentPtr in) {
     return bRet;
 }
 
-void RegionPool::maybeAddToKeyswitchList(CompiledRegionPtr region) {
-    if (region->sw_lolast >= 0 && region->sw_hilast >= region->sw_lolast) {
-        for (int pitch = region->sw_lolast; pitch <= region->sw_hilast; ++pitch) {
-            lastKeyswitchLists_[pitch].push_back(region.get());
-        }
-    }
-}
-
 void RegionPool::fillRegionLookup() {
     sortByPitchAndVelocity(regions);
     removeOverlaps();
-    assert(noteActivationLists_.size() == 128);
 
-    for (auto region : regions) {
+    // the flat per region state
+    const int numRegions = int(regions.size());
+    keySwitched_.assign(numRegions, 0);
+    sequenceCounters_.assign(numRegions, 0);
+    std::vector<int> regionsAtPitch[128];
+    for (int i = 0; i < numRegions; ++i) {
+        const CompiledRegion* region = regions[i].get();
+        keySwitched_[i] = region->keySwitched;
+        sequenceCounters_[i] = region->sequenceCounter;
+
+        if (region->sw_lolast >= 0 && region->sw_hilast >= region->sw_lolast) {
+            for (int pitch = region->sw_lolast; pitch <= std::min(region->sw_hilast, 127); ++pitch) {
+                lastKeyswitchLists_[pitch].push_back(i);
+            }
+        }
+
         const int low = region->lokey;
-        const int high = region->hikey;
+        const int high = std::min(region->hikey, 127);
         assert(high >= low);
         assert(low >= 0);
 
         // map this region to every key it contains
         // but don't do it if a crazy negative key slipped in here
         if (low >= 0) {
-            for (int i = low; i <= high; ++i) {
-                noteActivationLists_[i].push_back(region.get());
+            for (int pitch = low; pitch <= high; ++pitch) {
+                regionsAtPitch[pitch].push_back(i);
+            }
+        }
+    }
+
+    // Now make a velocity row for each different set of regions,
+    // and a run of candidates for each different set of regions at a velocity.
+    std::map<std::vector<int>, int> rowsByRegions;
+    std::map<std::vector<int>, Span> spansByRegions;
+    for (int pitch = 0; pitch < 128; ++pitch) {
+        const std::vector<int>& atPitch = regionsAtPitch[pitch];
+
+        Span& sequences = sequenceSpans_[pitch];
+        sequences.first = int(sequenceRegions_.size());
+        for (int i : atPitch) {
+            if (regions[i]->sequenceLength > 1) {
+                sequenceRegions_.push_back(i);
+            }
+        }
+        sequences.count = int(sequenceRegions_.size()) - sequences.first;
+
+        auto row = rowsByRegions.find(atPitch);
+        if (row != rowsByRegions.end()) {
+            pitchToRow_[pitch] = row->second;
+            continue;
+        }
+
+        VelocityRow velocityRow;
+        std::vector<int> atVel;
+        std::vector<int> atLastVel;
+        for (int vel = 0; vel < 128; ++vel) {
+            atVel.clear();
+            for (int i : atPitch) {
+                if (vel >= regions[i]->lovel && vel <= regions[i]->hivel) {
+                    atVel.push_back(i);
+                }
+            }
+
+            // usually the same as the velocity below, so check that before the map
+            if (vel > 0 && atVel == atLastVel) {
+                velocityRow[vel] = velocityRow[vel - 1];
+                continue;
+            }
+            atLastVel = atVel;
+
+            auto span = spansByRegions.find(atVel);
+            if (span != spansByRegions.end()) {
+                velocityRow[vel] = span->second;
+                continue;
+            }
+            Span newSpan;
+            newSpan.first = int(candidates_.size());
+            newSpan.count = int(atVel.size());
+            for (int i : atVel) {
+                const CompiledRegion* region = regions[i].get();
+                Candidate candidate;
+                candidate.lorand = region->lorand;
+                candidate.hirand = region->hirand;
+                candidate.region = i;
+                candidate.sequenceLength = region->sequenceLength;
+                candidate.sequencePosition = region->sequencePosition;
+                candidates_.push_back(candidate);
             }
+            spansByRegions[atVel] = newSpan;
+            velocityRow[vel] = newSpan;
         }
+        pitchToRow_[pitch] = int(velocityRows_.size());
+        rowsByRegions[atPitch] = pitchToRow_[pitch];
+        velocityRows_.push_back(velocityRow);
     }
 }
 
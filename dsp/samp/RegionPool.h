@@ -1,9 +1,9 @@
 #pragma once
 
+#include <array>
 #include <functional>
 #include <memory>
 #include <vector>
-#include <array>
 
 class CompiledRegion;
 class SInstrument;
@@ -23,6 +23,8 @@ public:
     /** 
      * After the pool is built, this function is called 
      * every time a note needs to be played.
+     * It only touches the flat tables made by fillRegionLookup,
+     * and the one region it returns.
      */
     const CompiledRegion* play(const VoicePlayParameter& params, float random, bool& didKeyswitch);
 
@@ -40,16 +42,54 @@ public:
 private:
     std::vector<CompiledRegionPtr> regions;
     bool fixupCompiledTree();
+
+    /**
+     * Everything play() needs to know about a region, other than the
+     * keyswitch and round robin state.
+     * region is the index into regions, keySwitched_, and sequenceCounters_.
+     */
+    class Candidate {
+    public:
+        float lorand = 0;
+        float hirand = 1;
+        int region = 0;
+        int sequenceLength = 1;
+        int sequencePosition = -1;
+    };
+
+    /**
+     * A run of entries in candidates_ or sequenceRegions_.
+     */
+    class Span {
+    public:
+        int first = 0;
+        int count = 0;
+    };
+    using VelocityRow = std::array<Span, 128>;
+
+    /**
+     * The lookup table. For each pitch, velocityRows_[pitchToRow_[pitch]][velocity]
+     * is the run of candidates that might play, in priority order.
+     * Pitches that have the same regions share a row.
+     */
+    std::array<int, 128> pitchToRow_ = {};
+    std::vector<VelocityRow> velocityRows_;
+    std::vector<Candidate> candidates_;
+
     /**
-    * we use raw pointers here.
-    * Everything in these lists is kept alive by the object
-    * tree from this->groups.
-    * noteActivationLists_ is named after the similar variable in sfizz.
-    * It tracks for each midi pitch, what regions might play if that key is active.
-    */
-    using CompiledRegionList = std::vector<CompiledRegion*>;
-    std::vector<CompiledRegionList> noteActivationLists_{128};
-    std::array<CompiledRegionList, 128> lastKeyswitchLists_;  
+     * Every region with a sequence at each pitch. Their counters all advance
+     * when the pitch plays, whatever the velocity.
+     */
+    std::array<Span, 128> sequenceSpans_;
+    std::vector<int> sequenceRegions_;
+    std::vector<int> sequenceCounters_;
+
+    /**
+     * Keyswitch state for each region, and for each pitch,
+     * the regions that pitch switches on.
+     */
+    std::vector<char> keySwitched_;
+    std::array<std::vector<int>, 128> lastKeyswitchLists_;
 
     /** current keyswitch value, or -1 if none
      */
@@ -57,8 +97,8 @@ private:
 
     void fillRegionLookup();
     void removeOverlaps();
-    void maybeAddToKeyswitchList(CompiledRegionPtr);
-    static bool shouldRegionPlayNow(const VoicePlayParameter& params, const CompiledRegion* region, float random);
+    bool candidateMatches(const Candidate&, float random) const;
+    void setKeySwitched(int region, bool on);
 
     /**
      * returns true if overlap cannot be corrected.
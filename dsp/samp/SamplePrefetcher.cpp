@@ -0,0 +1,75 @@
+#include "SamplePrefetcher.h"
+
+#include <assert.h>
+#include <stdlib.h>
+
+#include "WaveLoader.h"
+
+SamplePrefetcher::SamplePrefetcher(WaveLoader& wl, const std::vector<int>& p) : loader(wl), pitches(p) {
+    done.resize(pitches.size(), false);
+    lastPitch = 60;
+    stopRequested = false;
+    thread.reset(new std::thread([this]() {
+        this->threadFunction();
+    }));
+}
+
+SamplePrefetcher::~SamplePrefetcher() {
+    stopRequested = true;
+    waitUntilDone();
+}
+
+void SamplePrefetcher::waitUntilDone() {
+    if (thread && thread->joinable()) {
+        thread->join();
+    }
+}
+
+void SamplePrefetcher::request(int index, int midiPitch) {
+    lastPitch = midiPitch;
+    if (!requests.full()) {
+        requests.push(index);
+    }
+}
+
+void SamplePrefetcher::threadFunction() {
+    while (!stopRequested) {
+        const int index = pickNext();
+        if (index < 0) {
+            return;
+        }
+        loader.loadDeferred(index);
+        done[index - 1] = true;
+        ++numDone;
+        loadOrder.push_back(index);
+    }
+}
+
+int SamplePrefetcher::pickNext() {
+    while (!requests.empty()) {
+        const int index = requests.pop();
+        if (index >= 1 && index <= int(done.size()) && !done[index - 1]) {
+            return index;
+        }
+    }
+
+    if (numDone >= int(done.size())) {
+        return -1;
+    }
+
+    const int pitch = lastPitch;
+    int best = -1;
+    int bestDistance = 0;
+    for (int i = 0; i < int(done.size()); ++i) {
+        if (done[i]) {
+            continue;
+        }
+        const int distance = abs(pitches[i] - pitch);
+        if (best < 0 || distance < bestDistance) {
+            best = i;
+            bestDistance = distance;
+        }
+    }
+    assert(best >= 0);
+    return best + 1;
+}
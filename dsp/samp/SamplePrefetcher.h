@@ -0,0 +1,69 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "AtomicRingBuffer.h"
+
+class WaveLoader;
+
+/**
+ * Decodes the samples of a lazy WaveLoader on a thread of its own.
+ *
+ * Samples that a note is waiting for are loaded first.
+ * When no note is waiting it loads the sample closest in pitch to the last note played
+ * (middle C to start with), so the part of the keyboard that is being used fills in first.
+ * The thread exits when everything is loaded.
+ */
+class SamplePrefetcher {
+public:
+    /**
+     * @param pitches is a midi pitch for each sample. pitches[0] is sample 1.
+     */
+    SamplePrefetcher(WaveLoader& loader, const std::vector<int>& pitches);
+    ~SamplePrefetcher();
+
+    SamplePrefetcher(const SamplePrefetcher&) = delete;
+    const SamplePrefetcher& operator=(const SamplePrefetcher&) = delete;
+
+    /**
+     * Asks for a sample to be loaded next.
+     * Called from the audio thread, so it never blocks. If too many requests
+     * are waiting it is dropped, and the sample will be loaded with the others.
+     */
+    void request(int index, int midiPitch);
+
+    /**
+     * Blocks until all the samples are loaded.
+     */
+    void waitUntilDone();
+
+    /**
+     * The samples, in the order they were loaded.
+     * Only valid after waitUntilDone.
+     */
+    const std::vector<int>& _loadOrder() const { return loadOrder; }
+
+private:
+    WaveLoader& loader;
+    const std::vector<int> pitches;
+
+    // these are only touched by the prefetch thread.
+    std::vector<bool> done;
+    int numDone = 0;
+    std::vector<int> loadOrder;
+
+    AtomicRingBuffer<int, 64> requests;
+    std::atomic<int> lastPitch;
+    std::atomic<bool> stopRequested;
+    std::unique_ptr<std::thread> thread;
+
+    void threadFunction();
+
+    /**
+     * @returns the next sample to load, or -1 if they are all loaded.
+     */
+    int pickNext();
+};
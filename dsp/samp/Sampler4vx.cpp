@@ -8,6 +8,8 @@
 
 void Sampler4vx::setPatch(CompiledInstrumentPtr inst) {
     patch = inst;
+    // pending notes point into the old patch.
+    pendingMask = 0;
 }
 
 const float Sampler4vx::defaultAttackSec = {.001f};
@@ -16,6 +18,7 @@ const float Sampler4vx::defaultReleaseSec = {.3f};
 
 void Sampler4vx::setLoader(WaveLoaderPtr loader) {
     waves = loader;
+    pendingMask = 0;
 
     // While we are at it, let's initialize the ADSR.
     adsr.setASec(defaultAttackSec);
@@ -24,11 +27,28 @@ void Sampler4vx::setLoader(WaveLoaderPtr loader) {
     adsr.setRSec(defaultReleaseSec);
 }
 
+float_4 Sampler4vx::getLevel() const {
+    if (!patch || !waves) {
+        return float_4::zero();
+    }
+    if (!player.blockEnvelopes()) {
+        return adsr.get();
+    }
+    float_4 ret;
+    for (int i = 0; i < 4; ++i) {
+        ret[i] = player.channels[i].canPlay() ? 1.f : 0.f;
+    }
+    return ret;
+}
+
 #ifdef _SAMPFM
 float_4 Sampler4vx::step(const float_4& gates, float sampleTime, const float_4& lfm, bool lfmEnabled) {
     sampleTime_ = sampleTime;
     if (patch && waves) {
         simd_assertMask(gates);
+        if (pendingMask) {
+            startPending(gates);
+        }
         float_4 samples = player.step(lfm, lfmEnabled);
         samples *= _outputGain();
         if (!player.blockEnvelopes()) {
@@ -42,6 +62,55 @@ float_4 Sampler4vx::step(const float_4& gates, float sampleTime, const float_4&
     return 0.f;
 }
 
+bool Sampler4vx::prepareBlock(SimdDispatch::SampleBank& bank, const float_4& gates, float sampleTime, const float_4& lfm) {
+    sampleTime_ = sampleTime;
+    if (!patch || !waves) {
+        blockOutput = 0;
+        return false;
+    }
+    simd_assertMask(gates);
+    if (pendingMask) {
+        startPending(gates);
+    }
+    player.prepareBlock(bank, lfm);
+
+    blockGates = gates;
+    bank.gates = &blockGates[0];
+    bank.env = adsr._envData();
+    bank.attacking = adsr._attackingData();
+    bank.attackLambda = adsr._attackLambdaData();
+    bank.decayLambda = adsr._decayLambdaData();
+    bank.releaseLambda = adsr._releaseLambdaData();
+    bank.sustain = adsr._sustainData();
+    bank.useEnvelope = !player.blockEnvelopes();
+    bank.output = &blockOutput[0];
+    return true;
+}
+
+void Sampler4vx::startPending(const float_4& gates) {
+    const int gateMask = rack::simd::movemask(gates);
+    for (int channel = 0; channel < 4; ++channel) {
+        const int bit = 1 << channel;
+        if (!(pendingMask & bit)) {
+            continue;
+        }
+        if (!(gateMask & bit)) {
+            // gate went away before the sample got here.
+            pendingMask &= ~bit;
+            continue;
+        }
+        VoicePlayInfo& info = pendingInfo[channel];
+        if (waves->isReady(info.sampleIndex)) {
+            pendingMask &= ~bit;
+            // now that we have the sample we can finish the pitch.
+            if (info.region) {
+                CompiledInstrument::getPlayPitch(info, pendingPitch[channel], info.region, waves.get(), pendingSampleRate);
+            }
+            startNote(channel, info);
+        }
+    }
+}
+
 void Sampler4vx::setExpFM(const float_4& value) {
     fmCV = value;
     updatePitch();
@@ -99,6 +168,9 @@ bool Sampler4vx::note_on(int channel, int midiPitch, int midiVelocity, float sam
     if (patch->isInError()) {
         assert(false);
     }
+    // a new note replaces whatever was waiting on this channel.
+    pendingMask &= ~(1 << channel);
+
     VoicePlayInfo patchInfo;
     VoicePlayParameter params;
     params.midiPitch = midiPitch;
@@ -110,6 +182,22 @@ bool Sampler4vx::note_on(int channel, int midiPitch, int midiVelocity, float sam
         return didKS;
     }
 
+    if (!waves->isReady(patchInfo.sampleIndex)) {
+        // Loading lazily, and this sample isn't here yet. Ask for it, and play silence until it gets here.
+        waves->requestLoad(patchInfo.sampleIndex, midiPitch);
+        player.clearSamples(channel);
+        pendingInfo[channel] = patchInfo;
+        pendingPitch[channel] = midiPitch;
+        pendingSampleRate = sampleRate;
+        pendingMask |= (1 << channel);
+        return didKS;
+    }
+
+    startNote(channel, patchInfo);
+    return didKS;
+}
+
+void Sampler4vx::startNote(int channel, const VoicePlayInfo& patchInfo) {
     WaveLoader::WaveInfoPtr waveInfo = waves->getInfo(patchInfo.sampleIndex);
     assert(waveInfo->isValid());
 #if 0
@@ -156,7 +244,6 @@ bool Sampler4vx::note_on(int channel, int midiPitch, int midiVelocity, float sam
     R[channel] = patchInfo.ampeg_release;
     adsr.setRSec(R[channel]);
     releaseTime_ = patchInfo.ampeg_release;
-    return didKS;
 }
 
 void Sampler4vx::setNumVoices(int voices) {
@@ -4,6 +4,7 @@
 #include <memory>
 
 #include "ADSRSampler.h"
+#include "SamplerPlayback.h"
 #include "SimdBlocks.h"
 
 class CompiledInstrument;
@@ -68,10 +69,32 @@ public:
 #ifdef _SAMPFM
     void setExpFM(const float_4& value);
     float_4 step(const float_4& gates, float sampleTime, const float_4& lfm, bool lfmEnabled);
+
+    /**
+     * step, split up so that all the banks can share one call to SimdDispatch::kernels().sampleStep.
+     * Call prepareBlock, then the kernel, then finishBlock. Same results as step.
+     * Returns false if there is nothing to play, in which case don't pass the bank
+     * to the kernel. finishBlock will return zero.
+     */
+    bool prepareBlock(SimdDispatch::SampleBank& bank, const float_4& gates, float sampleTime, const float_4& lfm);
+    float_4 finishBlock() const { return blockOutput; }
 #else
     float_4 step(const float_4& gates, float sampleTime);
 #endif
 
+    /**
+     * How loud each voice is, before the output gain. Usually the envelope.
+     * One shots don't use the envelope, so for them it's 1 while the sample is playing.
+     */
+    float_4 getLevel() const;
+
+    /**
+     * For when the bank goes to sleep. Sets the envelopes to zero.
+     */
+    void sleep() {
+        adsr.setSilent();
+    }
+
     // fixed
     static float_4 _outputGain() {
         return 5;
@@ -81,6 +104,7 @@ public:
     void clearSamples() {
         player.clearSamples();
         waves.reset();
+        pendingMask = 0;
     }
 
     static const float defaultAttackSec;
@@ -112,6 +136,24 @@ private:
     float_4 pitchCVFromKeyboard = {0};
     // float_4 pitchMod = {0};
     void updatePitch();
+
+    /**
+     * When loading lazily a note may arrive before its sample is loaded.
+     * We hold on to it here, and start it when the sample shows up, if the gate is still held.
+     * Bit n of pendingMask is set when channel n is waiting.
+     */
+    VoicePlayInfo pendingInfo[4];
+    int pendingPitch[4] = {0};
+    int pendingMask = 0;
+    float pendingSampleRate = 0;
+    void startPending(const float_4& gates);
+
+    void startNote(int channel, const VoicePlayInfo& patchInfo);
+
+    // for prepareBlock / finishBlock
+    float_4 blockGates = 0;
+    float_4 blockOutput = 0;
+
     int myIndex = -1;
     bool printErrors = true;
 };
\ No newline at end of file
@@ -30,6 +30,12 @@ public:
     float gain = 1;  // assume full volume
     float ampeg_release = .001f;
 
+    /**
+     * The region that was picked, or nullptr in test modes.
+     * Owned by the patch, so only good as long as the patch is.
+     */
+    const CompiledRegion* region = nullptr;
+
     bool canPlay() const {
         return valid && (sampleIndex > 0);
     }
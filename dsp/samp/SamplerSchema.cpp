@@ -3,6 +3,7 @@
 #include <assert.h>
 
 #include <algorithm>
+#include <map>
 #include <set>
 
 #include "SParse.h"
@@ -13,85 +14,105 @@ using Opcode = SamplerSchema::Opcode;
 using OpcodeType = SamplerSchema::OpcodeType;
 using DiscreteValue = SamplerSchema::DiscreteValue;
 
+class OpcodeEntry {
+public:
+    const char* name;
+    Opcode opcode;
+    OpcodeType type;
+};
+
 // TODO: compare this to the spec
-static std::map<Opcode, OpcodeType> keyType = {
-    {Opcode::HI_KEY, OpcodeType::Int},
-    {Opcode::KEY, OpcodeType::Int},
-    {Opcode::LO_KEY, OpcodeType::Int},
-    {Opcode::HI_VEL, OpcodeType::Int},
-    {Opcode::LO_VEL, OpcodeType::Int},
-    {Opcode::SAMPLE, OpcodeType::String},
-    {Opcode::AMPEG_RELEASE, OpcodeType::Float},
-    {Opcode::LOOP_MODE, OpcodeType::Discrete},
-    {Opcode::OSCILLATOR, OpcodeType::Discrete},
-    //  {Opcode::LOOP_CONTINUOUS, OpcodeType::}
-    {Opcode::PITCH_KEYCENTER, OpcodeType::Int},
-    {Opcode::LOOP_START, OpcodeType::Int},
-    {Opcode::LOOP_END, OpcodeType::Int},
-    {Opcode::PAN, OpcodeType::Int},
-    {Opcode::GROUP, OpcodeType::Int},
-    {Opcode::TRIGGER, OpcodeType::Discrete},
-    {Opcode::VOLUME, OpcodeType::Float},
-    {Opcode::TUNE, OpcodeType::Int},
-    {Opcode::OFFSET, OpcodeType::Int},
-    {Opcode::END, OpcodeType::Int},
-    {Opcode::POLYPHONY, OpcodeType::Int},
-    {Opcode::PITCH_KEYTRACK, OpcodeType::Int},
-    {Opcode::AMP_VELTRACK, OpcodeType::Float},
-    {Opcode::LO_RAND, OpcodeType::Float},
-    {Opcode::HI_RAND, OpcodeType::Float},
-    {Opcode::SEQ_LENGTH, OpcodeType::Int},
-    {Opcode::SEQ_POSITION, OpcodeType::Int},
-    {Opcode::DEFAULT_PATH, OpcodeType::String},
-    {Opcode::SW_LABEL, OpcodeType::String},
-    {Opcode::SW_LAST, OpcodeType::Int},
-    {Opcode::SW_LOKEY, OpcodeType::Int},
-    {Opcode::SW_HIKEY, OpcodeType::Int},
-    {Opcode::SW_DEFAULT, OpcodeType::Int},
-    {Opcode::HICC64_HACK, OpcodeType::Int},
-    {Opcode::LOCC64_HACK, OpcodeType::Int}};
-
-static std::map<std::string, Opcode> opcodes = {
-    {"hivel", Opcode::HI_VEL},
-    {"lovel", Opcode::LO_VEL},
-    {"hikey", Opcode::HI_KEY},
-    {"lokey", Opcode::LO_KEY},
-    {"hirand", Opcode::HI_RAND},
-    {"lorand", Opcode::LO_RAND},
-    {"pitch_keycenter", Opcode::PITCH_KEYCENTER},
-    {"ampeg_release", Opcode::AMPEG_RELEASE},
-    {"amp_release", Opcode::AMPEG_RELEASE},  // synonym
-    {"loop_mode", Opcode::LOOP_MODE},
-    {"loop_start", Opcode::LOOP_START},
-    {"loopstart", Opcode::LOOP_START},  // synonym!
-    {"loop_end", Opcode::LOOP_END},
-    {"loopend", Opcode::LOOP_END},  // synonym!
-    {"sample", Opcode::SAMPLE},
-    {"pan", Opcode::PAN},
-    {"group", Opcode::GROUP},
-    {"trigger", Opcode::TRIGGER},
-    {"volume", Opcode::VOLUME},
-    {"tune", Opcode::TUNE},
-    {"offset", Opcode::OFFSET},
-    {"end", Opcode::END},
-    {"oscillator", Opcode::OSCILLATOR},
-    {"polyphony", Opcode::POLYPHONY},
-    {"pitch_keytrack", Opcode::PITCH_KEYTRACK},
-    {"amp_veltrack", Opcode::AMP_VELTRACK},
-    {"key", Opcode::KEY},
-    {"seq_length", Opcode::SEQ_LENGTH},
-    {"seq_position", Opcode::SEQ_POSITION},
-    {"default_path", Opcode::DEFAULT_PATH},
-    {"sw_label", Opcode::SW_LABEL},
-    {"sw_last", Opcode::SW_LAST},
-    {"sw_lokey", Opcode::SW_LOKEY},
-    {"sw_hikey", Opcode::SW_HIKEY},
-    {"sw_default", Opcode::SW_DEFAULT},
-    {"hicc64", Opcode::HICC64_HACK},
-    {"locc64", Opcode::LOCC64_HACK}};
-
-static std::set<std::string>
-    unrecognized;
+static constexpr OpcodeEntry opcodeTable[] = {
+    {"hivel", Opcode::HI_VEL, OpcodeType::Int},
+    {"lovel", Opcode::LO_VEL, OpcodeType::Int},
+    {"hikey", Opcode::HI_KEY, OpcodeType::Int},
+    {"lokey", Opcode::LO_KEY, OpcodeType::Int},
+    {"hirand", Opcode::HI_RAND, OpcodeType::Float},
+    {"lorand", Opcode::LO_RAND, OpcodeType::Float},
+    {"pitch_keycenter", Opcode::PITCH_KEYCENTER, OpcodeType::Int},
+    {"ampeg_release", Opcode::AMPEG_RELEASE, OpcodeType::Float},
+    {"amp_release", Opcode::AMPEG_RELEASE, OpcodeType::Float},  // synonym
+    {"loop_mode", Opcode::LOOP_MODE, OpcodeType::Discrete},
+    {"loop_start", Opcode::LOOP_START, OpcodeType::Int},
+    {"loopstart", Opcode::LOOP_START, OpcodeType::Int},  // synonym!
+    {"loop_end", Opcode::LOOP_END, OpcodeType::Int},
+    {"loopend", Opcode::LOOP_END, OpcodeType::Int},  // synonym!
+    {"sample", Opcode::SAMPLE, OpcodeType::String},
+    {"pan", Opcode::PAN, OpcodeType::Int},
+    {"group", Opcode::GROUP, OpcodeType::Int},
+    {"trigger", Opcode::TRIGGER, OpcodeType::Discrete},
+    {"volume", Opcode::VOLUME, OpcodeType::Float},
+    {"tune", Opcode::TUNE, OpcodeType::Int},
+    {"offset", Opcode::OFFSET, OpcodeType::Int},
+    {"end", Opcode::END, OpcodeType::Int},
+    {"oscillator", Opcode::OSCILLATOR, OpcodeType::Discrete},
+    {"polyphony", Opcode::POLYPHONY, OpcodeType::Int},
+    {"pitch_keytrack", Opcode::PITCH_KEYTRACK, OpcodeType::Int},
+    {"amp_veltrack", Opcode::AMP_VELTRACK, OpcodeType::Float},
+    {"key", Opcode::KEY, OpcodeType::Int},
+    {"seq_length", Opcode::SEQ_LENGTH, OpcodeType::Int},
+    {"seq_position", Opcode::SEQ_POSITION, OpcodeType::Int},
+    {"default_path", Opcode::DEFAULT_PATH, OpcodeType::String},
+    {"sw_label", Opcode::SW_LABEL, OpcodeType::String},
+    {"sw_last", Opcode::SW_LAST, OpcodeType::Int},
+    {"sw_lokey", Opcode::SW_LOKEY, OpcodeType::Int},
+    {"sw_hikey", Opcode::SW_HIKEY, OpcodeType::Int},
+    {"sw_default", Opcode::SW_DEFAULT, OpcodeType::Int},
+    {"hicc64", Opcode::HICC64_HACK, OpcodeType::Int},
+    {"locc64", Opcode::LOCC64_HACK, OpcodeType::Int}};
+
+static constexpr int numOpcodeEntries = sizeof(opcodeTable) / sizeof(opcodeTable[0]);
+
+/**
+ * Opcode names are looked up with a perfect hash: FNV-1a, with a starting value
+ * that happens to put every name in opcodeTable in its own slot. So a lookup is
+ * one hash, one table read, and one string compare.
+ *
+ * If you add an opcode and the static_assert below fires, try other seeds until it doesn't.
+ */
+static constexpr uint32_t opcodeHashSeed = 32;
+static constexpr int opcodeHashSlots = 128;
+
+static constexpr uint32_t opcodeHash(const char* s, uint32_t h = opcodeHashSeed) {
+    return *s ? opcodeHash(s + 1, (h ^ uint8_t(*s)) * 16777619u) : h;
+}
+
+static constexpr int opcodeSlot(const char* s) {
+    return int(opcodeHash(s) % opcodeHashSlots);
+}
+
+static constexpr bool opcodeCollides(int i, int j) {
+    return (j < numOpcodeEntries) &&
+           ((opcodeSlot(opcodeTable[i].name) == opcodeSlot(opcodeTable[j].name)) || opcodeCollides(i, j + 1));
+}
+
+static constexpr bool opcodeHashIsPerfect(int i = 0) {
+    return (i >= numOpcodeEntries) || (!opcodeCollides(i, i + 1) && opcodeHashIsPerfect(i + 1));
+}
+
+static_assert(opcodeHashIsPerfect(), "opcode names collide in the hash table. pick a new opcodeHashSeed");
+static_assert(numOpcodeEntries < opcodeHashSlots, "opcode hash table is full");
+
+// for each hash slot, the index into opcodeTable, or -1
+static std::array<int8_t, opcodeHashSlots> makeOpcodeSlots() {
+    std::array<int8_t, opcodeHashSlots> ret;
+    ret.fill(-1);
+    for (int i = 0; i < numOpcodeEntries; ++i) {
+        ret[opcodeSlot(opcodeTable[i].name)] = int8_t(i);
+    }
+    return ret;
+}
+
+static const std::array<int8_t, opcodeHashSlots> opcodeSlots = makeOpcodeSlots();
+
+static const OpcodeEntry* findOpcode(const std::string& key) {
+    const int index = opcodeSlots[opcodeSlot(key.c_str())];
+    if (index < 0) {
+        return nullptr;
+    }
+    const OpcodeEntry& entry = opcodeTable[index];
+    return (key == entry.name) ? &entry : nullptr;
+}
 
 static std::map<std::string, DiscreteValue> discreteValues = {
     {"loop_continuous", DiscreteValue::LOOP_CONTINUOUS},
@@ -119,20 +140,14 @@ DiscreteValue SamplerSchema::translated(const std::string& s) {
 }
 
 OpcodeType SamplerSchema::keyTextToType(const std::string& key, bool suppressErrorMessages) {
-    Opcode opcode = SamplerSchema::translate(key, suppressErrorMessages);
-    if (opcode == Opcode::NONE) {
+    const OpcodeEntry* entry = findOpcode(key);
+    if (!entry) {
         if (!suppressErrorMessages) {
             //SQINFO("unknown opcode type %s", key.c_str());
         }
         return OpcodeType::Unknown;
     }
-    auto typeIter = keyType.find(opcode);
-    // OpcodeType type = keyType(opcode);
-    if (typeIter == keyType.end()) {
-        SQFATAL("unknown type for key %s", key.c_str());
-        return OpcodeType::Unknown;
-    }
-    return typeIter->second;
+    return entry->type;
 }
 
 // TODO: octaves
@@ -301,24 +316,19 @@ bool SamplerSchema::stringToFloat(const char* sPeriod, float* outValue) {
 }
 
 void SamplerSchema::compile(SamplerErrorContext& err, SamplerSchema::KeysAndValuesPtr results, SKeyValuePairPtr input) {
-    Opcode opcode = translate(input->key, true);
-    if (opcode == Opcode::NONE) {
+    const OpcodeEntry* entry = findOpcode(input->key);
+    if (!entry) {
         //  std::string e = std::string("could not translate opcode ") + input->key.c_str();
         err.unrecognizedOpcodes.insert(input->key);
         //SQWARN("could not translate opcode %s", input->key.c_str());
         return;
     }
-    auto typeIter = keyType.find(opcode);
-    if (typeIter == keyType.end()) {
-        SQFATAL("could not find type for %s", input->key.c_str());
-        assert(false);
-        return;
-    }
 
-    const OpcodeType type = typeIter->second;
+    const Opcode opcode = entry->opcode;
+    const OpcodeType type = entry->type;
 
-    ValuePtr vp = std::make_shared<Value>();
-    vp->type = type;
+    Value v;
+    v.type = type;
     bool isValid = true;
 
     switch (type) {
@@ -327,7 +337,7 @@ void SamplerSchema::compile(SamplerErrorContext& err, SamplerSchema::KeysAndValu
             if (!foo.first) {
                 return;
             }
-            vp->numericInt = foo.second;
+            v.numericInt = foo.second;
         } break;
         case OpcodeType::Float: {
             float floatValue = 0;
@@ -337,12 +347,12 @@ void SamplerSchema::compile(SamplerErrorContext& err, SamplerSchema::KeysAndValu
                 err.sawMalformedInput = true;
                 return;
             }
-            vp->numericFloat = floatValue;
+            v.numericFloat = floatValue;
         }
 
         break;
         case OpcodeType::String:
-            vp->string = input->value;
+            v.string = input->value;
             break;
         case OpcodeType::Discrete: {
             const DiscreteValue dv = translated(input->value);
@@ -352,39 +362,33 @@ void SamplerSchema::compile(SamplerErrorContext& err, SamplerSchema::KeysAndValu
                 return;
             }
 
-            vp->discrete = dv;
+            v.discrete = dv;
         } break;
         default:
             assert(false);
     }
     if (isValid) {
-        results->add(opcode, vp);
+        results->add(opcode, std::move(v));
     }
 }
 
 SamplerSchema::KeysAndValuesPtr SamplerSchema::compile(SamplerErrorContext& err, const SKeyValueList& inputs) {
     SamplerSchema::KeysAndValuesPtr results = std::make_shared<SamplerSchema::KeysAndValues>();
-    for (auto input : inputs) {
+    for (const auto& input : inputs) {
         compile(err, results, input);
     }
     return results;
 }
 
 SamplerSchema::Opcode SamplerSchema::translate(const std::string& s, bool suppressErrors) {
-    auto entry = opcodes.find(s);
-    if (entry == opcodes.end()) {
-        auto find2 = unrecognized.find(s);
-        if (find2 == unrecognized.end()) {
-            unrecognized.insert({s});
-            if (!suppressErrors) {
-                //SQWARN("!! unrecognized opcode %s\n", s.c_str());
-            }
+    const OpcodeEntry* entry = findOpcode(s);
+    if (!entry) {
+        if (!suppressErrors) {
+            //SQWARN("!! unrecognized opcode %s\n", s.c_str());
         }
-
         return Opcode::NONE;
-    } else {
-        return entry->second;
     }
+    return entry->opcode;
 }
 
 std::set<std::string> SamplerSchema::freeTextFields = {
@@ -423,11 +427,9 @@ bool SamplerSchema::isFreeTextType(const std::string& key) {
 
 std::vector<std::string> SamplerSchema::_getKnownTextOpcodes() {
     std::vector<std::string> ret;
-    for (auto x : opcodes) {
-        const Opcode oc = x.second;
-        auto type = keyType[oc];
-        if (type == OpcodeType::String) {
-            ret.push_back(x.first);
+    for (auto& x : opcodeTable) {
+        if (x.type == OpcodeType::String) {
+            ret.push_back(x.name);
         }
     }
     return ret;
@@ -435,12 +437,10 @@ std::vector<std::string> SamplerSchema::_getKnownTextOpcodes() {
 
 std::vector<std::string> SamplerSchema::_getKnownNonTextOpcodes() {
     std::vector<std::string> ret;
-    for (auto x : opcodes) {
-        const Opcode oc = x.second;
-        auto type = keyType[oc];
-        if (type != OpcodeType::String) {
-            ret.push_back(x.first);
+    for (auto& x : opcodeTable) {
+        if (x.type != OpcodeType::String) {
+            ret.push_back(x.name);
         }
     }
     return ret;
-}
\ No newline at end of file
+}
@@ -1,8 +1,9 @@
 #pragma once
 
 #include <assert.h>
+#include <stdint.h>
 
-#include <map>
+#include <array>
 #include <memory>
 #include <set>
 #include <string>
@@ -57,6 +58,7 @@ public:
         SW_DEFAULT,
         HICC64_HACK,        // It's a hack becuase it won't scale to "all" cc
         LOCC64_HACK,
+        NUM_OPCODES         // must be last
     };
 
     enum class DiscreteValue {
@@ -112,39 +114,49 @@ public:
         }
     };
 
-    using ValuePtr = std::shared_ptr<Value>;
+    /**
+     * Points into a KeysAndValues, so it's only good for as long as that is.
+     */
+    using ValuePtr = const Value*;
 
     /**
      * hold the compiled form of a collection of group attributes.
+     * The values are stored contiguously, and found through a small
+     * index array, so a lookup is just two array accesses.
      */
     class KeysAndValues {
     public:
+        KeysAndValues() {
+            index.fill(-1);
+        }
         size_t _size() const {
-            return data.size();
+            return values.size();
         }
-        void add(Opcode o, ValuePtr vp) {
-            data[o] = vp;
+        void add(Opcode o, Value v) {
+            int8_t& i = index[static_cast<int>(o)];
+            if (i < 0) {
+                i = int8_t(values.size());
+                values.push_back(std::move(v));
+            } else {
+                values[i] = std::move(v);
+            }
         }
 
-        ValuePtr get(Opcode o) {
-            assert(this);
-            auto it = data.find(o);
-            if (it == data.end()) {
-                return nullptr;
-            }
-            return it->second;
+        ValuePtr get(Opcode o) const {
+            const int i = index[static_cast<int>(o)];
+            return (i < 0) ? nullptr : &values[i];
         }
 
         void _dump() {
-            for (auto x : data) {
-                //SQINFO("key=%d val=", x.first);
-                x.second->_dump();
+            for (auto& x : values) {
+                x._dump();
             }
         }
 
     private:
-        // the int key is really an Opcode
-        std::map<Opcode, ValuePtr> data;
+        // for each Opcode, where its value is in values, or -1
+        std::array<int8_t, static_cast<int>(Opcode::NUM_OPCODES)> index;
+        std::vector<Value> values;
     };
     using KeysAndValuesPtr = std::shared_ptr<KeysAndValues>;
 
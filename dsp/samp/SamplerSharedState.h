@@ -2,6 +2,8 @@
 
 #include <atomic>
 #include <memory>
+#include <mutex>
+#include <string>
 
 #include "SqLog.h"
 
@@ -50,6 +52,40 @@ public:
         progressPercent = pct;
     }
 
+    /**
+     * When samples are loaded as they are played, a sample that won't decode
+     * is only found after the instrument went to the UI.
+     * Called from the prefetch thread.
+     */
+    void w_setLoadError(const std::string& err) {
+        std::lock_guard<std::mutex> guard(loadErrorMutex);
+        loadError = err;
+        hasNewLoadError = true;
+    }
+
+    /**
+     * Called from the worker thread when it starts on a new instrument.
+     */
+    void w_clearLoadError() {
+        std::lock_guard<std::mutex> guard(loadErrorMutex);
+        loadError.clear();
+        hasNewLoadError = false;
+    }
+
+    /**
+     * Called from the UI thread.
+     * @returns true, and the error, the first time it is called after w_setLoadError.
+     */
+    bool ui_getNewLoadError(std::string& err) {
+        std::lock_guard<std::mutex> guard(loadErrorMutex);
+        if (!hasNewLoadError) {
+            return false;
+        }
+        hasNewLoadError = false;
+        err = loadError;
+        return true;
+    }
+
     // called from audio thread
     bool au_isSampleReloadRequested() const {
         return sampleReloadRequested;
@@ -63,6 +99,11 @@ private:
     std::atomic<bool> sampleReloadRequested = {false};
     std::atomic<bool> sampleReloadRequestGranted = {false};
     std::atomic<float> progressPercent = {0};
+
+    // the audio thread never touches these
+    std::mutex loadErrorMutex;
+    std::string loadError;
+    bool hasNewLoadError = false;
 };
 
 
@@ -50,10 +50,59 @@ float_4 Streamer::step(float_4 fm, bool fmEnabled) {
     return ret;
 }
 
+void Streamer::prepareBlock(SimdDispatch::SampleBank& bank, float_4 fm) {
+    // voices with nothing to play stay at zero
+    for (int i = 0; i < 4; ++i) {
+        blockTaps[i] = float_4::zero();
+    }
+    blockFraction = float_4::zero();
+    blockGain = float_4::zero();
+
+    bool anyPlaying = false;
+    for (int channel = 0; channel < 4; ++channel) {
+        ChannelData& cd = channels[channel];
+
+        assert(!std::isinf(cd.curFloatSampleOffset));
+        assert(!std::isinf(cd.transposeMultiplier));
+
+        float offset = 0;
+        const float* buffer = cd.data ? findInterpolationBuffer(cd, offset) : nullptr;
+        if (buffer) {
+            anyPlaying = true;
+            // vol is always one, so the kernel leaves it out.
+            assert(cd.vol == 1);
+            const unsigned int index = CubicInterpolator<float>::getIntegerPart(offset);
+            assert(index >= 1);
+            for (int i = 0; i < 4; ++i) {
+                blockTaps[i][channel] = buffer[index - 1 + i];
+            }
+            blockFraction[channel] = CubicInterpolator<float>::getFloatPart(offset);
+            blockGain[channel] = cd.gain;
+            cd.advancePointer(fm[channel]);
+        }
+    }
+    // Often a bank is held open by its gates after the samples ran out.
+    // Then the kernel can skip the interpolation.
+    bank.taps = anyPlaying ? &blockTaps[0][0] : nullptr;
+    bank.fraction = &blockFraction[0];
+    bank.gain = &blockGain[0];
+}
+
 float Streamer::stepTranspose(ChannelData& cd, float lfm) {
+    float offset = 0;
+    const float* buffer = findInterpolationBuffer(cd, offset);
+    if (!buffer) {
+        return 0;
+    }
+    float ret = CubicInterpolator<float>::interpolate(buffer, offset);
+    cd.advancePointer(lfm);
+    return ret * cd.vol;
+}
+
+const float* Streamer::findInterpolationBuffer(ChannelData& cd, float& offset) {
     assert(cd.curFloatSampleOffset >= 0);
 #ifdef _LOG
-    //SQINFO("in stepTranspose offset=%f cd=%p", cd.curFloatSampleOffset, &cd);
+    //SQINFO("in findInterpolationBuffer offset=%f cd=%p", cd.curFloatSampleOffset, &cd);
 #endif
     if (cd.loopActive && (cd.curFloatSampleOffset >= (cd.loopData.loop_end - 2))) {
         const int dataBufferOffset = 3 - cd.loopData.loop_end;
@@ -63,9 +112,8 @@ float Streamer::stepTranspose(ChannelData& cd, float lfm) {
             //SQINFO("loop, loope end x=%d to %d shift=%d", x - 1, x + 2, dataBufferOffset);
         }
 #endif
-        float ret = CubicInterpolator<float>::interpolate(cd.loopEndBuffer, float(dataBufferOffset + cd.curFloatSampleOffset));
-        cd.advancePointer(lfm);
-        return ret * cd.vol;
+        offset = float(dataBufferOffset + cd.curFloatSampleOffset);
+        return cd.loopEndBuffer;
     } else if (CubicInterpolator<float>::canInterpolate(float(cd.curFloatSampleOffset), cd.frames)) {
         // common case - interp in place
 #ifdef _LOG
@@ -74,16 +122,15 @@ float Streamer::stepTranspose(ChannelData& cd, float lfm) {
             //SQINFO("straight interp, case 1 linear x=%d to %d", x - 1, x + 2);
         }
 #endif
-        float ret = CubicInterpolator<float>::interpolate(cd.data, float(cd.curFloatSampleOffset));
-        cd.advancePointer(lfm);
-        return ret * cd.vol;
+        offset = float(cd.curFloatSampleOffset);
+        return cd.data;
     } else if (cd.curFloatSampleOffset > (cd.frames - 1)) {
         // if not more data, something is wrong - we ran past end.
         // this can happen with transpose is high..
 #ifdef _LOG
         //SQINFO("ran past end offset=%f frames=%d", cd.curFloatSampleOffset, cd.frames);
 #endif
-        return 0;
+        return nullptr;
     } else if (cd.curFloatSampleOffset < 1) {
         // If we are right at the start, we need to use the offset buffer
         // This won't be correct if we are looping
@@ -93,9 +140,8 @@ float Streamer::stepTranspose(ChannelData& cd, float lfm) {
             //SQINFO("start: offset buffer interp,  x=%d to %d", x - 1, x + 2);
         }
 #endif
-        float ret = CubicInterpolator<float>::interpolate(cd.offsetBuffer, float(1 + cd.curFloatSampleOffset));
-        cd.advancePointer(lfm);
-        return ret * cd.vol;
+        offset = float(1 + cd.curFloatSampleOffset);
+        return cd.offsetBuffer;
     } else if (cd.loopActive) {
         assert(false);
     } else if (cd.curFloatSampleOffset >= (cd.frames - 2)) {
@@ -109,9 +155,8 @@ float Streamer::stepTranspose(ChannelData& cd, float lfm) {
             //SQINFO("end buffer interp,  x=%d to %d", x - 1, x + 2);
         }
 #endif
-        float ret = CubicInterpolator<float>::interpolate(cd.endBuffer, subIndex);
-        cd.advancePointer(lfm);
-        return ret * cd.vol;
+        offset = subIndex;
+        return cd.endBuffer;
     }
 
     if (cd.loopActive) {
@@ -123,7 +168,7 @@ float Streamer::stepTranspose(ChannelData& cd, float lfm) {
         }
     }
     //SQINFO("Stream defaul case offset=%f, total=%d", cd.curFloatSampleOffset, cd.frames);
-    return 0;
+    return nullptr;
 }
 
 void Streamer::ChannelData::advancePointer(float lfm) {
@@ -2,6 +2,7 @@
 #pragma once
 
 #include "SimdBlocks.h"
+#include "SimdDispatch.h"
 #include "CompiledRegion.h"
 #include "SqLog.h"
 
@@ -31,6 +32,13 @@ public:
      * not the pitch modulation
      */
     float_4 step(float_4 fm, bool fmEnabled);
+
+    /**
+     * Like step, but instead of interpolating it fills in the taps, fraction
+     * and gain of the bank for the SimdDispatch sampleStep kernel.
+     * Advances the voices just like step.
+     */
+    void prepareBlock(SimdDispatch::SampleBank& bank, float_4 fm);
     void _assertValid();
 
     bool _isTransposed(int channel) const;
@@ -87,5 +95,17 @@ public:
     float stepNoTranspose(ChannelData&);
     float stepTranspose(ChannelData&, const float lfm);
 
+    /**
+     * Finds the buffer we should interpolate from, and the offset into it.
+     * Returns nullptr if there is nothing to play.
+     */
+    const float* findInterpolationBuffer(ChannelData&, float& offset);
+
     const ChannelData& _cd(int channel) const;
+
+private:
+    // for prepareBlock
+    float_4 blockTaps[4] = {0, 0, 0, 0};
+    float_4 blockFraction = 0;
+    float_4 blockGain = 0;
 };
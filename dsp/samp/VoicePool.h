@@ -0,0 +1,168 @@
+#pragma once
+
+#include <assert.h>
+
+#include "BankActivity.h"
+#include "SimdBlocks.h"
+
+/**
+ * Assigns the (up to 16) input channels of Samp to a larger pool of voices.
+ *
+ * Every new note gets its own voice, and the voice the channel was playing
+ * before is left to finish its release tail. So re-triggering a channel doesn't
+ * cut off the previous note, and more than 16 voices can be sounding at once.
+ *
+ * A new note always gets the lowest numbered free voice, so the active voices stay
+ * packed into the first few banks of four, and the rest of the banks can sleep.
+ * When there are no free voices it steals the quietest released voice
+ * (the oldest one, if there is a tie).
+ *
+ * Voice v is lane (v % 4) of bank (v / 4).
+ */
+template <int NumVoices>
+class VoicePool {
+public:
+    static const int numVoices = NumVoices;
+    static const int numBanks = NumVoices / 4;
+    static const int numChannels = 16;
+
+    VoicePool();
+
+    /**
+     * Starts a new note on a channel.
+     * The note the channel was holding (if any) is released.
+     * @returns the voice to play it on.
+     */
+    int noteOn(int channel);
+
+    /**
+     * Releases the voice the channel is holding, if any.
+     */
+    void noteOff(int channel);
+
+    /**
+     * Tells the pool how loud the four voices in a bank are.
+     * Released voices that are silent are free to be re-used.
+     */
+    void setLevels(int bank, float_4 levels);
+
+    /**
+     * @returns simd mask of the voices in the bank that are held.
+     */
+    float_4 getGates(int bank) const {
+        return held[bank] > float_4::zero();
+    }
+
+    /**
+     * @returns the channel that most recently played on this voice, or -1 if never used.
+     * A released voice still belongs to its channel until it is re-used,
+     * so its tail goes to the same output.
+     */
+    int getChannel(int voice) const {
+        return voiceChannel[voice];
+    }
+
+    /**
+     * @returns the voice that channel most recently started, or -1
+     */
+    int getVoice(int channel) const {
+        return channelVoice[channel];
+    }
+
+    bool isHeld(int voice) const {
+        return held[voice / 4][voice % 4] != 0;
+    }
+
+private:
+    int voiceChannel[NumVoices];
+    unsigned voiceStartTime[NumVoices];
+    float voiceLevel[NumVoices];
+    int channelVoice[numChannels];
+
+    // 1 or 0 for each voice.
+    float_4 held[numBanks];
+    unsigned noteCounter = 0;
+
+    int findVoice() const;
+    void setHeld(int voice, bool on) {
+        held[voice / 4][voice % 4] = on ? 1.f : 0.f;
+    }
+
+    static_assert((NumVoices % 4) == 0, "voices come in banks of four");
+    static_assert(NumVoices > numChannels, "must have room for release tails");
+};
+
+template <int NumVoices>
+inline VoicePool<NumVoices>::VoicePool() {
+    for (int i = 0; i < NumVoices; ++i) {
+        voiceChannel[i] = -1;
+        voiceStartTime[i] = 0;
+        voiceLevel[i] = 0;
+    }
+    for (int i = 0; i < numChannels; ++i) {
+        channelVoice[i] = -1;
+    }
+    for (int i = 0; i < numBanks; ++i) {
+        held[i] = float_4::zero();
+    }
+}
+
+template <int NumVoices>
+inline int VoicePool<NumVoices>::noteOn(int channel) {
+    assert(channel >= 0 && channel < numChannels);
+    noteOff(channel);
+
+    const int voice = findVoice();
+    const int oldChannel = voiceChannel[voice];
+    if (oldChannel >= 0 && channelVoice[oldChannel] == voice) {
+        channelVoice[oldChannel] = -1;
+    }
+
+    voiceChannel[voice] = channel;
+    voiceStartTime[voice] = ++noteCounter;
+    channelVoice[channel] = voice;
+    setHeld(voice, true);
+    return voice;
+}
+
+template <int NumVoices>
+inline void VoicePool<NumVoices>::noteOff(int channel) {
+    assert(channel >= 0 && channel < numChannels);
+    const int voice = channelVoice[channel];
+    if (voice >= 0) {
+        setHeld(voice, false);
+    }
+}
+
+template <int NumVoices>
+inline void VoicePool<NumVoices>::setLevels(int bank, float_4 levels) {
+    assert(bank >= 0 && bank < numBanks);
+    for (int i = 0; i < 4; ++i) {
+        voiceLevel[bank * 4 + i] = levels[i];
+    }
+}
+
+template <int NumVoices>
+inline int VoicePool<NumVoices>::findVoice() const {
+    for (int i = 0; i < NumVoices; ++i) {
+        if (voiceChannel[i] < 0 || (!isHeld(i) && voiceLevel[i] <= BankActivity::silenceLevel())) {
+            return i;
+        }
+    }
+
+    // Nothing free - steal a release tail. There are more voices than channels,
+    // so there is always at least one.
+    int best = -1;
+    for (int i = 0; i < NumVoices; ++i) {
+        if (isHeld(i)) {
+            continue;
+        }
+        if ((best < 0) ||
+            (voiceLevel[i] < voiceLevel[best]) ||
+            (voiceLevel[i] == voiceLevel[best] && voiceStartTime[i] < voiceStartTime[best])) {
+            best = i;
+        }
+    }
+    assert(best >= 0);
+    return best;
+}
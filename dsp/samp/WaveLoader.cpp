@@ -1,12 +1,18 @@
 
 #include "WaveLoader.h"
+#include "SamplePrefetcher.h"
 #include "SqLog.h"
 
 #include <assert.h>
 #include <algorithm>
 
+// out of line, where SamplePrefetcher is a complete type
+WaveLoader::WaveLoader() = default;
+WaveLoader::~WaveLoader() = default;
+
 void WaveLoader::clear() {
     finalInfo.clear();
+    finalStamps.clear();
 }
 
 WaveLoader::WaveInfoPtr WaveLoader::getInfo(int index) const {
@@ -23,6 +29,31 @@ void WaveLoader::addNextSample(const FilePath& fileName) {
     curLoadIndex = 0;
 }
 
+void WaveLoader::reuseFrom(const WaveLoader& previous) {
+    assert(!didLoad);
+    assert(finalInfo.size() == finalStamps.size());
+    assert(previous.finalInfo.size() == previous.finalStamps.size());
+    for (size_t i = 0; i < previous.finalInfo.size(); ++i) {
+        const FileStamp& stamp = previous.finalStamps[i];
+        if (stamp.isValid() && previous.isReady(int(i) + 1)) {
+            Reusable& r = reusable[previous.finalInfo[i]->getFileName()];
+            r.info = previous.finalInfo[i];
+            r.stamp = stamp;
+        }
+    }
+}
+
+WaveLoader::WaveInfoPtr WaveLoader::findReusable(const FilePath& file, const FileStamp& stamp) const {
+    if (!stamp.isValid()) {
+        return nullptr;
+    }
+    auto it = reusable.find(file.toString());
+    if (it == reusable.end() || !(it->second.stamp == stamp)) {
+        return nullptr;
+    }
+    return it->second.info;
+}
+
 float WaveLoader::getProgressPercent() const {
     float done = float(curLoadIndex);
     float total = float(filesToLoad.size());
@@ -35,24 +66,92 @@ WaveLoader::LoaderState WaveLoader::loadNextFile() {
         return LoaderState::Done;
     }
 
+    if (lazy && !ready) {
+        ready.reset(new std::atomic<bool>[filesToLoad.size()]);
+        for (size_t i = 0; i < filesToLoad.size(); ++i) {
+            ready[i] = false;
+        }
+    }
+
     FilePath& file = filesToLoad[curLoadIndex];
-    WaveInfoPtr fileLoader = loaderFactory(file);
-    std::string err;
+    const FileStamp stamp = getFileStamp(file);
+    WaveInfoPtr fileLoader = findReusable(file, stamp);
+    if (fileLoader) {
+        ++numReused;
+        if (lazy) {
+            ready[curLoadIndex] = true;
+        }
+    } else if (lazy) {
+        // don't load it now, but do report missing files the same as we would have
+        if (!stamp.isValid()) {
+            lastError = "can't open " + file.getFilenamePart();
+            return LoaderState::Error;
+        }
+        fileLoader = loaderFactory(file);
+    } else {
+        fileLoader = loaderFactory(file);
+        std::string err;
 
-    const bool b = fileLoader->load(err);
-    if (!b) {
-        // bail on first error
-        assert(!err.empty());
-        lastError = err;
-        return LoaderState::Error;
+        const bool b = fileLoader->load(err);
+        if (!b) {
+            // bail on first error
+            assert(!err.empty());
+            lastError = err;
+            return LoaderState::Error;
+        }
     }
-    
+
     finalInfo.push_back(fileLoader);
+    finalStamps.push_back(stamp);
     curLoadIndex++;
     auto ret = curLoadIndex >= int(filesToLoad.size()) ? LoaderState::Done : LoaderState::Progress;
     if (ret == LoaderState::Done) {
         didLoad = true;
+
+        // let go of the old samples we didn't use
+        reusable.clear();
     }
 
     return ret;
 }
+
+void WaveLoader::startPrefetch(const std::vector<int>& pitches, ErrorCallback onError) {
+    assert(lazy);
+    assert(didLoad);
+    assert(!prefetcher);
+    assert(pitches.size() == finalInfo.size());
+    prefetchErrorCallback = onError;
+    prefetcher.reset(new SamplePrefetcher(*this, pitches));
+}
+
+void WaveLoader::requestLoad(int index, int midiPitch) {
+    if (prefetcher) {
+        prefetcher->request(index, midiPitch);
+    }
+}
+
+void WaveLoader::_waitForPrefetch() {
+    if (prefetcher) {
+        prefetcher->waitUntilDone();
+    }
+}
+
+void WaveLoader::loadDeferred(int index) {
+    assert(lazy);
+    WaveInfoPtr info = finalInfo[index - 1];
+    if (ready[index - 1]) {
+        return;
+    }
+    std::string err;
+    if (info->load(err)) {
+        ready[index - 1].store(true, std::memory_order_release);
+        return;
+    }
+
+    // Not much point trying it again, so it stays silent. Make sure someone hears about it.
+    assert(!err.empty());
+    SQWARN("could not load %s: %s", info->getFileName().c_str(), err.c_str());
+    if (prefetchErrorCallback) {
+        prefetchErrorCallback(err);
+    }
+}
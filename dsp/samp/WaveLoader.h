@@ -1,12 +1,19 @@
 #pragma once
 
 #include <assert.h>
+#include <stdint.h>
+
+#include <atomic>
+#include <functional>
+#include <map>
 #include <memory>
 #include <string>
 #include <vector>
 
 #include "FilePath.h"
 
+class SamplePrefetcher;
+
 // Abstract interface for audio files
 class WaveInfoInterface {
 public:
@@ -30,11 +37,72 @@ public:
     };
     using WaveInfoPtr = std::shared_ptr<WaveInfoInterface>;
 
+    WaveLoader();
+    ~WaveLoader();
+
     /** Sample files are added one at a time until "all"
      * are loaded.
      */
     void addNextSample(const FilePath& fileName);
 
+    /**
+     * Lets this loader use samples the previous one already decoded,
+     * so reloading an edited instrument only decodes the files that are new or changed.
+     * A sample is re-used if it has the same path, and the file's size
+     * and modification time haven't changed since it was loaded.
+     * Call before loadNextFile.
+     */
+    void reuseFrom(const WaveLoader& previous);
+
+    /**
+     * @returns how many files were re-used instead of loaded.
+     */
+    int getNumReused() const { return numReused; }
+
+    /**
+     * In lazy mode loadNextFile only checks that the files are there,
+     * so a big instrument is ready to play right away.
+     * The sample data is decoded later by a prefetch thread (see startPrefetch).
+     * Call before loadNextFile.
+     */
+    void setLazy(bool b) { lazy = b; }
+
+    using ErrorCallback = std::function<void(const std::string&)>;
+
+    /**
+     * Starts decoding the samples, after loadNextFile is Done. Only for lazy mode.
+     * @param pitches is a midi pitch for each sample, to decide which ones to load first.
+     * @param onError is called from the prefetch thread for each sample that won't decode.
+     *      Those samples are never ready, so notes that use them stay silent.
+     */
+    void startPrefetch(const std::vector<int>& pitches, ErrorCallback onError = nullptr);
+
+    /**
+     * @returns true if the data for a sample may be used.
+     * Always true if not lazy. Safe to call from the audio thread.
+     */
+    bool isReady(int index) const {
+        if (!lazy) {
+            return true;
+        }
+        if (index < 1 || index > int(finalInfo.size())) {
+            return false;
+        }
+        return ready[index - 1].load(std::memory_order_acquire);
+    }
+
+    /**
+     * Asks for a sample that isn't ready yet to be loaded soon.
+     * Safe (non-blocking) to call from the audio thread.
+     */
+    void requestLoad(int index, int midiPitch);
+
+    /**
+     * Blocks until the prefetch thread has loaded everything.
+     */
+    void _waitForPrefetch();
+    const SamplePrefetcher* _prefetcher() const { return prefetcher.get(); }
+
     /**
      * load() is called one - after all the samples have been added.
      * load will load all of them.
@@ -64,13 +132,54 @@ public:
 private:
    // Tests _testMode = Tests::None;
 
+    /**
+     * What we know about a file on disk, to tell if it changed.
+     * -1 if unknown.
+     */
+    class FileStamp {
+    public:
+        int64_t modTime = -1;   // nanoseconds
+        int64_t size = -1;
+        bool isValid() const { return modTime >= 0; }
+        bool operator==(const FileStamp& other) const {
+            return modTime == other.modTime && size == other.size;
+        }
+    };
+
+    class Reusable {
+    public:
+        WaveInfoPtr info;
+        FileStamp stamp;
+    };
+
     std::vector<FilePath> filesToLoad;
     std::vector<WaveInfoPtr> finalInfo;
+    std::vector<FileStamp> finalStamps;   // one for each finalInfo
+
+    // samples from the previous loader, by path
+    std::map<std::string, Reusable> reusable;
+    int numReused = 0;
+
     static WaveInfoPtr loaderFactory(const FilePath& file);
+    static FileStamp getFileStamp(const FilePath& file);
+    WaveInfoPtr findReusable(const FilePath& file, const FileStamp& stamp) const;
     void clear();
     bool didLoad = false;
     void validate();
     int curLoadIndex = -1;
+
+    bool lazy = false;
+
+    // In lazy mode, one for each sample. Set when its data may be used.
+    std::unique_ptr<std::atomic<bool>[]> ready;
+    ErrorCallback prefetchErrorCallback;
+
+    // called by the prefetch thread
+    friend class SamplePrefetcher;
+    void loadDeferred(int index);
+
+    // this is last, so its thread stops before anything else is destroyed
+    std::unique_ptr<SamplePrefetcher> prefetcher;
 };
 
 using WaveLoaderPtr = std::shared_ptr<WaveLoader>;
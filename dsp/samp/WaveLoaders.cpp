@@ -1,4 +1,10 @@
 
+#include <sys/stat.h>
+
+#ifdef ARCH_WIN
+#include <windows.h>
+#endif
+
 #include "FlacReader.h"
 #include "SqLog.h"
 #include "WaveLoader.h"
@@ -213,6 +219,40 @@ WaveLoader::WaveInfoPtr WaveLoader::loaderFactory(const FilePath& file) {
     return loader;
 }
 
+// Modification times are in nanoseconds, so a file that is re-written
+// with the same size in the same second still looks different.
+#ifdef ARCH_WIN
+WaveLoader::FileStamp WaveLoader::getFileStamp(const FilePath& file) {
+    FileStamp ret;
+    wchar_t* widePath = wchar_from_utf8(file.toString().c_str());
+    WIN32_FILE_ATTRIBUTE_DATA attributes;
+    const BOOL ok = GetFileAttributesExW(widePath, GetFileExInfoStandard, &attributes);
+    free(widePath);
+    if (ok) {
+        // FILETIME is in 100 ns units
+        const int64_t writeTime = (int64_t(attributes.ftLastWriteTime.dwHighDateTime) << 32) | attributes.ftLastWriteTime.dwLowDateTime;
+        ret.modTime = writeTime * 100;
+        ret.size = (int64_t(attributes.nFileSizeHigh) << 32) | attributes.nFileSizeLow;
+    }
+    return ret;
+}
+#else
+WaveLoader::FileStamp WaveLoader::getFileStamp(const FilePath& file) {
+    FileStamp ret;
+    struct stat st;
+    if (stat(file.toString().c_str(), &st) == 0) {
+#ifdef ARCH_MAC
+        const struct timespec& modTime = st.st_mtimespec;
+#else
+        const struct timespec& modTime = st.st_mtim;
+#endif
+        ret.modTime = int64_t(modTime.tv_sec) * 1000000000 + int64_t(modTime.tv_nsec);
+        ret.size = int64_t(st.st_size);
+    }
+    return ret;
+}
+#endif
+
 void WaveLoader::_setTestMode(Tests test) {
     WaveInfoPtr wav = std::make_shared<TestFileLoader>(FilePath(), test);
     switch (test) {
@@ -223,6 +263,7 @@ void WaveLoader::_setTestMode(Tests test) {
         case Tests::DCTenSec:
         case Tests::DCOneSec: {
             finalInfo.push_back(wav);
+            finalStamps.push_back(FileStamp());
             std::string err;
             const bool b = wav->load(err);
             (void) b;
@@ -0,0 +1,72 @@
+#pragma once
+
+#include "SimdBlocks.h"
+
+/**
+ * float_8 is an eight lane float vector.
+ *
+ * It is made from two float_4, so code written with it will compile and run on
+ * any machine that VCV runs on. The lanes are laid out in memory exactly like
+ * two adjacent float_4, so an array of float_4 may be processed as half as many float_8.
+ *
+ * Composites should not try to use AVX instructions directly. Code that is worth
+ * running with 256 bit registers goes into a kernel in SimdDispatch, which will
+ * pick the AVX2 version at startup if the CPU supports it.
+ */
+struct float_8 {
+    float_4 lo;
+    float_4 hi;
+
+    float_8() = default;
+    float_8(float x) : lo(x), hi(x) {}
+    float_8(float_4 a, float_4 b) : lo(a), hi(b) {}
+
+    static float_8 zero() {
+        return float_8(float_4::zero(), float_4::zero());
+    }
+
+    static float_8 load(const float* p) {
+        return float_8(float_4::load(p), float_4::load(p + 4));
+    }
+
+    void store(float* p) {
+        lo.store(p);
+        hi.store(p + 4);
+    }
+
+    float operator[](int i) const {
+        return (i < 4) ? lo[i] : hi[i - 4];
+    }
+};
+
+inline float_8 operator+(const float_8& a, const float_8& b) { return float_8(a.lo + b.lo, a.hi + b.hi); }
+inline float_8 operator-(const float_8& a, const float_8& b) { return float_8(a.lo - b.lo, a.hi - b.hi); }
+inline float_8 operator*(const float_8& a, const float_8& b) { return float_8(a.lo * b.lo, a.hi * b.hi); }
+inline float_8 operator/(const float_8& a, const float_8& b) { return float_8(a.lo / b.lo, a.hi / b.hi); }
+inline float_8 operator-(const float_8& a) { return float_8(-a.lo, -a.hi); }
+
+inline float_8& operator+=(float_8& a, const float_8& b) { a = a + b; return a; }
+inline float_8& operator-=(float_8& a, const float_8& b) { a = a - b; return a; }
+inline float_8& operator*=(float_8& a, const float_8& b) { a = a * b; return a; }
+
+// comparisons return masks, just like float_4
+inline float_8 operator<(const float_8& a, const float_8& b) { return float_8(a.lo < b.lo, a.hi < b.hi); }
+inline float_8 operator>(const float_8& a, const float_8& b) { return float_8(a.lo > b.lo, a.hi > b.hi); }
+inline float_8 operator&(const float_8& a, const float_8& b) { return float_8(a.lo & b.lo, a.hi & b.hi); }
+inline float_8 operator|(const float_8& a, const float_8& b) { return float_8(a.lo | b.lo, a.hi | b.hi); }
+
+class SimdBlocks8 {
+public:
+    static float_8 ifelse(const float_8& mask, const float_8& a, const float_8& b) {
+        return float_8(SimdBlocks::ifelse(mask.lo, a.lo, b.lo), SimdBlocks::ifelse(mask.hi, a.hi, b.hi));
+    }
+    static float_8 wrapPhase01(const float_8& x) {
+        return float_8(SimdBlocks::wrapPhase01(x.lo), SimdBlocks::wrapPhase01(x.hi));
+    }
+    static float_8 sinTwoPi(const float_8& x) {
+        return float_8(SimdBlocks::sinTwoPi(x.lo), SimdBlocks::sinTwoPi(x.hi));
+    }
+    static float_8 fold(const float_8& x) {
+        return float_8(SimdBlocks::fold(x.lo), SimdBlocks::fold(x.hi));
+    }
+};
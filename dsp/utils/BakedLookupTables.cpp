@@ -0,0 +1,960 @@
+// Generated by "test.exe --bake". Do not edit by hand.
+// See BakedLookupTables.h
+
+#include "BakedLookupTables.h"
+
+alignas(16) static const float audioTaperEntries[66] = {
+    0.0f, 0.00788696669f, 0.00788696669f, 0.00788696669f, 0.0157739334f, 0.00788696669f, 0.0236609001f, 0.00788696669f,
+    0.0315478668f, 0.00788696669f, 0.0394348353f, 0.00788696669f, 0.0473218001f, 0.00788696669f, 0.0552087687f, 0.00788696669f,
+    0.0630957335f, 0.00769884419f, 0.0707945749f, 0.00863824505f, 0.0794328228f, 0.00969227031f, 0.0891250968f, 0.0108749066f,
+    0.100000001f, 0.0122018456f, 0.112201847f, 0.0136906961f, 0.125892535f, 0.0153612131f, 0.141253754f, 0.0172355641f,
+    0.158489317f, 0.0193386208f, 0.177827939f, 0.0216982905f, 0.199526235f, 0.0243458822f, 0.22387211f, 0.0273165293f,
+    0.251188636f, 0.0306496508f, 0.281838298f, 0.0343894735f, 0.316227764f, 0.0385856219f, 0.354813397f, 0.0432937816f,
+    0.398107171f, 0.048576422f, 0.446683586f, 0.054503642f, 0.501187205f, 0.0611540899f, 0.562341332f, 0.0686160177f,
+    0.630957365f, 0.0769884363f, 0.707945764f, 0.0863824487f, 0.794328213f, 0.0969227031f, 0.891250908f, 0.108749062f,
+    1.0f, 0.122018456f
+};
+
+alignas(16) static const float audioTaper18Entries[66] = {
+    0.0f, 0.0157365669f, 0.0157365669f, 0.0157365669f, 0.0314731337f, 0.0157365669f, 0.0472097024f, 0.0157365669f,
+    0.0629462674f, 0.0157365669f, 0.0786828399f, 0.0157365669f, 0.0944194049f, 0.0157365669f, 0.11015597f, 0.0157365669f,
+    0.125892535f, 0.0113535551f, 0.137246102f, 0.0123774698f, 0.149623573f, 0.0134937251f, 0.16311729f, 0.0147106498f,
+    0.177827939f, 0.0160373226f, 0.193865269f, 0.0174836405f, 0.211348906f, 0.0190603938f, 0.230409294f, 0.0207793452f,
+    0.251188636f, 0.0226533208f, 0.273841977f, 0.0246962979f, 0.298538268f, 0.0269235224f, 0.325461775f, 0.0293516051f,
+    0.354813397f, 0.0319986641f, 0.386812061f, 0.0348844491f, 0.421696514f, 0.0380304866f, 0.459726989f, 0.0414602458f,
+    0.501187205f, 0.045199316f, 0.54638654f, 0.049275592f, 0.595662117f, 0.053719487f, 0.649381638f, 0.0585641526f,
+    0.707945764f, 0.0638457313f, 0.771791518f, 0.0696036294f, 0.84139514f, 0.0758807957f, 0.917275906f, 0.0827240646f,
+    1.0f, 0.0901844949f
+};
+
+alignas(16) static const float bipolarAudioTaperEntries[66] = {
+    -1.0f, 0.205671772f, -0.794328213f, 0.163370892f, -0.630957365f, 0.129770115f, -0.501187205f, 0.103080064f,
+    -0.398107171f, 0.0818794072f, -0.316227764f, 0.0650391206f, -0.251188636f, 0.0516624115f, -0.199526235f, 0.0410369113f,
+    -0.158489317f, 0.0325967781f, -0.125892535f, 0.0258925408f, -0.100000001f, 0.0205671769f, -0.0794328228f, 0.0163370892f,
+    -0.0630957335f, 0.0157739334f, -0.0473218001f, 0.0157739334f, -0.0315478668f, 0.0157739334f, -0.0157739334f, 0.0157739334f,
+    0.0f, 0.0157739334f, 0.0157739334f, 0.0157739334f, 0.0315478668f, 0.0157739334f, 0.0473218001f, 0.0157739334f,
+    0.0630957335f, 0.0163370892f, 0.0794328228f, 0.0205671769f, 0.100000001f, 0.0258925408f, 0.125892535f, 0.0325967781f,
+    0.158489317f, 0.0410369113f, 0.199526235f, 0.0516624115f, 0.251188636f, 0.0650391206f, 0.316227764f, 0.0818794072f,
+    0.398107171f, 0.103080064f, 0.501187205f, 0.129770115f, 0.630957365f, 0.163370892f, 0.794328213f, 0.205671772f,
+    1.0f, 0.258925408f
+};
+
+alignas(16) static const float bipolarAudioTaper30Entries[66] = {
+    -1.0f, 0.250105798f, -0.749894202f, 0.187552884f, -0.562341332f, 0.140644819f, -0.421696514f, 0.105468735f,
+    -0.316227764f, 0.0790903941f, -0.237137377f, 0.0593094304f, -0.177827939f, 0.0444757976f, -0.133352146f, 0.0333521441f,
+    -0.100000001f, 0.0250105783f, -0.0749894232f, 0.0187552888f, -0.0562341325f, 0.0140644824f, -0.0421696492f, 0.0105468733f,
+    -0.0316227749f, 0.00790569372f, -0.023717083f, 0.00790569372f, -0.0158113874f, 0.00790569372f, -0.00790569372f, 0.00790569372f,
+    0.0f, 0.00790569372f, 0.00790569372f, 0.00790569372f, 0.0158113874f, 0.00790569372f, 0.023717083f, 0.00790569372f,
+    0.0316227749f, 0.0105468733f, 0.0421696492f, 0.0140644824f, 0.0562341325f, 0.0187552888f, 0.0749894232f, 0.0250105783f,
+    0.100000001f, 0.0333521441f, 0.133352146f, 0.0444757976f, 0.177827939f, 0.0593094304f, 0.237137377f, 0.0790903941f,
+    0.316227764f, 0.105468735f, 0.421696514f, 0.140644819f, 0.562341332f, 0.187552884f, 0.749894202f, 0.250105798f,
+    1.0f, 0.333521426f
+};
+
+alignas(16) static const float bipolarAudioTaper42Entries[66] = {
+    -1.0f, 0.331656069f, -0.668343902f, 0.221660331f, -0.446683586f, 0.148145333f, -0.298538268f, 0.0990120322f,
+    -0.199526235f, 0.0661740899f, -0.133352146f, 0.0442270488f, -0.0891250968f, 0.0295588803f, -0.0595662147f, 0.0197554976f,
+    -0.0398107171f, 0.0132034663f, -0.0266072508f, 0.00882445648f, -0.0177827943f, 0.00589777203f, -0.0118850218f, 0.00394173991f,
+    -0.0079432819f, 0.00198582048f, -0.00595746189f, 0.00198582048f, -0.00397164095f, 0.00198582048f, -0.00198582048f, 0.00198582048f,
+    0.0f, 0.00198582048f, 0.00198582048f, 0.00198582048f, 0.00397164095f, 0.00198582048f, 0.00595746189f, 0.00198582048f,
+    0.0079432819f, 0.00394173991f, 0.0118850218f, 0.00589777203f, 0.0177827943f, 0.00882445648f, 0.0266072508f, 0.0132034663f,
+    0.0398107171f, 0.0197554976f, 0.0595662147f, 0.0295588803f, 0.0891250968f, 0.0442270488f, 0.133352146f, 0.0661740899f,
+    0.199526235f, 0.0990120322f, 0.298538268f, 0.148145333f, 0.446683586f, 0.221660331f, 0.668343902f, 0.331656069f,
+    1.0f, 0.496235669f
+};
+
+alignas(16) static const float sinEntries[4098] = {
+    0.0f, 0.00306795677f, 0.00306795677f, 0.0030679279f, 0.00613588467f, 0.00306787016f, 0.00920375437f, 0.00306778355f,
+    0.0122715384f, 0.00306766806f, 0.015339206f, 0.00306752371f, 0.0184067301f, 0.00306735048f, 0.0214740802f, 0.00306714815f,
+    0.024541229f, 0.00306691718f, 0.027608145f, 0.00306665734f, 0.030674804f, 0.00306636863f, 0.0337411724f, 0.00306605105f,
+    0.0368072242f, 0.0030657046f, 0.0398729257f, 0.00306532928f, 0.0429382585f, 0.00306492508f, 0.0460031815f, 0.00306449225f,
+    0.0490676761f, 0.00306403032f, 0.052131705f, 0.00306353974f, 0.0551952459f, 0.00306302006f, 0.0582582653f, 0.00306247175f,
+    0.061320737f, 0.00306189456f, 0.0643826276f, 0.00306128873f, 0.0674439222f, 0.00306065381f, 0.070504576f, 0.00305999024f,
+    0.0735645667f, 0.0030592978f, 0.0766238645f, 0.00305857649f, 0.0796824396f, 0.00305782654f, 0.0827402622f, 0.00305704772f,
+    0.0857973099f, 0.00305624027f, 0.0888535529f, 0.00305540394f, 0.0919089541f, 0.00305453874f, 0.0949634984f, 0.0030536449f,
+    0.0980171412f, 0.00305272243f, 0.10106986f, 0.00305177108f, 0.104121633f, 0.0030507911f, 0.107172422f, 0.00304978224f,
+    0.110222206f, 0.00304874498f, 0.113270953f, 0.00304767862f, 0.116318628f, 0.00304658385f, 0.119365215f, 0.00304546044f,
+    0.122410677f, 0.00304430816f, 0.125454977f, 0.00304312748f, 0.128498107f, 0.00304191792f, 0.13154003f, 0.00304067973f,
+    0.134580702f, 0.00303941313f, 0.137620121f, 0.00303811766f, 0.140658244f, 0.00303679379f, 0.143695027f, 0.00303544127f,
+    0.146730468f, 0.00303406012f, 0.149764538f, 0.00303265057f, 0.152797192f, 0.00303121237f, 0.155828401f, 0.00302974577f,
+    0.15885815f, 0.00302825053f, 0.161886394f, 0.00302672666f, 0.164913118f, 0.00302517437f, 0.167938292f, 0.00302359369f,
+    0.170961887f, 0.00302198459f, 0.173983872f, 0.0030203471f, 0.177004218f, 0.00301868096f, 0.180022895f, 0.00301698665f,
+    0.183039889f, 0.0030152637f, 0.186055154f, 0.00301351259f, 0.18906866f, 0.00301173283f, 0.192080393f, 0.0030099249f,
+    0.195090324f, 0.0030080888f, 0.198098406f, 0.00300622405f, 0.201104641f, 0.00300433114f, 0.204108968f, 0.00300241006f,
+    0.207111374f, 0.0030004608f, 0.210111842f, 0.00299848313f, 0.213110313f, 0.00299647707f, 0.216106802f, 0.00299444306f,
+    0.219101235f, 0.00299238088f, 0.222093627f, 0.00299029029f, 0.225083917f, 0.00298817176f, 0.228072077f, 0.00298602507f,
+    0.231058106f, 0.00298385019f, 0.234041959f, 0.00298164738f, 0.237023607f, 0.0029794164f, 0.24000302f, 0.00297715748f,
+    0.242980182f, 0.00297487038f, 0.24595505f, 0.00297255535f, 0.248927608f, 0.00297021237f, 0.251897812f, 0.00296784146f,
+    0.254865646f, 0.0029654426f, 0.257831097f, 0.00296301581f, 0.260794103f, 0.00296056108f, 0.263754666f, 0.0029580784f,
+    0.266712755f, 0.00295556802f, 0.269668311f, 0.00295302994f, 0.272621363f, 0.00295046391f, 0.275571823f, 0.00294787018f,
+    0.27851969f, 0.0029452485f, 0.281464934f, 0.00294259936f, 0.284407526f, 0.00293992227f, 0.287347466f, 0.00293721771f,
+    0.290284663f, 0.00293448544f, 0.293219149f, 0.00293172547f, 0.296150893f, 0.00292893802f, 0.299079835f, 0.0029261231f,
+    0.302005947f, 0.00292328047f, 0.304929227f, 0.00292041036f, 0.307849646f, 0.00291751279f, 0.310767144f, 0.00291458773f,
+    0.313681751f, 0.00291163521f, 0.316593379f, 0.00290865521f, 0.319502026f, 0.00290564797f, 0.322407693f, 0.00290261325f,
+    0.32531029f, 0.00289955153f, 0.328209847f, 0.0028964621f, 0.331106305f, 0.00289334566f, 0.333999664f, 0.00289020198f,
+    0.336889863f, 0.00288703106f, 0.339776874f, 0.0028838329f, 0.342660725f, 0.00288060773f, 0.345541328f, 0.00287735532f,
+    0.348418683f, 0.0028740759f, 0.351292759f, 0.00287076924f, 0.354163527f, 0.0028674358f, 0.357030958f, 0.00286407536f,
+    0.359895051f, 0.00286068791f, 0.362755716f, 0.00285727344f, 0.365612984f, 0.00285383221f, 0.368466824f, 0.00285036396f,
+    0.371317208f, 0.00284686894f, 0.374164075f, 0.00284334715f, 0.377007425f, 0.00283979881f, 0.379847199f, 0.00283622346f,
+    0.382683426f, 0.00283262157f, 0.385516047f, 0.0028289929f, 0.388345033f, 0.00282533769f, 0.391170382f, 0.00282165571f,
+    0.393992037f, 0.00281794742f, 0.396809995f, 0.00281421235f, 0.399624199f, 0.00281045097f, 0.402434647f, 0.00280666305f,
+    0.405241311f, 0.00280284882f, 0.408044159f, 0.00279900827f, 0.410843164f, 0.00279514119f, 0.413638324f, 0.0027912478f,
+    0.416429549f, 0.00278732833f, 0.419216901f, 0.00278338254f, 0.422000259f, 0.00277941045f, 0.424779683f, 0.00277541229f,
+    0.427555084f, 0.00277138781f, 0.430326492f, 0.00276733749f, 0.433093816f, 0.00276326109f, 0.435857087f, 0.00275915861f,
+    0.438616246f, 0.00275503029f, 0.441371262f, 0.00275087589f, 0.444122136f, 0.00274669565f, 0.446868837f, 0.00274248957f,
+    0.449611336f, 0.00273825764f, 0.452349573f, 0.00273399986f, 0.455083579f, 0.00272971648f, 0.457813293f, 0.00272540725f,
+    0.460538715f, 0.00272107264f, 0.463259786f, 0.00271671219f, 0.465976506f, 0.00271232636f, 0.468688816f, 0.00270791468f,
+    0.471396744f, 0.00270347786f, 0.474100202f, 0.00269901543f, 0.47679922f, 0.00269452762f, 0.479493767f, 0.00269001443f,
+    0.482183784f, 0.00268547586f, 0.484869242f, 0.00268091215f, 0.487550169f, 0.00267632306f, 0.490226477f, 0.00267170905f,
+    0.492898196f, 0.00266706967f, 0.495565265f, 0.00266240514f, 0.498227656f, 0.0026577157f, 0.500885367f, 0.00265300111f,
+    0.50353837f, 0.00264826161f, 0.506186664f, 0.0026434972f, 0.50883013f, 0.00263870787f, 0.511468828f, 0.00263389386f,
+    0.514102757f, 0.00262905471f, 0.516731799f, 0.00262419111f, 0.519356012f, 0.00261930283f, 0.521975279f, 0.00261438964f,
+    0.524589658f, 0.002609452f, 0.527199149f, 0.00260448991f, 0.529803634f, 0.00259950315f, 0.532403111f, 0.00259449193f,
+    0.534997642f, 0.0025894565f, 0.537587047f, 0.0025843964f, 0.540171444f, 0.00257931207f, 0.542750776f, 0.00257420354f,
+    0.545324981f, 0.00256907078f, 0.547894061f, 0.00256391382f, 0.550457954f, 0.00255873264f, 0.553016722f, 0.00255352748f,
+    0.555570245f, 0.0025482981f, 0.558118522f, 0.00254304498f, 0.560661554f, 0.00253776787f, 0.563199341f, 0.00253246678f,
+    0.565731823f, 0.00252714194f, 0.568258941f, 0.00252179313f, 0.570780754f, 0.00251642079f, 0.573297143f, 0.00251102471f,
+    0.575808167f, 0.00250560511f, 0.578313768f, 0.00250016176f, 0.580813944f, 0.0024946949f, 0.583308637f, 0.00248920452f,
+    0.585797846f, 0.00248369086f, 0.588281572f, 0.00247815368f, 0.590759695f, 0.00247259322f, 0.593232274f, 0.00246700947f,
+    0.59569931f, 0.00246140244f, 0.598160684f, 0.00245577237f, 0.600616455f, 0.00245011924f, 0.603066623f, 0.00244444283f,
+    0.605511069f, 0.0024387436f, 0.607949793f, 0.00243302132f, 0.610382795f, 0.00242727622f, 0.612810075f, 0.00242150808f,
+    0.615231574f, 0.00241571735f, 0.61764729f, 0.0024099038f, 0.620057225f, 0.00240406767f, 0.622461259f, 0.00239820872f,
+    0.624859512f, 0.00239232741f, 0.627251804f, 0.00238642353f, 0.629638255f, 0.00238049706f, 0.632018745f, 0.00237454823f,
+    0.634393275f, 0.00236857706f, 0.636761844f, 0.00236258353f, 0.639124453f, 0.00235656789f, 0.641481042f, 0.00235053012f,
+    0.643831551f, 0.00234447001f, 0.64617604f, 0.002338388f, 0.64851439f, 0.00233228388f, 0.65084666f, 0.00232615788f,
+    0.653172851f, 0.00232000998f, 0.655492842f, 0.0023138402f, 0.657806695f, 0.00230764877f, 0.660114348f, 0.00230143545f,
+    0.662415802f, 0.00229520071f, 0.664710999f, 0.00228894409f, 0.666999936f, 0.00228266604f, 0.669282615f, 0.00227636658f,
+    0.671558976f, 0.00227004546f, 0.673829019f, 0.00226370315f, 0.676092684f, 0.00225733966f, 0.678350031f, 0.00225095474f,
+    0.680601001f, 0.00224454864f, 0.682845533f, 0.00223812135f, 0.685083687f, 0.0022316731f, 0.687315345f, 0.00222520391f,
+    0.689540565f, 0.00221871352f, 0.691759229f, 0.00221220241f, 0.693971455f, 0.00220567058f, 0.696177125f, 0.00219911803f,
+    0.698376238f, 0.00219254452f, 0.700568795f, 0.00218595052f, 0.702754736f, 0.0021793358f, 0.704934061f, 0.00217270083f,
+    0.707106769f, 0.00216604536f, 0.709272802f, 0.00215936941f, 0.711432219f, 0.00215267297f, 0.71358484f, 0.0021459565f,
+    0.715730846f, 0.00213921978f, 0.717870057f, 0.0021324628f, 0.720002532f, 0.00212568603f, 0.722128212f, 0.00211888901f,
+    0.724247098f, 0.00211207219f, 0.726359129f, 0.00210523535f, 0.728464365f, 0.00209837873f, 0.730562747f, 0.00209150254f,
+    0.732654274f, 0.00208460633f, 0.734738886f, 0.00207769079f, 0.736816585f, 0.0020707557f, 0.73888731f, 0.00206380081f,
+    0.740951121f, 0.00205682684f, 0.743007958f, 0.0020498333f, 0.745057762f, 0.00204282044f, 0.747100592f, 0.00203578849f,
+    0.749136388f, 0.00202873745f, 0.751165152f, 0.00202166708f, 0.753186822f, 0.00201457785f, 0.755201399f, 0.00200746953f,
+    0.757208824f, 0.00200034236f, 0.759209216f, 0.00199319655f, 0.761202395f, 0.00198603189f, 0.763188422f, 0.00197884836f,
+    0.765167236f, 0.00197164621f, 0.767138898f, 0.00196442567f, 0.769103348f, 0.00195718673f, 0.771060526f, 0.00194992905f,
+    0.773010433f, 0.00194265321f, 0.774953127f, 0.00193535909f, 0.77688849f, 0.00192804669f, 0.778816521f, 0.00192071614f,
+    0.780737221f, 0.00191336754f, 0.78265059f, 0.00190600101f, 0.784556568f, 0.00189861644f, 0.786455214f, 0.00189121405f,
+    0.78834641f, 0.00188379386f, 0.790230215f, 0.00187635585f, 0.792106569f, 0.00186890026f, 0.793975472f, 0.0018614271f,
+    0.795836926f, 0.00185393635f, 0.797690868f, 0.00184642815f, 0.799537241f, 0.00183890259f, 0.801376164f, 0.00183135981f,
+    0.803207517f, 0.00182379968f, 0.805031359f, 0.00181622244f, 0.806847572f, 0.00180862809f, 0.808656156f, 0.00180101662f,
+    0.81045717f, 0.00179338828f, 0.812250614f, 0.00178574317f, 0.81403631f, 0.00177808106f, 0.815814435f, 0.0017704023f,
+    0.817584813f, 0.0017627069f, 0.819347501f, 0.00175499497f, 0.8211025f, 0.00174726639f, 0.82284981f, 0.00173952139f,
+    0.824589312f, 0.0017317601f, 0.826321065f, 0.00172398239f, 0.82804507f, 0.0017161885f, 0.829761207f, 0.00170837855f,
+    0.831469595f, 0.00170055241f, 0.833170176f, 0.00169271033f, 0.834862888f, 0.00168485229f, 0.836547732f, 0.00167697831f,
+    0.838224709f, 0.00166908861f, 0.839893818f, 0.0016611832f, 0.841554999f, 0.00165326218f, 0.843208253f, 0.00164532557f,
+    0.84485358f, 0.00163737347f, 0.84649092f, 0.001629406f, 0.848120332f, 0.00162142317f, 0.849741757f, 0.00161342509f,
+    0.851355195f, 0.00160541188f, 0.852960587f, 0.00159738341f, 0.854557991f, 0.00158934004f, 0.856147349f, 0.00158128166f,
+    0.857728601f, 0.00157320837f, 0.859301805f, 0.0015651203f, 0.860866964f, 0.00155701744f, 0.862423956f, 0.00154890004f,
+    0.863972843f, 0.00154076796f, 0.865513623f, 0.00153262145f, 0.867046237f, 0.0015244605f, 0.868570685f, 0.00151628512f,
+    0.870086968f, 0.00150809553f, 0.871595085f, 0.00149989175f, 0.873094976f, 0.00149167387f, 0.874586642f, 0.00148344191f,
+    0.876070082f, 0.00147519598f, 0.877545297f, 0.0014669362f, 0.879012227f, 0.00145866268f, 0.880470872f, 0.0014503753f,
+    0.881921291f, 0.00144207431f, 0.883363366f, 0.00143375981f, 0.884797096f, 0.00142543169f, 0.886222541f, 0.0014170903f,
+    0.887639642f, 0.00140873541f, 0.889048338f, 0.00140036736f, 0.890448749f, 0.00139198615f, 0.891840696f, 0.00138359179f,
+    0.893224299f, 0.00137518439f, 0.894599497f, 0.00136676407f, 0.895966232f, 0.00135833095f, 0.897324562f, 0.00134988502f,
+    0.898674488f, 0.00134142628f, 0.900015891f, 0.00133295509f, 0.901348829f, 0.0013244712f, 0.902673304f, 0.00131597486f,
+    0.903989315f, 0.00130746618f, 0.905296743f, 0.00129894516f, 0.906595707f, 0.00129041192f, 0.907886088f, 0.00128186657f,
+    0.909168005f, 0.00127330911f, 0.910441279f, 0.00126473978f, 0.91170603f, 0.00125615846f, 0.912962198f, 0.00124756526f,
+    0.914209783f, 0.00123896042f, 0.915448725f, 0.00123034383f, 0.916679084f, 0.00122171571f, 0.917900801f, 0.00121307606f,
+    0.919113874f, 0.001204425f, 0.920318305f, 0.00119576266f, 0.921514034f, 0.00118708902f, 0.92270112f, 0.0011784042f,
+    0.923879504f, 0.00116970832f, 0.925049245f, 0.00116100139f, 0.926210225f, 0.00115228351f, 0.927362502f, 0.00114355481f,
+    0.928506076f, 0.00113481539f, 0.929640889f, 0.00112606527f, 0.93076694f, 0.00111730455f, 0.931884289f, 0.00110853324f,
+    0.932992816f, 0.00109975156f, 0.934092522f, 0.00109095953f, 0.935183525f, 0.00108215725f, 0.936265647f, 0.00107334473f,
+    0.937339008f, 0.00106452219f, 0.938403547f, 0.00105568953f, 0.939459205f, 0.00104684697f, 0.940506041f, 0.00103799463f,
+    0.941544056f, 0.0010291324f, 0.94257319f, 0.0010202605f, 0.943593442f, 0.00101137906f, 0.944604814f, 0.00100248808f,
+    0.945607305f, 0.000993587659f, 0.946600914f, 0.000984677928f, 0.947585583f, 0.000975758885f, 0.94856137f, 0.000966830703f,
+    0.949528158f, 0.000957893382f, 0.950486064f, 0.000948947039f, 0.95143503f, 0.000939991733f, 0.952374995f, 0.000931027636f,
+    0.953306019f, 0.000922054751f, 0.954228103f, 0.000913073192f, 0.955141187f, 0.000904083019f, 0.95604527f, 0.000895084406f,
+    0.956940353f, 0.000886077294f, 0.957826436f, 0.000877061859f, 0.958703458f, 0.000868038158f, 0.95957154f, 0.000859006308f,
+    0.960430503f, 0.000849966367f, 0.961280465f, 0.000840918452f, 0.962121427f, 0.000831862621f, 0.962953269f, 0.000822798931f,
+    0.963776052f, 0.0008137275f, 0.964589775f, 0.000804648385f, 0.965394437f, 0.000795561762f, 0.966189981f, 0.000786467572f,
+    0.966976464f, 0.000777366047f, 0.967753828f, 0.000768257189f, 0.968522072f, 0.000759141054f, 0.969281256f, 0.000750017818f,
+    0.970031261f, 0.000740887539f, 0.970772147f, 0.000731750275f, 0.971503913f, 0.000722606084f, 0.972226501f, 0.000713455142f,
+    0.972939968f, 0.000704297447f, 0.973644257f, 0.000695133116f, 0.974339366f, 0.000685962266f, 0.975025356f, 0.000676784955f,
+    0.975702107f, 0.0006676013f, 0.976369739f, 0.0006584113f, 0.977028131f, 0.000649215188f, 0.977677345f, 0.000640012906f,
+    0.97831738f, 0.00063080457f, 0.978948176f, 0.000621590356f, 0.979569793f, 0.000612370262f, 0.980182111f, 0.000603144406f,
+    0.980785251f, 0.000593912904f, 0.981379211f, 0.000584675814f, 0.981963873f, 0.000575433194f, 0.982539296f, 0.000566185161f,
+    0.983105481f, 0.000556931773f, 0.983662426f, 0.000547673204f, 0.984210074f, 0.000538409397f, 0.984748483f, 0.000529140583f,
+    0.985277653f, 0.000519866764f, 0.985797524f, 0.000510588055f, 0.986308098f, 0.000501304574f, 0.986809373f, 0.000492016319f,
+    0.987301409f, 0.000482723495f, 0.987784147f, 0.000473426073f, 0.988257587f, 0.000464124227f, 0.988721669f, 0.000454818015f,
+    0.989176512f, 0.000445507496f, 0.989621997f, 0.000436192786f, 0.990058184f, 0.000426874001f, 0.990485072f, 0.000417551171f,
+    0.990902662f, 0.000408224412f, 0.991310835f, 0.000398893812f, 0.991709769f, 0.000389559485f, 0.992099285f, 0.000380221463f,
+    0.992479563f, 0.000370879861f, 0.992850423f, 0.000361534767f, 0.993211925f, 0.000352186296f, 0.993564129f, 0.000342834479f,
+    0.993906975f, 0.00033347946f, 0.994240463f, 0.000324121269f, 0.994564593f, 0.000314760051f, 0.994879305f, 0.000305395864f,
+    0.99518472f, 0.000296028826f, 0.995480776f, 0.000286658964f, 0.995767415f, 0.000277286425f, 0.996044695f, 0.000267911295f,
+    0.996312618f, 0.000258533604f, 0.996571124f, 0.000249153498f, 0.996820271f, 0.000239771049f, 0.997060061f, 0.000230386344f,
+    0.997290432f, 0.000220999456f, 0.997511446f, 0.000211610502f, 0.997723043f, 0.000202219555f, 0.997925282f, 0.000192826701f,
+    0.998118103f, 0.000183432028f, 0.998301566f, 0.000174035638f, 0.998475552f, 0.000164637604f, 0.998640239f, 0.000155238027f,
+    0.99879545f, 0.000145836981f, 0.998941302f, 0.000136434566f, 0.999077737f, 0.000127030871f, 0.999204755f, 0.000117625968f,
+    0.999322355f, 0.000108219967f, 0.999430597f, 9.88129468e-05f, 0.999529421f, 8.94049954e-05f, 0.999618828f, 7.99961999e-05f,
+    0.999698818f, 7.05866551e-05f, 0.99976939f, 6.11764481e-05f, 0.999830604f, 5.1765659e-05f, 0.99988234f, 4.23543861e-05f,
+    0.999924719f, 3.2942713e-05f, 0.999957621f, 2.35307307e-05f, 0.999981165f, 1.41185274e-05f, 0.999995291f, 4.70619034e-06f,
+    1.0f, -4.70619034e-06f, 0.999995291f, -1.41185274e-05f, 0.999981165f, -2.35307307e-05f, 0.999957621f, -3.2942713e-05f,
+    0.999924719f, -4.23543861e-05f, 0.99988234f, -5.1765659e-05f, 0.999830604f, -6.11764481e-05f, 0.99976939f, -7.05866551e-05f,
+    0.999698818f, -7.99961999e-05f, 0.999618828f, -8.94049954e-05f, 0.999529421f, -9.88129468e-05f, 0.999430597f, -0.000108219967f,
+    0.999322355f, -0.000117625968f, 0.999204755f, -0.000127030871f, 0.999077737f, -0.000136434566f, 0.998941302f, -0.000145836981f,
+    0.99879545f, -0.000155238027f, 0.998640239f, -0.000164637604f, 0.998475552f, -0.000174035638f, 0.998301566f, -0.000183432028f,
+    0.998118103f, -0.000192826701f, 0.997925282f, -0.000202219555f, 0.997723043f, -0.000211610502f, 0.997511446f, -0.000220999456f,
+    0.997290432f, -0.000230386344f, 0.997060061f, -0.000239771049f, 0.996820271f, -0.000249153498f, 0.996571124f, -0.000258533604f,
+    0.996312618f, -0.000267911295f, 0.996044695f, -0.000277286425f, 0.995767415f, -0.000286658964f, 0.995480776f, -0.000296028826f,
+    0.99518472f, -0.000305395864f, 0.994879305f, -0.000314760051f, 0.994564593f, -0.000324121269f, 0.994240463f, -0.00033347946f,
+    0.993906975f, -0.000342834479f, 0.993564129f, -0.000352186296f, 0.993211925f, -0.000361534767f, 0.992850423f, -0.000370879861f,
+    0.992479563f, -0.000380221463f, 0.992099285f, -0.000389559485f, 0.991709769f, -0.000398893812f, 0.991310835f, -0.000408224412f,
+    0.990902662f, -0.000417551171f, 0.990485072f, -0.000426874001f, 0.990058184f, -0.000436192786f, 0.989621997f, -0.000445507496f,
+    0.989176512f, -0.000454818015f, 0.988721669f, -0.000464124227f, 0.988257587f, -0.000473426073f, 0.987784147f, -0.000482723495f,
+    0.987301409f, -0.000492016319f, 0.986809373f, -0.000501304574f, 0.986308098f, -0.000510588055f, 0.985797524f, -0.000519866764f,
+    0.985277653f, -0.000529140583f, 0.984748483f, -0.000538409397f, 0.984210074f, -0.000547673204f, 0.983662426f, -0.000556931773f,
+    0.983105481f, -0.000566185161f, 0.982539296f, -0.000575433194f, 0.981963873f, -0.000584675814f, 0.981379211f, -0.000593912904f,
+    0.980785251f, -0.000603144406f, 0.980182111f, -0.000612370262f, 0.979569793f, -0.000621590356f, 0.978948176f, -0.00063080457f,
+    0.97831738f, -0.000640012906f, 0.977677345f, -0.000649215188f, 0.977028131f, -0.0006584113f, 0.976369739f, -0.0006676013f,
+    0.975702107f, -0.000676784955f, 0.975025356f, -0.000685962266f, 0.974339366f, -0.000695133116f, 0.973644257f, -0.000704297447f,
+    0.972939968f, -0.000713455142f, 0.972226501f, -0.000722606084f, 0.971503913f, -0.000731750275f, 0.970772147f, -0.000740887539f,
+    0.970031261f, -0.000750017818f, 0.969281256f, -0.000759141054f, 0.968522072f, -0.000768257189f, 0.967753828f, -0.000777366047f,
+    0.966976464f, -0.000786467572f, 0.966189981f, -0.000795561762f, 0.965394437f, -0.000804648385f, 0.964589775f, -0.0008137275f,
+    0.963776052f, -0.000822798931f, 0.962953269f, -0.000831862621f, 0.962121427f, -0.000840918452f, 0.961280465f, -0.000849966367f,
+    0.960430503f, -0.000859006308f, 0.95957154f, -0.000868038158f, 0.958703458f, -0.000877061859f, 0.957826436f, -0.000886077294f,
+    0.956940353f, -0.000895084406f, 0.95604527f, -0.000904083019f, 0.955141187f, -0.000913073192f, 0.954228103f, -0.000922054751f,
+    0.953306019f, -0.000931027636f, 0.952374995f, -0.000939991733f, 0.95143503f, -0.000948947039f, 0.950486064f, -0.000957893382f,
+    0.949528158f, -0.000966830703f, 0.94856137f, -0.000975758885f, 0.947585583f, -0.000984677928f, 0.946600914f, -0.000993587659f,
+    0.945607305f, -0.00100248808f, 0.944604814f, -0.00101137906f, 0.943593442f, -0.0010202605f, 0.94257319f, -0.0010291324f,
+    0.941544056f, -0.00103799463f, 0.940506041f, -0.00104684697f, 0.939459205f, -0.00105568953f, 0.938403547f, -0.00106452219f,
+    0.937339008f, -0.00107334473f, 0.936265647f, -0.00108215725f, 0.935183525f, -0.00109095953f, 0.934092522f, -0.00109975156f,
+    0.932992816f, -0.00110853324f, 0.931884289f, -0.00111730455f, 0.93076694f, -0.00112606527f, 0.929640889f, -0.00113481539f,
+    0.928506076f, -0.00114355481f, 0.927362502f, -0.00115228351f, 0.926210225f, -0.00116100139f, 0.925049245f, -0.00116970832f,
+    0.923879504f, -0.0011784042f, 0.92270112f, -0.00118708902f, 0.921514034f, -0.00119576266f, 0.920318305f, -0.001204425f,
+    0.919113874f, -0.00121307606f, 0.917900801f, -0.00122171571f, 0.916679084f, -0.00123034383f, 0.915448725f, -0.00123896042f,
+    0.914209783f, -0.00124756526f, 0.912962198f, -0.00125615846f, 0.91170603f, -0.00126473978f, 0.910441279f, -0.00127330911f,
+    0.909168005f, -0.00128186657f, 0.907886088f, -0.00129041192f, 0.906595707f, -0.00129894516f, 0.905296743f, -0.00130746618f,
+    0.903989315f, -0.00131597486f, 0.902673304f, -0.0013244712f, 0.901348829f, -0.00133295509f, 0.900015891f, -0.00134142628f,
+    0.898674488f, -0.00134988502f, 0.897324562f, -0.00135833095f, 0.895966232f, -0.00136676407f, 0.894599497f, -0.00137518439f,
+    0.893224299f, -0.00138359179f, 0.891840696f, -0.00139198615f, 0.890448749f, -0.00140036736f, 0.889048338f, -0.00140873541f,
+    0.887639642f, -0.0014170903f, 0.886222541f, -0.00142543169f, 0.884797096f, -0.00143375981f, 0.883363366f, -0.00144207431f,
+    0.881921291f, -0.0014503753f, 0.880470872f, -0.00145866268f, 0.879012227f, -0.0014669362f, 0.877545297f, -0.00147519598f,
+    0.876070082f, -0.00148344191f, 0.874586642f, -0.00149167387f, 0.873094976f, -0.00149989175f, 0.871595085f, -0.00150809553f,
+    0.870086968f, -0.00151628512f, 0.868570685f, -0.0015244605f, 0.867046237f, -0.00153262145f, 0.865513623f, -0.00154076796f,
+    0.863972843f, -0.00154890004f, 0.862423956f, -0.00155701744f, 0.860866964f, -0.0015651203f, 0.859301805f, -0.00157320837f,
+    0.857728601f, -0.00158128166f, 0.856147349f, -0.00158934004f, 0.854557991f, -0.00159738341f, 0.852960587f, -0.00160541188f,
+    0.851355195f, -0.00161342509f, 0.849741757f, -0.00162142317f, 0.848120332f, -0.001629406f, 0.84649092f, -0.00163737347f,
+    0.84485358f, -0.00164532557f, 0.843208253f, -0.00165326218f, 0.841554999f, -0.0016611832f, 0.839893818f, -0.00166908861f,
+    0.838224709f, -0.00167697831f, 0.836547732f, -0.00168485229f, 0.834862888f, -0.00169271033f, 0.833170176f, -0.00170055241f,
+    0.831469595f, -0.00170837855f, 0.829761207f, -0.0017161885f, 0.82804507f, -0.00172398239f, 0.826321065f, -0.0017317601f,
+    0.824589312f, -0.00173952139f, 0.82284981f, -0.00174726639f, 0.8211025f, -0.00175499497f, 0.819347501f, -0.0017627069f,
+    0.817584813f, -0.0017704023f, 0.815814435f, -0.00177808106f, 0.81403631f, -0.00178574317f, 0.812250614f, -0.00179338828f,
+    0.81045717f, -0.00180101662f, 0.808656156f, -0.00180862809f, 0.806847572f, -0.00181622244f, 0.805031359f, -0.00182379968f,
+    0.803207517f, -0.00183135981f, 0.801376164f, -0.00183890259f, 0.799537241f, -0.00184642815f, 0.797690868f, -0.00185393635f,
+    0.795836926f, -0.0018614271f, 0.793975472f, -0.00186890026f, 0.792106569f, -0.00187635585f, 0.790230215f, -0.00188379386f,
+    0.78834641f, -0.00189121405f, 0.786455214f, -0.00189861644f, 0.784556568f, -0.00190600101f, 0.78265059f, -0.00191336754f,
+    0.780737221f, -0.00192071614f, 0.778816521f, -0.00192804669f, 0.77688849f, -0.00193535909f, 0.774953127f, -0.00194265321f,
+    0.773010433f, -0.00194992905f, 0.771060526f, -0.00195718673f, 0.769103348f, -0.00196442567f, 0.767138898f, -0.00197164621f,
+    0.765167236f, -0.00197884836f, 0.763188422f, -0.00198603189f, 0.761202395f, -0.00199319655f, 0.759209216f, -0.00200034236f,
+    0.757208824f, -0.00200746953f, 0.755201399f, -0.00201457785f, 0.753186822f, -0.00202166708f, 0.751165152f, -0.00202873745f,
+    0.749136388f, -0.00203578849f, 0.747100592f, -0.00204282044f, 0.745057762f, -0.0020498333f, 0.743007958f, -0.00205682684f,
+    0.740951121f, -0.00206380081f, 0.73888731f, -0.0020707557f, 0.736816585f, -0.00207769079f, 0.734738886f, -0.00208460633f,
+    0.732654274f, -0.00209150254f, 0.730562747f, -0.00209837873f, 0.728464365f, -0.00210523535f, 0.726359129f, -0.00211207219f,
+    0.724247098f, -0.00211888901f, 0.722128212f, -0.00212568603f, 0.720002532f, -0.0021324628f, 0.717870057f, -0.00213921978f,
+    0.715730846f, -0.0021459565f, 0.71358484f, -0.00215267297f, 0.711432219f, -0.00215936941f, 0.709272802f, -0.00216604536f,
+    0.707106769f, -0.00217270083f, 0.704934061f, -0.0021793358f, 0.702754736f, -0.00218595052f, 0.700568795f, -0.00219254452f,
+    0.698376238f, -0.00219911803f, 0.696177125f, -0.00220567058f, 0.693971455f, -0.00221220241f, 0.691759229f, -0.00221871352f,
+    0.689540565f, -0.00222520391f, 0.687315345f, -0.0022316731f, 0.685083687f, -0.00223812135f, 0.682845533f, -0.00224454864f,
+    0.680601001f, -0.00225095474f, 0.678350031f, -0.00225733966f, 0.676092684f, -0.00226370315f, 0.673829019f, -0.00227004546f,
+    0.671558976f, -0.00227636658f, 0.669282615f, -0.00228266604f, 0.666999936f, -0.00228894409f, 0.664710999f, -0.00229520071f,
+    0.662415802f, -0.00230143545f, 0.660114348f, -0.00230764877f, 0.657806695f, -0.0023138402f, 0.655492842f, -0.00232000998f,
+    0.653172851f, -0.00232615788f, 0.65084666f, -0.00233228388f, 0.64851439f, -0.002338388f, 0.64617604f, -0.00234447001f,
+    0.643831551f, -0.00235053012f, 0.641481042f, -0.00235656789f, 0.639124453f, -0.00236258353f, 0.636761844f, -0.00236857706f,
+    0.634393275f, -0.00237454823f, 0.632018745f, -0.00238049706f, 0.629638255f, -0.00238642353f, 0.627251804f, -0.00239232741f,
+    0.624859512f, -0.00239820872f, 0.622461259f, -0.00240406767f, 0.620057225f, -0.0024099038f, 0.61764729f, -0.00241571735f,
+    0.615231574f, -0.00242150808f, 0.612810075f, -0.00242727622f, 0.610382795f, -0.00243302132f, 0.607949793f, -0.0024387436f,
+    0.605511069f, -0.00244444283f, 0.603066623f, -0.00245011924f, 0.600616455f, -0.00245577237f, 0.598160684f, -0.00246140244f,
+    0.59569931f, -0.00246700947f, 0.593232274f, -0.00247259322f, 0.590759695f, -0.00247815368f, 0.588281572f, -0.00248369086f,
+    0.585797846f, -0.00248920452f, 0.583308637f, -0.0024946949f, 0.580813944f, -0.00250016176f, 0.578313768f, -0.00250560511f,
+    0.575808167f, -0.00251102471f, 0.573297143f, -0.00251642079f, 0.570780754f, -0.00252179313f, 0.568258941f, -0.00252714194f,
+    0.565731823f, -0.00253246678f, 0.563199341f, -0.00253776787f, 0.560661554f, -0.00254304498f, 0.558118522f, -0.0025482981f,
+    0.555570245f, -0.00255352748f, 0.553016722f, -0.00255873264f, 0.550457954f, -0.00256391382f, 0.547894061f, -0.00256907078f,
+    0.545324981f, -0.00257420354f, 0.542750776f, -0.00257931207f, 0.540171444f, -0.0025843964f, 0.537587047f, -0.0025894565f,
+    0.534997642f, -0.00259449193f, 0.532403111f, -0.00259950315f, 0.529803634f, -0.00260448991f, 0.527199149f, -0.002609452f,
+    0.524589658f, -0.00261438964f, 0.521975279f, -0.00261930283f, 0.519356012f, -0.00262419111f, 0.516731799f, -0.00262905471f,
+    0.514102757f, -0.00263389386f, 0.511468828f, -0.00263870787f, 0.50883013f, -0.0026434972f, 0.506186664f, -0.00264826161f,
+    0.50353837f, -0.00265300111f, 0.500885367f, -0.0026577157f, 0.498227656f, -0.00266240514f, 0.495565265f, -0.00266706967f,
+    0.492898196f, -0.00267170905f, 0.490226477f, -0.00267632306f, 0.487550169f, -0.00268091215f, 0.484869242f, -0.00268547586f,
+    0.482183784f, -0.00269001443f, 0.479493767f, -0.00269452762f, 0.47679922f, -0.00269901543f, 0.474100202f, -0.00270347786f,
+    0.471396744f, -0.00270791468f, 0.468688816f, -0.00271232636f, 0.465976506f, -0.00271671219f, 0.463259786f, -0.00272107264f,
+    0.460538715f, -0.00272540725f, 0.457813293f, -0.00272971648f, 0.455083579f, -0.00273399986f, 0.452349573f, -0.00273825764f,
+    0.449611336f, -0.00274248957f, 0.446868837f, -0.00274669565f, 0.444122136f, -0.00275087589f, 0.441371262f, -0.00275503029f,
+    0.438616246f, -0.00275915861f, 0.435857087f, -0.00276326109f, 0.433093816f, -0.00276733749f, 0.430326492f, -0.00277138781f,
+    0.427555084f, -0.00277541229f, 0.424779683f, -0.00277941045f, 0.422000259f, -0.00278338254f, 0.419216901f, -0.00278732833f,
+    0.416429549f, -0.0027912478f, 0.413638324f, -0.00279514119f, 0.410843164f, -0.00279900827f, 0.408044159f, -0.00280284882f,
+    0.405241311f, -0.00280666305f, 0.402434647f, -0.00281045097f, 0.399624199f, -0.00281421235f, 0.396809995f, -0.00281794742f,
+    0.393992037f, -0.00282165571f, 0.391170382f, -0.00282533769f, 0.388345033f, -0.0028289929f, 0.385516047f, -0.00283262157f,
+    0.382683426f, -0.00283622346f, 0.379847199f, -0.00283979881f, 0.377007425f, -0.00284334715f, 0.374164075f, -0.00284686894f,
+    0.371317208f, -0.00285036396f, 0.368466824f, -0.00285383221f, 0.365612984f, -0.00285727344f, 0.362755716f, -0.00286068791f,
+    0.359895051f, -0.00286407536f, 0.357030958f, -0.0028674358f, 0.354163527f, -0.00287076924f, 0.351292759f, -0.0028740759f,
+    0.348418683f, -0.00287735532f, 0.345541328f, -0.00288060773f, 0.342660725f, -0.0028838329f, 0.339776874f, -0.00288703106f,
+    0.336889863f, -0.00289020198f, 0.333999664f, -0.00289334566f, 0.331106305f, -0.0028964621f, 0.328209847f, -0.00289955153f,
+    0.32531029f, -0.00290261325f, 0.322407693f, -0.00290564797f, 0.319502026f, -0.00290865521f, 0.316593379f, -0.00291163521f,
+    0.313681751f, -0.00291458773f, 0.310767144f, -0.00291751279f, 0.307849646f, -0.00292041036f, 0.304929227f, -0.00292328047f,
+    0.302005947f, -0.0029261231f, 0.299079835f, -0.00292893802f, 0.296150893f, -0.00293172547f, 0.293219149f, -0.00293448544f,
+    0.290284663f, -0.00293721771f, 0.287347466f, -0.00293992227f, 0.284407526f, -0.00294259936f, 0.281464934f, -0.0029452485f,
+    0.27851969f, -0.00294787018f, 0.275571823f, -0.00295046391f, 0.272621363f, -0.00295302994f, 0.269668311f, -0.00295556802f,
+    0.266712755f, -0.0029580784f, 0.263754666f, -0.00296056108f, 0.260794103f, -0.00296301581f, 0.257831097f, -0.0029654426f,
+    0.254865646f, -0.00296784146f, 0.251897812f, -0.00297021237f, 0.248927608f, -0.00297255535f, 0.24595505f, -0.00297487038f,
+    0.242980182f, -0.00297715748f, 0.24000302f, -0.0029794164f, 0.237023607f, -0.00298164738f, 0.234041959f, -0.00298385019f,
+    0.231058106f, -0.00298602507f, 0.228072077f, -0.00298817176f, 0.225083917f, -0.00299029029f, 0.222093627f, -0.00299238088f,
+    0.219101235f, -0.00299444306f, 0.216106802f, -0.00299647707f, 0.213110313f, -0.00299848313f, 0.210111842f, -0.0030004608f,
+    0.207111374f, -0.00300241006f, 0.204108968f, -0.00300433114f, 0.201104641f, -0.00300622405f, 0.198098406f, -0.0030080888f,
+    0.195090324f, -0.0030099249f, 0.192080393f, -0.00301173283f, 0.18906866f, -0.00301351259f, 0.186055154f, -0.0030152637f,
+    0.183039889f, -0.00301698665f, 0.180022895f, -0.00301868096f, 0.177004218f, -0.0030203471f, 0.173983872f, -0.00302198459f,
+    0.170961887f, -0.00302359369f, 0.167938292f, -0.00302517437f, 0.164913118f, -0.00302672666f, 0.161886394f, -0.00302825053f,
+    0.15885815f, -0.00302974577f, 0.155828401f, -0.00303121237f, 0.152797192f, -0.00303265057f, 0.149764538f, -0.00303406012f,
+    0.146730468f, -0.00303544127f, 0.143695027f, -0.00303679379f, 0.140658244f, -0.00303811766f, 0.137620121f, -0.00303941313f,
+    0.134580702f, -0.00304067973f, 0.13154003f, -0.00304191792f, 0.128498107f, -0.00304312748f, 0.125454977f, -0.00304430816f,
+    0.122410677f, -0.00304546044f, 0.119365215f, -0.00304658385f, 0.116318628f, -0.00304767862f, 0.113270953f, -0.00304874498f,
+    0.110222206f, -0.00304978224f, 0.107172422f, -0.0030507911f, 0.104121633f, -0.00305177108f, 0.10106986f, -0.00305272243f,
+    0.0980171412f, -0.0030536449f, 0.0949634984f, -0.00305453874f, 0.0919089541f, -0.00305540394f, 0.0888535529f, -0.00305624027f,
+    0.0857973099f, -0.00305704772f, 0.0827402622f, -0.00305782654f, 0.0796824396f, -0.00305857649f, 0.0766238645f, -0.0030592978f,
+    0.0735645667f, -0.00305999024f, 0.070504576f, -0.00306065381f, 0.0674439222f, -0.00306128873f, 0.0643826276f, -0.00306189456f,
+    0.061320737f, -0.00306247175f, 0.0582582653f, -0.00306302006f, 0.0551952459f, -0.00306353974f, 0.052131705f, -0.00306403032f,
+    0.0490676761f, -0.00306449225f, 0.0460031815f, -0.00306492508f, 0.0429382585f, -0.00306532928f, 0.0398729257f, -0.0030657046f,
+    0.0368072242f, -0.00306605105f, 0.0337411724f, -0.00306636863f, 0.030674804f, -0.00306665734f, 0.027608145f, -0.00306691718f,
+    0.024541229f, -0.00306714815f, 0.0214740802f, -0.00306735048f, 0.0184067301f, -0.00306752371f, 0.015339206f, -0.00306766806f,
+    0.0122715384f, -0.00306778355f, 0.00920375437f, -0.00306787016f, 0.00613588467f, -0.0030679279f, 0.00306795677f, -0.00306795677f,
+    1.22464685e-16f, -0.00306795677f, -0.00306795677f, -0.0030679279f, -0.00613588467f, -0.00306787016f, -0.00920375437f, -0.00306778355f,
+    -0.0122715384f, -0.00306766806f, -0.015339206f, -0.00306752371f, -0.0184067301f, -0.00306735048f, -0.0214740802f, -0.00306714815f,
+    -0.024541229f, -0.00306691718f, -0.027608145f, -0.00306665734f, -0.030674804f, -0.00306636863f, -0.0337411724f, -0.00306605105f,
+    -0.0368072242f, -0.0030657046f, -0.0398729257f, -0.00306532928f, -0.0429382585f, -0.00306492508f, -0.0460031815f, -0.00306449225f,
+    -0.0490676761f, -0.00306403032f, -0.052131705f, -0.00306353974f, -0.0551952459f, -0.00306302006f, -0.0582582653f, -0.00306247175f,
+    -0.061320737f, -0.00306189456f, -0.0643826276f, -0.00306128873f, -0.0674439222f, -0.00306065381f, -0.070504576f, -0.00305999024f,
+    -0.0735645667f, -0.0030592978f, -0.0766238645f, -0.00305857649f, -0.0796824396f, -0.00305782654f, -0.0827402622f, -0.00305704772f,
+    -0.0857973099f, -0.00305624027f, -0.0888535529f, -0.00305540394f, -0.0919089541f, -0.00305453874f, -0.0949634984f, -0.0030536449f,
+    -0.0980171412f, -0.00305272243f, -0.10106986f, -0.00305177108f, -0.104121633f, -0.0030507911f, -0.107172422f, -0.00304978224f,
+    -0.110222206f, -0.00304874498f, -0.113270953f, -0.00304767862f, -0.116318628f, -0.00304658385f, -0.119365215f, -0.00304546044f,
+    -0.122410677f, -0.00304430816f, -0.125454977f, -0.00304312748f, -0.128498107f, -0.00304191792f, -0.13154003f, -0.00304067973f,
+    -0.134580702f, -0.00303941313f, -0.137620121f, -0.00303811766f, -0.140658244f, -0.00303679379f, -0.143695027f, -0.00303544127f,
+    -0.146730468f, -0.00303406012f, -0.149764538f, -0.00303265057f, -0.152797192f, -0.00303121237f, -0.155828401f, -0.00302974577f,
+    -0.15885815f, -0.00302825053f, -0.161886394f, -0.00302672666f, -0.164913118f, -0.00302517437f, -0.167938292f, -0.00302359369f,
+    -0.170961887f, -0.00302198459f, -0.173983872f, -0.0030203471f, -0.177004218f, -0.00301868096f, -0.180022895f, -0.00301698665f,
+    -0.183039889f, -0.0030152637f, -0.186055154f, -0.00301351259f, -0.18906866f, -0.00301173283f, -0.192080393f, -0.0030099249f,
+    -0.195090324f, -0.0030080888f, -0.198098406f, -0.00300622405f, -0.201104641f, -0.00300433114f, -0.204108968f, -0.00300241006f,
+    -0.207111374f, -0.0030004608f, -0.210111842f, -0.00299848313f, -0.213110313f, -0.00299647707f, -0.216106802f, -0.00299444306f,
+    -0.219101235f, -0.00299238088f, -0.222093627f, -0.00299029029f, -0.225083917f, -0.00298817176f, -0.228072077f, -0.00298602507f,
+    -0.231058106f, -0.00298385019f, -0.234041959f, -0.00298164738f, -0.237023607f, -0.0029794164f, -0.24000302f, -0.00297715748f,
+    -0.242980182f, -0.00297487038f, -0.24595505f, -0.00297255535f, -0.248927608f, -0.00297021237f, -0.251897812f, -0.00296784146f,
+    -0.254865646f, -0.0029654426f, -0.257831097f, -0.00296301581f, -0.260794103f, -0.00296056108f, -0.263754666f, -0.0029580784f,
+    -0.266712755f, -0.00295556802f, -0.269668311f, -0.00295302994f, -0.272621363f, -0.00295046391f, -0.275571823f, -0.00294787018f,
+    -0.27851969f, -0.0029452485f, -0.281464934f, -0.00294259936f, -0.284407526f, -0.00293992227f, -0.287347466f, -0.00293721771f,
+    -0.290284663f, -0.00293448544f, -0.293219149f, -0.00293172547f, -0.296150893f, -0.00292893802f, -0.299079835f, -0.0029261231f,
+    -0.302005947f, -0.00292328047f, -0.304929227f, -0.00292041036f, -0.307849646f, -0.00291751279f, -0.310767144f, -0.00291458773f,
+    -0.313681751f, -0.00291163521f, -0.316593379f, -0.00290865521f, -0.319502026f, -0.00290564797f, -0.322407693f, -0.00290261325f,
+    -0.32531029f, -0.00289955153f, -0.328209847f, -0.0028964621f, -0.331106305f, -0.00289334566f, -0.333999664f, -0.00289020198f,
+    -0.336889863f, -0.00288703106f, -0.339776874f, -0.0028838329f, -0.342660725f, -0.00288060773f, -0.345541328f, -0.00287735532f,
+    -0.348418683f, -0.0028740759f, -0.351292759f, -0.00287076924f, -0.354163527f, -0.0028674358f, -0.357030958f, -0.00286407536f,
+    -0.359895051f, -0.00286068791f, -0.362755716f, -0.00285727344f, -0.365612984f, -0.00285383221f, -0.368466824f, -0.00285036396f,
+    -0.371317208f, -0.00284686894f, -0.374164075f, -0.00284334715f, -0.377007425f, -0.00283979881f, -0.379847199f, -0.00283622346f,
+    -0.382683426f, -0.00283262157f, -0.385516047f, -0.0028289929f, -0.388345033f, -0.00282533769f, -0.391170382f, -0.00282165571f,
+    -0.393992037f, -0.00281794742f, -0.396809995f, -0.00281421235f, -0.399624199f, -0.00281045097f, -0.402434647f, -0.00280666305f,
+    -0.405241311f, -0.00280284882f, -0.408044159f, -0.00279900827f, -0.410843164f, -0.00279514119f, -0.413638324f, -0.0027912478f,
+    -0.416429549f, -0.00278732833f, -0.419216901f, -0.00278338254f, -0.422000259f, -0.00277941045f, -0.424779683f, -0.00277541229f,
+    -0.427555084f, -0.00277138781f, -0.430326492f, -0.00276733749f, -0.433093816f, -0.00276326109f, -0.435857087f, -0.00275915861f,
+    -0.438616246f, -0.00275503029f, -0.441371262f, -0.00275087589f, -0.444122136f, -0.00274669565f, -0.446868837f, -0.00274248957f,
+    -0.449611336f, -0.00273825764f, -0.452349573f, -0.00273399986f, -0.455083579f, -0.00272971648f, -0.457813293f, -0.00272540725f,
+    -0.460538715f, -0.00272107264f, -0.463259786f, -0.00271671219f, -0.465976506f, -0.00271232636f, -0.468688816f, -0.00270791468f,
+    -0.471396744f, -0.00270347786f, -0.474100202f, -0.00269901543f, -0.47679922f, -0.00269452762f, -0.479493767f, -0.00269001443f,
+    -0.482183784f, -0.00268547586f, -0.484869242f, -0.00268091215f, -0.487550169f, -0.00267632306f, -0.490226477f, -0.00267170905f,
+    -0.492898196f, -0.00266706967f, -0.495565265f, -0.00266240514f, -0.498227656f, -0.0026577157f, -0.500885367f, -0.00265300111f,
+    -0.50353837f, -0.00264826161f, -0.506186664f, -0.0026434972f, -0.50883013f, -0.00263870787f, -0.511468828f, -0.00263389386f,
+    -0.514102757f, -0.00262905471f, -0.516731799f, -0.00262419111f, -0.519356012f, -0.00261930283f, -0.521975279f, -0.00261438964f,
+    -0.524589658f, -0.002609452f, -0.527199149f, -0.00260448991f, -0.529803634f, -0.00259950315f, -0.532403111f, -0.00259449193f,
+    -0.534997642f, -0.0025894565f, -0.537587047f, -0.0025843964f, -0.540171444f, -0.00257931207f, -0.542750776f, -0.00257420354f,
+    -0.545324981f, -0.00256907078f, -0.547894061f, -0.00256391382f, -0.550457954f, -0.00255873264f, -0.553016722f, -0.00255352748f,
+    -0.555570245f, -0.0025482981f, -0.558118522f, -0.00254304498f, -0.560661554f, -0.00253776787f, -0.563199341f, -0.00253246678f,
+    -0.565731823f, -0.00252714194f, -0.568258941f, -0.00252179313f, -0.570780754f, -0.00251642079f, -0.573297143f, -0.00251102471f,
+    -0.575808167f, -0.00250560511f, -0.578313768f, -0.00250016176f, -0.580813944f, -0.0024946949f, -0.583308637f, -0.00248920452f,
+    -0.585797846f, -0.00248369086f, -0.588281572f, -0.00247815368f, -0.590759695f, -0.00247259322f, -0.593232274f, -0.00246700947f,
+    -0.59569931f, -0.00246140244f, -0.598160684f, -0.00245577237f, -0.600616455f, -0.00245011924f, -0.603066623f, -0.00244444283f,
+    -0.605511069f, -0.0024387436f, -0.607949793f, -0.00243302132f, -0.610382795f, -0.00242727622f, -0.612810075f, -0.00242150808f,
+    -0.615231574f, -0.00241571735f, -0.61764729f, -0.0024099038f, -0.620057225f, -0.00240406767f, -0.622461259f, -0.00239820872f,
+    -0.624859512f, -0.00239232741f, -0.627251804f, -0.00238642353f, -0.629638255f, -0.00238049706f, -0.632018745f, -0.00237454823f,
+    -0.634393275f, -0.00236857706f, -0.636761844f, -0.00236258353f, -0.639124453f, -0.00235656789f, -0.641481042f, -0.00235053012f,
+    -0.643831551f, -0.00234447001f, -0.64617604f, -0.002338388f, -0.64851439f, -0.00233228388f, -0.65084666f, -0.00232615788f,
+    -0.653172851f, -0.00232000998f, -0.655492842f, -0.0023138402f, -0.657806695f, -0.00230764877f, -0.660114348f, -0.00230143545f,
+    -0.662415802f, -0.00229520071f, -0.664710999f, -0.00228894409f, -0.666999936f, -0.00228266604f, -0.669282615f, -0.00227636658f,
+    -0.671558976f, -0.00227004546f, -0.673829019f, -0.00226370315f, -0.676092684f, -0.00225733966f, -0.678350031f, -0.00225095474f,
+    -0.680601001f, -0.00224454864f, -0.682845533f, -0.00223812135f, -0.685083687f, -0.0022316731f, -0.687315345f, -0.00222520391f,
+    -0.689540565f, -0.00221871352f, -0.691759229f, -0.00221220241f, -0.693971455f, -0.00220567058f, -0.696177125f, -0.00219911803f,
+    -0.698376238f, -0.00219254452f, -0.700568795f, -0.00218595052f, -0.702754736f, -0.0021793358f, -0.704934061f, -0.00217270083f,
+    -0.707106769f, -0.00216604536f, -0.709272802f, -0.00215936941f, -0.711432219f, -0.00215267297f, -0.71358484f, -0.0021459565f,
+    -0.715730846f, -0.00213921978f, -0.717870057f, -0.0021324628f, -0.720002532f, -0.00212568603f, -0.722128212f, -0.00211888901f,
+    -0.724247098f, -0.00211207219f, -0.726359129f, -0.00210523535f, -0.728464365f, -0.00209837873f, -0.730562747f, -0.00209150254f,
+    -0.732654274f, -0.00208460633f, -0.734738886f, -0.00207769079f, -0.736816585f, -0.0020707557f, -0.73888731f, -0.00206380081f,
+    -0.740951121f, -0.00205682684f, -0.743007958f, -0.0020498333f, -0.745057762f, -0.00204282044f, -0.747100592f, -0.00203578849f,
+    -0.749136388f, -0.00202873745f, -0.751165152f, -0.00202166708f, -0.753186822f, -0.00201457785f, -0.755201399f, -0.00200746953f,
+    -0.757208824f, -0.00200034236f, -0.759209216f, -0.00199319655f, -0.761202395f, -0.00198603189f, -0.763188422f, -0.00197884836f,
+    -0.765167236f, -0.00197164621f, -0.767138898f, -0.00196442567f, -0.769103348f, -0.00195718673f, -0.771060526f, -0.00194992905f,
+    -0.773010433f, -0.00194265321f, -0.774953127f, -0.00193535909f, -0.77688849f, -0.00192804669f, -0.778816521f, -0.00192071614f,
+    -0.780737221f, -0.00191336754f, -0.78265059f, -0.00190600101f, -0.784556568f, -0.00189861644f, -0.786455214f, -0.00189121405f,
+    -0.78834641f, -0.00188379386f, -0.790230215f, -0.00187635585f, -0.792106569f, -0.00186890026f, -0.793975472f, -0.0018614271f,
+    -0.795836926f, -0.00185393635f, -0.797690868f, -0.00184642815f, -0.799537241f, -0.00183890259f, -0.801376164f, -0.00183135981f,
+    -0.803207517f, -0.00182379968f, -0.805031359f, -0.00181622244f, -0.806847572f, -0.00180862809f, -0.808656156f, -0.00180101662f,
+    -0.81045717f, -0.00179338828f, -0.812250614f, -0.00178574317f, -0.81403631f, -0.00177808106f, -0.815814435f, -0.0017704023f,
+    -0.817584813f, -0.0017627069f, -0.819347501f, -0.00175499497f, -0.8211025f, -0.00174726639f, -0.82284981f, -0.00173952139f,
+    -0.824589312f, -0.0017317601f, -0.826321065f, -0.00172398239f, -0.82804507f, -0.0017161885f, -0.829761207f, -0.00170837855f,
+    -0.831469595f, -0.00170055241f, -0.833170176f, -0.00169271033f, -0.834862888f, -0.00168485229f, -0.836547732f, -0.00167697831f,
+    -0.838224709f, -0.00166908861f, -0.839893818f, -0.0016611832f, -0.841554999f, -0.00165326218f, -0.843208253f, -0.00164532557f,
+    -0.84485358f, -0.00163737347f, -0.84649092f, -0.001629406f, -0.848120332f, -0.00162142317f, -0.849741757f, -0.00161342509f,
+    -0.851355195f, -0.00160541188f, -0.852960587f, -0.00159738341f, -0.854557991f, -0.00158934004f, -0.856147349f, -0.00158128166f,
+    -0.857728601f, -0.00157320837f, -0.859301805f, -0.0015651203f, -0.860866964f, -0.00155701744f, -0.862423956f, -0.00154890004f,
+    -0.863972843f, -0.00154076796f, -0.865513623f, -0.00153262145f, -0.867046237f, -0.0015244605f, -0.868570685f, -0.00151628512f,
+    -0.870086968f, -0.00150809553f, -0.871595085f, -0.00149989175f, -0.873094976f, -0.00149167387f, -0.874586642f, -0.00148344191f,
+    -0.876070082f, -0.00147519598f, -0.877545297f, -0.0014669362f, -0.879012227f, -0.00145866268f, -0.880470872f, -0.0014503753f,
+    -0.881921291f, -0.00144207431f, -0.883363366f, -0.00143375981f, -0.884797096f, -0.00142543169f, -0.886222541f, -0.0014170903f,
+    -0.887639642f, -0.00140873541f, -0.889048338f, -0.00140036736f, -0.890448749f, -0.00139198615f, -0.891840696f, -0.00138359179f,
+    -0.893224299f, -0.00137518439f, -0.894599497f, -0.00136676407f, -0.895966232f, -0.00135833095f, -0.897324562f, -0.00134988502f,
+    -0.898674488f, -0.00134142628f, -0.900015891f, -0.00133295509f, -0.901348829f, -0.0013244712f, -0.902673304f, -0.00131597486f,
+    -0.903989315f, -0.00130746618f, -0.905296743f, -0.00129894516f, -0.906595707f, -0.00129041192f, -0.907886088f, -0.00128186657f,
+    -0.909168005f, -0.00127330911f, -0.910441279f, -0.00126473978f, -0.91170603f, -0.00125615846f, -0.912962198f, -0.00124756526f,
+    -0.914209783f, -0.00123896042f, -0.915448725f, -0.00123034383f, -0.916679084f, -0.00122171571f, -0.917900801f, -0.00121307606f,
+    -0.919113874f, -0.001204425f, -0.920318305f, -0.00119576266f, -0.921514034f, -0.00118708902f, -0.92270112f, -0.0011784042f,
+    -0.923879504f, -0.00116970832f, -0.925049245f, -0.00116100139f, -0.926210225f, -0.00115228351f, -0.927362502f, -0.00114355481f,
+    -0.928506076f, -0.00113481539f, -0.929640889f, -0.00112606527f, -0.93076694f, -0.00111730455f, -0.931884289f, -0.00110853324f,
+    -0.932992816f, -0.00109975156f, -0.934092522f, -0.00109095953f, -0.935183525f, -0.00108215725f, -0.936265647f, -0.00107334473f,
+    -0.937339008f, -0.00106452219f, -0.938403547f, -0.00105568953f, -0.939459205f, -0.00104684697f, -0.940506041f, -0.00103799463f,
+    -0.941544056f, -0.0010291324f, -0.94257319f, -0.0010202605f, -0.943593442f, -0.00101137906f, -0.944604814f, -0.00100248808f,
+    -0.945607305f, -0.000993587659f, -0.946600914f, -0.000984677928f, -0.947585583f, -0.000975758885f, -0.94856137f, -0.000966830703f,
+    -0.949528158f, -0.000957893382f, -0.950486064f, -0.000948947039f, -0.95143503f, -0.000939991733f, -0.952374995f, -0.000931027636f,
+    -0.953306019f, -0.000922054751f, -0.954228103f, -0.000913073192f, -0.955141187f, -0.000904083019f, -0.95604527f, -0.000895084406f,
+    -0.956940353f, -0.000886077294f, -0.957826436f, -0.000877061859f, -0.958703458f, -0.000868038158f, -0.95957154f, -0.000859006308f,
+    -0.960430503f, -0.000849966367f, -0.961280465f, -0.000840918452f, -0.962121427f, -0.000831862621f, -0.962953269f, -0.000822798931f,
+    -0.963776052f, -0.0008137275f, -0.964589775f, -0.000804648385f, -0.965394437f, -0.000795561762f, -0.966189981f, -0.000786467572f,
+    -0.966976464f, -0.000777366047f, -0.967753828f, -0.000768257189f, -0.968522072f, -0.000759141054f, -0.969281256f, -0.000750017818f,
+    -0.970031261f, -0.000740887539f, -0.970772147f, -0.000731750275f, -0.971503913f, -0.000722606084f, -0.972226501f, -0.000713455142f,
+    -0.972939968f, -0.000704297447f, -0.973644257f, -0.000695133116f, -0.974339366f, -0.000685962266f, -0.975025356f, -0.000676784955f,
+    -0.975702107f, -0.0006676013f, -0.976369739f, -0.0006584113f, -0.977028131f, -0.000649215188f, -0.977677345f, -0.000640012906f,
+    -0.97831738f, -0.00063080457f, -0.978948176f, -0.000621590356f, -0.979569793f, -0.000612370262f, -0.980182111f, -0.000603144406f,
+    -0.980785251f, -0.000593912904f, -0.981379211f, -0.000584675814f, -0.981963873f, -0.000575433194f, -0.982539296f, -0.000566185161f,
+    -0.983105481f, -0.000556931773f, -0.983662426f, -0.000547673204f, -0.984210074f, -0.000538409397f, -0.984748483f, -0.000529140583f,
+    -0.985277653f, -0.000519866764f, -0.985797524f, -0.000510588055f, -0.986308098f, -0.000501304574f, -0.986809373f, -0.000492016319f,
+    -0.987301409f, -0.000482723495f, -0.987784147f, -0.000473426073f, -0.988257587f, -0.000464124227f, -0.988721669f, -0.000454818015f,
+    -0.989176512f, -0.000445507496f, -0.989621997f, -0.000436192786f, -0.990058184f, -0.000426874001f, -0.990485072f, -0.000417551171f,
+    -0.990902662f, -0.000408224412f, -0.991310835f, -0.000398893812f, -0.991709769f, -0.000389559485f, -0.992099285f, -0.000380221463f,
+    -0.992479563f, -0.000370879861f, -0.992850423f, -0.000361534767f, -0.993211925f, -0.000352186296f, -0.993564129f, -0.000342834479f,
+    -0.993906975f, -0.00033347946f, -0.994240463f, -0.000324121269f, -0.994564593f, -0.000314760051f, -0.994879305f, -0.000305395864f,
+    -0.99518472f, -0.000296028826f, -0.995480776f, -0.000286658964f, -0.995767415f, -0.000277286425f, -0.996044695f, -0.000267911295f,
+    -0.996312618f, -0.000258533604f, -0.996571124f, -0.000249153498f, -0.996820271f, -0.000239771049f, -0.997060061f, -0.000230386344f,
+    -0.997290432f, -0.000220999456f, -0.997511446f, -0.000211610502f, -0.997723043f, -0.000202219555f, -0.997925282f, -0.000192826701f,
+    -0.998118103f, -0.000183432028f, -0.998301566f, -0.000174035638f, -0.998475552f, -0.000164637604f, -0.998640239f, -0.000155238027f,
+    -0.99879545f, -0.000145836981f, -0.998941302f, -0.000136434566f, -0.999077737f, -0.000127030871f, -0.999204755f, -0.000117625968f,
+    -0.999322355f, -0.000108219967f, -0.999430597f, -9.88129468e-05f, -0.999529421f, -8.94049954e-05f, -0.999618828f, -7.99961999e-05f,
+    -0.999698818f, -7.05866551e-05f, -0.99976939f, -6.11764481e-05f, -0.999830604f, -5.1765659e-05f, -0.99988234f, -4.23543861e-05f,
+    -0.999924719f, -3.2942713e-05f, -0.999957621f, -2.35307307e-05f, -0.999981165f, -1.41185274e-05f, -0.999995291f, -4.70619034e-06f,
+    -1.0f, 4.70619034e-06f, -0.999995291f, 1.41185274e-05f, -0.999981165f, 2.35307307e-05f, -0.999957621f, 3.2942713e-05f,
+    -0.999924719f, 4.23543861e-05f, -0.99988234f, 5.1765659e-05f, -0.999830604f, 6.11764481e-05f, -0.99976939f, 7.05866551e-05f,
+    -0.999698818f, 7.99961999e-05f, -0.999618828f, 8.94049954e-05f, -0.999529421f, 9.88129468e-05f, -0.999430597f, 0.000108219967f,
+    -0.999322355f, 0.000117625968f, -0.999204755f, 0.000127030871f, -0.999077737f, 0.000136434566f, -0.998941302f, 0.000145836981f,
+    -0.99879545f, 0.000155238027f, -0.998640239f, 0.000164637604f, -0.998475552f, 0.000174035638f, -0.998301566f, 0.000183432028f,
+    -0.998118103f, 0.000192826701f, -0.997925282f, 0.000202219555f, -0.997723043f, 0.000211610502f, -0.997511446f, 0.000220999456f,
+    -0.997290432f, 0.000230386344f, -0.997060061f, 0.000239771049f, -0.996820271f, 0.000249153498f, -0.996571124f, 0.000258533604f,
+    -0.996312618f, 0.000267911295f, -0.996044695f, 0.000277286425f, -0.995767415f, 0.000286658964f, -0.995480776f, 0.000296028826f,
+    -0.99518472f, 0.000305395864f, -0.994879305f, 0.000314760051f, -0.994564593f, 0.000324121269f, -0.994240463f, 0.00033347946f,
+    -0.993906975f, 0.000342834479f, -0.993564129f, 0.000352186296f, -0.993211925f, 0.000361534767f, -0.992850423f, 0.000370879861f,
+    -0.992479563f, 0.000380221463f, -0.992099285f, 0.000389559485f, -0.991709769f, 0.000398893812f, -0.991310835f, 0.000408224412f,
+    -0.990902662f, 0.000417551171f, -0.990485072f, 0.000426874001f, -0.990058184f, 0.000436192786f, -0.989621997f, 0.000445507496f,
+    -0.989176512f, 0.000454818015f, -0.988721669f, 0.000464124227f, -0.988257587f, 0.000473426073f, -0.987784147f, 0.000482723495f,
+    -0.987301409f, 0.000492016319f, -0.986809373f, 0.000501304574f, -0.986308098f, 0.000510588055f, -0.985797524f, 0.000519866764f,
+    -0.985277653f, 0.000529140583f, -0.984748483f, 0.000538409397f, -0.984210074f, 0.000547673204f, -0.983662426f, 0.000556931773f,
+    -0.983105481f, 0.000566185161f, -0.982539296f, 0.000575433194f, -0.981963873f, 0.000584675814f, -0.981379211f, 0.000593912904f,
+    -0.980785251f, 0.000603144406f, -0.980182111f, 0.000612370262f, -0.979569793f, 0.000621590356f, -0.978948176f, 0.00063080457f,
+    -0.97831738f, 0.000640012906f, -0.977677345f, 0.000649215188f, -0.977028131f, 0.0006584113f, -0.976369739f, 0.0006676013f,
+    -0.975702107f, 0.000676784955f, -0.975025356f, 0.000685962266f, -0.974339366f, 0.000695133116f, -0.973644257f, 0.000704297447f,
+    -0.972939968f, 0.000713455142f, -0.972226501f, 0.000722606084f, -0.971503913f, 0.000731750275f, -0.970772147f, 0.000740887539f,
+    -0.970031261f, 0.000750017818f, -0.969281256f, 0.000759141054f, -0.968522072f, 0.000768257189f, -0.967753828f, 0.000777366047f,
+    -0.966976464f, 0.000786467572f, -0.966189981f, 0.000795561762f, -0.965394437f, 0.000804648385f, -0.964589775f, 0.0008137275f,
+    -0.963776052f, 0.000822798931f, -0.962953269f, 0.000831862621f, -0.962121427f, 0.000840918452f, -0.961280465f, 0.000849966367f,
+    -0.960430503f, 0.000859006308f, -0.95957154f, 0.000868038158f, -0.958703458f, 0.000877061859f, -0.957826436f, 0.000886077294f,
+    -0.956940353f, 0.000895084406f, -0.95604527f, 0.000904083019f, -0.955141187f, 0.000913073192f, -0.954228103f, 0.000922054751f,
+    -0.953306019f, 0.000931027636f, -0.952374995f, 0.000939991733f, -0.95143503f, 0.000948947039f, -0.950486064f, 0.000957893382f,
+    -0.949528158f, 0.000966830703f, -0.94856137f, 0.000975758885f, -0.947585583f, 0.000984677928f, -0.946600914f, 0.000993587659f,
+    -0.945607305f, 0.00100248808f, -0.944604814f, 0.00101137906f, -0.943593442f, 0.0010202605f, -0.94257319f, 0.0010291324f,
+    -0.941544056f, 0.00103799463f, -0.940506041f, 0.00104684697f, -0.939459205f, 0.00105568953f, -0.938403547f, 0.00106452219f,
+    -0.937339008f, 0.00107334473f, -0.936265647f, 0.00108215725f, -0.935183525f, 0.00109095953f, -0.934092522f, 0.00109975156f,
+    -0.932992816f, 0.00110853324f, -0.931884289f, 0.00111730455f, -0.93076694f, 0.00112606527f, -0.929640889f, 0.00113481539f,
+    -0.928506076f, 0.00114355481f, -0.927362502f, 0.00115228351f, -0.926210225f, 0.00116100139f, -0.925049245f, 0.00116970832f,
+    -0.923879504f, 0.0011784042f, -0.92270112f, 0.00118708902f, -0.921514034f, 0.00119576266f, -0.920318305f, 0.001204425f,
+    -0.919113874f, 0.00121307606f, -0.917900801f, 0.00122171571f, -0.916679084f, 0.00123034383f, -0.915448725f, 0.00123896042f,
+    -0.914209783f, 0.00124756526f, -0.912962198f, 0.00125615846f, -0.91170603f, 0.00126473978f, -0.910441279f, 0.00127330911f,
+    -0.909168005f, 0.00128186657f, -0.907886088f, 0.00129041192f, -0.906595707f, 0.00129894516f, -0.905296743f, 0.00130746618f,
+    -0.903989315f, 0.00131597486f, -0.902673304f, 0.0013244712f, -0.901348829f, 0.00133295509f, -0.900015891f, 0.00134142628f,
+    -0.898674488f, 0.00134988502f, -0.897324562f, 0.00135833095f, -0.895966232f, 0.00136676407f, -0.894599497f, 0.00137518439f,
+    -0.893224299f, 0.00138359179f, -0.891840696f, 0.00139198615f, -0.890448749f, 0.00140036736f, -0.889048338f, 0.00140873541f,
+    -0.887639642f, 0.0014170903f, -0.886222541f, 0.00142543169f, -0.884797096f, 0.00143375981f, -0.883363366f, 0.00144207431f,
+    -0.881921291f, 0.0014503753f, -0.880470872f, 0.00145866268f, -0.879012227f, 0.0014669362f, -0.877545297f, 0.00147519598f,
+    -0.876070082f, 0.00148344191f, -0.874586642f, 0.00149167387f, -0.873094976f, 0.00149989175f, -0.871595085f, 0.00150809553f,
+    -0.870086968f, 0.00151628512f, -0.868570685f, 0.0015244605f, -0.867046237f, 0.00153262145f, -0.865513623f, 0.00154076796f,
+    -0.863972843f, 0.00154890004f, -0.862423956f, 0.00155701744f, -0.860866964f, 0.0015651203f, -0.859301805f, 0.00157320837f,
+    -0.857728601f, 0.00158128166f, -0.856147349f, 0.00158934004f, -0.854557991f, 0.00159738341f, -0.852960587f, 0.00160541188f,
+    -0.851355195f, 0.00161342509f, -0.849741757f, 0.00162142317f, -0.848120332f, 0.001629406f, -0.84649092f, 0.00163737347f,
+    -0.84485358f, 0.00164532557f, -0.843208253f, 0.00165326218f, -0.841554999f, 0.0016611832f, -0.839893818f, 0.00166908861f,
+    -0.838224709f, 0.00167697831f, -0.836547732f, 0.00168485229f, -0.834862888f, 0.00169271033f, -0.833170176f, 0.00170055241f,
+    -0.831469595f, 0.00170837855f, -0.829761207f, 0.0017161885f, -0.82804507f, 0.00172398239f, -0.826321065f, 0.0017317601f,
+    -0.824589312f, 0.00173952139f, -0.82284981f, 0.00174726639f, -0.8211025f, 0.00175499497f, -0.819347501f, 0.0017627069f,
+    -0.817584813f, 0.0017704023f, -0.815814435f, 0.00177808106f, -0.81403631f, 0.00178574317f, -0.812250614f, 0.00179338828f,
+    -0.81045717f, 0.00180101662f, -0.808656156f, 0.00180862809f, -0.806847572f, 0.00181622244f, -0.805031359f, 0.00182379968f,
+    -0.803207517f, 0.00183135981f, -0.801376164f, 0.00183890259f, -0.799537241f, 0.00184642815f, -0.797690868f, 0.00185393635f,
+    -0.795836926f, 0.0018614271f, -0.793975472f, 0.00186890026f, -0.792106569f, 0.00187635585f, -0.790230215f, 0.00188379386f,
+    -0.78834641f, 0.00189121405f, -0.786455214f, 0.00189861644f, -0.784556568f, 0.00190600101f, -0.78265059f, 0.00191336754f,
+    -0.780737221f, 0.00192071614f, -0.778816521f, 0.00192804669f, -0.77688849f, 0.00193535909f, -0.774953127f, 0.00194265321f,
+    -0.773010433f, 0.00194992905f, -0.771060526f, 0.00195718673f, -0.769103348f, 0.00196442567f, -0.767138898f, 0.00197164621f,
+    -0.765167236f, 0.00197884836f, -0.763188422f, 0.00198603189f, -0.761202395f, 0.00199319655f, -0.759209216f, 0.00200034236f,
+    -0.757208824f, 0.00200746953f, -0.755201399f, 0.00201457785f, -0.753186822f, 0.00202166708f, -0.751165152f, 0.00202873745f,
+    -0.749136388f, 0.00203578849f, -0.747100592f, 0.00204282044f, -0.745057762f, 0.0020498333f, -0.743007958f, 0.00205682684f,
+    -0.740951121f, 0.00206380081f, -0.73888731f, 0.0020707557f, -0.736816585f, 0.00207769079f, -0.734738886f, 0.00208460633f,
+    -0.732654274f, 0.00209150254f, -0.730562747f, 0.00209837873f, -0.728464365f, 0.00210523535f, -0.726359129f, 0.00211207219f,
+    -0.724247098f, 0.00211888901f, -0.722128212f, 0.00212568603f, -0.720002532f, 0.0021324628f, -0.717870057f, 0.00213921978f,
+    -0.715730846f, 0.0021459565f, -0.71358484f, 0.00215267297f, -0.711432219f, 0.00215936941f, -0.709272802f, 0.00216604536f,
+    -0.707106769f, 0.00217270083f, -0.704934061f, 0.0021793358f, -0.702754736f, 0.00218595052f, -0.700568795f, 0.00219254452f,
+    -0.698376238f, 0.00219911803f, -0.696177125f, 0.00220567058f, -0.693971455f, 0.00221220241f, -0.691759229f, 0.00221871352f,
+    -0.689540565f, 0.00222520391f, -0.687315345f, 0.0022316731f, -0.685083687f, 0.00223812135f, -0.682845533f, 0.00224454864f,
+    -0.680601001f, 0.00225095474f, -0.678350031f, 0.00225733966f, -0.676092684f, 0.00226370315f, -0.673829019f, 0.00227004546f,
+    -0.671558976f, 0.00227636658f, -0.669282615f, 0.00228266604f, -0.666999936f, 0.00228894409f, -0.664710999f, 0.00229520071f,
+    -0.662415802f, 0.00230143545f, -0.660114348f, 0.00230764877f, -0.657806695f, 0.0023138402f, -0.655492842f, 0.00232000998f,
+    -0.653172851f, 0.00232615788f, -0.65084666f, 0.00233228388f, -0.64851439f, 0.002338388f, -0.64617604f, 0.00234447001f,
+    -0.643831551f, 0.00235053012f, -0.641481042f, 0.00235656789f, -0.639124453f, 0.00236258353f, -0.636761844f, 0.00236857706f,
+    -0.634393275f, 0.00237454823f, -0.632018745f, 0.00238049706f, -0.629638255f, 0.00238642353f, -0.627251804f, 0.00239232741f,
+    -0.624859512f, 0.00239820872f, -0.622461259f, 0.00240406767f, -0.620057225f, 0.0024099038f, -0.61764729f, 0.00241571735f,
+    -0.615231574f, 0.00242150808f, -0.612810075f, 0.00242727622f, -0.610382795f, 0.00243302132f, -0.607949793f, 0.0024387436f,
+    -0.605511069f, 0.00244444283f, -0.603066623f, 0.00245011924f, -0.600616455f, 0.00245577237f, -0.598160684f, 0.00246140244f,
+    -0.59569931f, 0.00246700947f, -0.593232274f, 0.00247259322f, -0.590759695f, 0.00247815368f, -0.588281572f, 0.00248369086f,
+    -0.585797846f, 0.00248920452f, -0.583308637f, 0.0024946949f, -0.580813944f, 0.00250016176f, -0.578313768f, 0.00250560511f,
+    -0.575808167f, 0.00251102471f, -0.573297143f, 0.00251642079f, -0.570780754f, 0.00252179313f, -0.568258941f, 0.00252714194f,
+    -0.565731823f, 0.00253246678f, -0.563199341f, 0.00253776787f, -0.560661554f, 0.00254304498f, -0.558118522f, 0.0025482981f,
+    -0.555570245f, 0.00255352748f, -0.553016722f, 0.00255873264f, -0.550457954f, 0.00256391382f, -0.547894061f, 0.00256907078f,
+    -0.545324981f, 0.00257420354f, -0.542750776f, 0.00257931207f, -0.540171444f, 0.0025843964f, -0.537587047f, 0.0025894565f,
+    -0.534997642f, 0.00259449193f, -0.532403111f, 0.00259950315f, -0.529803634f, 0.00260448991f, -0.527199149f, 0.002609452f,
+    -0.524589658f, 0.00261438964f, -0.521975279f, 0.00261930283f, -0.519356012f, 0.00262419111f, -0.516731799f, 0.00262905471f,
+    -0.514102757f, 0.00263389386f, -0.511468828f, 0.00263870787f, -0.50883013f, 0.0026434972f, -0.506186664f, 0.00264826161f,
+    -0.50353837f, 0.00265300111f, -0.500885367f, 0.0026577157f, -0.498227656f, 0.00266240514f, -0.495565265f, 0.00266706967f,
+    -0.492898196f, 0.00267170905f, -0.490226477f, 0.00267632306f, -0.487550169f, 0.00268091215f, -0.484869242f, 0.00268547586f,
+    -0.482183784f, 0.00269001443f, -0.479493767f, 0.00269452762f, -0.47679922f, 0.00269901543f, -0.474100202f, 0.00270347786f,
+    -0.471396744f, 0.00270791468f, -0.468688816f, 0.00271232636f, -0.465976506f, 0.00271671219f, -0.463259786f, 0.00272107264f,
+    -0.460538715f, 0.00272540725f, -0.457813293f, 0.00272971648f, -0.455083579f, 0.00273399986f, -0.452349573f, 0.00273825764f,
+    -0.449611336f, 0.00274248957f, -0.446868837f, 0.00274669565f, -0.444122136f, 0.00275087589f, -0.441371262f, 0.00275503029f,
+    -0.438616246f, 0.00275915861f, -0.435857087f, 0.00276326109f, -0.433093816f, 0.00276733749f, -0.430326492f, 0.00277138781f,
+    -0.427555084f, 0.00277541229f, -0.424779683f, 0.00277941045f, -0.422000259f, 0.00278338254f, -0.419216901f, 0.00278732833f,
+    -0.416429549f, 0.0027912478f, -0.413638324f, 0.00279514119f, -0.410843164f, 0.00279900827f, -0.408044159f, 0.00280284882f,
+    -0.405241311f, 0.00280666305f, -0.402434647f, 0.00281045097f, -0.399624199f, 0.00281421235f, -0.396809995f, 0.00281794742f,
+    -0.393992037f, 0.00282165571f, -0.391170382f, 0.00282533769f, -0.388345033f, 0.0028289929f, -0.385516047f, 0.00283262157f,
+    -0.382683426f, 0.00283622346f, -0.379847199f, 0.00283979881f, -0.377007425f, 0.00284334715f, -0.374164075f, 0.00284686894f,
+    -0.371317208f, 0.00285036396f, -0.368466824f, 0.00285383221f, -0.365612984f, 0.00285727344f, -0.362755716f, 0.00286068791f,
+    -0.359895051f, 0.00286407536f, -0.357030958f, 0.0028674358f, -0.354163527f, 0.00287076924f, -0.351292759f, 0.0028740759f,
+    -0.348418683f, 0.00287735532f, -0.345541328f, 0.00288060773f, -0.342660725f, 0.0028838329f, -0.339776874f, 0.00288703106f,
+    -0.336889863f, 0.00289020198f, -0.333999664f, 0.00289334566f, -0.331106305f, 0.0028964621f, -0.328209847f, 0.00289955153f,
+    -0.32531029f, 0.00290261325f, -0.322407693f, 0.00290564797f, -0.319502026f, 0.00290865521f, -0.316593379f, 0.00291163521f,
+    -0.313681751f, 0.00291458773f, -0.310767144f, 0.00291751279f, -0.307849646f, 0.00292041036f, -0.304929227f, 0.00292328047f,
+    -0.302005947f, 0.0029261231f, -0.299079835f, 0.00292893802f, -0.296150893f, 0.00293172547f, -0.293219149f, 0.00293448544f,
+    -0.290284663f, 0.00293721771f, -0.287347466f, 0.00293992227f, -0.284407526f, 0.00294259936f, -0.281464934f, 0.0029452485f,
+    -0.27851969f, 0.00294787018f, -0.275571823f, 0.00295046391f, -0.272621363f, 0.00295302994f, -0.269668311f, 0.00295556802f,
+    -0.266712755f, 0.0029580784f, -0.263754666f, 0.00296056108f, -0.260794103f, 0.00296301581f, -0.257831097f, 0.0029654426f,
+    -0.254865646f, 0.00296784146f, -0.251897812f, 0.00297021237f, -0.248927608f, 0.00297255535f, -0.24595505f, 0.00297487038f,
+    -0.242980182f, 0.00297715748f, -0.24000302f, 0.0029794164f, -0.237023607f, 0.00298164738f, -0.234041959f, 0.00298385019f,
+    -0.231058106f, 0.00298602507f, -0.228072077f, 0.00298817176f, -0.225083917f, 0.00299029029f, -0.222093627f, 0.00299238088f,
+    -0.219101235f, 0.00299444306f, -0.216106802f, 0.00299647707f, -0.213110313f, 0.00299848313f, -0.210111842f, 0.0030004608f,
+    -0.207111374f, 0.00300241006f, -0.204108968f, 0.00300433114f, -0.201104641f, 0.00300622405f, -0.198098406f, 0.0030080888f,
+    -0.195090324f, 0.0030099249f, -0.192080393f, 0.00301173283f, -0.18906866f, 0.00301351259f, -0.186055154f, 0.0030152637f,
+    -0.183039889f, 0.00301698665f, -0.180022895f, 0.00301868096f, -0.177004218f, 0.0030203471f, -0.173983872f, 0.00302198459f,
+    -0.170961887f, 0.00302359369f, -0.167938292f, 0.00302517437f, -0.164913118f, 0.00302672666f, -0.161886394f, 0.00302825053f,
+    -0.15885815f, 0.00302974577f, -0.155828401f, 0.00303121237f, -0.152797192f, 0.00303265057f, -0.149764538f, 0.00303406012f,
+    -0.146730468f, 0.00303544127f, -0.143695027f, 0.00303679379f, -0.140658244f, 0.00303811766f, -0.137620121f, 0.00303941313f,
+    -0.134580702f, 0.00304067973f, -0.13154003f, 0.00304191792f, -0.128498107f, 0.00304312748f, -0.125454977f, 0.00304430816f,
+    -0.122410677f, 0.00304546044f, -0.119365215f, 0.00304658385f, -0.116318628f, 0.00304767862f, -0.113270953f, 0.00304874498f,
+    -0.110222206f, 0.00304978224f, -0.107172422f, 0.0030507911f, -0.104121633f, 0.00305177108f, -0.10106986f, 0.00305272243f,
+    -0.0980171412f, 0.0030536449f, -0.0949634984f, 0.00305453874f, -0.0919089541f, 0.00305540394f, -0.0888535529f, 0.00305624027f,
+    -0.0857973099f, 0.00305704772f, -0.0827402622f, 0.00305782654f, -0.0796824396f, 0.00305857649f, -0.0766238645f, 0.0030592978f,
+    -0.0735645667f, 0.00305999024f, -0.070504576f, 0.00306065381f, -0.0674439222f, 0.00306128873f, -0.0643826276f, 0.00306189456f,
+    -0.061320737f, 0.00306247175f, -0.0582582653f, 0.00306302006f, -0.0551952459f, 0.00306353974f, -0.052131705f, 0.00306403032f,
+    -0.0490676761f, 0.00306449225f, -0.0460031815f, 0.00306492508f, -0.0429382585f, 0.00306532928f, -0.0398729257f, 0.0030657046f,
+    -0.0368072242f, 0.00306605105f, -0.0337411724f, 0.00306636863f, -0.030674804f, 0.00306665734f, -0.027608145f, 0.00306691718f,
+    -0.024541229f, 0.00306714815f, -0.0214740802f, 0.00306735048f, -0.0184067301f, 0.00306752371f, -0.015339206f, 0.00306766806f,
+    -0.0122715384f, 0.00306778355f, -0.00920375437f, 0.00306787016f, -0.00613588467f, 0.0030679279f, -0.00306795677f, 0.00306795677f,
+    -2.44929371e-16f, 0.00306795677f
+};
+
+alignas(16) static const float mixerPanLEntries[34] = {
+    1.0f, -0.00481528044f, 0.99518472f, -0.0143994689f, 0.980785251f, -0.0238448977f, 0.956940353f, -0.0330608487f,
+    0.923879504f, -0.0419582129f, 0.881921291f, -0.0504516959f, 0.831469595f, -0.0584591031f, 0.773010492f, -0.0659037232f,
+    0.707106769f, -0.0727134943f, 0.634393275f, -0.07882303f, 0.555570245f, -0.0841734707f, 0.471396774f, -0.0887133479f,
+    0.382683426f, -0.0923987925f, 0.290284634f, -0.0951942801f, 0.195090353f, -0.0970732197f, 0.0980171338f, -0.0980171785f,
+    -4.37113883e-08f, 0.0f
+};
+
+alignas(16) static const float mixerPanREntries[34] = {
+    0.0f, 0.0980171412f, 0.0980171412f, 0.0970731825f, 0.195090324f, 0.0951943398f, 0.290284663f, 0.0923987925f,
+    0.382683456f, 0.0887132585f, 0.471396714f, 0.0841735303f, 0.555570245f, 0.07882303f, 0.634393275f, 0.0727134943f,
+    0.707106769f, 0.0659036636f, 0.773010433f, 0.0584591627f, 0.831469595f, 0.0504516363f, 0.881921232f, 0.0419582725f,
+    0.923879504f, 0.0330608487f, 0.956940353f, 0.0238448977f, 0.980785251f, 0.0143994689f, 0.99518472f, 0.00481528044f,
+    1.0f, 0.0f
+};
+
+alignas(16) static const float exp2Entries[514] = {
+    4.0f, 0.14653179f, 4.14653158f, 0.151899695f, 4.2984314f, 0.157464221f, 4.4558959f, 0.163231835f,
+    4.61912775f, 0.169212267f, 4.78833961f, 0.175411001f, 4.96375084f, 0.181836829f, 5.14558744f, 0.18849805f,
+    5.33408546f, 0.195403293f, 5.52948904f, 0.202561483f, 5.73205042f, 0.209981918f, 5.94203234f, 0.217673153f,
+    6.15970564f, 0.22564818f, 6.38535357f, 0.233914331f, 6.61926794f, 0.242483303f, 6.86175156f, 0.251366198f,
+    7.11311769f, 0.26057446f, 7.37369204f, 0.270120084f, 7.64381218f, 0.280015379f, 7.92382765f, 0.290271819f,
+    8.21409893f, 0.300906688f, 8.51500607f, 0.311929792f, 8.82693577f, 0.323356688f, 9.1502924f, 0.335202187f,
+    9.48549461f, 0.347481638f, 9.83297634f, 0.360210925f, 10.1931868f, 0.3734065f, 10.5665941f, 0.387085497f,
+    10.9536791f, 0.401265562f, 11.3549452f, 0.41596511f, 11.7709103f, 0.431203157f, 12.2021132f, 0.446999371f,
+    12.6491127f, 0.463374287f, 13.1124868f, 0.480346799f, 13.5928335f, 0.497945577f, 14.0907793f, 0.516186774f,
+    14.606966f, 0.535096228f, 15.1420622f, 0.554698408f, 15.6967602f, 0.575018644f, 16.27178f, 0.596083283f,
+    16.8678627f, 0.617919564f, 17.4857826f, 0.640555739f, 18.1263371f, 0.664021194f, 18.7903595f, 0.688346267f,
+    19.4787045f, 0.713555753f, 20.1922607f, 0.739702046f, 20.931963f, 0.76679951f, 21.6987629f, 0.794889688f,
+    22.4936523f, 0.824008822f, 23.3176613f, 0.854194701f, 24.1718559f, 0.885486364f, 25.0573425f, 0.917924345f,
+    25.9752655f, 0.951550603f, 26.9268169f, 0.98640871f, 27.9132252f, 1.02254379f, 28.93577f, 1.06000257f,
+    29.9957714f, 1.09883356f, 31.0946064f, 1.13908708f, 32.2336922f, 1.18081522f, 33.4145088f, 1.22406054f,
+    34.6385689f, 1.26891291f, 35.9074821f, 1.3153969f, 37.2228775f, 1.3635838f, 38.5864639f, 1.41353595f,
+    39.9999962f, 1.46531785f, 41.4653168f, 1.51899683f, 42.984314f, 1.57464218f, 44.5589561f, 1.63232589f,
+    46.1912804f, 1.69212282f, 47.8834038f, 1.75411034f, 49.6375122f, 1.81836855f, 51.455883f, 1.88498068f,
+    53.3408623f, 1.95403314f, 55.2948952f, 2.02561522f, 57.3205109f, 2.09981942f, 59.42033f, 2.17672157f,
+    61.5970535f, 2.25648165f, 63.8535347f, 2.33914328f, 66.1926804f, 2.42483306f, 68.6175079f, 2.51366186f,
+    71.1311722f, 2.6057446f, 73.7369156f, 2.70120072f, 76.438118f, 2.80015373f, 79.2382736f, 2.90273166f,
+    82.1409988f, 3.00906706f, 85.1500702f, 3.11929822f, 88.269371f, 3.23356724f, 91.5029373f, 3.35202241f,
+    94.8549576f, 3.4748168f, 98.3297729f, 3.60210967f, 101.931885f, 3.73403049f, 105.665916f, 3.87085414f,
+    109.536766f, 4.01265478f, 113.549423f, 4.15965033f, 117.709076f, 4.31203032f, 122.021103f, 4.46999311f,
+    126.491096f, 4.63374186f, 131.124832f, 4.80348969f, 135.928329f, 4.97945547f, 140.907791f, 5.16186762f,
+    146.069656f, 5.35096216f, 151.420609f, 5.54698372f, 156.96759f, 5.75018597f, 162.717789f, 5.96083212f,
+    168.678619f, 6.17919493f, 174.857819f, 6.40549755f, 181.263306f, 6.64020967f, 187.903519f, 6.88346004f,
+    194.786972f, 7.13562155f, 201.922592f, 7.39702034f, 209.319626f, 7.66799498f, 216.98761f, 7.94889641f,
+    224.936508f, 8.24008751f, 233.176605f, 8.54194641f, 241.718552f, 8.85486317f, 250.57341f, 9.17915726f,
+    259.752563f, 9.51559162f, 269.268158f, 9.8639946f, 279.132141f, 10.2255297f, 289.357666f, 10.599926f,
+    299.957611f, 10.9884348f, 310.946045f, 11.3907642f, 322.336792f, 11.8082581f, 334.14505f, 12.2406044f,
+    346.385681f, 12.6892471f, 359.074921f, 13.1538496f, 372.22876f, 13.6359653f, 385.864716f, 14.135231f,
+    399.999969f, 14.6530409f, 414.653015f, 15.1901045f, 429.843109f, 15.746273f, 445.589386f, 16.3234062f,
+    461.912781f, 16.9210701f, 478.833862f, 17.5412598f, 496.375122f, 18.1835136f, 514.558655f, 18.8499756f,
+    533.40863f, 19.5401478f, 552.94873f, 20.2563324f, 573.205078f, 20.9979954f, 594.203064f, 21.7676144f,
+    615.970703f, 22.5646114f, 638.535339f, 23.3916512f, 661.926941f, 24.2481098f, 686.175049f, 25.1368523f,
+    711.311951f, 26.057209f, 737.369141f, 27.0117531f, 764.380859f, 28.0017872f, 792.38269f, 29.0270424f,
+    821.409729f, 30.0909424f, 851.500671f, 31.192688f, 882.693359f, 32.3359642f, 915.029297f, 33.5199089f,
+    948.549194f, 34.7484818f, 983.297668f, 36.0207558f, 1019.31848f, 37.340992f, 1056.65942f, 38.7081909f,
+    1095.36768f, 40.1269226f, 1135.49451f, 41.5961266f, 1177.0907f, 43.1207047f, 1220.21143f, 44.6995239f,
+    1264.91089f, 46.3369827f, 1311.24792f, 48.0353279f, 1359.2832f, 49.7940865f, 1409.07727f, 51.6191406f,
+    1460.69641f, 53.5091171f, 1514.20557f, 55.4703331f, 1569.6759f, 57.5013199f, 1627.17725f, 59.6088562f,
+    1686.78613f, 61.7913704f, 1748.57739f, 64.0561447f, 1812.63354f, 66.4014893f, 1879.03503f, 68.8352432f,
+    1947.87036f, 71.3555679f, 2019.22595f, 73.9708939f, 2093.19678f, 76.6792526f, 2169.87598f, 79.4882126f,
+    2249.36426f, 82.401619f, 2331.76587f, 85.418663f, 2417.18457f, 88.5494232f, 2505.73389f, 91.7915649f,
+    2597.52563f, 95.1559067f, 2692.6814f, 98.6399384f, 2791.32129f, 102.255287f, 2893.57666f, 105.999252f,
+    2999.57593f, 109.884338f, 3109.46021f, 113.907631f, 3223.36792f, 118.082573f, 3341.45044f, 122.406036f,
+    3463.85645f, 126.892464f, 3590.74902f, 131.538498f, 3722.28735f, 136.357086f, 3858.64453f, 141.354858f,
+    3999.99951f, 146.530411f, 4146.52979f, 151.901031f, 4298.43066f, 157.462723f, 4455.89355f, 163.234055f,
+    4619.12744f, 169.210678f, 4788.33838f, 175.412598f, 4963.75098f, 181.835129f, 5145.58594f, 188.499756f,
+    5334.08594f, 195.401459f, 5529.4873f, 202.563324f, 5732.05078f, 209.97995f, 5942.03076f, 217.676132f,
+    6159.70654f, 225.646103f, 6385.35254f, 233.912109f, 6619.26514f, 242.485458f, 6861.75049f, 251.3638f,
+    7113.11426f, 260.576782f, 7373.69092f, 270.117523f, 7643.80859f, 280.017853f, 7923.82617f, 290.270416f,
+    8214.09668f, 300.909393f, 8515.00586f, 311.92688f, 8826.93262f, 323.359619f, 9150.29297f, 335.199066f,
+    9485.49121f, 347.484772f, 9832.97656f, 360.200806f, 10193.1777f, 373.409637f, 10566.5869f, 387.081635f,
+    10953.6689f, 401.268921f, 11354.9375f, 415.960968f, 11770.8984f, 431.206757f, 12202.1055f, 446.994904f,
+    12649.1006f, 463.378174f, 13112.4785f, 480.344269f, 13592.8223f, 497.940521f, 14090.7627f, 516.19104f,
+    14606.9541f, 535.09082f, 15142.0449f, 554.702942f, 15696.748f, 575.012756f, 16271.7607f, 596.088135f,
+    16867.8496f, 617.913269f, 17485.7617f, 640.561035f, 18126.3223f, 664.014465f, 18790.3379f, 688.351929f,
+    19478.6895f, 713.555176f, 20192.2441f, 739.708374f, 20931.9531f, 766.791992f, 21698.7441f, 794.896484f,
+    22493.6406f, 824.000732f, 23317.6426f, 854.186035f, 24171.8281f, 885.493652f, 25057.3223f, 917.914978f,
+    25975.2363f, 951.558411f, 26926.7949f, 986.398682f, 27913.1934f, 1022.55219f, 28935.7461f, 1059.99182f,
+    29995.7383f, 1098.84265f, 31094.5801f, 1139.07556f, 32233.6562f, 1180.82495f, 33414.4805f, 1224.05957f,
+    34638.5391f, 1268.92371f, 35907.4648f, 1315.38403f, 37222.8477f, 1363.59546f, 38586.4453f, 1413.52197f,
+    39999.9648f, 1465.30298f
+};
+
+alignas(16) static const float exp2ExLowEntries[514] = {
+    2.0f, 0.0418244414f, 2.04182434f, 0.0426990837f, 2.08452344f, 0.0435920171f, 2.12811565f, 0.0445034429f,
+    2.1726191f, 0.0454342887f, 2.21805334f, 0.0463844202f, 2.26443768f, 0.0473544225f, 2.31179214f, 0.048344709f,
+    2.36013675f, 0.0493557043f, 2.40949249f, 0.0503878407f, 2.45988035f, 0.0514413565f, 2.51132178f, 0.0525173172f,
+    2.56383896f, 0.0536155701f, 2.61745453f, 0.0547367893f, 2.67219138f, 0.0558814593f, 2.72807288f, 0.0570500642f,
+    2.78512287f, 0.0582431071f, 2.84336615f, 0.0594610982f, 2.90282702f, 0.0607043169f, 2.96353149f, 0.0619740263f,
+    3.02550554f, 0.0632700399f, 3.0887754f, 0.0645931587f, 3.15336871f, 0.0659439415f, 3.21931267f, 0.0673229769f,
+    3.28663564f, 0.0687308535f, 3.35536647f, 0.0701678842f, 3.42553425f, 0.0716355294f, 3.49716997f, 0.0731335878f,
+    3.57030344f, 0.074662976f, 3.64496636f, 0.076224342f, 3.72119069f, 0.0778183639f, 3.79900908f, 0.0794457197f,
+    3.87845492f, 0.081106782f, 3.95956159f, 0.0828035623f, 4.04236507f, 0.0845348388f, 4.1269002f, 0.0863026455f,
+    4.21320248f, 0.0881067142f, 4.30130959f, 0.0899499357f, 4.39125919f, 0.0918309838f, 4.4830904f, 0.0937513784f,
+    4.57684183f, 0.0957119241f, 4.67255354f, 0.0977134779f, 4.77026701f, 0.0997568816f, 4.87002373f, 0.101843022f,
+    4.97186708f, 0.103972785f, 5.07584f, 0.106147081f, 5.18198681f, 0.108366854f, 5.29035378f, 0.110633045f,
+    5.40098667f, 0.11294663f, 5.51393318f, 0.115308598f, 5.62924194f, 0.117719956f, 5.74696207f, 0.120180771f,
+    5.86714268f, 0.122694984f, 5.98983765f, 0.125260815f, 6.11509848f, 0.12788029f, 6.24297857f, 0.130554557f,
+    6.37353325f, 0.133284733f, 6.50681829f, 0.136072025f, 6.64288998f, 0.13891758f, 6.7818079f, 0.141822666f,
+    6.92363024f, 0.144788489f, 7.06841898f, 0.147816345f, 7.21623516f, 0.150907502f, 7.36714268f, 0.154063314f,
+    7.5212059f, 0.157285124f, 7.67849112f, 0.160573006f, 7.83906412f, 0.163932249f, 8.00299644f, 0.167360425f,
+    8.17035675f, 0.170860305f, 8.34121704f, 0.17443338f, 8.51565075f, 0.17808117f, 8.69373131f, 0.181805238f,
+    8.87553692f, 0.185607195f, 9.06114388f, 0.189488649f, 9.25063229f, 0.193451285f, 9.44408417f, 0.197496772f,
+    9.64158058f, 0.201626867f, 9.84320736f, 0.205843329f, 10.0490513f, 0.210147977f, 10.2591991f, 0.214542642f,
+    10.4737415f, 0.21902743f, 10.6927691f, 0.223609552f, 10.916379f, 0.22828573f, 11.1446648f, 0.233059689f,
+    11.3777237f, 0.237933487f, 11.6156578f, 0.242909193f, 11.8585663f, 0.247988969f, 12.1065559f, 0.253174961f,
+    12.3597307f, 0.258469433f, 12.6182003f, 0.26387459f, 12.8820744f, 0.269392788f, 13.1514673f, 0.275026411f,
+    13.4264936f, 0.280777812f, 13.7072716f, 0.286649495f, 13.9939213f, 0.29264161f, 14.2865629f, 0.298763752f,
+    14.5853262f, 0.30501157f, 14.8903379f, 0.311390042f, 15.2017279f, 0.317901909f, 15.5196304f, 0.324549943f,
+    15.8441801f, 0.331337005f, 16.1755161f, 0.338268727f, 16.5137863f, 0.345337152f, 16.8591232f, 0.352558851f,
+    17.2116814f, 0.3599374f, 17.571619f, 0.367458612f, 17.9390774f, 0.375148982f, 18.3142262f, 0.382988065f,
+    18.6972141f, 0.39100346f, 19.0882187f, 0.399173826f, 19.4873924f, 0.407527953f, 19.8949203f, 0.416043609f,
+    20.3109627f, 0.424750805f, 20.735714f, 0.433626354f, 21.1693401f, 0.442701519f, 21.6120415f, 0.451952159f,
+    22.0639954f, 0.4614034f, 22.5253983f, 0.471059918f, 22.9964581f, 0.480903119f, 23.4773617f, 0.490967721f,
+    23.9683285f, 0.501226962f, 24.4695549f, 0.511716902f, 24.9812717f, 0.522409678f, 25.5036812f, 0.533342957f,
+    26.0370255f, 0.544487655f, 26.5815125f, 0.555882931f, 27.1373959f, 0.567498624f, 27.704895f, 0.579375565f,
+    28.2842693f, 0.591482162f, 28.8757515f, 0.603860974f, 29.4796124f, 0.616479218f, 30.0960922f, 0.629371047f,
+    30.7254639f, 0.642542899f, 31.3680058f, 0.655969381f, 32.0239754f, 0.669697881f, 32.6936722f, 0.6836918f,
+    33.3773651f, 0.698000491f, 34.075367f, 0.712585807f, 34.7879524f, 0.727499187f, 35.5154495f, 0.742700994f,
+    36.258152f, 0.758244634f, 37.0163956f, 0.7740888f, 37.7904854f, 0.790289342f, 38.5807762f, 0.806803167f,
+    39.3875771f, 0.823688388f, 40.2112656f, 0.840900123f, 41.052166f, 0.858485043f, 41.9106522f, 0.87645191f,
+    42.7871017f, 0.894766152f, 43.6818695f, 0.913492262f, 44.5953598f, 0.932580531f, 45.5279427f, 0.952098072f,
+    46.4800415f, 0.971993029f, 47.452034f, 0.992335439f, 48.4443703f, 1.01307118f, 49.4574394f, 1.03427327f,
+    50.4917145f, 1.05588531f, 51.5475998f, 1.0779835f, 52.6255836f, 1.10050893f, 53.7260895f, 1.123541f,
+    54.8496323f, 1.14701843f, 55.9966507f, 1.17100489f, 57.1676559f, 1.19551229f, 58.3631668f, 1.22049367f,
+    59.5836601f, 1.24603677f, 60.8296967f, 1.27207386f, 62.1017723f, 1.29869652f, 63.4004669f, 1.32583392f,
+    64.7263031f, 1.35358167f, 66.0798874f, 1.38186598f, 67.4617462f, 1.41078639f, 68.8725357f, 1.44026613f,
+    70.3128052f, 1.47040868f, 71.7832108f, 1.50113428f, 73.2843475f, 1.53252602f, 74.8168716f, 1.56459963f,
+    76.3814697f, 1.59729338f, 77.9787674f, 1.63072228f, 79.6094894f, 1.66479778f, 81.2742844f, 1.69963956f,
+    82.9739227f, 1.73515511f, 84.7090759f, 1.77146924f, 86.480545f, 1.80848575f, 88.289032f, 1.8463347f,
+    90.1353683f, 1.88491559f, 92.0202866f, 1.92436409f, 93.9446487f, 1.96457541f, 95.9092255f, 2.00569105f,
+    97.914917f, 2.04760194f, 99.9625168f, 2.09042144f, 102.05294f, 2.13417077f, 104.187111f, 2.17876625f,
+    106.365875f, 2.22436476f, 108.59024f, 2.2708447f, 110.861084f, 2.31837034f, 113.179451f, 2.36681461f,
+    115.546272f, 2.4163487f, 117.962616f, 2.46684051f, 120.429459f, 2.5184679f, 122.947929f, 2.57109356f,
+    125.51902f, 2.62490273f, 128.143921f, 2.67975235f, 130.823669f, 2.73583579f, 133.559509f, 2.79300356f,
+    136.352509f, 2.85141087f, 139.203918f, 2.9110868f, 142.115005f, 2.97191668f, 145.086929f, 3.03411436f,
+    148.121048f, 3.09751511f, 151.218552f, 3.16234136f, 154.380905f, 3.22842145f, 157.609314f, 3.29598761f,
+    160.905304f, 3.3648603f, 164.270172f, 3.43528175f, 167.705444f, 3.5070653f, 171.212509f, 3.58046293f,
+    174.792984f, 3.65527987f, 178.448257f, 3.73177958f, 182.180038f, 3.80975842f, 185.989792f, 3.88942838f,
+    189.879227f, 3.97082829f, 193.850052f, 4.05380249f, 197.903854f, 4.13870955f, 202.042572f, 4.22512484f,
+    206.267685f, 4.31355047f, 210.581238f, 4.40368605f, 214.984924f, 4.49584866f, 219.480774f, 4.58979368f,
+    224.070572f, 4.6858511f, 228.756424f, 4.78376627f, 233.540192f, 4.88388348f, 238.424072f, 4.98593664f,
+    243.410004f, 5.09020281f, 248.500214f, 5.19673347f, 253.696945f, 5.3053236f, 259.002258f, 5.41626883f,
+    264.418549f, 5.52971268f, 269.948242f, 5.64517212f, 275.593414f, 5.76322412f, 281.356628f, 5.88374472f,
+    287.240387f, 6.00697994f, 293.247375f, 6.13240433f, 299.379761f, 6.26064539f, 305.640411f, 6.39156866f,
+    312.031982f, 6.52543974f, 318.557434f, 6.66168976f, 325.219116f, 6.80099916f, 332.020111f, 6.94322205f,
+    338.963348f, 7.08841896f, 346.051758f, 7.23688602f, 353.288635f, 7.38799047f, 360.676636f, 7.54248857f,
+    368.219116f, 7.70021772f, 375.919342f, 7.86149883f, 383.780853f, 8.02564526f, 391.806488f, 8.19347763f,
+    399.999969f, 8.36482048f
+};
+
+alignas(16) static const float exp2ExHighEntries[1026] = {
+    399.999969f, 3.06807542f, 403.068024f, 3.09133959f, 406.159363f, 3.11531925f, 409.274689f, 3.13921428f,
+    412.41391f, 3.16301799f, 415.576935f, 3.18755364f, 418.764496f, 3.21200275f, 421.976471f, 3.2363584f,
+    425.21283f, 3.26146293f, 428.474304f, 3.28619361f, 431.760498f, 3.31168461f, 435.072174f, 3.33708596f,
+    438.409271f, 3.36239004f, 441.771667f, 3.38847208f, 445.160126f, 3.41416597f, 448.57431f, 3.44064975f,
+    452.014954f, 3.46704006f, 455.481995f, 3.49332952f, 458.975311f, 3.52042747f, 462.495758f, 3.5474298f,
+    466.043182f, 3.5743289f, 469.617493f, 3.60205507f, 473.219543f, 3.62936831f, 476.848938f, 3.65752149f,
+    480.506439f, 3.68557525f, 484.192017f, 3.71352196f, 487.905548f, 3.74232793f, 491.647858f, 3.77070475f,
+    495.418579f, 3.79995418f, 499.218536f, 3.82910061f, 503.047638f, 3.85813546f, 506.905762f, 3.88806319f,
+    510.793823f, 3.9178853f, 514.711731f, 3.94759345f, 518.659302f, 3.97821498f, 522.637512f, 4.00838041f,
+    526.645935f, 4.03947353f, 530.685364f, 4.07045746f, 534.755859f, 4.10132217f, 538.857178f, 4.13313627f,
+    542.990295f, 4.16447639f, 547.154785f, 4.19678068f, 551.351562f, 4.22897053f, 555.580505f, 4.26103783f,
+    559.841553f, 4.29409075f, 564.13562f, 4.32702732f, 568.462708f, 4.35983753f, 572.82251f, 4.39365721f,
+    577.216187f, 4.42697287f, 581.643127f, 4.46131277f, 586.104431f, 4.49553204f, 590.599976f, 4.52962017f,
+    595.129639f, 4.56475687f, 599.694397f, 4.59976912f, 604.294128f, 4.63464785f, 608.928772f, 4.67059898f,
+    613.599365f, 4.70601463f, 618.30542f, 4.74251938f, 623.047913f, 4.77889538f, 627.826782f, 4.81513214f,
+    632.641968f, 4.85248327f, 637.494446f, 4.88927841f, 642.383728f, 4.92720461f, 647.310913f, 4.96499729f,
+    652.275879f, 5.00264502f, 657.278564f, 5.04145098f, 662.320007f, 5.08011961f, 667.400146f, 5.11864042f,
+    672.518738f, 5.15834618f, 677.677124f, 5.19746017f, 682.874573f, 5.23777723f, 688.112366f, 5.27795172f,
+    693.39032f, 5.31797266f, 698.708252f, 5.3592248f, 704.067505f, 5.39986181f, 709.467346f, 5.44174862f,
+    714.909119f, 5.48348808f, 720.392578f, 5.52506781f, 725.917664f, 5.56792593f, 731.485596f, 5.6106329f,
+    737.096191f, 5.65317631f, 742.74939f, 5.69702816f, 748.446411f, 5.74022722f, 754.186646f, 5.78475428f,
+    759.971436f, 5.82912445f, 765.800537f, 5.87332487f, 771.673828f, 5.91888428f, 777.592712f, 5.96428347f,
+    783.557007f, 6.00950861f, 789.566528f, 6.05612469f, 795.622681f, 6.10204649f, 801.724731f, 6.14938021f,
+    807.874084f, 6.19654703f, 814.070618f, 6.24353361f, 820.314148f, 6.29196501f, 826.60614f, 6.33967495f,
+    832.945801f, 6.38885164f, 839.334656f, 6.43785572f, 845.772522f, 6.48667192f, 852.259155f, 6.53698921f,
+    858.796143f, 6.58712912f, 865.383301f, 6.63707733f, 872.020386f, 6.68856144f, 878.708923f, 6.73927832f,
+    885.448242f, 6.7915554f, 892.239746f, 6.84364796f, 899.083435f, 6.89554119f, 905.978943f, 6.94902992f,
+    912.927979f, 7.00172234f, 919.929688f, 7.05603504f, 926.985779f, 7.11015606f, 934.095886f, 7.16407013f,
+    941.259949f, 7.21964216f, 948.479614f, 7.27501822f, 955.754639f, 7.33018208f, 963.084839f, 7.38704252f,
+    970.471863f, 7.44305611f, 977.914917f, 7.5007925f, 985.41571f, 7.55832481f, 992.97406f, 7.6156373f,
+    1000.58966f, 7.67471218f, 1008.2644f, 7.73290682f, 1015.99731f, 7.7928915f, 1023.79016f, 7.85266447f,
+    1031.64282f, 7.91220856f, 1039.55505f, 7.9735837f, 1047.52869f, 8.03474236f, 1055.56335f, 8.09566784f,
+    1063.65906f, 8.15846634f, 1071.8175f, 8.22032928f, 1080.03784f, 8.28409481f, 1088.3219f, 8.34763527f,
+    1096.66956f, 8.41093254f, 1105.08057f, 8.47617626f, 1113.55664f, 8.54119015f, 1122.0979f, 8.60595512f,
+    1130.70386f, 8.67271233f, 1139.37659f, 8.73847485f, 1148.11499f, 8.80625916f, 1156.92126f, 8.87380505f,
+    1165.79504f, 8.94109249f, 1174.73621f, 9.01044846f, 1183.74658f, 9.07877159f, 1192.82544f, 9.14919662f,
+    1201.97461f, 9.21937275f, 1211.19397f, 9.28927994f, 1220.48328f, 9.36133766f, 1229.8446f, 9.43314075f,
+    1239.27771f, 9.50466919f, 1248.78235f, 9.5783968f, 1258.36084f, 9.65102673f, 1268.01184f, 9.72589016f,
+    1277.73767f, 9.80048943f, 1287.53821f, 9.87480354f, 1297.41296f, 9.95140266f, 1307.36438f, 10.0268612f,
+    1317.39124f, 10.10464f, 1327.49585f, 10.1821451f, 1337.6781f, 10.2593527f, 1347.93738f, 10.3389349f,
+    1358.27637f, 10.4182367f, 1368.69458f, 10.4972343f, 1379.19177f, 10.5786619f, 1389.77051f, 10.6588764f,
+    1400.42932f, 10.7415581f, 1411.1709f, 10.8239479f, 1421.99487f, 10.9060221f, 1432.90088f, 10.9906206f,
+    1443.89148f, 11.0749207f, 1454.96643f, 11.1588984f, 1466.12537f, 11.2454586f, 1477.37073f, 11.3307295f,
+    1488.70154f, 11.418622f, 1500.12012f, 11.5062046f, 1511.62634f, 11.5934525f, 1523.21973f, 11.6833839f,
+    1534.9032f, 11.7719755f, 1546.67517f, 11.8632908f, 1558.53845f, 11.9542847f, 1570.49268f, 12.0449305f,
+    1582.5376f, 12.1383629f, 1594.67603f, 12.2314663f, 1606.90747f, 12.324214f, 1619.23169f, 12.4198132f,
+    1631.65149f, 12.5139885f, 1644.16553f, 12.6110601f, 1656.77649f, 12.7077894f, 1669.48438f, 12.8041487f,
+    1682.28845f, 12.903471f, 1695.19202f, 13.0013142f, 1708.19324f, 13.1021652f, 1721.29541f, 13.2026615f,
+    1734.49805f, 13.3027735f, 1747.8009f, 13.4059629f, 1761.20679f, 13.5087891f, 1774.71558f, 13.6112223f,
+    1788.3269f, 13.7168055f, 1802.0437f, 13.8208151f, 1815.8645f, 13.9280243f, 1829.79248f, 14.0348549f,
+    1843.82739f, 14.1412764f, 1857.96863f, 14.2509708f, 1872.2196f, 14.3602781f, 1886.57983f, 14.4691677f,
+    1901.04907f, 14.5814056f, 1915.63049f, 14.6919718f, 1930.32239f, 14.8059378f, 1945.1283f, 14.9195023f,
+    1960.04785f, 15.0326319f, 1975.08044f, 15.1492405f, 1990.22974f, 15.2641125f, 2005.4939f, 15.3825169f,
+    2020.87634f, 15.5005035f, 2036.37683f, 15.6180391f, 2051.99487f, 15.7391891f, 2067.73413f, 15.8599119f,
+    2083.59399f, 15.9801722f, 2099.57422f, 16.1041317f, 2115.67822f, 16.226244f, 2131.90454f, 16.3521118f,
+    2148.25659f, 16.4775352f, 2164.73413f, 16.602478f, 2181.33667f, 16.7312641f, 2198.06787f, 16.8581333f,
+    2214.92603f, 16.9889011f, 2231.91504f, 17.1192093f, 2249.03418f, 17.2490196f, 2266.2832f, 17.3828201f,
+    2283.66602f, 17.5161495f, 2301.18213f, 17.6489697f, 2318.83105f, 17.7858734f, 2336.61694f, 17.9207382f,
+    2354.53784f, 18.0597496f, 2372.59741f, 18.1982708f, 2390.7959f, 18.3362637f, 2409.13208f, 18.4784985f,
+    2427.6106f, 18.6186142f, 2446.22925f, 18.7630405f, 2464.99219f, 18.9069557f, 2483.89917f, 19.0503216f,
+    2502.94946f, 19.1964283f, 2522.146f, 19.3453369f, 2541.49121f, 19.4920254f, 2560.98315f, 19.6432266f,
+    2580.62646f, 19.7938938f, 2600.42041f, 19.9439831f, 2620.36426f, 20.09869f, 2640.46313f, 20.2528515f,
+    2660.71582f, 20.4064217f, 2681.12231f, 20.5647144f, 2701.68701f, 20.7206516f, 2722.40771f, 20.881382f,
+    2743.28906f, 21.0415459f, 2764.33057f, 21.2010975f, 2785.53174f, 21.3655548f, 2806.89722f, 21.5294323f,
+    2828.42676f, 21.6926842f, 2850.11938f, 21.8609543f, 2871.98047f, 22.02672f, 2894.00708f, 22.1975822f,
+    2916.20459f, 22.3678417f, 2938.57251f, 22.5374489f, 2961.10986f, 22.7122726f, 2983.82227f, 22.8844929f,
+    3006.70679f, 23.0620098f, 3029.7688f, 23.2388992f, 3053.00757f, 23.4151115f, 3076.42261f, 23.5967445f,
+    3100.01953f, 23.7777348f, 3123.79712f, 23.9580345f, 3147.75513f, 24.1438789f, 3171.89917f, 24.3269539f,
+    3196.22607f, 24.5156593f, 3220.7417f, 24.7036991f, 3245.44531f, 24.8910179f, 3270.33643f, 25.0840988f,
+    3295.42065f, 25.2743034f, 3320.69482f, 25.4703579f, 3346.16528f, 25.66572f, 3371.83081f, 25.8603344f,
+    3397.69116f, 26.0609341f, 3423.7522f, 26.2608261f, 3450.01294f, 26.4599552f, 3476.4729f, 26.665205f,
+    3503.13818f, 26.8673992f, 3530.00562f, 27.0758114f, 3557.0813f, 27.2834873f, 3584.36499f, 27.4903698f,
+    3611.85522f, 27.7036133f, 3639.55884f, 27.9161053f, 3667.47485f, 28.1277828f, 3695.60278f, 28.3459721f,
+    3723.94873f, 28.5609112f, 3752.50952f, 28.7824593f, 3781.29199f, 29.0032253f, 3810.29541f, 29.2231483f,
+    3839.51855f, 29.4498329f, 3868.96826f, 29.6731415f, 3898.64136f, 29.9033165f, 3928.54468f, 30.1326809f,
+    3958.67749f, 30.3611679f, 3989.03857f, 30.5966797f, 4019.63525f, 30.8313637f, 4050.46655f, 31.0651474f,
+    4081.53174f, 31.3061199f, 4112.83789f, 31.5435047f, 4144.38135f, 31.7881889f, 4176.16943f, 32.0320091f,
+    4208.20166f, 32.2748985f, 4240.47656f, 32.5252571f, 4273.00195f, 32.7718849f, 4305.77344f, 33.0261002f,
+    4338.7998f, 33.2794151f, 4372.0791f, 33.5317612f, 4405.61084f, 33.7918701f, 4439.40283f, 34.0510597f,
+    4473.4541f, 34.3092575f, 4507.76318f, 34.5753975f, 4542.33838f, 34.8375702f, 4577.17627f, 35.1078072f,
+    4612.28369f, 35.3770905f, 4647.66113f, 35.6453438f, 4683.30615f, 35.9218445f, 4719.22803f, 36.1973724f,
+    4755.42578f, 36.4718475f, 4791.89746f, 36.7547607f, 4828.65234f, 37.0334587f, 4865.68555f, 37.3207283f,
+    4903.00635f, 37.606987f, 4940.61328f, 37.8921471f, 4978.50537f, 38.1860771f, 5016.69141f, 38.4756317f,
+    5055.16699f, 38.7740898f, 5093.94141f, 39.0714912f, 5133.0127f, 39.3677597f, 5172.38037f, 39.6731377f,
+    5212.05371f, 39.9774361f, 5252.03125f, 40.2805748f, 5292.31152f, 40.5930328f, 5332.90479f, 40.9008369f,
+    5373.80566f, 41.2181053f, 5415.02344f, 41.534256f, 5456.55811f, 41.8491974f, 5498.40723f, 42.1738243f,
+    5540.58105f, 42.4936142f, 5583.07471f, 42.8232384f, 5625.89795f, 43.1516991f, 5669.04932f, 43.4789047f,
+    5712.52832f, 43.8161736f, 5756.34473f, 44.1522522f, 5800.49658f, 44.4870453f, 5844.98389f, 44.8321304f,
+    5889.81592f, 45.172081f, 5934.98828f, 45.52248f, 5980.51074f, 45.8716469f, 6026.38232f, 46.2194786f,
+    6072.60156f, 46.5780029f, 6119.17969f, 46.9311905f, 6166.11084f, 47.2952347f, 6213.40625f, 47.6580009f,
+    6261.06396f, 48.0193748f, 6309.0835f, 48.3918648f, 6357.4751f, 48.7630386f, 6406.23828f, 49.1327934f,
+    6455.37109f, 49.513916f, 6504.88525f, 49.8893661f, 6554.77441f, 50.2763596f, 6605.05078f, 50.6619873f,
+    6655.71289f, 51.0461426f, 6706.75879f, 51.4421082f, 6758.20117f, 51.8366814f, 6810.0376f, 52.2297401f,
+    6862.26758f, 52.6348877f, 6914.90234f, 53.0340042f, 6967.93652f, 53.4453888f, 7021.38184f, 53.8553276f,
+    7075.2373f, 54.2636948f, 7129.50098f, 54.6846199f, 7184.18555f, 55.0992737f, 7239.28467f, 55.5266838f,
+    7294.81152f, 55.9525833f, 7350.76416f, 56.3768539f, 7407.14062f, 56.8141708f, 7463.95508f, 57.2499466f,
+    7521.20508f, 57.6840553f, 7578.88916f, 58.1315117f, 7637.02051f, 58.5723038f, 7695.59277f, 59.0266533f,
+    7754.61963f, 59.4793968f, 7814.09863f, 59.9304123f, 7874.0293f, 60.3952942f, 7934.42432f, 60.8532524f,
+    7995.27783f, 61.3252945f, 8056.60303f, 61.7956696f, 8118.39893f, 62.2642479f, 8180.66309f, 62.7472305f,
+    8243.41016f, 63.2285156f, 8306.63867f, 63.7079582f, 8370.34668f, 64.2021408f, 8434.54883f, 64.6889648f,
+    8499.23828f, 65.1907578f, 8564.42871f, 65.6907883f, 8630.11914f, 66.1888962f, 8696.30859f, 66.7023315f,
+    8763.01074f, 67.2139511f, 8830.22461f, 67.7236099f, 8897.94824f, 68.2489471f, 8966.19727f, 68.7664566f,
+    9034.96387f, 69.299881f, 9104.26367f, 69.8314209f, 9174.09473f, 70.3609314f, 9244.45605f, 70.906723f,
+    9315.3623f, 71.4443893f, 9386.80664f, 71.9985809f, 9458.80566f, 72.550827f, 9531.35645f, 73.1009598f,
+    9604.45703f, 73.6680069f, 9678.125f, 74.2330475f, 9752.3584f, 74.7959366f, 9827.1543f, 75.3761292f,
+    9902.53027f, 75.9476852f, 9978.47852f, 76.5368118f, 10055.0146f, 77.1238632f, 10132.1387f, 77.7086716f,
+    10209.8477f, 78.3114624f, 10288.1592f, 78.9052734f, 10367.0645f, 79.5173416f, 10446.5811f, 80.1272583f,
+    10526.709f, 80.7348328f, 10607.4434f, 81.3610992f, 10688.8047f, 81.9851532f, 10770.79f, 82.6068192f,
+    10853.3965f, 83.2476044f, 10936.6445f, 83.8788452f, 11020.5234f, 84.5294952f, 11105.0527f, 85.1778564f,
+    11190.2305f, 85.8237305f, 11276.0537f, 86.4894714f, 11362.5439f, 87.1452866f, 11449.6885f, 87.8212814f,
+    11537.5098f, 88.4948883f, 11626.0049f, 89.1659164f, 11715.1709f, 89.8575745f, 11805.0283f, 90.5467987f,
+    11895.5752f, 91.2333908f, 11986.8086f, 91.9410934f, 12078.75f, 92.6382523f, 12171.3877f, 93.3568497f,
+    12264.7451f, 94.0729141f, 12358.8184f, 94.7862396f, 12453.6045f, 95.5214996f, 12549.126f, 96.2541656f,
+    12645.3799f, 96.9840317f, 12742.3643f, 97.7363434f, 12840.1006f, 98.4774475f, 12938.5771f, 99.2413406f,
+    13037.8193f, 100.002541f, 13137.8213f, 100.760826f, 13238.582f, 101.542427f, 13340.125f, 102.312393f,
+    13442.4375f, 103.106033f, 13545.543f, 103.896881f, 13649.4404f, 104.684692f, 13754.125f, 105.496735f,
+    13859.6211f, 106.305916f, 13965.9277f, 107.112f, 14073.0391f, 107.942871f, 14180.9824f, 108.761368f,
+    14289.7432f, 109.605034f, 14399.3486f, 110.445724f, 14509.7939f, 111.283203f, 14621.0771f, 112.146431f,
+    14733.2236f, 112.996803f, 14846.2207f, 113.873322f, 14960.0938f, 114.74675f, 15074.8408f, 115.616837f,
+    15190.458f, 116.513687f, 15306.9717f, 117.407364f, 15424.3789f, 118.29763f, 15542.6768f, 119.215271f,
+    15661.8916f, 120.11924f, 15782.0107f, 121.05101f, 15903.0615f, 121.979492f, 16025.041f, 122.904427f,
+    16147.9463f, 123.857796f, 16271.8037f, 124.807808f, 16396.6113f, 125.754189f, 16522.3652f, 126.729668f,
+    16649.0957f, 127.69062f, 16776.7852f, 128.681122f, 16905.4668f, 129.668137f, 17035.1348f, 130.651367f,
+    17165.7871f, 131.664825f, 17297.4512f, 132.663208f, 17430.1152f, 133.692276f, 17563.8066f, 134.717728f,
+    17698.5254f, 135.739243f, 17834.2637f, 136.792175f, 17971.0566f, 137.8414f, 18108.8965f, 138.886612f,
+    18247.7832f, 139.963959f, 18387.748f, 141.025253f, 18528.7734f, 142.119202f, 18670.8926f, 143.209274f,
+    18814.1016f, 144.295181f, 18958.3965f, 145.41449f, 19103.8105f, 146.51712f, 19250.3281f, 147.653656f,
+    19397.9824f, 148.786194f, 19546.7676f, 149.914383f, 19696.6836f, 151.077286f, 19847.7598f, 152.236069f,
+    19999.9961f, 153.390427f
+};
+
+alignas(16) static const float db2GainEntries[66] = {
+    9.99999975e-05f, 4.33012574e-05f, 0.000143301251f, 6.20512437e-05f, 0.00020535251f, 8.89202129e-05f, 0.00029427273f, 0.000127423787f,
+    0.000421696517f, 0.000182599892f, 0.000604296394f, 0.00026166832f, 0.000865964685f, 0.000374973606f, 0.00124093832f, 0.000537341868f,
+    0.00177828025f, 0.000770017679f, 0.00254829787f, 0.00110344496f, 0.00365174282f, 0.00158125057f, 0.00523299351f, 0.00226595183f,
+    0.00749894558f, 0.00324713765f, 0.0107460832f, 0.00465318887f, 0.0153992716f, 0.00666807825f, 0.0220673513f, 0.0095554404f,
+    0.0316227898f, 0.0136930654f, 0.045315858f, 0.0196223352f, 0.064938195f, 0.0281190537f, 0.093057245f, 0.0402949564f,
+    0.133352205f, 0.0577431992f, 0.191095397f, 0.0827467144f, 0.273842126f, 0.118577078f, 0.392419189f, 0.169922441f,
+    0.56234163f, 0.243500993f, 0.805842638f, 0.348939985f, 1.15478265f, 0.500035405f, 1.65481806f, 0.716557026f,
+    2.37137508f, 1.0268352f, 3.39821029f, 1.47146773f, 4.86967802f, 2.10863256f, 6.97831059f, 3.02169609f,
+    10.0000067f, 4.33012867f
+};
+
+alignas(16) static const float tanh5Entries[514] = {
+    -0.999909222f, 7.37750042e-06f, -0.999901831f, 7.97691882e-06f, -0.999893844f, 8.62503384e-06f, -0.999885201f, 9.32580133e-06f,
+    -0.999875903f, 1.00834977e-05f, -0.99986583f, 1.09027469e-05f, -0.999854922f, 1.17885456e-05f, -0.999843121f, 1.27463009e-05f,
+    -0.999830365f, 1.37818542e-05f, -0.999816597f, 1.49015241e-05f, -0.999801695f, 1.61121388e-05f, -0.999785602f, 1.74210854e-05f,
+    -0.999768138f, 1.88363429e-05f, -0.999749303f, 2.03665422e-05f, -0.999728978f, 2.20210168e-05f, -0.999706924f, 2.3809851e-05f,
+    -0.999683142f, 2.57439478e-05f, -0.999657393f, 2.78350999e-05f, -0.999629557f, 3.00960473e-05f, -0.999599457f, 3.25405672e-05f,
+    -0.999566913f, 3.51835515e-05f, -0.999531746f, 3.80410966e-05f, -0.999493659f, 4.11306028e-05f, -0.999452531f, 4.44708821e-05f,
+    -0.999408066f, 4.808226e-05f, -0.999360025f, 5.19867172e-05f, -0.99930799f, 5.62080022e-05f, -0.999251783f, 6.07717848e-05f,
+    -0.999191046f, 6.57058117e-05f, -0.999125302f, 7.10400636e-05f, -0.999054313f, 7.6806944e-05f, -0.998977482f, 8.30414647e-05f,
+    -0.998894453f, 8.9781468e-05f, -0.998804688f, 9.70678375e-05f, -0.998707592f, 0.000104944753f, -0.998602629f, 0.00011345993f,
+    -0.998489201f, 0.000122664947f, -0.998366535f, 0.000132615489f, -0.998233914f, 0.000143371726f, -0.998090565f, 0.000154998648f,
+    -0.997935534f, 0.000167566439f, -0.997767985f, 0.000181150899f, -0.997586846f, 0.000195833869f, -0.997390985f, 0.000211703693f,
+    -0.99717927f, 0.000228855788f, -0.996950448f, 0.000247393094f, -0.996703029f, 0.000267426774f, -0.996435583f, 0.000289076677f,
+    -0.99614656f, 0.000312472228f, -0.995834053f, 0.000337752979f, -0.995496333f, 0.000365069456f, -0.995131254f, 0.000394583942f,
+    -0.994736671f, 0.000426471379f, -0.9943102f, 0.000460920361f, -0.993849277f, 0.000498134061f, -0.993351102f, 0.000538331398f,
+    -0.992812812f, 0.00058174791f, -0.992231071f, 0.000628637441f, -0.991602421f, 0.000679272925f, -0.990923166f, 0.000733947963f,
+    -0.990189195f, 0.000792978331f, -0.989396214f, 0.000856703264f, -0.988539517f, 0.000925487315f, -0.987614036f, 0.000999721582f,
+    -0.986614287f, 0.0010798258f, -0.985534489f, 0.00116624997f, -0.984368205f, 0.0012594763f, -0.983108759f, 0.00136002095f,
+    -0.9817487f, 0.00146843586f, -0.98028028f, 0.00158531102f, -0.978694975f, 0.00171127648f, -0.976983726f, 0.00184700359f,
+    -0.975136697f, 0.00199320773f, -0.973143518f, 0.0021506499f, -0.970992863f, 0.00232013804f, -0.968672693f, 0.00250252918f,
+    -0.966170192f, 0.00269873021f, -0.963471472f, 0.00290969945f, -0.960561752f, 0.0031364474f, -0.957425296f, 0.00338003621f,
+    -0.954045236f, 0.00364158046f, -0.95040369f, 0.00392224593f, -0.946481407f, 0.00422324752f, -0.942258179f, 0.00454584695f,
+    -0.937712312f, 0.0048913504f, -0.932820976f, 0.00526110036f, -0.927559912f, 0.0056564738f, -0.921903431f, 0.0060788705f,
+    -0.915824533f, 0.00652970513f, -0.909294844f, 0.0070103961f, -0.902284443f, 0.00752234925f, -0.894762099f, 0.00806694385f,
+    -0.886695147f, 0.00864551123f, -0.878049612f, 0.00925931334f, -0.868790329f, 0.00990951713f, -0.858880818f, 0.0105971675f,
+    -0.848283648f, 0.0113231521f, -0.836960495f, 0.0120881675f, -0.824872315f, 0.0128926802f, -0.811979651f, 0.013736886f,
+    -0.798242748f, 0.0146206636f, -0.783622086f, 0.015543527f, -0.768078566f, 0.0165045802f, -0.75157398f, 0.0175024644f,
+    -0.734071493f, 0.0185353104f, -0.715536237f, 0.0196006931f, -0.695935488f, 0.0206955895f, -0.675239921f, 0.0218163393f,
+    -0.653423607f, 0.0229586102f, -0.630464971f, 0.024117386f, -0.60634762f, 0.0252869558f, -0.581060648f, 0.0264609158f,
+    -0.554599702f, 0.0276321955f, -0.526967525f, 0.0287931003f, -0.498174429f, 0.029935373f, -0.468239039f, 0.0310502686f,
+    -0.437188774f, 0.0321286693f, -0.405060112f, 0.0331612043f, -0.371898919f, 0.0341383889f, -0.337760508f, 0.0350507908f,
+    -0.302709728f, 0.0358892009f, -0.26682052f, 0.0366448164f, -0.230175704f, 0.0373094194f, -0.192866296f, 0.0378755629f,
+    -0.154990733f, 0.0383367427f, -0.116653986f, 0.0386875458f, -0.0779664442f, 0.0389237963f, -0.0390426442f, 0.0390426442f,
+    0.0f, 0.0390426442f, 0.0390426442f, 0.0389237963f, 0.0779664442f, 0.0386875458f, 0.116653986f, 0.0383367427f,
+    0.154990733f, 0.0378755629f, 0.192866296f, 0.0373094194f, 0.230175704f, 0.0366448164f, 0.26682052f, 0.0358892009f,
+    0.302709728f, 0.0350507908f, 0.337760508f, 0.0341383889f, 0.371898919f, 0.0331612043f, 0.405060112f, 0.0321286693f,
+    0.437188774f, 0.0310502686f, 0.468239039f, 0.029935373f, 0.498174429f, 0.0287931003f, 0.526967525f, 0.0276321955f,
+    0.554599702f, 0.0264609158f, 0.581060648f, 0.0252869558f, 0.60634762f, 0.024117386f, 0.630464971f, 0.0229586102f,
+    0.653423607f, 0.0218163393f, 0.675239921f, 0.0206955895f, 0.695935488f, 0.0196006931f, 0.715536237f, 0.0185353104f,
+    0.734071493f, 0.0175024644f, 0.75157398f, 0.0165045802f, 0.768078566f, 0.015543527f, 0.783622086f, 0.0146206636f,
+    0.798242748f, 0.013736886f, 0.811979651f, 0.0128926802f, 0.824872315f, 0.0120881675f, 0.836960495f, 0.0113231521f,
+    0.848283648f, 0.0105971675f, 0.858880818f, 0.00990951713f, 0.868790329f, 0.00925931334f, 0.878049612f, 0.00864551123f,
+    0.886695147f, 0.00806694385f, 0.894762099f, 0.00752234925f, 0.902284443f, 0.0070103961f, 0.909294844f, 0.00652970513f,
+    0.915824533f, 0.0060788705f, 0.921903431f, 0.0056564738f, 0.927559912f, 0.00526110036f, 0.932820976f, 0.0048913504f,
+    0.937712312f, 0.00454584695f, 0.942258179f, 0.00422324752f, 0.946481407f, 0.00392224593f, 0.95040369f, 0.00364158046f,
+    0.954045236f, 0.00338003621f, 0.957425296f, 0.0031364474f, 0.960561752f, 0.00290969945f, 0.963471472f, 0.00269873021f,
+    0.966170192f, 0.00250252918f, 0.968672693f, 0.00232013804f, 0.970992863f, 0.0021506499f, 0.973143518f, 0.00199320773f,
+    0.975136697f, 0.00184700359f, 0.976983726f, 0.00171127648f, 0.978694975f, 0.00158531102f, 0.98028028f, 0.00146843586f,
+    0.9817487f, 0.00136002095f, 0.983108759f, 0.0012594763f, 0.984368205f, 0.00116624997f, 0.985534489f, 0.0010798258f,
+    0.986614287f, 0.000999721582f, 0.987614036f, 0.000925487315f, 0.988539517f, 0.000856703264f, 0.989396214f, 0.000792978331f,
+    0.990189195f, 0.000733947963f, 0.990923166f, 0.000679272925f, 0.991602421f, 0.000628637441f, 0.992231071f, 0.00058174791f,
+    0.992812812f, 0.000538331398f, 0.993351102f, 0.000498134061f, 0.993849277f, 0.000460920361f, 0.9943102f, 0.000426471379f,
+    0.994736671f, 0.000394583942f, 0.995131254f, 0.000365069456f, 0.995496333f, 0.000337752979f, 0.995834053f, 0.000312472228f,
+    0.99614656f, 0.000289076677f, 0.996435583f, 0.000267426774f, 0.996703029f, 0.000247393094f, 0.996950448f, 0.000228855788f,
+    0.99717927f, 0.000211703693f, 0.997390985f, 0.000195833869f, 0.997586846f, 0.000181150899f, 0.997767985f, 0.000167566439f,
+    0.997935534f, 0.000154998648f, 0.998090565f, 0.000143371726f, 0.998233914f, 0.000132615489f, 0.998366535f, 0.000122664947f,
+    0.998489201f, 0.00011345993f, 0.998602629f, 0.000104944753f, 0.998707592f, 9.70678375e-05f, 0.998804688f, 8.9781468e-05f,
+    0.998894453f, 8.30414647e-05f, 0.998977482f, 7.6806944e-05f, 0.999054313f, 7.10400636e-05f, 0.999125302f, 6.57058117e-05f,
+    0.999191046f, 6.07717848e-05f, 0.999251783f, 5.62080022e-05f, 0.99930799f, 5.19867172e-05f, 0.999360025f, 4.808226e-05f,
+    0.999408066f, 4.44708821e-05f, 0.999452531f, 4.11306028e-05f, 0.999493659f, 3.80410966e-05f, 0.999531746f, 3.51835515e-05f,
+    0.999566913f, 3.25405672e-05f, 0.999599457f, 3.00960473e-05f, 0.999629557f, 2.78350999e-05f, 0.999657393f, 2.57439478e-05f,
+    0.999683142f, 2.3809851e-05f, 0.999706924f, 2.20210168e-05f, 0.999728978f, 2.03665422e-05f, 0.999749303f, 1.88363429e-05f,
+    0.999768138f, 1.74210854e-05f, 0.999785602f, 1.61121388e-05f, 0.999801695f, 1.49015241e-05f, 0.999816597f, 1.37818542e-05f,
+    0.999830365f, 1.27463009e-05f, 0.999843121f, 1.17885456e-05f, 0.999854922f, 1.09027469e-05f, 0.99986583f, 1.00834977e-05f,
+    0.999875903f, 9.32580133e-06f, 0.999885201f, 8.62503384e-06f, 0.999893844f, 7.97691882e-06f, 0.999901831f, 7.37750042e-06f,
+    0.999909222f, 6.82312111e-06f
+};
+
+const BakedLookupTable BakedLookupTables::tables[BakedLookupTables::NumTables] = {
+    {"audioTaper", 32, 32.0f, -0.0f, 0.0f, 1.0f, audioTaperEntries},
+    {"audioTaper18", 32, 32.0f, -0.0f, 0.0f, 1.0f, audioTaper18Entries},
+    {"bipolarAudioTaper", 32, 16.0f, 16.0f, -1.0f, 1.0f, bipolarAudioTaperEntries},
+    {"bipolarAudioTaper30", 32, 16.0f, 16.0f, -1.0f, 1.0f, bipolarAudioTaper30Entries},
+    {"bipolarAudioTaper42", 32, 16.0f, 16.0f, -1.0f, 1.0f, bipolarAudioTaper42Entries},
+    {"sin", 2048, 2048.0f, -0.0f, 0.0f, 1.0f, sinEntries},
+    {"mixerPanL", 16, 8.0f, 8.0f, -1.0f, 1.0f, mixerPanLEntries},
+    {"mixerPanR", 16, 8.0f, 8.0f, -1.0f, 1.0f, mixerPanREntries},
+    {"exp2", 256, 19.2659206f, -38.5318413f, 2.0f, 15.2877121f, exp2Entries},
+    {"exp2ExLow", 256, 33.4909515f, -33.4909515f, 1.0f, 8.64385605f, exp2ExLowEntries},
+    {"exp2ExHigh", 512, 90.7181168f, -784.154358f, 8.64385605f, 14.2877121f, exp2ExHighEntries},
+    {"db2Gain", 32, 0.319999993f, 25.5999985f, -80.0f, 20.0f, db2GainEntries},
+    {"tanh5", 256, 25.6000004f, 128.0f, -5.0f, 5.0f, tanh5Entries}
+};
@@ -0,0 +1,51 @@
+#pragma once
+
+/**
+ * The standard float lookup tables, generated ahead of time
+ * and compiled into the plugin as read-only data.
+ *
+ * ObjectCache<float> hands these out, so getting one of the standard tables
+ * no longer calls exp or sin thousands of times, no matter how often
+ * modules come and go.
+ *
+ * BakedLookupTables.cpp is generated code - don't edit it by hand.
+ * After changing how any of these tables is made in LookupTableFactory,
+ * regenerate it by running "test.exe --bake" from the root of the repo.
+ * testObjectCache will fail if the baked tables get out of date.
+ */
+struct BakedLookupTable {
+    const char* name;
+    int numBins;
+    float a;
+    float b;
+    float xMin;
+    float xMax;
+    const float* entries;   // (numBins + 1) pairs of value, slope. 16 byte aligned.
+};
+
+class BakedLookupTables {
+public:
+    enum Id {
+        AudioTaper,
+        AudioTaper18,
+        BipolarAudioTaper,
+        BipolarAudioTaper30,
+        BipolarAudioTaper42,
+        Sin,
+        MixerPanL,
+        MixerPanR,
+        Exp2,
+        Exp2ExLow,
+        Exp2ExHigh,
+        Db2Gain,
+        Tanh5,
+        NumTables
+    };
+
+    static const BakedLookupTable& get(Id id) {
+        return tables[id];
+    }
+
+private:
+    static const BakedLookupTable tables[NumTables];
+};
@@ -0,0 +1,78 @@
+#pragma once
+
+#include "simd.h"
+
+#include <assert.h>
+
+/**
+ * class BankActivityN.
+ *
+ * Keeps track of which float_4 banks of a polyphonic composite are silent,
+ * so they can skip their DSP.
+ *
+ * A bank goes to sleep when all four of its gates are off and its envelopes
+ * (or whatever sets its output level) are all below -100 dB.
+ * It wakes up as soon as any of its gates comes on.
+ *
+ * While a bank is asleep the composite should write zeros to its outputs and not
+ * step anything else in the bank. The composite should also zero the envelopes,
+ * so a sleeping bank wakes up in the same state as one that was never used.
+ *
+ * NumBanks is usually 4 (16 voices), so most composites use the BankActivity alias.
+ */
+template <int NumBanks>
+class BankActivityN {
+public:
+    /**
+     * Call before running a bank.
+     * @param gates is a simd mask.
+     * @returns true if the bank needs to run this sample.
+     */
+    bool run(int bank, float_4 gates) {
+        assert(bank >= 0 && bank < NumBanks);
+        if (asleep[bank] && anyOn(gates)) {
+            asleep[bank] = false;
+        }
+        return !asleep[bank];
+    }
+
+    /**
+     * Call after running a bank.
+     * @param level is the envelope level of the four voices.
+     * @returns true if the bank just went to sleep.
+     */
+    bool update(int bank, float_4 gates, float_4 level) {
+        assert(bank >= 0 && bank < NumBanks);
+        if (asleep[bank] || anyOn(gates | (level > float_4(silenceLevel())))) {
+            return false;
+        }
+        asleep[bank] = true;
+        return true;
+    }
+
+    bool isAsleep(int bank) const {
+        return asleep[bank];
+    }
+
+    /**
+     * For when the bank's output no longer depends on its envelopes.
+     */
+    void wakeAll() {
+        for (int i = 0; i < NumBanks; ++i) {
+            asleep[i] = false;
+        }
+    }
+
+    static float silenceLevel() {
+        return .00001f;
+    }
+
+    static bool anyOn(float_4 mask) {
+        return rack::simd::movemask(mask) != 0;
+    }
+
+private:
+    bool asleep[NumBanks] = {};
+};
+
+using BankActivity = BankActivityN<4>;
@@ -9,6 +9,7 @@
 
 
 #include "SqLog.h"
+#include "SimdDispatch.h"
 #include "SqMath.h"
 #include "simd.h"
 
@@ -36,6 +37,16 @@ public:
 
     float_4 step(float_4);
     float_4 stepPoly(float_4, float_4);
+
+    /**
+     * stepPoly split in two, so a composite can gather up all its banks
+     * and run the envelope detectors through one SimdDispatch kernel:
+     * prepareEnvelopeBlock, then kernels().detectEnvelope, then finishEnvelopeBlock.
+     * Same results as stepPoly.
+     */
+    void prepareEnvelopeBlock(SimdDispatch::EnvelopeBank& bank, float_4 detectorInput);
+    float_4 finishEnvelopeBlock(float_4 input);
+
     void setTimes(float attackMs, float releaseMs, float sampleTime);
     void setThreshold(float th);
     void setCurve(Ratios);
@@ -114,7 +125,14 @@ private:
 
     float_4 stepPolyMultiMono(float_4, float_4);
     float_4 stepPolyLinked(float_4, float_4);
+    float_4 detectorLevel(float_4 detectorInput) const;
+    float_4 applyGainMultiMono(float_4 input, float_4 envelope);
+    float_4 applyGainLinked(float_4 input, float_4 envelope);
     void setThresholdPolySub(float_4 th);
+
+    // for prepareEnvelopeBlock / finishEnvelopeBlock
+    float_4 envelopeBlockInput = 0;
+    float_4 envelopeBlockOutput = 0;
 };
 
 inline float_4 Cmprsr::getGain() const {
@@ -354,11 +372,9 @@ inline float_4 Cmprsr::stepPoly(float_4 input, float_4 detectorInput) {
 }
 #endif
 
-inline float_4 Cmprsr::stepPolyLinked(float_4 input, float_4 detectorInput) {
-    float_4 envelope;
-    {
-        auto inp = detectorInput * detectorInput;
-
+inline float_4 Cmprsr::detectorLevel(float_4 detectorInput) const {
+    auto inp = detectorInput * detectorInput;
+    if (isLinked) {
         float avg = (inp[0] + inp[1]) * .5f;
         inp[0] = avg;
         inp[1] = avg;
@@ -366,13 +382,22 @@ inline float_4 Cmprsr::stepPolyLinked(float_4 input, float_4 detectorInput) {
         avg = (inp[2] + inp[3]) * .5f;
         inp[2] = avg;
         inp[3] = avg;
+    }
+    return inp;
+}
 
-        lag.step(inp);
+inline float_4 Cmprsr::stepPolyLinked(float_4 input, float_4 detectorInput) {
+    float_4 envelope;
+    {
+        lag.step(detectorLevel(detectorInput));
         attackFilter.step(lag.get());
         envelope = SimdBlocks::ifelse(reduceDistortionPoly, attackFilter.get(), lag.get());
         envelope = rack::simd::sqrt(envelope);
     }
+    return applyGainLinked(input, envelope);
+}
 
+inline float_4 Cmprsr::applyGainLinked(float_4 input, float_4 envelope) {
     if (ratio[0] == Ratios::HardLimit) {
         gain_[0] = (envelope[0] > threshold[0]) ? threshold[0] / envelope[0] : 1.f;
     } else {
@@ -406,14 +431,15 @@ inline float_4 Cmprsr::stepPolyMultiMono(float_4 input, float_4 detectorInput) {
     float_4 envelope;
 
     {
-        auto inp = detectorInput * detectorInput;
-
-        lag.step(inp);
+        lag.step(detectorLevel(detectorInput));
         attackFilter.step(lag.get());
         envelope = SimdBlocks::ifelse(reduceDistortionPoly, attackFilter.get(), lag.get());
         envelope = rack::simd::sqrt(envelope);
     }
+    return applyGainMultiMono(input, envelope);
+}
 
+inline float_4 Cmprsr::applyGainMultiMono(float_4 input, float_4 envelope) {
     // have to do the rest non-simd - in case the curves are all different.
     // TODO: optimized case for all curves the same
     for (int iChan = 0; iChan < 4; ++iChan) {
@@ -434,6 +460,29 @@ inline float_4 Cmprsr::stepPolyMultiMono(float_4 input, float_4 detectorInput) {
     return gain_ * input;
 }
 
+inline void Cmprsr::prepareEnvelopeBlock(SimdDispatch::EnvelopeBank& bank, float_4 detectorInput) {
+    assert(wasInit());
+    assert(polySet);
+    assert(cvIsPoly);
+    assert(lag._isEnabled());
+
+    envelopeBlockInput = detectorLevel(detectorInput);
+    bank.input = &envelopeBlockInput[0];
+    bank.lagMemory = lag._memoryData();
+    bank.lagAttack = lag._attackData();
+    bank.lagRelease = lag._releaseData();
+    bank.lagInstant = lag._instantData();
+    bank.filterMemory = attackFilter._memoryData();
+    bank.filterL = attackFilter._lData();
+    bank.filterK = attackFilter._kData();
+    bank.useFilter = &reduceDistortionPoly[0];
+    bank.output = &envelopeBlockOutput[0];
+}
+
+inline float_4 Cmprsr::finishEnvelopeBlock(float_4 input) {
+    return isLinked ? applyGainLinked(input, envelopeBlockOutput) : applyGainMultiMono(input, envelopeBlockOutput);
+}
+
 inline void Cmprsr::setTimesPoly(float_4 attackMs, float_4 releaseMs, float sampleTime) {
     assert(polySet);
     assert(cvIsPoly);
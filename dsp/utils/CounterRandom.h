@@ -0,0 +1,175 @@
+#pragma once
+
+#include "AudioMath.h"
+#include "simd.h"
+#include "simd8.h"
+
+#include <assert.h>
+#include <stdint.h>
+#include <atomic>
+#include <memory>
+
+/**
+ * Random numbers for noise sources and generative modules, four or eight at a time.
+ *
+ * It's counter based: the n'th number is a hash of (n, seed), so there is no
+ * state to churn other than the counter. The four lanes are four consecutive
+ * counts, hashed in one SSE register. Each hash is two rounds of
+ * multiply / xor-shift (lowbias32), with a key from the seed added in each round,
+ * so different seeds are not just shifted copies of each other.
+ *
+ * The same seed always gives the same numbers, so renders are reproducible.
+ * Default seeds come from a counter, so every instance gets its own stream,
+ * but the same patch loaded the same way gets the same seeds.
+ *
+ * Gaussians use Box-Muller on eight uniforms at a time.
+ * uniform() and gaussian() hand out single values from a buffered block.
+ */
+class CounterRandom {
+public:
+    CounterRandom() {
+        setSeed(nextDefaultSeed());
+    }
+    CounterRandom(uint64_t seed) {
+        setSeed(seed);
+    }
+
+    /**
+     * Also rewinds to the first number
+     */
+    void setSeed(uint64_t seed) {
+        _seed = seed;
+        counterLo = 0;
+        counterHi = 0;
+        makeKeys();
+        uniformIndex = bufferSize;
+        gaussianIndex = bufferSize;
+        haveSpareGaussian = false;
+    }
+
+    uint64_t getSeed() const {
+        return _seed;
+    }
+
+    /**
+     * uniform in [0, 1)
+     */
+    float_4 uniform4() {
+        // top 24 bits, so every value is exact in a float
+        const __m128i bits = _mm_srli_epi32(nextBits(), 8);
+        return float_4(_mm_cvtepi32_ps(bits)) * float_4(1.f / 16777216.f);
+    }
+
+    float_8 uniform8() {
+        const float_4 lo = uniform4();
+        return float_8(lo, uniform4());
+    }
+
+    /**
+     * normal, mean zero and standard deviation one
+     */
+    float_8 gaussian8() {
+        // 1 - u is in (0, 1], so the log is finite
+        const float_4 u1 = float_4(1) - uniform4();
+        const float_4 u2 = uniform4();
+        const float_4 radius = rack::simd::sqrt(float_4(-2) * rack::simd::log(u1));
+        const float_4 theta = float_4(float(2 * AudioMath::Pi)) * u2;
+        return float_8(radius * rack::simd::cos(theta), radius * rack::simd::sin(theta));
+    }
+
+    float_4 gaussian4() {
+        if (haveSpareGaussian) {
+            haveSpareGaussian = false;
+            return spareGaussian;
+        }
+        const float_8 x = gaussian8();
+        spareGaussian = x.hi;
+        haveSpareGaussian = true;
+        return x.lo;
+    }
+
+    float uniform() {
+        if (uniformIndex >= bufferSize) {
+            uniform8().store(uniformBuffer);
+            uniformIndex = 0;
+        }
+        return uniformBuffer[uniformIndex++];
+    }
+
+    float gaussian() {
+        if (gaussianIndex >= bufferSize) {
+            gaussian8().store(gaussianBuffer);
+            gaussianIndex = 0;
+        }
+        return gaussianBuffer[gaussianIndex++];
+    }
+
+    /**
+     * For things that want an AudioMath::RandomUniformFunc.
+     * The function owns its own generator.
+     */
+    static AudioMath::RandomUniformFunc makeUniformFunc(uint64_t seed) {
+        std::shared_ptr<CounterRandom> random = std::make_shared<CounterRandom>(seed);
+        return [random]() {
+            return random->uniform();
+        };
+    }
+
+    static uint64_t nextDefaultSeed() {
+        static std::atomic<uint64_t> count = {0};
+        return ++count;
+    }
+
+private:
+    static const int bufferSize = 8;
+
+    uint64_t _seed = 0;
+    uint32_t counterLo = 0;
+    uint32_t counterHi = 0;
+    __m128i key0;
+    __m128i key1;
+
+    float uniformBuffer[bufferSize];
+    float gaussianBuffer[bufferSize];
+    int uniformIndex = bufferSize;
+    int gaussianIndex = bufferSize;
+
+    float_4 spareGaussian = 0;
+    bool haveSpareGaussian = false;
+
+    /**
+     * 32 random bits in each lane
+     */
+    __m128i nextBits() {
+        __m128i x = _mm_add_epi32(_mm_set1_epi32(int32_t(counterLo)), _mm_setr_epi32(0, 1, 2, 3));
+        x = hash(_mm_add_epi32(x, key0));
+        x = hash(_mm_xor_si128(x, key1));
+
+        counterLo += 4;
+        if (counterLo == 0) {
+            // used up 2**32 numbers. Move on to a new set of keys.
+            ++counterHi;
+            makeKeys();
+        }
+        return x;
+    }
+
+    static __m128i hash(__m128i x) {
+        x = _mm_xor_si128(x, _mm_srli_epi32(x, 16));
+        x = _mm_mullo_epi32(x, _mm_set1_epi32(0x7feb352d));
+        x = _mm_xor_si128(x, _mm_srli_epi32(x, 15));
+        x = _mm_mullo_epi32(x, _mm_set1_epi32(int32_t(0x846ca68b)));
+        x = _mm_xor_si128(x, _mm_srli_epi32(x, 16));
+        return x;
+    }
+
+    void makeKeys() {
+        // splitmix64 of the seed and the high part of the counter
+        uint64_t z = _seed + (uint64_t(counterHi) + 1) * 0x9e3779b97f4a7c15ull;
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+        z = z ^ (z >> 31);
+        key0 = _mm_set1_epi32(int32_t(uint32_t(z)));
+        key1 = _mm_set1_epi32(int32_t(uint32_t(z >> 32)));
+    }
+};
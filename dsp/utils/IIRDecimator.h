@@ -50,6 +50,18 @@ public:
         return x;
     }
 
+    /**
+     * For SIMD kernels that run the filter themselves.
+     */
+    BiquadState<T, 3>& _getState()
+    {
+        return state;
+    }
+    const BiquadParams<T, 3>& _getParams() const
+    {
+        return *params;
+    }
+
 private:
     /**
      * This is the oversampling factor. For example,
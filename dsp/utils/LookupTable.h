@@ -1,6 +1,7 @@
 #pragma once
 
 #include "AudioMath.h"
+#include "SimdBlocks.h"
 #include "SqLog.h"
 
 #include <algorithm>
@@ -31,6 +32,12 @@ public:
      */
     static T lookup(const LookupTableParams<T>& params, T input, bool allowOutsideDomain = false);
 
+    /**
+     * Four lookups at once. Each lane gives exactly the same result as lookup().
+     * Only implemented for float tables.
+     */
+    static float_4 lookupSimd(const LookupTableParams<T>& params, float_4 input, bool allowOutsideDomain = false);
+
     /**
      * init will create the entries in the lookup table
      * bins is the number of entries desired in the lookup table.
@@ -207,6 +214,7 @@ public:
     T * entries = 0;		// each entry is value, slope
     T xMin = 0;				// minimum x value we will accept as input
     T xMax = 0;				// max x value we will accept as input
+    bool ownsEntries = true;	// false if entries are static data we must not free
 
     LookupTableParams()
     {
@@ -217,7 +225,9 @@ public:
 
     ~LookupTableParams()
     {
-        free(entries);
+        if (ownsEntries) {
+            free(entries);
+        }
         --_numLookupParams;
     }
 
@@ -231,9 +241,25 @@ public:
 
     void alloc(int bins)
     {
-        if (entries) free(entries);
+        if (entries && ownsEntries) free(entries);
         // allocate one extra, so we can index all the way to the end...
         entries = (T *) malloc((bins + 1) * 2 * sizeof(T));
+        ownsEntries = true;
+        numBins_i = bins;
+        a = 0;
+        b = 0;
+    }
+
+    /**
+     * Use entries that live somewhere else, like the baked tables.
+     * They are not copied, and will not be freed.
+     */
+    void setStaticEntries(const T* staticEntries, int bins)
+    {
+        if (entries && ownsEntries) free(entries);
+        // lookup never writes to the entries, so it's safe to drop the const
+        entries = const_cast<T*>(staticEntries);
+        ownsEntries = false;
         numBins_i = bins;
         a = 0;
         b = 0;
@@ -248,5 +274,44 @@ public:
 
 };
 
+/***************************************************************************/
 
+template<>
+inline float_4 LookupTable<float>::lookupSimd(const LookupTableParams<float>& params, float_4 input, bool allowOutsideDomain)
+{
+    assert(allowOutsideDomain || (
+        input[0] >= params.xMin && input[0] <= params.xMax &&
+        input[1] >= params.xMin && input[1] <= params.xMax &&
+        input[2] >= params.xMin && input[2] <= params.xMax &&
+        input[3] >= params.xMin && input[3] <= params.xMax));
+
+    input = SimdBlocks::min(input, float_4(params.xMax));
+    input = SimdBlocks::max(input, float_4(params.xMin));
+    assert(params.isValid());
 
+    const float_4 scaledInput = input * params.a + params.b;
+    const __m128i input_int = _mm_cvttps_epi32(scaledInput.v);
+    float_4 input_float = scaledInput - float_4(_mm_cvtepi32_ps(input_int));
+
+    // same clamping as the scalar version
+    input_float = SimdBlocks::max(input_float, float_4(0));
+    input_float = SimdBlocks::min(input_float, float_4(1));
+
+    // Each entry is a (value, slope) pair, so gather two floats for each lane.
+    alignas(16) int32_t index[4];
+    _mm_store_si128((__m128i*)index, input_int);
+    assert(index[0] >= 0 && index[0] <= params.numBins_i);
+    assert(index[1] >= 0 && index[1] <= params.numBins_i);
+    assert(index[2] >= 0 && index[2] <= params.numBins_i);
+    assert(index[3] >= 0 && index[3] <= params.numBins_i);
+
+    const float* entries = params.entries;
+    __m128 e01 = _mm_loadl_pi(_mm_setzero_ps(), (const __m64*)(entries + 2 * index[0]));
+    e01 = _mm_loadh_pi(e01, (const __m64*)(entries + 2 * index[1]));
+    __m128 e23 = _mm_loadl_pi(_mm_setzero_ps(), (const __m64*)(entries + 2 * index[2]));
+    e23 = _mm_loadh_pi(e23, (const __m64*)(entries + 2 * index[3]));
+
+    const float_4 y = _mm_shuffle_ps(e01, e23, _MM_SHUFFLE(2, 0, 2, 0));
+    const float_4 slope = _mm_shuffle_ps(e01, e23, _MM_SHUFFLE(3, 1, 3, 1));
+    return y + input_float * slope;
+}
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "BakedLookupTables.h"
 #include "LookupTable.h"
 #include "SqMath.h"
 
@@ -30,6 +31,28 @@ public:
     static void makeMixerPanL(LookupTableParams<T>& params);
     static void makeMixerPanR(LookupTableParams<T>& params);
 
+    /**
+     * sin(2 * pi * x), domain = 0..1
+     */
+    static void makeSin(LookupTableParams<T>& params);
+
+    /**
+     * gain from db, domain = -80..20
+     */
+    static void makeDb2Gain(LookupTableParams<T>& params);
+
+    /**
+     * tanh, unscaled, domain = -5..5
+     */
+    static void makeTanh5(LookupTableParams<T>& params);
+
+    /**
+     * Makes any of the tables that ObjectCache serves up.
+     * For float these are baked into BakedLookupTables.cpp, and this is
+     * how that file gets generated.
+     */
+    static void makeStandard(LookupTableParams<T>& params, BakedLookupTables::Id id);
+
     static void makeGenericExpTaper(int numSteps, LookupTableParams<T>& params, double xMin, double xMax, double yMin, double yMax);
 
     /**
@@ -147,6 +170,80 @@ inline void LookupTableFactory<T>::makeMixerPanR(LookupTableParams<T>& params)
         });
 }
 
+template<typename T>
+inline void LookupTableFactory<T>::makeSin(LookupTableParams<T>& params)
+{
+    std::function<double(double)> f = AudioMath::makeFunc_Sin();
+    // Used to use 4096, but 512 gives about 92db  snr, so let's save memory
+    // working on high purity BasicVCO. move up to 2k to get rid of slight
+    // High-frequency junk (very, very low);
+    LookupTable<T>::init(params, 2 * 1024, 0, 1, f);
+}
+
+template<typename T>
+inline void LookupTableFactory<T>::makeDb2Gain(LookupTableParams<T>& params)
+{
+    LookupTable<T>::init(params, 32, -80, 20, [](double x) {
+        return AudioMath::gainFromDb(x);
+        });
+}
+
+template<typename T>
+inline void LookupTableFactory<T>::makeTanh5(LookupTableParams<T>& params)
+{
+    LookupTable<T>::init(params, 256, -5, 5, [](double x) {
+        return std::tanh(x);
+        });
+}
+
+template<typename T>
+inline void LookupTableFactory<T>::makeStandard(LookupTableParams<T>& params, BakedLookupTables::Id id)
+{
+    switch (id) {
+        case BakedLookupTables::AudioTaper:
+            makeAudioTaper(params);
+            break;
+        case BakedLookupTables::AudioTaper18:
+            makeAudioTaper(params, -18);
+            break;
+        case BakedLookupTables::BipolarAudioTaper:
+            makeBipolarAudioTaper(params);
+            break;
+        case BakedLookupTables::BipolarAudioTaper30:
+            makeBipolarAudioTaper(params, -30);
+            break;
+        case BakedLookupTables::BipolarAudioTaper42:
+            makeBipolarAudioTaper(params, -42);
+            break;
+        case BakedLookupTables::Sin:
+            makeSin(params);
+            break;
+        case BakedLookupTables::MixerPanL:
+            makeMixerPanL(params);
+            break;
+        case BakedLookupTables::MixerPanR:
+            makeMixerPanR(params);
+            break;
+        case BakedLookupTables::Exp2:
+            makeExp2(params);
+            break;
+        case BakedLookupTables::Exp2ExLow:
+            makeExp2ExLow(params);
+            break;
+        case BakedLookupTables::Exp2ExHigh:
+            makeExp2ExHigh(params);
+            break;
+        case BakedLookupTables::Db2Gain:
+            makeDb2Gain(params);
+            break;
+        case BakedLookupTables::Tanh5:
+            makeTanh5(params);
+            break;
+        default:
+            assert(false);
+    }
+}
+
 template<typename T>
 inline void  LookupTableFactory<T>::makeGenericExpTaper(int numSteps, LookupTableParams<T>& params, double xMin, double xMax, double yMin, double yMax)
 {
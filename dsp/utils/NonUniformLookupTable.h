@@ -1,9 +1,12 @@
 #pragma once
 
+#include "SimdBlocks.h"
 #include "SqLog.h"
+#include <algorithm>
 #include <assert.h>
 #include <map>
 #include <memory>
+#include <vector>
 
 template <typename T> class NonUniformLookupTable;
 
@@ -51,6 +54,11 @@ private:
     using container = std::map<T, Entry>;
     bool isFinalized = false;
     container entries;
+
+    // Copy of the entries in flat arrays, for lookupSimd.
+    std::vector<T> flatX;
+    std::vector<T> flatY;
+    std::vector<T> flatA;
 };
 
 
@@ -62,6 +70,12 @@ public:
     static void addPoint(NonUniformLookupTableParams<T>& params, T x, T y);
     static void finalize(NonUniformLookupTableParams<T>& params);
     static T lookup(const NonUniformLookupTableParams<T>& params, T x);
+
+    /**
+     * Four lookups at once. Each lane gives the same result as lookup().
+     * Only implemented for float tables.
+     */
+    static float_4 lookupSimd(const NonUniformLookupTableParams<T>& params, float_4 x);
 };
 
 template <typename T>
@@ -93,6 +107,9 @@ inline void NonUniformLookupTable<T>::finalize(NonUniformLookupTableParams<T>& p
             T a = (it_next->second.y - it->second.y) / (it_next->second.x - it->second.x);
             it->second.a = a;
         }
+        params.flatX.push_back(it->second.x);
+        params.flatY.push_back(it->second.y);
+        params.flatA.push_back(it->second.a);
     }
 
     params.isFinalized = true;
@@ -131,3 +148,42 @@ inline T NonUniformLookupTable<T>::lookup(const NonUniformLookupTableParams<T>&
     return ret;
 }
 
+template <>
+inline float_4 NonUniformLookupTable<float>::lookupSimd(const NonUniformLookupTableParams<float>& params, float_4 x)
+{
+    assert(params.isFinalized);
+    assert(!params.entries.empty());
+
+    const float* xs = params.flatX.data();
+    const int size = int(params.flatX.size());
+
+    // Below the first point we return the first y. Since the line segment
+    // goes through that point we can just move x there.
+    // Above the last point the slope is zero, so that works out without any help.
+    x = SimdBlocks::max(x, float_4(xs[0]));
+
+    // index of the last point <= x
+    int index[4];
+    if (size <= 32) {
+        // for small tables, compare against every point
+        float_4 count = 0;
+        for (int i = 1; i < size; ++i) {
+            count += SimdBlocks::ifelse(x >= float_4(xs[i]), float_4(1), float_4(0));
+        }
+        for (int lane = 0; lane < 4; ++lane) {
+            index[lane] = int(count[lane]);
+        }
+    } else {
+        for (int lane = 0; lane < 4; ++lane) {
+            index[lane] = int(std::upper_bound(xs, xs + size, x[lane]) - xs) - 1;
+        }
+    }
+
+    float_4 x0, y0, a;
+    for (int lane = 0; lane < 4; ++lane) {
+        x0[lane] = xs[index[lane]];
+        y0[lane] = params.flatY[index[lane]];
+        a[lane] = params.flatA[index[lane]];
+    }
+    return a * (x - x0) + y0;
+}
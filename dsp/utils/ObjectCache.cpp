@@ -10,7 +10,28 @@
 #include "LookupTableFactory.h"
 #include "ObjectCache.h"
 
+/**
+ * The float tables are baked into the plugin, so making one
+ * just points it at the baked data. Double tables are still
+ * computed at runtime - only the unit tests use those.
+ */
+template <typename T>
+static void makeStandardTable(LookupTableParams<T>& params, BakedLookupTables::Id id)
+{
+    LookupTableFactory<T>::makeStandard(params, id);
+}
 
+template <>
+void makeStandardTable<float>(LookupTableParams<float>& params, BakedLookupTables::Id id)
+{
+    const BakedLookupTable& baked = BakedLookupTables::get(id);
+    params.setStaticEntries(baked.entries, baked.numBins);
+    params.a = baked.a;
+    params.b = baked.b;
+    params.xMin = baked.xMin;
+    params.xMax = baked.xMax;
+    assert(params.isValid());
+}
 
 template <typename T>
 std::shared_ptr<LookupTableParams<T>> ObjectCache<T>::getBipolarAudioTaper()
@@ -18,7 +39,7 @@ std::shared_ptr<LookupTableParams<T>> ObjectCache<T>::getBipolarAudioTaper()
     std::shared_ptr< LookupTableParams<T>> ret = bipolarAudioTaper.lock();
     if (!ret) {
         ret = std::make_shared<LookupTableParams<T>>();
-        LookupTableFactory<T>::makeBipolarAudioTaper(*ret);
+        makeStandardTable(*ret, BakedLookupTables::BipolarAudioTaper);
         bipolarAudioTaper = ret;
     }
     return ret;
@@ -30,7 +51,7 @@ std::shared_ptr<LookupTableParams<T>> ObjectCache<T>::getBipolarAudioTaper30()
     std::shared_ptr< LookupTableParams<T>> ret = bipolarAudioTaper30.lock();
     if (!ret) {
         ret = std::make_shared<LookupTableParams<T>>();
-        LookupTableFactory<T>::makeBipolarAudioTaper(*ret, -30);
+        makeStandardTable(*ret, BakedLookupTables::BipolarAudioTaper30);
         bipolarAudioTaper30 = ret;
     }
     return ret;
@@ -42,7 +63,7 @@ std::shared_ptr<LookupTableParams<T>> ObjectCache<T>::getBipolarAudioTaper42()
     std::shared_ptr< LookupTableParams<T>> ret = bipolarAudioTaper42.lock();
     if (!ret) {
         ret = std::make_shared<LookupTableParams<T>>();
-        LookupTableFactory<T>::makeBipolarAudioTaper(*ret, -42);
+        makeStandardTable(*ret, BakedLookupTables::BipolarAudioTaper42);
         bipolarAudioTaper42 = ret;
     }
     return ret;
@@ -55,7 +76,7 @@ std::shared_ptr<LookupTableParams<T>> ObjectCache<T>::getAudioTaper()
     std::shared_ptr< LookupTableParams<T>> ret = audioTaper.lock();
     if (!ret) {
         ret = std::make_shared<LookupTableParams<T>>();
-        LookupTableFactory<T>::makeAudioTaper(*ret);
+        makeStandardTable(*ret, BakedLookupTables::AudioTaper);
         audioTaper = ret;
     }
     return ret;
@@ -68,7 +89,7 @@ std::shared_ptr<LookupTableParams<T>> ObjectCache<T>::getAudioTaper18()
     std::shared_ptr< LookupTableParams<T>> ret = audioTaper18.lock();
     if (!ret) {
         ret = std::make_shared<LookupTableParams<T>>();
-        LookupTableFactory<T>::makeAudioTaper(*ret, -18);
+        makeStandardTable(*ret, BakedLookupTables::AudioTaper18);
         audioTaper18 = ret;
     }
     return ret;
@@ -80,11 +101,7 @@ std::shared_ptr<LookupTableParams<T>> ObjectCache<T>::getSinLookup()
     std::shared_ptr< LookupTableParams<T>> ret = sinLookupTable.lock();
     if (!ret) {
         ret = std::make_shared<LookupTableParams<T>>();
-        std::function<double(double)> f = AudioMath::makeFunc_Sin();
-        // Used to use 4096, but 512 gives about 92db  snr, so let's save memory
-        // working on high purity BasicVCO. move up to 2k to get rid of slight
-        // High-frequency junk (very, very low);
-        LookupTable<T>::init(*ret, 2 * 1024, 0, 1, f);
+        makeStandardTable(*ret, BakedLookupTables::Sin);
         sinLookupTable = ret;
     }
     return ret;
@@ -96,7 +113,7 @@ std::shared_ptr<LookupTableParams<T>> ObjectCache<T>::getMixerPanL()
     std::shared_ptr< LookupTableParams<T>> ret = mixerPanL.lock();
     if (!ret) {
         ret = std::make_shared<LookupTableParams<T>>();
-        LookupTableFactory<T>::makeMixerPanL(*ret);
+        makeStandardTable(*ret, BakedLookupTables::MixerPanL);
         mixerPanL = ret;
     }
     return ret;
@@ -108,7 +125,7 @@ std::shared_ptr<LookupTableParams<T>> ObjectCache<T>::getMixerPanR()
     std::shared_ptr< LookupTableParams<T>> ret = mixerPanR.lock();
     if (!ret) {
         ret = std::make_shared<LookupTableParams<T>>();
-        LookupTableFactory<T>::makeMixerPanR(*ret);
+        makeStandardTable(*ret, BakedLookupTables::MixerPanR);
         mixerPanR = ret;
     }
     return ret;
@@ -120,7 +137,7 @@ std::shared_ptr<LookupTableParams<T>> ObjectCache<T>::getExp2()
     std::shared_ptr< LookupTableParams<T>> ret = exp2.lock();
     if (!ret) {
         ret = std::make_shared<LookupTableParams<T>>();
-        LookupTableFactory<T>::makeExp2(*ret);
+        makeStandardTable(*ret, BakedLookupTables::Exp2);
         exp2 = ret;
     }
     return ret;
@@ -132,7 +149,7 @@ std::shared_ptr<LookupTableParams<T>> ObjectCache<T>::getExp2ExtendedLow()
     std::shared_ptr< LookupTableParams<T>> ret = exp2ExLow.lock();
     if (!ret) {
         ret = std::make_shared<LookupTableParams<T>>();
-        LookupTableFactory<T>::makeExp2ExLow(*ret);
+        makeStandardTable(*ret, BakedLookupTables::Exp2ExLow);
         exp2ExLow = ret;
     }
     return ret;
@@ -144,7 +161,7 @@ std::shared_ptr<LookupTableParams<T>> ObjectCache<T>::getExp2ExtendedHigh()
     std::shared_ptr< LookupTableParams<T>> ret = exp2ExHigh.lock();
     if (!ret) {
         ret = std::make_shared<LookupTableParams<T>>();
-        LookupTableFactory<T>::makeExp2ExHigh(*ret);
+        makeStandardTable(*ret, BakedLookupTables::Exp2ExHigh);
         exp2ExHigh = ret;
     }
     return ret;
@@ -158,9 +175,7 @@ std::shared_ptr<LookupTableParams<T>> ObjectCache<T>::getDb2Gain()
     std::shared_ptr< LookupTableParams<T>> ret = db2Gain.lock();
     if (!ret) {
         ret = std::make_shared<LookupTableParams<T>>();
-        LookupTable<T>::init(*ret, 32, -80, 20, [](double x) {
-            return AudioMath::gainFromDb(x);
-            });
+        makeStandardTable(*ret, BakedLookupTables::Db2Gain);
         db2Gain = ret;
     }
     return ret;
@@ -173,9 +188,7 @@ std::shared_ptr<LookupTableParams<T>> ObjectCache<T>::getTanh5()
     std::shared_ptr< LookupTableParams<T>> ret = tanh5.lock();
     if (!ret) {
         ret = std::make_shared<LookupTableParams<T>>();
-        LookupTable<T>::init(*ret, 256, -5, 5, [](double x) {
-            return std::tanh(x);
-            });
+        makeStandardTable(*ret, BakedLookupTables::Tanh5);
         tanh5 = ret;
     }
     return ret;
@@ -11,6 +11,9 @@
  * All accessors return shared pointers to make the lifetime management easy.
  * Clients are free to use the shared_ptr directly, or may use the raw pointer,
  * as long as the client holds onto the reference.
+ *
+ * The float lookup tables are not computed at all - they come from BakedLookupTables,
+ * so re-creating one after it has been freed is cheap.
  */
 
 template <typename T>
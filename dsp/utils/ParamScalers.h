@@ -0,0 +1,118 @@
+#pragma once
+
+#include "LookupTable.h"
+#include "ObjectCache.h"
+#include "SimdBlocks.h"
+#include "simd.h"
+
+#include <assert.h>
+#include <memory>
+
+/**
+ * Value type versions of AudioMath::ScaleFun and SimpleScaleFun.
+ *
+ * The std::function versions can't be inlined, and they get called per channel
+ * in a lot of control rate code. These do exactly the same math, but the
+ * call is an ordinary inline member function.
+ * Each one can be called with float, or with float_4 to do four at once.
+ */
+
+/**
+ * Same as AudioMath::makeLinearScaler.
+ * x = cv * trim + knob, clipped to -5..5, then mapped to y0..y1
+ */
+class LinearScaler {
+public:
+    LinearScaler(float y0, float y1) : a((y1 - y0) / 10.f),
+                                       b(y0 + a * 5.f) {
+    }
+
+    float operator()(float cv, float knob, float trim) const {
+        float x = cv * trim + knob;
+        x = std::max<float>(-5.0f, x);
+        x = std::min(5.0f, x);
+        return a * x + b;
+    }
+
+    float_4 operator()(float_4 cv, float_4 knob, float_4 trim) const {
+        float_4 x = cv * trim + knob;
+        x = SimdBlocks::max(x, float_4(-5.f));
+        x = SimdBlocks::min(x, float_4(5.f));
+        return a * x + b;
+    }
+
+private:
+    float a;
+    float b;
+};
+
+/**
+ * Same as AudioMath::makeScalerWithBipolarAudioTrim.
+ * Like LinearScaler, but the trim has an audio taper.
+ */
+class BipolarAudioTrimScaler {
+public:
+    BipolarAudioTrimScaler(float y0, float y1) : a((y1 - y0) / 10.f),
+                                                 b(y0 + a * 5.f) {
+    }
+
+    float operator()(float cv, float knob, float trim) const {
+        const float mappedTrim = LookupTable<float>::lookup(*lookup, trim);
+        float x = cv * mappedTrim + knob;
+        x = std::max<float>(-5.0f, x);
+        x = std::min(5.0f, x);
+        return a * x + b;
+    }
+
+    float_4 operator()(float_4 cv, float_4 knob, float_4 trim) const {
+        const float_4 mappedTrim = LookupTable<float>::lookupSimd(*lookup, trim);
+        float_4 x = cv * mappedTrim + knob;
+        x = SimdBlocks::max(x, float_4(-5.f));
+        x = SimdBlocks::min(x, float_4(5.f));
+        return a * x + b;
+    }
+
+private:
+    float a;
+    float b;
+    std::shared_ptr<LookupTableParams<float>> lookup = ObjectCache<float>::getBipolarAudioTaper();
+};
+
+/**
+ * Same as AudioMath::makeSimpleScalerAudioTaper.
+ * cv + knob, clipped to -5..5, then mapped to y0..y1 with an audio taper.
+ */
+class AudioTaperScaler {
+public:
+    AudioTaperScaler(float y0, float y1) : a(y1 - y0),
+                                           b(y0) {
+    }
+
+    float operator()(float cv, float knob) const {
+        float x = cv + knob;
+        x = std::max<float>(-5.0f, x);
+        x = std::min(5.0f, x);
+
+        // adjust to 0..1 and map
+        x += 5.f;
+        x /= 10.f;
+        assert(x >= 0 && x <= 1);
+        x = LookupTable<float>::lookup(*lookup, x);
+        return a * x + b;
+    }
+
+    float_4 operator()(float_4 cv, float_4 knob) const {
+        float_4 x = cv + knob;
+        x = SimdBlocks::max(x, float_4(-5.f));
+        x = SimdBlocks::min(x, float_4(5.f));
+        x += 5.f;
+        x /= 10.f;
+        x = LookupTable<float>::lookupSimd(*lookup, x);
+        return a * x + b;
+    }
+
+private:
+    float a;
+    float b;
+    std::shared_ptr<LookupTableParams<float>> lookup = ObjectCache<float>::getAudioTaper();
+};
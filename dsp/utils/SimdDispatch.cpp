@@ -0,0 +1,520 @@
+
+#include "SimdDispatch.h"
+#include "SimdBlocks.h"
+
+#include <assert.h>
+
+// AVX2 kernels are only possible on x86 with gcc or clang. Everyone else gets SSE.
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define _SQ_AVX2_KERNELS
+#include <immintrin.h>
+#endif
+
+//---------------------- SSE kernels -----------------------------
+
+static void sinTwoPi_sse(float* data, int numFloats) {
+    assert((numFloats % 8) == 0);
+    for (int i = 0; i < numFloats; i += 4) {
+        float_4 x = float_4::load(data + i);
+        SimdBlocks::sinTwoPi(x).store(data + i);
+    }
+}
+
+static void sinDecimateBank_sse(SimdDispatch::SinDecimateBank& bank, const float* taps, int oversample) {
+    float_4 z[6];
+    for (int i = 0; i < 6; ++i) {
+        z[i] = float_4::load(bank.state + 4 * i);
+    }
+    float_4 foldGain = bank.foldGain ? float_4::load(bank.foldGain) : float_4(1);
+
+    float_4 y = 0;
+    for (int i = 0; i < oversample; ++i) {
+        y = SimdBlocks::sinTwoPi(float_4::load(bank.buffer + 4 * i));
+        if (bank.foldGain) {
+            y = SimdBlocks::fold(y * foldGain);
+        }
+        // same math as BiquadFilter::run
+        for (int stage = 0; stage < 3; ++stage) {
+            const float* t = taps + stage * 5 * 4;
+            float_4& z0 = z[stage * 2];
+            float_4& z1 = z[stage * 2 + 1];
+            const float_4 x = y + (float_4::load(t + 12) * z0 + float_4::load(t + 16) * z1);
+            y = float_4::load(t) * x +
+                float_4::load(t + 4) * z0 +
+                float_4::load(t + 8) * z1;
+            z1 = z0;
+            z0 = x;
+        }
+    }
+
+    for (int i = 0; i < 6; ++i) {
+        z[i].store(bank.state + 4 * i);
+    }
+    y.store(bank.output);
+}
+
+static void sinDecimate_sse(SimdDispatch::SinDecimateBank* banks, int numBanks, const float* taps, int oversample) {
+    for (int bank = 0; bank < numBanks; ++bank) {
+        sinDecimateBank_sse(banks[bank], taps, oversample);
+    }
+}
+
+// same math as MultiLag2::step, then MultiLPF2::step
+static void detectEnvelope_sse(SimdDispatch::EnvelopeBank* banks, int numBanks) {
+    for (int bank = 0; bank < numBanks; ++bank) {
+        SimdDispatch::EnvelopeBank& b = banks[bank];
+        const float_4 input = float_4::load(b.input);
+
+        float_4 memory = float_4::load(b.lagMemory);
+        const float_4 isAttack = input >= memory;
+        const float_4 l = SimdBlocks::ifelse(isAttack, float_4::load(b.lagAttack), float_4::load(b.lagRelease));
+        const float_4 k = float_4(1) - l;
+        const float_4 laggedMemory = input * k + memory * l;
+        const float_4 isInstantAttack = isAttack & float_4::load(b.lagInstant);
+        memory = SimdBlocks::ifelse(isInstantAttack, input, laggedMemory);
+        memory.store(b.lagMemory);
+
+        const float_4 temp = memory * float_4::load(b.filterK);
+        float_4 filter = float_4::load(b.filterMemory) * float_4::load(b.filterL);
+        filter += temp;
+        filter.store(b.filterMemory);
+
+        const float_4 envelope = SimdBlocks::ifelse(float_4::load(b.useFilter), filter, memory);
+        rack::simd::sqrt(envelope).store(b.output);
+    }
+}
+
+// same math as StateVariableFilter2::runXX4
+static void svf4xBank_sse(SimdDispatch::SvfBank& b, int mode) {
+    const float_4 input = float_4::load(b.input);
+    const float_4 fcGain = float_4::load(b.fcGain);
+    const float_4 qGain = float_4::load(b.qGain);
+    float_4 z1 = float_4::load(b.z1);
+    float_4 z2 = float_4::load(b.z2);
+
+    float_4 dLow, dHi, dBand;
+    for (int i = 0; i < 4; ++i) {
+        dLow = z2 + fcGain * z1;
+        dHi = input - (z1 * qGain + dLow);
+        dBand = dHi * fcGain + z1;
+        z1 = dBand;
+        z2 = dLow;
+    }
+    z1.store(b.z1);
+    z2.store(b.z2);
+
+    switch (mode) {
+        case 0:
+            dLow.store(b.output);
+            break;
+        case 1:
+            dBand.store(b.output);
+            break;
+        case 2:
+            dHi.store(b.output);
+            break;
+        case 3:
+            (dLow + dHi).store(b.output);
+            break;
+        default:
+            assert(false);
+    }
+}
+
+static void svf4x_sse(SimdDispatch::SvfBank* banks, int numBanks, int mode) {
+    for (int bank = 0; bank < numBanks; ++bank) {
+        svf4xBank_sse(banks[bank], mode);
+    }
+}
+
+// same math as CubicInterpolator<float>::interpolate, which works in double
+static inline float interpolateCubic(const float* taps, int voice, double x) {
+    const double x0 = -1.0;
+    const double x1 = 0.0;
+    const double x2 = 1.0;
+    const double x3 = 2.0;
+
+    const float y0 = taps[voice];
+    const float y1 = taps[voice + 4];
+    const float y2 = taps[voice + 8];
+    const float y3 = taps[voice + 12];
+
+    float ret = -(1.0 / 6.0) * y0 * (x - x1) * (x - x2) * (x - x3);
+    ret += (1.0 / 2.0) * y1 * (x - x0) * (x - x2) * (x - x3);
+    ret += (-1.0 / 2.0) * y2 * (x - x0) * (x - x1) * (x - x3);
+    ret += (1.0 / 6.0) * y3 * (x - x0) * (x - x1) * (x - x2);
+    return ret;
+}
+
+// same math as Streamer::step and Sampler4vx::step, with ADSRSampler::step
+static void sampleStepBank_sse(SimdDispatch::SampleBank& b, float outputGain, float sampleTime) {
+    float_4 samples = float_4::zero();
+    if (b.taps) {
+        for (int i = 0; i < 4; ++i) {
+            samples[i] = interpolateCubic(b.taps, i, b.fraction[i]);
+        }
+        samples *= float_4::load(b.gain);
+    }
+    samples *= float_4(outputGain);
+
+    if (b.useEnvelope) {
+        const float_4 gates = float_4::load(b.gates);
+        float_4 env = float_4::load(b.env);
+        float_4 attacking = float_4::load(b.attacking);
+
+        const float_4 target = SimdBlocks::ifelse(gates, SimdBlocks::ifelse(attacking, float_4(1.2f), float_4::load(b.sustain)), float_4::zero());
+        const float_4 lambda = SimdBlocks::ifelse(gates,
+                                                  SimdBlocks::ifelse(attacking, float_4::load(b.attackLambda), float_4::load(b.decayLambda)),
+                                                  float_4::load(b.releaseLambda));
+        env += (target - env) * lambda * sampleTime;
+        attacking = SimdBlocks::ifelse(env >= 1.f, float_4::zero(), attacking);
+        attacking = SimdBlocks::ifelse(gates, attacking, float_4::mask());
+
+        env.store(b.env);
+        attacking.store(b.attacking);
+        samples *= env;
+    }
+    samples.store(b.output);
+}
+
+static void sampleStep_sse(SimdDispatch::SampleBank* banks, int numBanks, float outputGain, float sampleTime) {
+    for (int bank = 0; bank < numBanks; ++bank) {
+        sampleStepBank_sse(banks[bank], outputGain, sampleTime);
+    }
+}
+
+static const SimdDispatch::Kernels sseKernels = {
+    sinTwoPi_sse,
+    sinDecimate_sse,
+    detectEnvelope_sse,
+    svf4x_sse,
+    sampleStep_sse
+};
+
+//---------------------- AVX2 kernels ----------------------------
+// These are compiled with the target attribute, so the rest of the
+// plugin is unaffected. They must only use intrinsics, not any of the
+// inline float_4 helpers, or the linker might pick AVX copies of them.
+// The order of operations matches the SSE versions, so results are identical.
+
+#ifdef _SQ_AVX2_KERNELS
+
+#define _SQ_AVX2 __attribute__((target("avx2")))
+
+_SQ_AVX2 static inline __m256 load2(const float* lo, const float* hi) {
+    return _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(lo)), _mm_loadu_ps(hi), 1);
+}
+
+_SQ_AVX2 static inline void store2(float* lo, float* hi, __m256 x) {
+    _mm_storeu_ps(lo, _mm256_castps256_ps128(x));
+    _mm_storeu_ps(hi, _mm256_extractf128_ps(x, 1));
+}
+
+// SimdBlocks::sinTwoPi
+_SQ_AVX2 static inline __m256 sinTwoPi8(__m256 x) {
+    const float pi = 3.141592653589793238f;
+    const __m256 zero = _mm256_setzero_ps();
+
+    const __m256 gtPi = _mm256_cmp_ps(x, _mm256_set1_ps(pi), _CMP_GT_OQ);
+    x = _mm256_sub_ps(x, _mm256_and_ps(gtPi, _mm256_set1_ps(2 * pi)));
+
+    const __m256 xneg = _mm256_cmp_ps(x, zero, _CMP_LT_OQ);
+    const __m256 xOffset = _mm256_add_ps(
+        _mm256_blendv_ps(_mm256_set1_ps(-pi / 2.f), _mm256_set1_ps(pi / 2.f), xneg),
+        x);
+    const __m256 xSquared = _mm256_mul_ps(xOffset, xOffset);
+
+    __m256 ret = _mm256_mul_ps(xSquared, _mm256_set1_ps(1.f / 24.f));
+    const __m256 correction = _mm256_mul_ps(_mm256_mul_ps(ret, xSquared), _mm256_set1_ps(.02f / .254f));
+    ret = _mm256_add_ps(ret, _mm256_set1_ps(-.5f));
+    ret = _mm256_mul_ps(ret, xSquared);
+    ret = _mm256_add_ps(ret, _mm256_set1_ps(1.f));
+    ret = _mm256_sub_ps(ret, correction);
+
+    return _mm256_blendv_ps(ret, _mm256_sub_ps(zero, ret), xneg);
+}
+
+// SimdBlocks::fold
+_SQ_AVX2 static inline __m256 fold8(__m256 x) {
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256 mask = _mm256_cmp_ps(x, zero, _CMP_LT_OQ);
+    const __m256 bias = _mm256_blendv_ps(_mm256_set1_ps(1), _mm256_set1_ps(-1), mask);
+
+    const __m256 temp = _mm256_div_ps(_mm256_add_ps(x, bias), _mm256_set1_ps(2.f));
+    const __m256i phase = _mm256_cvttps_epi32(temp);
+
+    const __m256i one = _mm256_set1_epi32(1);
+    const __m256i isEven = _mm256_xor_si256(one, _mm256_and_si256(phase, one));
+    const __m256 isEvenMask = _mm256_cmp_ps(_mm256_cvtepi32_ps(isEven), zero, _CMP_GT_OQ);
+
+    const __m256 twoPhase = _mm256_mul_ps(_mm256_set1_ps(2.f), _mm256_cvtepi32_ps(phase));
+    const __m256 evenFold = _mm256_sub_ps(x, twoPhase);
+    const __m256 oddFold = _mm256_add_ps(_mm256_sub_ps(zero, x), twoPhase);
+    return _mm256_blendv_ps(oddFold, evenFold, isEvenMask);
+}
+
+_SQ_AVX2 static void sinTwoPi_avx2(float* data, int numFloats) {
+    assert((numFloats % 8) == 0);
+    for (int i = 0; i < numFloats; i += 8) {
+        _mm256_storeu_ps(data + i, sinTwoPi8(_mm256_loadu_ps(data + i)));
+    }
+}
+
+// Two banks at once, one in each half of the registers.
+_SQ_AVX2 static void sinDecimatePair_avx2(SimdDispatch::SinDecimateBank& a, SimdDispatch::SinDecimateBank& b, const float* taps, int oversample) {
+    __m256 z[6];
+    for (int i = 0; i < 6; ++i) {
+        z[i] = load2(a.state + 4 * i, b.state + 4 * i);
+    }
+
+    // Both banks of a WVCO share a waveform, but we don't need to depend on that.
+    const bool doFold = a.foldGain || b.foldGain;
+    const float one[4] = {1, 1, 1, 1};
+    const __m256 foldGain = load2(a.foldGain ? a.foldGain : one, b.foldGain ? b.foldGain : one);
+    const __m256 foldMask = _mm256_castsi256_ps(_mm256_set_epi32(
+        b.foldGain ? -1 : 0, b.foldGain ? -1 : 0, b.foldGain ? -1 : 0, b.foldGain ? -1 : 0,
+        a.foldGain ? -1 : 0, a.foldGain ? -1 : 0, a.foldGain ? -1 : 0, a.foldGain ? -1 : 0));
+
+    __m256 y = _mm256_setzero_ps();
+    for (int i = 0; i < oversample; ++i) {
+        y = sinTwoPi8(load2(a.buffer + 4 * i, b.buffer + 4 * i));
+        if (doFold) {
+            y = _mm256_blendv_ps(y, fold8(_mm256_mul_ps(y, foldGain)), foldMask);
+        }
+        for (int stage = 0; stage < 3; ++stage) {
+            const float* t = taps + stage * 5 * 4;
+            __m256& z0 = z[stage * 2];
+            __m256& z1 = z[stage * 2 + 1];
+            const __m256 x = _mm256_add_ps(y, _mm256_add_ps(
+                                                  _mm256_mul_ps(load2(t + 12, t + 12), z0),
+                                                  _mm256_mul_ps(load2(t + 16, t + 16), z1)));
+            y = _mm256_add_ps(
+                _mm256_add_ps(
+                    _mm256_mul_ps(load2(t, t), x),
+                    _mm256_mul_ps(load2(t + 4, t + 4), z0)),
+                _mm256_mul_ps(load2(t + 8, t + 8), z1));
+            z1 = z0;
+            z0 = x;
+        }
+    }
+
+    for (int i = 0; i < 6; ++i) {
+        store2(a.state + 4 * i, b.state + 4 * i, z[i]);
+    }
+    store2(a.output, b.output, y);
+}
+
+_SQ_AVX2 static void sinDecimate_avx2(SimdDispatch::SinDecimateBank* banks, int numBanks, const float* taps, int oversample) {
+    int bank = 0;
+    for (; bank + 1 < numBanks; bank += 2) {
+        sinDecimatePair_avx2(banks[bank], banks[bank + 1], taps, oversample);
+    }
+    if (bank < numBanks) {
+        sinDecimateBank_sse(banks[bank], taps, oversample);
+    }
+}
+
+_SQ_AVX2 static inline __m256 ifelse8(__m256 mask, __m256 a, __m256 b) {
+    return _mm256_blendv_ps(b, a, mask);
+}
+
+_SQ_AVX2 static void detectEnvelopePair_avx2(SimdDispatch::EnvelopeBank& a, SimdDispatch::EnvelopeBank& b) {
+    const __m256 input = load2(a.input, b.input);
+
+    __m256 memory = load2(a.lagMemory, b.lagMemory);
+    const __m256 isAttack = _mm256_cmp_ps(input, memory, _CMP_GE_OQ);
+    const __m256 l = ifelse8(isAttack, load2(a.lagAttack, b.lagAttack), load2(a.lagRelease, b.lagRelease));
+    const __m256 k = _mm256_sub_ps(_mm256_set1_ps(1), l);
+    const __m256 laggedMemory = _mm256_add_ps(_mm256_mul_ps(input, k), _mm256_mul_ps(memory, l));
+    const __m256 isInstantAttack = _mm256_and_ps(isAttack, load2(a.lagInstant, b.lagInstant));
+    memory = ifelse8(isInstantAttack, input, laggedMemory);
+    store2(a.lagMemory, b.lagMemory, memory);
+
+    const __m256 temp = _mm256_mul_ps(memory, load2(a.filterK, b.filterK));
+    __m256 filter = _mm256_mul_ps(load2(a.filterMemory, b.filterMemory), load2(a.filterL, b.filterL));
+    filter = _mm256_add_ps(filter, temp);
+    store2(a.filterMemory, b.filterMemory, filter);
+
+    const __m256 envelope = ifelse8(load2(a.useFilter, b.useFilter), filter, memory);
+    store2(a.output, b.output, _mm256_sqrt_ps(envelope));
+}
+
+_SQ_AVX2 static void detectEnvelope_avx2(SimdDispatch::EnvelopeBank* banks, int numBanks) {
+    int bank = 0;
+    for (; bank + 1 < numBanks; bank += 2) {
+        detectEnvelopePair_avx2(banks[bank], banks[bank + 1]);
+    }
+    if (bank < numBanks) {
+        detectEnvelope_sse(banks + bank, 1);
+    }
+}
+
+_SQ_AVX2 static void svf4xPair_avx2(SimdDispatch::SvfBank& a, SimdDispatch::SvfBank& b, int mode) {
+    const __m256 input = load2(a.input, b.input);
+    const __m256 fcGain = load2(a.fcGain, b.fcGain);
+    const __m256 qGain = load2(a.qGain, b.qGain);
+    __m256 z1 = load2(a.z1, b.z1);
+    __m256 z2 = load2(a.z2, b.z2);
+
+    __m256 dLow = z2, dHi = z2, dBand = z2;
+    for (int i = 0; i < 4; ++i) {
+        dLow = _mm256_add_ps(z2, _mm256_mul_ps(fcGain, z1));
+        dHi = _mm256_sub_ps(input, _mm256_add_ps(_mm256_mul_ps(z1, qGain), dLow));
+        dBand = _mm256_add_ps(_mm256_mul_ps(dHi, fcGain), z1);
+        z1 = dBand;
+        z2 = dLow;
+    }
+    store2(a.z1, b.z1, z1);
+    store2(a.z2, b.z2, z2);
+
+    switch (mode) {
+        case 0:
+            store2(a.output, b.output, dLow);
+            break;
+        case 1:
+            store2(a.output, b.output, dBand);
+            break;
+        case 2:
+            store2(a.output, b.output, dHi);
+            break;
+        case 3:
+            store2(a.output, b.output, _mm256_add_ps(dLow, dHi));
+            break;
+        default:
+            assert(false);
+    }
+}
+
+_SQ_AVX2 static void svf4x_avx2(SimdDispatch::SvfBank* banks, int numBanks, int mode) {
+    int bank = 0;
+    for (; bank + 1 < numBanks; bank += 2) {
+        svf4xPair_avx2(banks[bank], banks[bank + 1], mode);
+    }
+    if (bank < numBanks) {
+        svf4xBank_sse(banks[bank], mode);
+    }
+}
+
+// CubicInterpolator works in double, so this part only gets one bank per register.
+_SQ_AVX2 static inline __m128 interpolateCubic4(const float* taps, const float* fraction) {
+    const __m256d x = _mm256_cvtps_pd(_mm_loadu_ps(fraction));
+    const __m256d xMinusX0 = _mm256_sub_pd(x, _mm256_set1_pd(-1.0));
+    const __m256d xMinusX1 = _mm256_sub_pd(x, _mm256_set1_pd(0.0));
+    const __m256d xMinusX2 = _mm256_sub_pd(x, _mm256_set1_pd(1.0));
+    const __m256d xMinusX3 = _mm256_sub_pd(x, _mm256_set1_pd(2.0));
+
+    const __m256d y0 = _mm256_cvtps_pd(_mm_loadu_ps(taps));
+    const __m256d y1 = _mm256_cvtps_pd(_mm_loadu_ps(taps + 4));
+    const __m256d y2 = _mm256_cvtps_pd(_mm_loadu_ps(taps + 8));
+    const __m256d y3 = _mm256_cvtps_pd(_mm_loadu_ps(taps + 12));
+
+    // round to float after every term, the way the scalar code does.
+    __m256d term = _mm256_mul_pd(_mm256_mul_pd(_mm256_mul_pd(_mm256_mul_pd(_mm256_set1_pd(-(1.0 / 6.0)), y0), xMinusX1), xMinusX2), xMinusX3);
+    __m128 ret = _mm256_cvtpd_ps(term);
+    term = _mm256_mul_pd(_mm256_mul_pd(_mm256_mul_pd(_mm256_mul_pd(_mm256_set1_pd(1.0 / 2.0), y1), xMinusX0), xMinusX2), xMinusX3);
+    ret = _mm256_cvtpd_ps(_mm256_add_pd(_mm256_cvtps_pd(ret), term));
+    term = _mm256_mul_pd(_mm256_mul_pd(_mm256_mul_pd(_mm256_mul_pd(_mm256_set1_pd(-1.0 / 2.0), y2), xMinusX0), xMinusX1), xMinusX3);
+    ret = _mm256_cvtpd_ps(_mm256_add_pd(_mm256_cvtps_pd(ret), term));
+    term = _mm256_mul_pd(_mm256_mul_pd(_mm256_mul_pd(_mm256_mul_pd(_mm256_set1_pd(1.0 / 6.0), y3), xMinusX0), xMinusX1), xMinusX2);
+    ret = _mm256_cvtpd_ps(_mm256_add_pd(_mm256_cvtps_pd(ret), term));
+    return ret;
+}
+
+_SQ_AVX2 static void sampleStepPair_avx2(SimdDispatch::SampleBank& a, SimdDispatch::SampleBank& b, float outputGain, float sampleTime) {
+    const __m128 aSamples = a.taps ? interpolateCubic4(a.taps, a.fraction) : _mm_setzero_ps();
+    const __m128 bSamples = b.taps ? interpolateCubic4(b.taps, b.fraction) : _mm_setzero_ps();
+    __m256 samples = _mm256_insertf128_ps(_mm256_castps128_ps256(aSamples), bSamples, 1);
+    samples = _mm256_mul_ps(samples, load2(a.gain, b.gain));
+    samples = _mm256_mul_ps(samples, _mm256_set1_ps(outputGain));
+
+    if (a.useEnvelope) {
+        const __m256 gates = load2(a.gates, b.gates);
+        __m256 env = load2(a.env, b.env);
+        __m256 attacking = load2(a.attacking, b.attacking);
+        const __m256 zero = _mm256_setzero_ps();
+
+        const __m256 target = ifelse8(gates, ifelse8(attacking, _mm256_set1_ps(1.2f), load2(a.sustain, b.sustain)), zero);
+        const __m256 lambda = ifelse8(gates,
+                                      ifelse8(attacking, load2(a.attackLambda, b.attackLambda), load2(a.decayLambda, b.decayLambda)),
+                                      load2(a.releaseLambda, b.releaseLambda));
+        env = _mm256_add_ps(env, _mm256_mul_ps(_mm256_mul_ps(_mm256_sub_ps(target, env), lambda), _mm256_set1_ps(sampleTime)));
+        attacking = ifelse8(_mm256_cmp_ps(env, _mm256_set1_ps(1.f), _CMP_GE_OQ), zero, attacking);
+        attacking = ifelse8(gates, attacking, _mm256_castsi256_ps(_mm256_set1_epi32(-1)));
+
+        store2(a.env, b.env, env);
+        store2(a.attacking, b.attacking, attacking);
+        samples = _mm256_mul_ps(samples, env);
+    }
+    store2(a.output, b.output, samples);
+}
+
+_SQ_AVX2 static void sampleStep_avx2(SimdDispatch::SampleBank* banks, int numBanks, float outputGain, float sampleTime) {
+    int bank = 0;
+    for (; bank + 1 < numBanks; bank += 2) {
+        // A one shot next to a normal region is rare, so don't bother pairing them.
+        if (banks[bank].useEnvelope == banks[bank + 1].useEnvelope) {
+            sampleStepPair_avx2(banks[bank], banks[bank + 1], outputGain, sampleTime);
+        } else {
+            sampleStep_sse(banks + bank, 2, outputGain, sampleTime);
+        }
+    }
+    if (bank < numBanks) {
+        sampleStepBank_sse(banks[bank], outputGain, sampleTime);
+    }
+}
+
+static const SimdDispatch::Kernels avx2Kernels = {
+    sinTwoPi_avx2,
+    sinDecimate_avx2,
+    detectEnvelope_avx2,
+    svf4x_avx2,
+    sampleStep_avx2
+};
+#endif
+
+//---------------------- dispatch ----------------------------
+
+bool SimdDispatch::cpuHasAVX2() {
+#ifdef _SQ_AVX2_KERNELS
+    // This runs from a static initializer, maybe before libgcc has
+    // looked at the CPU, so we have to ask it to.
+    __builtin_cpu_init();
+    static const bool ret = __builtin_cpu_supports("avx2");
+    return ret;
+#else
+    return false;
+#endif
+}
+
+const SimdDispatch::Kernels* SimdDispatch::pickKernels() {
+#ifdef _SQ_AVX2_KERNELS
+    if (cpuHasAVX2()) {
+        return &avx2Kernels;
+    }
+#endif
+    return &sseKernels;
+}
+
+// This static needs somewhere to live. It gets set up when the plugin loads.
+const SimdDispatch::Kernels* SimdDispatch::current = SimdDispatch::pickKernels();
+
+SimdDispatch::Level SimdDispatch::getLevel() {
+    return (current == &sseKernels) ? Level::SSE : Level::AVX2;
+}
+
+const char* SimdDispatch::getLevelName(Level level) {
+    return (level == Level::SSE) ? "SSE" : "AVX2";
+}
+
+void SimdDispatch::_setLevel(Level level) {
+    if (level == Level::SSE) {
+        current = &sseKernels;
+        return;
+    }
+#ifdef _SQ_AVX2_KERNELS
+    assert(cpuHasAVX2());
+    current = &avx2Kernels;
+#else
+    assert(false);
+#endif
+}
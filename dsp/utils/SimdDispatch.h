@@ -0,0 +1,136 @@
+#pragma once
+
+/**
+ * Runtime selection of SIMD kernels.
+ *
+ * The plugin is compiled for the same baseline SSE instruction set as VCV itself,
+ * so we can't just turn on AVX for the whole build. Instead a few hot inner loops
+ * are implemented twice: once with float_4, and once with 256 bit AVX2 registers
+ * that process two float_4 banks at a time.
+ * When the plugin loads we check the CPU and pick one table of kernels.
+ *
+ * All kernels work on plain float arrays laid out like an array of float_4,
+ * and give the same results at every level.
+ */
+class SimdDispatch {
+public:
+    enum class Level {
+        SSE,
+        AVX2
+    };
+
+    /**
+     * One bank of four oscillators for the sinDecimate kernel.
+     */
+    struct SinDecimateBank {
+        float* buffer = nullptr;            // oversample float_4 of phase, in radians. Will be trashed.
+        const float* foldGain = nullptr;    // one float_4. If not null, sin is scaled and folded.
+        float* state = nullptr;             // delay memory of a three stage BiquadState<float_4>
+        float* output = nullptr;            // one float_4, the decimated output
+    };
+
+    /**
+     * One bank of four Cmprsr envelope detectors for the detectEnvelope kernel.
+     * Each pointer is one float_4.
+     */
+    struct EnvelopeBank {
+        const float* input = nullptr;           // detector input, already squared
+        float* lagMemory = nullptr;             // MultiLag2 state and settings
+        const float* lagAttack = nullptr;
+        const float* lagRelease = nullptr;
+        const float* lagInstant = nullptr;      // mask
+        float* filterMemory = nullptr;          // MultiLPF2 state and settings
+        const float* filterL = nullptr;
+        const float* filterK = nullptr;
+        const float* useFilter = nullptr;       // mask. Where true the envelope comes from the filter, else the lag.
+        float* output = nullptr;                // sqrt of the envelope
+    };
+
+    /**
+     * One bank of four StateVariableFilter2 for the svf4x kernel.
+     * Each pointer is one float_4.
+     */
+    struct SvfBank {
+        const float* input = nullptr;
+        float* z1 = nullptr;
+        float* z2 = nullptr;
+        const float* fcGain = nullptr;
+        const float* qGain = nullptr;
+        float* output = nullptr;
+    };
+
+    /**
+     * One Sampler4vx for the sampleStep kernel.
+     * Each pointer is one float_4, except for taps.
+     */
+    struct SampleBank {
+        const float* taps = nullptr;            // four float_4: the samples at x = -1, 0, 1, 2 around each voice.
+                                                // null if no voice has anything to play.
+        const float* fraction = nullptr;        // where each voice is between tap 1 and tap 2. 0..1
+        const float* gain = nullptr;            // zero for voices that have nothing to play
+        const float* gates = nullptr;           // mask
+        float* env = nullptr;                   // ADSRSampler state and settings
+        float* attacking = nullptr;
+        const float* attackLambda = nullptr;
+        const float* decayLambda = nullptr;
+        const float* releaseLambda = nullptr;
+        const float* sustain = nullptr;
+        bool useEnvelope = true;                // one shots don't use (or step) the envelope
+        float* output = nullptr;
+    };
+
+    struct Kernels {
+        /**
+         * In-place SimdBlocks::sinTwoPi of every element.
+         * numFloats must be a multiple of 8.
+         */
+        void (*sinTwoPi)(float* data, int numFloats);
+
+        /**
+         * For each bank, take sinTwoPi of the oversampled phases, optionally fold it,
+         * then decimate with a three stage biquad (like IIRDecimator<float_4>).
+         * taps are the BiquadParams<float_4, 3>, shared by all banks.
+         */
+        void (*sinDecimate)(SinDecimateBank* banks, int numBanks, const float* taps, int oversample);
+
+        /**
+         * For each bank, step the lag and attack filter of Cmprsr,
+         * then output the sqrt of the envelope.
+         */
+        void (*detectEnvelope)(EnvelopeBank* banks, int numBanks);
+
+        /**
+         * For each bank, run a StateVariableFilter2 four times over the same input,
+         * like the runXX4 functions. mode is a StateVariableFilter2::Mode.
+         */
+        void (*svf4x)(SvfBank* banks, int numBanks, int mode);
+
+        /**
+         * For each bank, cubic interpolate the taps (in double, like CubicInterpolator),
+         * apply the gain and outputGain, then step the ADSRSampler and apply it.
+         */
+        void (*sampleStep)(SampleBank* banks, int numBanks, float outputGain, float sampleTime);
+    };
+
+    static const Kernels& kernels() {
+        return *current;
+    }
+
+    static Level getLevel();
+    static const char* getLevelName(Level);
+
+    /**
+     * Does this machine support the AVX2 kernels?
+     */
+    static bool cpuHasAVX2();
+
+    /**
+     * For unit tests and perf tests. Will assert if AVX2
+     * is requested on a CPU that does not support it.
+     */
+    static void _setLevel(Level);
+
+private:
+    static const Kernels* current;
+    static const Kernels* pickKernels();
+};
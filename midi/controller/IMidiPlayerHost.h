@@ -3,6 +3,8 @@
 #include "rack.hpp"
 #include <memory>
 
+class MidiPlayerEventBuffer;
+
 /**
  * Implemented by a class that wants to host a Midi Player.
  * Single track players can ignore the track parameter.
@@ -19,6 +21,16 @@ public:
      * go and reset the clock.
      */
     virtual void resetClock() = 0;
+
+    /**
+     * A host that returns a buffer here gets all its gate and CV changes
+     * put in the buffer, stamped with the sample they happen on, instead
+     * of through setGate and setCV.
+     * The default of nullptr means "call setGate and setCV".
+     */
+    virtual MidiPlayerEventBuffer* getEventBuffer() {
+        return nullptr;
+    }
     virtual ~IMidiPlayerHost4() = default;
     rack::dsp::PulseGenerator eocTrigger;
 };
@@ -489,18 +489,12 @@ void MidiEditor::updateSelectionForCursor(bool extendCurrent) {
 MidiNoteEventPtr MidiEditor::getNoteUnderCursor() {
     const int cursorSemi = PitchUtils::cvToSemitone(seq()->context->cursorPitch());
 
-    // iterate over all the notes that are in the edit context
-    auto start = seq()->context->startTime();
-    auto end = seq()->context->endTime();
-    MidiTrack::note_iterator_pair notes = getTrack()->timeRangeNotes(start, end);
-    for (auto it = notes.first; it != notes.second; ++it) {
-        MidiNoteEventPtr note = safe_cast<MidiNoteEvent>(it->second);
-        const auto startTime = note->startTime;
-        const auto endTime = note->startTime + note->duration;
-
-        if ((PitchUtils::cvToSemitone(note->pitchCV) == cursorSemi) &&
-            (startTime <= seq()->context->cursorTime()) &&
-            (endTime > seq()->context->cursorTime())) {
+    // iterate over all the notes that are playing at the cursor
+    const float cursorTime = seq()->context->cursorTime();
+    std::vector<MidiNoteEventPtr> notes;
+    getTrack()->getNotesOverlapping(cursorTime, cursorTime, notes);
+    for (auto note : notes) {
+        if (PitchUtils::cvToSemitone(note->pitchCV) == cursorSemi) {
             //seq()->selection->select(note);
             return note;
         }
@@ -541,15 +535,16 @@ void MidiEditor::extendSelectionToCurrentNote() {
         boundingBox.pos.y,
         boundingBox.getBottom());
 
-    // iterate all the notes, and add to selection
+    // gather all the notes, and add them to selection
+    std::vector<MidiEventPtr> notes;
     for (; it.first != it.second; ++it.first) {
         auto temp = *(it.first);
         MidiEventPtr ev = temp.second;
-        MidiNoteEventPtr n = safe_cast<MidiNoteEvent>(ev);
-        if (n) {
-            seq()->selection->extendSelection(n);
+        if (ev->type == MidiEvent::Type::Note) {
+            notes.push_back(ev);
         }
     }
+    seq()->selection->extendSelection(notes);
 }
 
 void MidiEditor::setNoteEditorAttribute(MidiEditorContext::NoteAttribute attr) {
@@ -4,6 +4,8 @@
 #include "MidiFile.h"
 #include "MidiLock.h"
 #include "MidiSong.h"
+#include "SmfReader.h"
+#include "SmfWriter.h"
 #include "TimeUtils.h"
 
 //#include <direct.h>
@@ -12,45 +14,30 @@
 #include <iostream>
 
 bool MidiFileProxy::save(MidiSongPtr song, const std::string& filePath) {
-    smf::MidiFile midiFile;
-    midiFile.setTPQ(480);
-    const int ppq = midiFile.getTPQ();
-    assert(ppq == 480);
-
     MidiTrackPtr track = song->getTrack(0);  // for now we always have one track here
-    const int outputTkNum = 0;
-    for (auto it : *track) {
-        MidiEventPtr evt = it.second;
-        MidiNoteEventPtr note = safe_cast<MidiNoteEvent>(evt);
-        MidiEndEventPtr end = safe_cast<MidiEndEvent>(evt);
-        if (note) {
-            int startTick = int(note->startTime * ppq);
-            int duration = int(note->duration * ppq);
-            int key = PitchUtils::pitchCVToMidi(note->pitchCV);
-            if (key < 0 || key > 127) {
-                fprintf(stderr, "pitch outside MIDI range, not writing to file");
-            } else {
-                const int endTick = startTick + duration;
-                const int outputMidiChannel = 0;
-                const int velocity = 0x3f;
-                midiFile.addNoteOn(outputTkNum, startTick, outputMidiChannel, key, velocity);
-                midiFile.addNoteOff(outputTkNum, endTick, outputMidiChannel, key);
-            }
-        } else if (end) {
-            int tick = int(end->startTime * ppq);
-            std::vector<smf::uchar> data;
-            data.push_back(0);
-            assert(data.size() == 1);
-            midiFile.addMetaEvent(outputTkNum, tick, 0x2f, data);
-        }
-    }
-
-    midiFile.sortTracks();
-    return midiFile.write(filePath);
-    return false;
+    return SmfWriter::write(track, filePath);
 }
 
 MidiSongPtr MidiFileProxy::load(const std::string& filename) {
+    MidiSongPtr song = std::make_shared<MidiSong>();
+    MidiTrackPtr track;
+    switch (SmfReader::read(filename, song->lock, track)) {
+        case SmfReader::Status::ok:
+            break;
+        case SmfReader::Status::noNotes:
+            return nullptr;
+        case SmfReader::Status::cantOpen:
+            printf("open failed\n");
+            return nullptr;
+        case SmfReader::Status::notSupported:
+            return loadSmf(filename);
+    }
+    song->addTrack(0, track);
+    song->assertValid();
+    return song;
+}
+
+MidiSongPtr MidiFileProxy::loadSmf(const std::string& filename) {
     smf::MidiFile midiFile;
 
     bool b = midiFile.read(filename);
@@ -15,7 +15,17 @@ using MidiTrackPtr = std::shared_ptr<MidiTrack>;
 class MidiFileProxy {
 public:
     MidiFileProxy() = delete;
+
+    /**
+     * Loads the first track with notes in it.
+     * Uses SmfReader when it can, otherwise loadSmf.
+     */
     static MidiSongPtr load(const std::string& filename);
+
+    /**
+     * The old way, through smf::MidiFile. Much slower, but reads everything.
+     */
+    static MidiSongPtr loadSmf(const std::string& filename);
     static MidiTrackPtr getFirst(MidiSongPtr song, smf::MidiFile&);
     static bool save(MidiSongPtr song, const std::string& filePath);
 };
\ No newline at end of file
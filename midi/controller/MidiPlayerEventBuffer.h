@@ -0,0 +1,134 @@
+#pragma once
+
+#include <assert.h>
+#include <stdint.h>
+
+/**
+ * Gate and CV changes coming out of MidiPlayer4 for one block of samples.
+ *
+ * Each event is stamped with the sample in the block where it happened,
+ * so the host can play them back at exactly the right sample in the
+ * next block. Pushing an event is just a store - there is no virtual
+ * call per gate or CV change, like there is with IMidiPlayerHost4::setGate.
+ *
+ * Fixed size, so it never allocates on the audio thread.
+ */
+class MidiPlayerEventBuffer
+{
+public:
+    enum class Type : uint8_t
+    {
+        Gate,
+        CV
+    };
+
+    class Event
+    {
+    public:
+        int16_t sampleOffset;
+        uint8_t track;
+        uint8_t voice;
+        Type type;
+        float value;        // CV, or for gates 1 = on, 0 = off
+    };
+
+    /**
+     * Enough for every voice on every track to
+     * stop, re-trigger and start again in the same block.
+     */
+    static const int maxEvents = 4 * 16 * 4;
+
+    /**
+     * Events pushed from now on happen this many samples into the block.
+     */
+    void setSampleOffset(int offset)
+    {
+        assert(offset >= 0);
+        sampleOffset = int16_t(offset);
+    }
+    int getSampleOffset() const
+    {
+        return sampleOffset;
+    }
+
+    void pushGate(int track, int voice, bool gate)
+    {
+        push(Type::Gate, track, voice, gate ? 1.f : 0.f);
+    }
+    void pushCV(int track, int voice, float cv)
+    {
+        push(Type::CV, track, voice, cv);
+    }
+
+    /**
+     * Events usually get pushed in time order, but not always
+     * (re-triggers finish at the end of the block). This puts them in order,
+     * keeping the order of events at the same sample - CV still comes before gate.
+     */
+    void sort();
+
+    /**
+     * Forget all the events, and go back to sample zero.
+     */
+    void clear()
+    {
+        numEvents = 0;
+        sampleOffset = 0;
+    }
+
+    int size() const
+    {
+        return numEvents;
+    }
+    const Event& operator[](int index) const
+    {
+        assert(index >= 0 && index < numEvents);
+        return events[index];
+    }
+
+    /**
+     * How many events we had to drop because the buffer was full.
+     */
+    int _getOverflowCount() const
+    {
+        return overflowCount;
+    }
+
+private:
+    Event events[maxEvents];
+    int numEvents = 0;
+    int16_t sampleOffset = 0;
+    int overflowCount = 0;
+
+    void push(Type type, int track, int voice, float value);
+};
+
+inline void MidiPlayerEventBuffer::push(Type type, int track, int voice, float value)
+{
+    assert(track >= 0 && track < 4);
+    assert(voice >= 0 && voice < 16);
+    if (numEvents >= maxEvents) {
+        ++overflowCount;
+        return;
+    }
+    Event& event = events[numEvents++];
+    event.sampleOffset = sampleOffset;
+    event.track = uint8_t(track);
+    event.voice = uint8_t(voice);
+    event.type = type;
+    event.value = value;
+}
+
+inline void MidiPlayerEventBuffer::sort()
+{
+    // insertion sort is stable, and fast for the almost sorted lists we get
+    for (int i = 1; i < numEvents; ++i) {
+        const Event event = events[i];
+        int j = i - 1;
+        while (j >= 0 && events[j].sampleOffset > event.sampleOffset) {
+            events[j + 1] = events[j];
+            --j;
+        }
+        events[j + 1] = event;
+    }
+}
@@ -0,0 +1,362 @@
+#include "MidiTrackCodec.h"
+
+#include "MidiLock.h"
+#include "MidiTrack.h"
+#include "PitchUtils.h"
+
+#include <assert.h>
+#include <string.h>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace {
+
+const char* const base64Chars = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+int base64Value(char c) {
+    if (c >= 'A' && c <= 'Z') {
+        return c - 'A';
+    }
+    if (c >= 'a' && c <= 'z') {
+        return c - 'a' + 26;
+    }
+    if (c >= '0' && c <= '9') {
+        return c - '0' + 52;
+    }
+    if (c == '+') {
+        return 62;
+    }
+    if (c == '/') {
+        return 63;
+    }
+    return -1;
+}
+
+/**
+ * Writes bytes and numbers, as base64 text.
+ */
+class CodecOutput {
+public:
+    CodecOutput(std::string& s) : text(s) {
+    }
+
+    void byte(uint8_t b) {
+        bits = (bits << 8) | b;
+        if (++pending == 3) {
+            emit(4);
+            bits = 0;
+            pending = 0;
+        }
+    }
+
+    void varUInt(uint32_t value) {
+        while (value >= 0x80) {
+            byte(uint8_t(value | 0x80));
+            value >>= 7;
+        }
+        byte(uint8_t(value));
+    }
+
+    void varInt(int32_t value) {
+        // zigzag, so small negative numbers are small too
+        varUInt((uint32_t(value) << 1) ^ uint32_t(value >> 31));
+    }
+
+    void rawFloat(float value) {
+        uint32_t x;
+        memcpy(&x, &value, sizeof(x));
+        for (int i = 0; i < 4; ++i) {
+            byte(uint8_t(x >> (8 * i)));
+        }
+    }
+
+    /**
+     * flush out the last partial group, with padding
+     */
+    void finish() {
+        if (pending) {
+            const int chars = pending + 1;
+            bits <<= 8 * (3 - pending);
+            emit(chars);
+            text.append(4 - chars, '=');
+            bits = 0;
+            pending = 0;
+        }
+    }
+
+private:
+    std::string& text;
+    uint32_t bits = 0;
+    int pending = 0;
+
+    void emit(int chars) {
+        for (int i = 0; i < chars; ++i) {
+            text.push_back(base64Chars[(bits >> (18 - 6 * i)) & 0x3f]);
+        }
+    }
+};
+
+/**
+ * Reads bytes and numbers out of base64 text.
+ * Running off the end, or bad text, sets good to false
+ * and reads zeros from then on.
+ */
+class CodecInput {
+public:
+    CodecInput(const char* begin, const char* end) : p(begin), end(end) {
+    }
+
+    bool good = true;
+
+    bool atEnd() const {
+        return (next == available) && (p == end);
+    }
+
+    uint8_t byte() {
+        if (next == available && !refill()) {
+            good = false;
+            return 0;
+        }
+        return buffer[next++];
+    }
+
+    uint32_t varUInt() {
+        uint32_t ret = 0;
+        for (int shift = 0; shift < 35; shift += 7) {
+            const uint8_t b = byte();
+            ret |= uint32_t(b & 0x7f) << shift;
+            if (!(b & 0x80)) {
+                return ret;
+            }
+        }
+        good = false;
+        return 0;
+    }
+
+    int32_t varInt() {
+        const uint32_t x = varUInt();
+        return int32_t(x >> 1) ^ -int32_t(x & 1);
+    }
+
+    float rawFloat() {
+        uint32_t x = 0;
+        for (int i = 0; i < 4; ++i) {
+            x |= uint32_t(byte()) << (8 * i);
+        }
+        float ret;
+        memcpy(&ret, &x, sizeof(ret));
+        return ret;
+    }
+
+private:
+    const char* p;
+    const char* const end;
+    uint8_t buffer[3];
+    int next = 0;
+    int available = 0;
+
+    bool refill() {
+        if (!good || end - p < 4) {
+            return false;
+        }
+        uint32_t bits = 0;
+        int padding = 0;
+        for (int i = 0; i < 4; ++i) {
+            const char c = p[i];
+            int value = 0;
+            if (c == '=' && i >= 2) {
+                ++padding;
+            } else {
+                value = base64Value(c);
+                if (value < 0 || padding) {
+                    return false;
+                }
+            }
+            bits = (bits << 6) | uint32_t(value);
+        }
+        p += 4;
+        if (padding && p != end) {
+            // padding is only allowed at the very end
+            return false;
+        }
+        for (int i = 0; i < 3; ++i) {
+            buffer[i] = uint8_t(bits >> (16 - 8 * i));
+        }
+        next = 0;
+        available = 3 - padding;
+        return true;
+    }
+};
+
+enum EventFlags : uint8_t {
+    typeNote = 1,
+    typeEnd = 2,
+    typeMask = 3,
+    rawStart = 4,
+    rawPitch = 8,
+    rawDuration = 16,
+    allFlags = 31
+};
+
+// the pitch we start the deltas from. 0V
+const int32_t firstSemitone = 48;
+
+float fromTicks(int32_t ticks) {
+    return float(ticks) / MidiTrackCodec::ticksPerQuarter;
+}
+
+/**
+ * returns false if time is not exactly on a tick
+ */
+bool toTicks(float time, int32_t& ticks) {
+    const float x = time * MidiTrackCodec::ticksPerQuarter;
+    if (!(std::abs(x) < float(1 << 30))) {
+        return false;
+    }
+    ticks = int32_t(std::lround(x));
+    return fromTicks(ticks) == time;
+}
+
+/**
+ * returns false if cv is not exactly on a semitone
+ */
+bool toSemitone(float cv, int32_t& semi) {
+    const float x = (cv + 4) * 12;
+    if (!(std::abs(x) < float(1 << 20))) {
+        return false;
+    }
+    semi = int32_t(std::lround(x));
+    return PitchUtils::semitoneToCV(semi) == cv;
+}
+
+}  // namespace
+
+std::string MidiTrackCodec::encode(MidiTrackPtr track) {
+    std::string text;
+    // 8 bytes per event covers almost everything, and base64 is 4 chars for 3 bytes
+    text.reserve(size_t(track->size()) * 11 + 16);
+    CodecOutput out(text);
+
+    out.byte(version);
+    out.varUInt(uint32_t(track->size()));
+
+    int32_t lastTick = 0;
+    int32_t lastSemi = firstSemitone;
+    for (auto it : *track) {
+        const MidiEvent* evt = it.second.get();
+        const bool isNote = evt->type == MidiEvent::Type::Note;
+        assert(isNote || evt->type == MidiEvent::Type::End);
+
+        int32_t tick = 0;
+        int32_t semi = 0;
+        int32_t durationTicks = 0;
+        uint8_t flags = isNote ? typeNote : typeEnd;
+        if (!toTicks(evt->startTime, tick)) {
+            flags |= rawStart;
+        }
+        const MidiNoteEvent* note = isNote ? static_cast<const MidiNoteEvent*>(evt) : nullptr;
+        if (note) {
+            if (!toSemitone(note->pitchCV, semi)) {
+                flags |= rawPitch;
+            }
+            if (!toTicks(note->duration, durationTicks)) {
+                flags |= rawDuration;
+            }
+        }
+
+        out.byte(flags);
+        if (flags & rawStart) {
+            out.rawFloat(evt->startTime);
+        } else {
+            out.varInt(tick - lastTick);
+            lastTick = tick;
+        }
+        if (note) {
+            if (flags & rawPitch) {
+                out.rawFloat(note->pitchCV);
+            } else {
+                out.varInt(semi - lastSemi);
+                lastSemi = semi;
+            }
+            if (flags & rawDuration) {
+                out.rawFloat(note->duration);
+            } else {
+                out.varInt(durationTicks);
+            }
+        }
+    }
+    out.finish();
+    return text;
+}
+
+MidiTrackPtr MidiTrackCodec::decode(const std::string& text, std::shared_ptr<MidiLock> lock) {
+    return decode(text.data(), text.size(), lock);
+}
+
+MidiTrackPtr MidiTrackCodec::decode(const char* text, size_t length, std::shared_ptr<MidiLock> lock) {
+    CodecInput in(text, text + length);
+    if (in.byte() != version) {
+        return nullptr;
+    }
+
+    // every event is at least two bytes, so a big count means the text is bad
+    const uint32_t count = in.varUInt();
+    if (!in.good || count == 0 || count > length) {
+        return nullptr;
+    }
+
+    std::vector<MidiEventPtr> events;
+    events.reserve(count);
+    int32_t lastTick = 0;
+    int32_t lastSemi = firstSemitone;
+    MidiEvent::time_t lastStart = -std::numeric_limits<float>::infinity();
+    bool haveEnd = false;
+    for (uint32_t i = 0; i < count && in.good; ++i) {
+        const uint8_t flags = in.byte();
+        const uint8_t type = flags & typeMask;
+        if ((flags & ~allFlags) || (type != typeNote && type != typeEnd) || haveEnd) {
+            // unknown event, or something after the end
+            return nullptr;
+        }
+
+        MidiEvent::time_t start;
+        if (flags & rawStart) {
+            start = in.rawFloat();
+        } else {
+            lastTick = int32_t(uint32_t(lastTick) + uint32_t(in.varInt()));
+            start = fromTicks(lastTick);
+        }
+        if (!(start >= lastStart)) {
+            // out of order, or not a number
+            return nullptr;
+        }
+        lastStart = start;
+
+        if (type == typeNote) {
+            MidiNoteEventPtr note = std::make_shared<MidiNoteEvent>();
+            note->startTime = start;
+            if (flags & rawPitch) {
+                note->pitchCV = in.rawFloat();
+            } else {
+                lastSemi = int32_t(uint32_t(lastSemi) + uint32_t(in.varInt()));
+                note->pitchCV = PitchUtils::semitoneToCV(lastSemi);
+            }
+            note->duration = (flags & rawDuration) ? in.rawFloat() : fromTicks(in.varInt());
+            events.push_back(note);
+        } else {
+            MidiEndEventPtr end = std::make_shared<MidiEndEvent>();
+            end->startTime = start;
+            events.push_back(end);
+            haveEnd = true;
+        }
+    }
+
+    if (!in.good || !in.atEnd() || !haveEnd) {
+        return nullptr;
+    }
+
+    MidiTrackPtr track = std::make_shared<MidiTrack>(lock);
+    track->insertSortedEvents(events);
+    return track;
+}
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <memory>
+#include <string>
+
+class MidiLock;
+class MidiTrack;
+
+using MidiTrackPtr = std::shared_ptr<MidiTrack>;
+
+/**
+ * Compact encoding of a track, for saving in a patch.
+ *
+ * The old way wrote every note as its own json object, which makes
+ * huge patches for long songs, and slow autosaves. This packs the
+ * whole track into one base64 string.
+ *
+ * After a version byte and the event count, each event is a flags byte
+ * followed by its fields:
+ *      start time: delta in ticks from the previous start time
+ *      pitch:      delta in semitones from the previous note
+ *      duration:   ticks
+ * all as zigzag variable length numbers, so on-grid notes take a few bytes each.
+ * Any value that doesn't land exactly on a tick (or a semitone) is
+ * written as the raw float instead, so the round trip is always exact.
+ *
+ * Both ways go in one pass - the base64 is made (and taken apart)
+ * as the events go by, with no intermediate buffer.
+ */
+class MidiTrackCodec {
+public:
+    static const int ticksPerQuarter = 960;
+    static const uint8_t version = 1;
+
+    static std::string encode(MidiTrackPtr track);
+
+    /**
+     * returns nullptr if the text is not a track we can read.
+     * Caller must hold the lock.
+     */
+    static MidiTrackPtr decode(const char* text, size_t length, std::shared_ptr<MidiLock> lock);
+    static MidiTrackPtr decode(const std::string& text, std::shared_ptr<MidiLock> lock);
+};
@@ -1,7 +1,9 @@
 
 #include "IMidiPlayerHost.h"
+#include "MidiPlayerEventBuffer.h"
 #include "MidiVoice.h"
 
+#include <algorithm>
 #include <assert.h>
 #include <stdio.h>
 
@@ -13,6 +15,7 @@ MidiVoice::State MidiVoice::state() const
 void MidiVoice::setHost(IMidiPlayerHost4* ph)
 {
     host = ph;
+    eventBuffer = ph ? ph->getEventBuffer() : nullptr;
 }
 
 void MidiVoice::setIndex(int i)
@@ -28,12 +31,20 @@ void MidiVoice::setTrack(int i)
 void MidiVoice::setGate(bool g)
 {
    // printf("mv::setGate(%d) %d\n ", index, g);
-    host->setGate(track, index, g);
+    if (eventBuffer) {
+        eventBuffer->pushGate(track, index, g);
+    } else {
+        host->setGate(track, index, g);
+    }
 }
 
 void MidiVoice::setCV(float cv)
 {
-    host->setCV(track, index, cv);
+    if (eventBuffer) {
+        eventBuffer->pushCV(track, index, cv);
+    } else {
+        host->setCV(track, index, cv);
+    }
 }
 
 float MidiVoice::pitch() const
@@ -57,13 +68,25 @@ void MidiVoice::updateSampleCount(int samples)
 #ifdef _MLOG
         printf("midi voice will subtract %d from %d\n", samples, retriggerSampleCounter);
 #endif
+        const int samplesLeft = retriggerSampleCounter;
         retriggerSampleCounter -= samples;
         if (retriggerSampleCounter <= 0) {
             retriggerSampleCounter = 0;
             curState = State::Playing;
+
+            // With an event buffer, the re-trigger can end on the exact sample
+            // in this block where the count ran out.
+            int saveOffset = 0;
+            if (eventBuffer) {
+                saveOffset = eventBuffer->getSampleOffset();
+                eventBuffer->setSampleOffset(std::max(0, std::min(samples - 1, samplesLeft)));
+            }
             setCV(delayedNotePitch);
             noteOffTime = delayedNoteEndtime;
             setGate(true);
+            if (eventBuffer) {
+                eventBuffer->setSampleOffset(saveOffset);
+            }
         }
     } 
 }
@@ -86,6 +109,11 @@ void MidiVoice::playNote(float pitch, double currentTime, float endTime)
         delayedNotePitch = pitch;
         delayedNoteEndtime = endTime;
         retriggerSampleCounter = numSamplesInRetrigger;
+        if (eventBuffer) {
+            // we are part way into the block, and the count
+            // will get the whole block taken off at the end.
+            retriggerSampleCounter += eventBuffer->getSampleOffset();
+        }
 #ifdef _MLOG
         printf("voice retric count = %d\n", retriggerSampleCounter);
 #endif
@@ -3,6 +3,7 @@
 
 // #define _MLOG
 class IMidiPlayerHost4;
+class MidiPlayerEventBuffer;
 
 /**
  * Midi voice represents one "voice" of playback, so typically
@@ -84,6 +85,11 @@ private:
 
     IMidiPlayerHost4* host = nullptr;
 
+    /**
+     * If the host gave us an event buffer, we send gates and CV there.
+     */
+    MidiPlayerEventBuffer* eventBuffer = nullptr;
+
     State curState = State::Idle;
 
     /**
@@ -66,28 +66,16 @@ void ReplaceDataCommand::execute(MidiSequencerPtr seq, SequencerWidget*)
     MidiTrackPtr mt = seq->song->getTrack(trackNumber);
     assert(mt);
     MidiLocker l(mt->lock);
-
-    const float currentTrackLength = mt->getLength();
-    const bool isNewLengthRequested = (newTrackLength >= 0);
-    const bool isNewLengthLonger = (newTrackLength > currentTrackLength);
-   
     mt->assertValid();
-    // If we need to make track longer, do it first
-    if (isNewLengthRequested && isNewLengthLonger) {
-        mt->setLength(newTrackLength);
-    }
-
-    for (auto it : addData) {
-        mt->insertEvent(it);
-    }
-
-    for (auto it : removeData) {
-        mt->deleteEvent(*it);
-    }
 
-    //  if we need to make track shorter, do it last
-    if (isNewLengthRequested && !isNewLengthLonger) {
-        mt->setLength(newTrackLength);
+    if (haveSnapshots && mt->getSnapshot().isSameTree(beforeEdit)) {
+        // redo: the track is just as we found it the first time, so we can put back the result.
+        mt->restoreSnapshot(afterEdit);
+    } else {
+        beforeEdit = mt->getSnapshot();
+        applyEdits(mt, addData, removeData, newTrackLength);
+        afterEdit = mt->getSnapshot();
+        haveSnapshots = true;
     }
 
     // clone the selection, clear real selection, add stuff back correctly
@@ -103,12 +91,8 @@ void ReplaceDataCommand::execute(MidiSequencerPtr seq, SequencerWidget*)
 
     seq->assertValid();
     
-    for (auto it : addData) {
-        auto foundIter = mt->findEventDeep(*it);      // find an event in the track that matches the one we just inserted
-        assert(foundIter != mt->end());
-        MidiEventPtr evt = foundIter->second;
-        selection->extendSelection(evt);
-    }
+    // the events we added are in the track now, so select them
+    selection->extendSelection(addData);
     seq->assertValid();
 }
 
@@ -119,39 +103,50 @@ void ReplaceDataCommand::undo(MidiSequencerPtr seq, SequencerWidget*)
     assert(mt);
     MidiLocker l(mt->lock);
 
-    // we may need to change length back to originalTrackLength
+    if (haveSnapshots && mt->getSnapshot().isSameTree(afterEdit)) {
+        mt->restoreSnapshot(beforeEdit);
+    } else {
+        // Someone else changed the track since we did, so we can't use the snapshot.
+        // Instead, delete what we added and put back what we removed.
+        applyEdits(mt, removeData, addData, originalTrackLength);
+    }
+
+    MidiSelectionModelPtr selection = seq->selection;
+    assert(selection);
+    selection->clear();
+    selection->extendSelection(removeData);
+    // TODO: move cursor
+}
+
+void ReplaceDataCommand::applyEdits(
+    MidiTrackPtr mt,
+    const std::vector<MidiEventPtr>& toAdd,
+    const std::vector<MidiEventPtr>& toRemove,
+    float trackLength)
+{
     const float currentTrackLength = mt->getLength();
-    const bool isNewLengthRequested = (originalTrackLength >= 0);
-    const bool isNewLengthLonger = (originalTrackLength > currentTrackLength);
+    const bool isNewLengthRequested = (trackLength >= 0);
+    const bool isNewLengthLonger = (trackLength > currentTrackLength);
 
     // If we need to make track longer, do it first
     if (isNewLengthRequested && isNewLengthLonger) {
-        mt->setLength(originalTrackLength);
+        mt->setLength(trackLength);
     }
 
-    // to undo the insertion, delete all of them
-    for (auto it : addData) {
+    // Remove first, so if an added event is the same as a removed one
+    // it's the added one that stays in the track.
+    for (auto it : toRemove) {
         mt->deleteEvent(*it);
     }
-    for (auto it : removeData) {
+
+    for (auto it : toAdd) {
         mt->insertEvent(it);
     }
 
-        // If we need to make track shorter, do it last
+    //  if we need to make track shorter, do it last
     if (isNewLengthRequested && !isNewLengthLonger) {
-        mt->setLength(originalTrackLength);
+        mt->setLength(trackLength);
     }
-
-    MidiSelectionModelPtr selection = seq->selection;
-    assert(selection);
-    selection->clear();
-    for (auto it : removeData) {
-        auto foundIter = mt->findEventDeep(*it);      // find an event in the track that matches the one we just inserted
-        assert(foundIter != mt->end());
-        MidiEventPtr evt = foundIter->second;
-        selection->extendSelection(evt);
-    }
-    // TODO: move cursor
 }
 
 ReplaceDataCommandPtr ReplaceDataCommand::makeDeleteCommand(MidiSequencerPtr seq, const char* name)
@@ -188,33 +183,6 @@ ReplaceDataCommandPtr ReplaceDataCommand::makeChangeNoteCommand(
     std::vector<MidiEventPtr> toAdd;
     std::vector<MidiEventPtr> toRemove;
 
-    float newTrackLength = -1;         // assume we won't need to change track length
-    if (canChangeLength) {
-        // Figure out the duration of the track after xforming the notes
-        MidiSelectionModelPtr clonedSelection = seq->selection->clone();
-        // find required length
-        MidiEndEventPtr end = seq->context->getTrack()->getEndEvent();
-        float endTime = end->startTime;
-
-        int index = 0;  // hope index is stable across clones
-        for (auto it : *clonedSelection) {
-            MidiEventPtr ev = it;
-            xform(ev, index++);
-            float t = ev->startTime;
-            MidiNoteEventPtrC note = safe_cast<MidiNoteEvent>(ev);
-            if (note) {
-                t += note->duration;
-            }
-            endTime = std::max(endTime, t);
-        }
-
-        // now end time is the required duration
-        // set up events to extend to that length
-        newTrackLength = calculateDurationRequest(seq, endTime);
-    }
-
-    MidiSelectionModelPtr clonedSelection = seq->selection->clone();
-
     // will remove existing selection
     for (auto it : *seq->selection) {
         auto note = safe_cast<MidiNoteEvent>(it);
@@ -223,14 +191,29 @@ ReplaceDataCommandPtr ReplaceDataCommand::makeChangeNoteCommand(
         }
     }
 
-    // and add back the transformed notes
-    int index=0;
+    // and add back the transformed notes.
+    // Only clone the selection once - it can be the whole track.
+    MidiSelectionModelPtr clonedSelection = seq->selection->clone();
+    MidiEndEventPtr end = seq->context->getTrack()->getEndEvent();
+    float endTime = end->startTime;
+    int index = 0;
     for (auto it : *clonedSelection) {
         MidiEventPtr event = it;
         xform(event, index++);
         toAdd.push_back(event);
+
+        float t = event->startTime;
+        MidiNoteEventPtrC note = safe_cast<MidiNoteEvent>(event);
+        if (note) {
+            t += note->duration;
+        }
+        endTime = std::max(endTime, t);
     }
 
+    // now end time is the required duration
+    // set up events to extend to that length
+    const float newTrackLength = canChangeLength ? calculateDurationRequest(seq, endTime) : -1;
+
     ReplaceDataCommandPtr ret = std::make_shared<ReplaceDataCommand>(
         seq->song,
         seq->selection,
@@ -3,6 +3,7 @@
 #include <functional>
 #include <vector>
 
+#include "MidiTrack.h"
 #include "SqCommand.h"
 
 class MidiEditorContext;
@@ -114,6 +115,26 @@ private:
      */
     bool extendSelection = false;
 
+    /**
+     * The track before and after we edited it the first time.
+     * Undo and redo just swap these back in, which is O(1) no matter
+     * how many events were edited. They are only used if the track
+     * hasn't been changed by anyone else in between.
+     */
+    MidiTrack::container beforeEdit;
+    MidiTrack::container afterEdit;
+    bool haveSnapshots = false;
+
+    /**
+     * The edit itself: remove events, add events, and change
+     * the length if trackLength isn't negative.
+     */
+    static void applyEdits(
+        std::shared_ptr<MidiTrack>,
+        const std::vector<MidiEventPtr>& toAdd,
+        const std::vector<MidiEventPtr>& toRemove,
+        float trackLength);
+
     /**
      * queues up note additions and deletions to make them all fit in a shorter track
      */
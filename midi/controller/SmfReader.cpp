@@ -0,0 +1,314 @@
+#include "SmfReader.h"
+
+#include "MidiLock.h"
+#include "MidiTrack.h"
+#include "PitchUtils.h"
+#include "TimeUtils.h"
+
+#include <assert.h>
+#include <stdio.h>
+#include <algorithm>
+#include <vector>
+
+namespace {
+
+/**
+ * Reads big-endian numbers and variable length quantities out of a buffer.
+ * Running off the end sets good to false, and reads zeros from then on.
+ */
+class SmfInput {
+public:
+    SmfInput(const uint8_t* begin, const uint8_t* end) : p(begin), end(end) {
+    }
+
+    bool atEnd() const {
+        return p >= end;
+    }
+    size_t remaining() const {
+        return size_t(end - p);
+    }
+
+    uint8_t peek() {
+        if (p >= end) {
+            good = false;
+            return 0;
+        }
+        return *p;
+    }
+
+    uint8_t byte() {
+        const uint8_t ret = peek();
+        if (good) {
+            ++p;
+        }
+        return ret;
+    }
+
+    uint32_t bigEndian(int bytes) {
+        uint32_t ret = 0;
+        for (int i = 0; i < bytes; ++i) {
+            ret = (ret << 8) | byte();
+        }
+        return ret;
+    }
+
+    uint32_t varLen() {
+        uint32_t ret = 0;
+        for (int i = 0; i < 4; ++i) {
+            const uint8_t b = byte();
+            ret = (ret << 7) | (b & 0x7f);
+            if (!(b & 0x80)) {
+                return ret;
+            }
+        }
+        // more than four bytes isn't legal
+        good = false;
+        return ret;
+    }
+
+    void skip(size_t bytes) {
+        if (bytes > remaining()) {
+            good = false;
+            p = end;
+        } else {
+            p += bytes;
+        }
+    }
+
+    bool matches(const char* id) {
+        if (remaining() < 4) {
+            return false;
+        }
+        return std::equal(p, p + 4, reinterpret_cast<const uint8_t*>(id));
+    }
+
+    const uint8_t* p;
+    const uint8_t* const end;
+    bool good = true;
+};
+
+class SmfNote {
+public:
+    static const uint32_t openTick = 0xffffffff;
+
+    uint32_t startTick;
+    uint32_t endTick;
+    int nextOpen;           // next older open note on the same key, or -1
+    uint8_t key;
+    uint8_t channel;
+};
+
+/**
+ * Pairs note-ons with note-offs as the track goes by.
+ * For each key we keep a list of the notes that are still on, newest first.
+ * Like smf::MidiFile::linkNotePairs, a note-off ends the newest note
+ * on that key and channel. That list is almost always one long.
+ */
+class SmfNotePairer {
+public:
+    SmfNotePairer(std::vector<SmfNote>& n) : notes(n) {
+        notes.clear();
+        std::fill(openNotes, openNotes + 128, -1);
+    }
+
+    void noteOn(uint32_t tick, int key, int channel) {
+        SmfNote note;
+        note.startTick = tick;
+        note.endTick = SmfNote::openTick;
+        note.nextOpen = openNotes[key];
+        note.key = uint8_t(key);
+        note.channel = uint8_t(channel);
+        openNotes[key] = int(notes.size());
+        notes.push_back(note);
+    }
+
+    void noteOff(uint32_t tick, int key, int channel) {
+        int prev = -1;
+        for (int index = openNotes[key]; index >= 0; index = notes[index].nextOpen) {
+            SmfNote& note = notes[index];
+            if (note.channel == channel) {
+                if (prev < 0) {
+                    openNotes[key] = note.nextOpen;
+                } else {
+                    notes[prev].nextOpen = note.nextOpen;
+                }
+                note.endTick = tick;
+                return;
+            }
+            prev = index;
+        }
+        // note-off with no note-on is ignored
+    }
+
+    /**
+     * anything still on at the end of the track stops there.
+     */
+    void closeAll(uint32_t tick) {
+        for (int key = 0; key < 128; ++key) {
+            for (int index = openNotes[key]; index >= 0; index = notes[index].nextOpen) {
+                notes[index].endTick = tick;
+            }
+            openNotes[key] = -1;
+        }
+    }
+
+private:
+    std::vector<SmfNote>& notes;
+    int openNotes[128];
+};
+
+/**
+ * Reads one MTrk chunk. Returns false if it's malformed.
+ * endTick is the time of the end of track, or of the last event if there isn't one.
+ */
+bool readTrack(SmfInput& in, std::vector<SmfNote>& notes, uint32_t& endTick) {
+    SmfNotePairer pairer(notes);
+    uint32_t tick = 0;
+    uint8_t runningStatus = 0;
+    while (!in.atEnd()) {
+        tick += in.varLen();
+        uint8_t status = in.peek();
+        if (status & 0x80) {
+            in.byte();
+        } else {
+            status = runningStatus;
+            if (!status) {
+                return false;
+            }
+        }
+
+        if (status == 0xff) {
+            const uint8_t type = in.byte();
+            in.skip(in.varLen());
+            if (type == 0x2f) {
+                break;  // end of track
+            }
+        } else if (status == 0xf0 || status == 0xf7) {
+            in.skip(in.varLen());  // sysex
+        } else if (status > 0xf0) {
+            return false;  // system common and real time can't be in a file
+        } else {
+            runningStatus = status;
+            const int kind = status & 0xf0;
+            const int channel = status & 0x0f;
+            const int data1 = in.byte() & 0x7f;
+            if (kind == 0xc0 || kind == 0xd0) {
+                continue;  // only one data byte
+            }
+            const int data2 = in.byte() & 0x7f;
+            if (kind == 0x90 && data2 > 0) {
+                pairer.noteOn(tick, data1, channel);
+            } else if (kind == 0x80 || kind == 0x90) {
+                pairer.noteOff(tick, data1, channel);
+            }
+        }
+        if (!in.good) {
+            return false;
+        }
+    }
+    pairer.closeAll(tick);
+    endTick = tick;
+    return in.good;
+}
+
+MidiTrackPtr makeTrack(const std::vector<SmfNote>& notes, uint32_t endTick, int ppq, std::shared_ptr<MidiLock> lock) {
+    // same conversions as MidiFileProxy::getFirst, so we get the same times
+    const double dppq = ppq;
+    std::vector<MidiEventPtr> events;
+    events.reserve(notes.size() + 1);
+    for (const SmfNote& note : notes) {
+        if (note.endTick <= note.startTick) {
+            continue;  // no duration, so we can't play it
+        }
+        MidiNoteEventPtr event = std::make_shared<MidiNoteEvent>();
+        event->startTime = float(double(note.startTick) / dppq);
+        event->duration = float(double(note.endTick - note.startTick) / dppq);
+        event->pitchCV = PitchUtils::midiToCV(note.key);
+        events.push_back(event);
+    }
+
+    // quantize end point to 1/16 note, because that's what we support
+    const float start = float(double(endTick) / dppq);
+    float startq = (float)TimeUtils::quantize(start, .25f, false);
+    if (startq < start) {
+        startq += .25f;
+    }
+    MidiEndEventPtr end = std::make_shared<MidiEndEvent>();
+    end->startTime = startq;
+    events.push_back(end);
+
+    MidiLocker l(lock);
+    MidiTrackPtr track = std::make_shared<MidiTrack>(lock);
+    track->insertSortedEvents(events);
+    return track;
+}
+
+}  // namespace
+
+SmfReader::Status SmfReader::read(const std::string& filename, std::shared_ptr<MidiLock> lock, MidiTrackPtr& track) {
+    FILE* fp = fopen(filename.c_str(), "rb");
+    if (!fp) {
+        return Status::cantOpen;
+    }
+    std::vector<uint8_t> data;
+    fseek(fp, 0, SEEK_END);
+    const long size = ftell(fp);
+    fseek(fp, 0, SEEK_SET);
+    if (size > 0) {
+        data.resize(size_t(size));
+        if (fread(data.data(), 1, data.size(), fp) != data.size()) {
+            data.clear();
+        }
+    }
+    fclose(fp);
+    if (data.empty()) {
+        return Status::notSupported;
+    }
+    return read(data.data(), data.size(), lock, track);
+}
+
+SmfReader::Status SmfReader::read(const uint8_t* data, size_t size, std::shared_ptr<MidiLock> lock, MidiTrackPtr& track) {
+    track.reset();
+    SmfInput in(data, data + size);
+    if (!in.matches("MThd")) {
+        return Status::notSupported;
+    }
+    in.skip(4);
+    const uint32_t headerLength = in.bigEndian(4);
+    in.bigEndian(2);  // format. we treat 0 and 1 the same
+    const int numTracks = int(in.bigEndian(2));
+    const int division = int(in.bigEndian(2));
+    if (!in.good || headerLength < 6 || (division & 0x8000) || division == 0) {
+        // SMPTE time has the top bit set
+        return Status::notSupported;
+    }
+    in.skip(headerLength - 6);
+
+    std::vector<SmfNote> notes;
+    for (int trackNum = 0; trackNum < numTracks && !in.atEnd();) {
+        const bool isTrack = in.matches("MTrk");
+        in.skip(4);
+        const uint32_t length = in.bigEndian(4);
+        if (!in.good || length > in.remaining()) {
+            return Status::notSupported;
+        }
+        if (!isTrack) {
+            in.skip(length);  // unknown chunks are allowed, and ignored
+            continue;
+        }
+
+        SmfInput trackInput(in.p, in.p + length);
+        in.skip(length);
+        ++trackNum;
+
+        uint32_t endTick = 0;
+        if (!readTrack(trackInput, notes, endTick)) {
+            return Status::notSupported;
+        }
+        if (!notes.empty()) {
+            track = makeTrack(notes, endTick, division, lock);
+            return Status::ok;
+        }
+    }
+    return Status::noNotes;
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <memory>
+#include <string>
+
+class MidiLock;
+class MidiTrack;
+
+using MidiTrackPtr = std::shared_ptr<MidiTrack>;
+
+/**
+ * Fast standard MIDI file reader.
+ *
+ * smf::MidiFile builds a full event list for every track, then we
+ * convert that into notes one at a time. For big files that takes seconds.
+ * This reads the file in one pass, straight into notes:
+ *      Note-ons and note-offs are paired up as they go by, with a table
+ *          of 128 open notes, one per key.
+ *      Notes come out in start time order, so the track is built
+ *          with one bulk insert.
+ *
+ * It gives the same track as MidiFileProxy::getFirst: the notes from the first
+ * track that has any, with the end quantized up to a sixteenth note.
+ * It does not do SMPTE time, or RIFF wrapped files - those still
+ * go through smf::MidiFile.
+ */
+class SmfReader {
+public:
+    enum class Status {
+        ok,
+        noNotes,        // file is fine, but there's nothing to play
+        cantOpen,
+        notSupported    // not a file we can read - malformed, or a format we don't do
+    };
+
+    static Status read(const std::string& filename, std::shared_ptr<MidiLock> lock, MidiTrackPtr& track);
+    static Status read(const uint8_t* data, size_t size, std::shared_ptr<MidiLock> lock, MidiTrackPtr& track);
+};
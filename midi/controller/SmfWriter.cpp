@@ -0,0 +1,147 @@
+#include "SmfWriter.h"
+
+#include "MidiTrack.h"
+#include "PitchUtils.h"
+
+#include <assert.h>
+#include <stdio.h>
+#include <algorithm>
+#include <functional>
+#include <queue>
+
+namespace {
+
+class SmfOutput {
+public:
+    SmfOutput(std::vector<uint8_t>& d) : data(d) {
+    }
+
+    void bigEndian(uint32_t value, int bytes) {
+        for (int i = bytes - 1; i >= 0; --i) {
+            data.push_back(uint8_t(value >> (8 * i)));
+        }
+    }
+
+    void varLen(uint32_t value) {
+        uint8_t buffer[5];
+        int count = 0;
+        do {
+            buffer[count++] = uint8_t(value & 0x7f);
+            value >>= 7;
+        } while (value);
+        while (count > 1) {
+            data.push_back(buffer[--count] | 0x80);
+        }
+        data.push_back(buffer[0]);
+    }
+
+    void event(uint32_t tick, uint8_t status, uint8_t data1, uint8_t data2) {
+        varLen(tick - lastTick);
+        lastTick = tick;
+        if (status != runningStatus) {
+            data.push_back(status);
+            runningStatus = status;
+        }
+        data.push_back(data1);
+        data.push_back(data2);
+    }
+
+    void endOfTrack(uint32_t tick) {
+        varLen(tick - lastTick);
+        lastTick = tick;
+        data.push_back(0xff);
+        data.push_back(0x2f);
+        data.push_back(0);
+    }
+
+    uint32_t getLastTick() const {
+        return lastTick;
+    }
+
+    std::vector<uint8_t>& data;
+
+private:
+    uint32_t lastTick = 0;
+    uint8_t runningStatus = 0;
+};
+
+// note-off time and key, earliest first
+using SmfPendingOff = std::pair<uint32_t, uint8_t>;
+using SmfOffQueue = std::priority_queue<SmfPendingOff, std::vector<SmfPendingOff>, std::greater<SmfPendingOff>>;
+
+const uint8_t noteOnStatus = 0x90;
+const uint8_t velocity = 0x3f;
+
+/**
+ * Send all the note-offs up to and including time tick.
+ * These go before any note-ons at the same time, so touching
+ * notes on the same key don't cut each other off.
+ */
+void flushNoteOffs(SmfOutput& out, SmfOffQueue& offs, uint32_t tick) {
+    while (!offs.empty() && offs.top().first <= tick) {
+        out.event(offs.top().first, noteOnStatus, offs.top().second, 0);
+        offs.pop();
+    }
+}
+
+}  // namespace
+
+void SmfWriter::write(MidiTrackPtr track, std::vector<uint8_t>& data) {
+    data.clear();
+    SmfOutput out(data);
+
+    out.data.insert(out.data.end(), {'M', 'T', 'h', 'd'});
+    out.bigEndian(6, 4);
+    out.bigEndian(0, 2);  // format 0
+    out.bigEndian(1, 2);  // one track
+    out.bigEndian(ppq, 2);
+
+    out.data.insert(out.data.end(), {'M', 'T', 'r', 'k'});
+    const size_t lengthPosition = out.data.size();
+    out.bigEndian(0, 4);  // fill in later
+    const size_t trackStart = out.data.size();
+
+    SmfOffQueue offs;
+    uint32_t endTick = 0;
+    for (auto it : *track) {
+        MidiEventPtr evt = it.second;
+        MidiNoteEventPtr note = safe_cast<MidiNoteEvent>(evt);
+        MidiEndEventPtr end = safe_cast<MidiEndEvent>(evt);
+        if (note) {
+            const int startTick = std::max(0, int(note->startTime * ppq));
+            const int duration = int(note->duration * ppq);
+            const int key = PitchUtils::pitchCVToMidi(note->pitchCV);
+            if (key < 0 || key > 127) {
+                fprintf(stderr, "pitch outside MIDI range, not writing to file");
+            } else {
+                flushNoteOffs(out, offs, startTick);
+                out.event(startTick, noteOnStatus, uint8_t(key), velocity);
+                offs.push(SmfPendingOff(startTick + std::max(duration, 1), uint8_t(key)));
+            }
+        } else if (end) {
+            endTick = uint32_t(std::max(0, int(end->startTime * ppq)));
+        }
+    }
+
+    // Notes that hang over the end still need their note-offs,
+    // and the end of track has to be the last thing.
+    flushNoteOffs(out, offs, 0xffffffff);
+    out.endOfTrack(std::max(endTick, out.getLastTick()));
+
+    const uint32_t trackLength = uint32_t(out.data.size() - trackStart);
+    for (int i = 0; i < 4; ++i) {
+        out.data[lengthPosition + i] = uint8_t(trackLength >> (8 * (3 - i)));
+    }
+}
+
+bool SmfWriter::write(MidiTrackPtr track, const std::string& filePath) {
+    std::vector<uint8_t> data;
+    write(track, data);
+
+    FILE* fp = fopen(filePath.c_str(), "wb");
+    if (!fp) {
+        return false;
+    }
+    const bool ok = fwrite(data.data(), 1, data.size(), fp) == data.size();
+    return (fclose(fp) == 0) && ok;
+}
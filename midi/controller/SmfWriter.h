@@ -0,0 +1,26 @@
+#pragma once
+
+#include <stdint.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+class MidiTrack;
+
+using MidiTrackPtr = std::shared_ptr<MidiTrack>;
+
+/**
+ * Writes a track as a type 0 standard MIDI file, 480 ticks per quarter note.
+ *
+ * Since the track is already sorted by start time, the note-ons come out
+ * in order. The note-offs are merged in from a queue as we go, so there
+ * is no big sort at the end. Note-offs are sent as note-on with
+ * velocity zero, so the whole track uses running status.
+ */
+class SmfWriter {
+public:
+    static const int ppq = 480;
+
+    static bool write(MidiTrackPtr track, const std::string& filePath);
+    static void write(MidiTrackPtr track, std::vector<uint8_t>& data);
+};
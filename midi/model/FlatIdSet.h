@@ -0,0 +1,146 @@
+#pragma once
+
+#include <assert.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <algorithm>
+#include <vector>
+
+/**
+ * A set of non-zero ids, as a flat open addressed hash table.
+ *
+ * Everything is in one array, so there is no allocation per id,
+ * and a lookup is usually a single probe. Zero marks an empty slot.
+ * Uses linear probing, and erase shifts the following ids back
+ * instead of leaving tombstones, so lookups stay short after lots of erases.
+ */
+class FlatIdSet
+{
+public:
+    using id_t = uint32_t;
+
+    size_t size() const
+    {
+        return count;
+    }
+    bool empty() const
+    {
+        return count == 0;
+    }
+
+    void clear()
+    {
+        std::fill(slots.begin(), slots.end(), 0);
+        count = 0;
+    }
+
+    /**
+     * make room for n ids without growing
+     */
+    void reserve(size_t n)
+    {
+        size_t needed = minSlots;
+        while (needed < 2 * n) {
+            needed *= 2;
+        }
+        if (needed > slots.size()) {
+            rehash(needed);
+        }
+    }
+
+    bool contains(id_t id) const
+    {
+        assert(id != 0);
+        if (slots.empty()) {
+            return false;
+        }
+        for (size_t i = home(id);; i = (i + 1) & mask) {
+            if (slots[i] == id) {
+                return true;
+            }
+            if (slots[i] == 0) {
+                return false;
+            }
+        }
+    }
+
+    /**
+     * returns false if it was already there
+     */
+    bool insert(id_t id)
+    {
+        assert(id != 0);
+        if (2 * (count + 1) > slots.size()) {
+            rehash(slots.empty() ? minSlots : 2 * slots.size());
+        }
+        for (size_t i = home(id);; i = (i + 1) & mask) {
+            if (slots[i] == id) {
+                return false;
+            }
+            if (slots[i] == 0) {
+                slots[i] = id;
+                ++count;
+                return true;
+            }
+        }
+    }
+
+    /**
+     * returns false if it wasn't there
+     */
+    bool erase(id_t id)
+    {
+        assert(id != 0);
+        if (slots.empty()) {
+            return false;
+        }
+        size_t i = home(id);
+        while (slots[i] != id) {
+            if (slots[i] == 0) {
+                return false;
+            }
+            i = (i + 1) & mask;
+        }
+
+        // Move back any following ids that would not be found with a hole here.
+        for (size_t j = (i + 1) & mask; slots[j] != 0; j = (j + 1) & mask) {
+            const size_t h = home(slots[j]);
+            // can slots[j] move to i? Only if its home is not in (i, j]
+            const bool homeBetween = (i <= j) ? (i < h && h <= j) : (i < h || h <= j);
+            if (!homeBetween) {
+                slots[i] = slots[j];
+                i = j;
+            }
+        }
+        slots[i] = 0;
+        --count;
+        return true;
+    }
+
+private:
+    static const size_t minSlots = 16;
+
+    std::vector<id_t> slots;
+    size_t mask = 0;
+    size_t count = 0;
+
+    size_t home(id_t id) const
+    {
+        // Ids are mostly sequential. Multiplying by a big odd number spreads them out.
+        return size_t(id * 2654435769u) & mask;
+    }
+
+    void rehash(size_t newSize)
+    {
+        std::vector<id_t> old;
+        old.swap(slots);
+        slots.resize(newSize, 0);
+        mask = newSize - 1;
+        count = 0;
+        for (id_t id : old) {
+            if (id) {
+                insert(id);
+            }
+        }
+    }
+};
@@ -5,6 +5,8 @@
 #include "MidiTrack.h"
 
 #include <assert.h>
+#include <algorithm>
+
 extern int _mdb;
 MidiSelectionModel::MidiSelectionModel(IMidiPlayerAuditionHostPtr aud) : auditionHost(aud)
 {
@@ -56,10 +58,47 @@ void MidiSelectionModel::extendSelection(std::shared_ptr<MidiEvent> event)
     add(event);
 }
 
+void MidiSelectionModel::extendSelection(const std::vector<MidiEventPtr>& events)
+{
+    allIsSelected = false;
+
+    // put the new ones on the end, sort them, then merge them in.
+    const size_t oldSize = selection.size();
+    for (const MidiEventPtr& evt : events) {
+        if (!ids.contains(evt->getId())) {
+            selection.push_back(evt);
+        }
+    }
+    if (selection.size() == oldSize) {
+        return;
+    }
+    const auto middle = selection.begin() + oldSize;
+    const CompareEventPtrs less;
+    std::stable_sort(middle, selection.end(), less);
+    std::inplace_merge(selection.begin(), middle, selection.end(), less);
+
+    // Merge is stable, so if a new event is == an old one, the old one comes first and stays.
+    auto last = std::unique(selection.begin(), selection.end(), [less](const MidiEventPtr& a, const MidiEventPtr& b) {
+        return !less(a, b);
+    });
+    selection.erase(last, selection.end());
+
+    // what's left that we don't know about is new.
+    ids.reserve(selection.size());
+    for (const MidiEventPtr& evt : selection) {
+        if (ids.insert(evt->getId())) {
+            MidiNoteEventPtr note = safe_cast<MidiNoteEvent>(evt);
+            if (note && !auditionSuppressed) {
+                auditionHost->auditionNote(note->pitchCV);
+            }
+        }
+    }
+}
+
 void MidiSelectionModel::addToSelection(std::shared_ptr<MidiEvent> event, bool keepExisting)
 {
     allIsSelected = false;
-    auto it = selection.find(event);
+    auto it = findDeep(event);
     if (it != selection.end()) {
         // if note is already in, then don't clear and re-add
         return;
@@ -67,19 +106,33 @@ void MidiSelectionModel::addToSelection(std::shared_ptr<MidiEvent> event, bool k
 
     if (!keepExisting) {
         selection.clear();
+        ids.clear();
     }
     add(event);
 }
 
 void MidiSelectionModel::removeFromSelection(std::shared_ptr<MidiEvent> event)
 {
-    auto it = selection.find(event);
+    auto it = findDeep(event);
     assert(it != selection.end());
     if (it != selection.end()) {
+        ids.erase((*it)->getId());
         selection.erase(it);
     }
 }
 
+MidiSelectionModel::container::iterator MidiSelectionModel::findDeep(const MidiEventPtr& event)
+{
+    auto it = std::lower_bound(selection.begin(), selection.end(), event, CompareEventPtrs());
+    return (it != selection.end() && !CompareEventPtrs()(event, *it)) ? it : selection.end();
+}
+
+MidiSelectionModel::container::const_iterator MidiSelectionModel::findDeep(const MidiEventPtr& event) const
+{
+    auto it = std::lower_bound(selection.begin(), selection.end(), event, CompareEventPtrs());
+    return (it != selection.end() && !CompareEventPtrs()(event, *it)) ? it : selection.end();
+}
+
 MidiSelectionModel::const_iterator MidiSelectionModel::begin() const
 {
     return selection.begin();
@@ -104,13 +157,17 @@ MidiSelectionModel::const_reverse_iterator MidiSelectionModel::rend() const
 void MidiSelectionModel::clear()
 {
     selection.clear();
+    ids.clear();
     allIsSelected = false;
 }
 
 void MidiSelectionModel::add(MidiEventPtr evt)
 {
-    auto found = selection.find(evt);
-    if (found != selection.end()) {
+    if (ids.contains(evt->getId())) {
+        return;
+    }
+    auto it = std::lower_bound(selection.begin(), selection.end(), evt, CompareEventPtrs());
+    if (it != selection.end() && !CompareEventPtrs()(evt, *it)) {
         // if the event is already there, don't do anything.
         return;
     }
@@ -119,14 +176,14 @@ void MidiSelectionModel::add(MidiEventPtr evt)
     if (note && !auditionSuppressed) {
         auditionHost->auditionNote(note->pitchCV);
     }
-    selection.insert(evt);
+    selection.insert(it, evt);
+    ids.insert(evt->getId());
 }
 
 bool MidiSelectionModel::isSelected(MidiEventPtr evt) const
 {
     assert(evt);
-    auto it = std::find(selection.begin(), selection.end(), evt);
-    return it != selection.end();
+    return ids.contains(evt->getId());
 }
 
 MidiEventPtr MidiSelectionModel::getLast()
@@ -166,30 +223,26 @@ MidiSelectionModelPtr MidiSelectionModel::clone() const
     // Clones ones never need to drive audition
     auto nullAudition = std::make_shared<NullAudition>();
     MidiSelectionModelPtr ret = std::make_shared<MidiSelectionModel>(nullAudition);
+
+    // clones are == to the originals, so they are already in order.
+    ret->selection.reserve(selection.size());
+    ret->ids.reserve(selection.size());
     for (auto it : selection) {
         MidiEventPtr clonedEvent = it->clone();
-        ret->add(clonedEvent);
+        ret->selection.push_back(clonedEvent);
+        ret->ids.insert(clonedEvent->getId());
     }
     return ret;
 }
 
 bool MidiSelectionModel::isSelectedDeep(MidiEventPtr evt) const
 {
-    auto it = std::find_if(begin(), end(), [evt](MidiEventPtr ev) {
-        return *ev == *evt;
-    });
-
-    return it != end();
+    return findDeep(evt) != end();
 }
 
-std::vector<MidiEventPtr> MidiSelectionModel::asVector() const
+const std::vector<MidiEventPtr>& MidiSelectionModel::asVector() const
 {
-    std::vector<MidiEventPtr> ret;
-    for (auto it : selection) {
-        MidiEventPtr event = it;
-        ret.push_back(event);
-    }
-    return ret;
+    return selection;
 }
 
 IMidiPlayerAuditionHostPtr MidiSelectionModel::_testGetAudition()
@@ -205,11 +258,14 @@ bool MidiSelectionModel::isAllSelected() const
  void MidiSelectionModel::selectAll(MidiTrackPtr track)
  {
     clear();
+    std::vector<MidiEventPtr> events;
+    events.reserve(track->size());
     for (auto it : *track) {
         MidiEventPtr orig = it.second;
         if (orig->type != MidiEvent::Type::End) {
-            extendSelection(orig);
+            events.push_back(orig);
         }
     }
+    extendSelection(events);
     allIsSelected = true;
  }
@@ -1,8 +1,9 @@
 #pragma once
 #include <memory>
-#include <set>
 #include <vector>
 
+#include "FlatIdSet.h"
+
 class MidiEvent;
 class MidiTrack;
 class MidiSelectionModel;
@@ -15,6 +16,11 @@ using MidiTrackPtr = std::shared_ptr<MidiTrack>;
 
 /**
  * Central manager for tracking selections in the MidiSong being edited.
+ *
+ * The selected events are kept in a vector, sorted the same as the events are (operator <).
+ * Like a set, two events that are == can't both be selected.
+ * Alongside that is a hash set of the event ids, so isSelected is O(1).
+ * Adding events in bulk sorts and merges once, instead of inserting them one at a time.
  */
 class MidiSelectionModel
 {
@@ -28,6 +34,12 @@ public:
      */
     void select(MidiEventPtr);
     void extendSelection(MidiEventPtr);
+
+    /**
+     * Add a bunch of events at once. They don't need to be sorted.
+     * O(n) for the merge, plus sorting the new ones.
+     */
+    void extendSelection(const std::vector<MidiEventPtr>&);
     void addToSelection(MidiEventPtr, bool keepExisting);
     void removeFromSelection(MidiEventPtr);
 
@@ -48,7 +60,7 @@ public:
         bool operator() (const MidiEventPtr& lhs, const MidiEventPtr& rhs) const;
     };
 
-    using container = std::set<MidiEventPtr, CompareEventPtrs>;
+    using container = std::vector<MidiEventPtr>;
     using const_iterator = container::const_iterator;
     using const_reverse_iterator = container::const_reverse_iterator;
 
@@ -70,9 +82,9 @@ public:
     MidiSelectionModelPtr clone() const;
 
     /**
-     * retrieve all the events in order into a vector
+     * all the events in order
      */
-    std::vector<MidiEventPtr> asVector() const;
+    const std::vector<MidiEventPtr>& asVector() const;
 
     MidiEventPtr getLast();
 
@@ -84,7 +96,7 @@ public:
 
     /** Returns true is there is an object in selection equivalent
      * to 'event'. i.e.  selection contains entry == *event.
-     * O(n), where n is the number of items in selection
+     * O(log n), where n is the number of items in selection
      */
     bool isSelectedDeep(MidiEventPtr event) const;
 
@@ -93,8 +105,11 @@ public:
 private:
 
     void add(MidiEventPtr);
+    container::iterator findDeep(const MidiEventPtr&);
+    container::const_iterator findDeep(const MidiEventPtr&) const;
 
     container selection;
+    FlatIdSet ids;
 
     IMidiPlayerAuditionHostPtr auditionHost;
     bool auditionSuppressed = false;
@@ -69,7 +69,24 @@ void MidiTrack::insertEvent(MidiEventPtr evIn)
 {
     assert(lock);
     assert(lock->locked());
-    events.insert(std::pair<MidiEvent::time_t, MidiEventPtr>(evIn->startTime, evIn));
+    events.insert(container::value_type(evIn->startTime, evIn));
+}
+
+void MidiTrack::insertSortedEvents(const std::vector<MidiEventPtr>& newEvents)
+{
+    assert(lock);
+    assert(lock->locked());
+    for (const MidiEventPtr& ev : newEvents) {
+        assert(events.empty() || ev->startTime >= events.rbegin()->first);
+        events.emplace_hint(events.end(), ev->startTime, ev);
+    }
+}
+
+void MidiTrack::restoreSnapshot(const container& snapshot)
+{
+    assert(lock);
+    assert(lock->locked());
+    events = snapshot;
 }
 
 float MidiTrack::getLength() const
@@ -193,6 +210,16 @@ MidiTrack::note_iterator_pair MidiTrack::timeRangeNotes(MidiEvent::time_t start,
         note_iterator(rawIterators.second, rawIterators.second, lambda));
 }
 
+void MidiTrack::getNotesOverlapping(MidiEvent::time_t start, MidiEvent::time_t end, std::vector<MidiNoteEventPtr>& notes) const
+{
+    notes.clear();
+    events.forEachOverlapping(start, end, [&notes](const container::value_type& value) {
+        if (value.second->type == MidiEvent::Type::Note) {
+            notes.push_back(std::static_pointer_cast<MidiNoteEvent>(value.second));
+        }
+    });
+}
+
 void MidiTrack::insertEnd(MidiEvent::time_t time)
 {
     assert(lock);
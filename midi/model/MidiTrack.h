@@ -5,6 +5,7 @@
 #include <memory>
 
 #include "FilteredIterator.h"
+#include "PersistentMultiMap.h"
 #include "SqCommand.h"
 
 #include "SqMidiEvent.h"
@@ -31,6 +32,14 @@ public:
     void assertValid() const;
 
     void insertEvent(MidiEventPtr ev);
+
+    /**
+     * Bulk insert for building a whole track at once (like loading a file).
+     * The events must be in time order, and none of them may be
+     * earlier than the last event already in the track, so each one
+     * just goes on the end.
+     */
+    void insertSortedEvents(const std::vector<MidiEventPtr>& events);
     void deleteEvent(const MidiEvent&);
     void insertEnd(MidiEvent::time_t time);
 
@@ -46,7 +55,23 @@ public:
      */
     std::vector<MidiEventPtr> _testGetVector() const;
 
-    using container = std::multimap<MidiEvent::time_t, MidiEventPtr>;
+    /**
+     * For the interval index: notes cover their whole duration,
+     * everything else is just a point.
+     */
+    class EventExtent
+    {
+    public:
+        static MidiEvent::time_t end(const std::pair<MidiEvent::time_t, MidiEventPtr>& value)
+        {
+            const MidiEvent* ev = value.second.get();
+            return (ev->type == MidiEvent::Type::Note) ?
+                value.first + static_cast<const MidiNoteEvent*>(ev)->duration :
+                value.first;
+        }
+    };
+
+    using container = PersistentMultiMap<MidiEvent::time_t, MidiEventPtr, EventExtent>;
     using iterator = container::iterator;
     using reverse_iterator = container::reverse_iterator;
     using const_iterator = container::const_iterator;
@@ -57,6 +82,14 @@ public:
     using note_iterator_pair = std::pair<note_iterator, note_iterator>;
     note_iterator_pair timeRangeNotes(MidiEvent::time_t start, MidiEvent::time_t end) const;
 
+    /**
+     * Finds all the notes that are playing at any time from start to end,
+     * including long ones that started before start. A note that ends
+     * right at start isn't playing then, so it's not included.
+     * Uses the track's interval index, so it's O(log n + k).
+     */
+    void getNotesOverlapping(MidiEvent::time_t start, MidiEvent::time_t end, std::vector<MidiNoteEventPtr>& notes) const;
+
     /**
      * finds an event that satisfies == and returns a pointer to it
      */
@@ -71,6 +104,23 @@ public:
 
     void setLength(float newTrackLength);
 
+    /**
+     * All the events in the track, as they are now.
+     * This is O(1) - the snapshot shares its storage with the track.
+     * Later edits to the track only copy the parts of it they touch.
+     */
+    container getSnapshot() const
+    {
+        return events;
+    }
+
+    /**
+     * Puts back the events from a snapshot, also O(1).
+     * Since the events themselves are shared, they must not
+     * have been changed in place since the snapshot was taken.
+     */
+    void restoreSnapshot(const container&);
+
    
     /**
      * Returns pair of iterators for all events  start <= t <= end
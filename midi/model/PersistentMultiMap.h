@@ -0,0 +1,598 @@
+#pragma once
+
+#include <assert.h>
+#include <stddef.h>
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <utility>
+#include <vector>
+
+/**
+ * Default extent for PersistentMultiMap: every element is just a point at its key.
+ */
+template <typename Key, typename T>
+class PersistentMultiMapPoints
+{
+public:
+    static Key end(const std::pair<Key, T>& value)
+    {
+        return value.first;
+    }
+};
+
+/**
+ * A sorted multimap that is cheap to copy.
+ *
+ * It's a B+ tree of shared, reference counted nodes. Copying the map just
+ * copies the root pointer, so the copy shares everything with the original.
+ * When one of them is edited, only the nodes on the path from the root to
+ * the changed leaf get copied - the rest stay shared. So an edit costs
+ * O(log n) no matter how many copies are around, and holding on to an old
+ * copy only costs memory for the parts that have changed since.
+ *
+ * MidiTrack uses this so undo can keep whole tracks instead of
+ * lists of changes.
+ *
+ * It has the parts of the std::multimap interface that MidiTrack uses, with these differences:
+ *      Elements are const. There is no non-const iterator.
+ *      Like std::vector, insert and erase invalidate all iterators,
+ *          except the one they return.
+ *      Iterators are bigger, and a little slower to increment.
+ *
+ * Each element can also cover a range of keys, from its key to Extent::end(element).
+ * Every node remembers the biggest end under it, which makes it an interval tree:
+ * forEachOverlapping finds the elements that overlap a range without looking at
+ * the ones that ended before it. By default every element is just a point.
+ */
+template <typename Key, typename T, typename Extent = PersistentMultiMapPoints<Key, T>>
+class PersistentMultiMap
+{
+public:
+    using key_type = Key;
+    using mapped_type = T;
+    using value_type = std::pair<Key, T>;
+    using size_type = size_t;
+
+    class const_iterator;
+    using iterator = const_iterator;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+    using reverse_iterator = const_reverse_iterator;
+
+    size_type size() const
+    {
+        return root ? root->count : 0;
+    }
+    bool empty() const
+    {
+        return !root;
+    }
+    void clear()
+    {
+        root.reset();
+    }
+
+    const_iterator begin() const;
+    const_iterator end() const
+    {
+        return const_iterator(root.get());
+    }
+    const_reverse_iterator rbegin() const
+    {
+        return const_reverse_iterator(end());
+    }
+    const_reverse_iterator rend() const
+    {
+        return const_reverse_iterator(begin());
+    }
+
+    const_iterator lower_bound(const Key& key) const
+    {
+        return bound(key, false);
+    }
+    const_iterator upper_bound(const Key& key) const
+    {
+        return bound(key, true);
+    }
+    std::pair<const_iterator, const_iterator> equal_range(const Key& key) const
+    {
+        return std::make_pair(lower_bound(key), upper_bound(key));
+    }
+
+    /**
+     * Like multimap, goes after any other elements with the same key.
+     */
+    const_iterator insert(const value_type&);
+
+    /**
+     * The hint is ignored - there's nothing to gain from it.
+     */
+    const_iterator emplace_hint(const_iterator, const Key& key, const T& value)
+    {
+        return insert(value_type(key, value));
+    }
+
+    /**
+     * returns the element after the one erased
+     */
+    const_iterator erase(const_iterator);
+
+    /**
+     * Calls f(value) for every element with key <= hi and Extent::end > lo, in order.
+     * Sub-trees that all end before lo are skipped, so this is about O(log n + k).
+     */
+    template <typename F>
+    void forEachOverlapping(const Key& lo, const Key& hi, F f) const
+    {
+        if (root) {
+            overlapping(root.get(), lo, hi, f);
+        }
+    }
+
+    /**
+     * true if both maps are the same shared tree - no edits since one was copied from the other.
+     */
+    bool isSameTree(const PersistentMultiMap& other) const
+    {
+        return root == other.root;
+    }
+
+private:
+    static const int maxNodeSize = 32;
+    static const int minNodeSize = maxNodeSize / 4;
+    static const int maxDepth = 16;
+
+    class Node
+    {
+    public:
+        bool isLeaf = true;
+        size_type count = 0;    // elements in this sub-tree
+        Key maxKey = Key();     // key of the last element in this sub-tree
+        Key maxEnd = Key();     // biggest Extent::end in this sub-tree
+        std::vector<value_type> values;                 // if leaf
+        std::vector<std::shared_ptr<Node>> children;    // if not leaf
+    };
+    using NodePtr = std::shared_ptr<Node>;
+
+    NodePtr root;
+
+    static size_t width(const Node* node)
+    {
+        return node->isLeaf ? node->values.size() : node->children.size();
+    }
+
+    /**
+     * Returns a node we can change. If anyone else might
+     * be using it, copy it first.
+     */
+    static Node* mutableNode(NodePtr& node)
+    {
+        if (node.use_count() != 1) {
+            node = std::make_shared<Node>(*node);
+        }
+        return node.get();
+    }
+
+    static void refresh(Node*);
+    static NodePtr split(Node*);
+    static NodePtr insert(Node*, const value_type&, size_type& rank);
+    static void erase(Node*, size_type rank);
+    static void rebalance(Node*, size_t childIndex);
+
+    template <typename F>
+    static bool overlapping(const Node*, const Key& lo, const Key& hi, F& f);
+
+    const_iterator bound(const Key&, bool upper) const;
+    const_iterator iteratorAt(size_type rank) const;
+};
+
+template <typename Key, typename T, typename Extent>
+class PersistentMultiMap<Key, T, Extent>::const_iterator
+{
+public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = typename PersistentMultiMap<Key, T, Extent>::value_type;
+    using difference_type = ptrdiff_t;
+    using pointer = const value_type*;
+    using reference = const value_type&;
+
+    const_iterator() = default;
+
+    reference operator*() const
+    {
+        assert(depth > 0);
+        return path[depth - 1].node->values[path[depth - 1].index];
+    }
+    pointer operator->() const
+    {
+        return &**this;
+    }
+
+    const_iterator& operator++();
+    const_iterator& operator--();
+    const_iterator operator++(int)
+    {
+        const_iterator ret = *this;
+        ++*this;
+        return ret;
+    }
+    const_iterator operator--(int)
+    {
+        const_iterator ret = *this;
+        --*this;
+        return ret;
+    }
+
+    bool operator==(const const_iterator& other) const
+    {
+        if (depth == 0 || other.depth == 0) {
+            return depth == other.depth;
+        }
+        return path[depth - 1].node == other.path[other.depth - 1].node &&
+            path[depth - 1].index == other.path[other.depth - 1].index;
+    }
+    bool operator!=(const const_iterator& other) const
+    {
+        return !(*this == other);
+    }
+
+private:
+    friend class PersistentMultiMap<Key, T, Extent>;
+
+    class Step
+    {
+    public:
+        const Node* node;
+        size_t index;
+    };
+
+    // the root is needed to step back from end()
+    const Node* root = nullptr;
+    Step path[maxDepth];
+    int depth = 0;      // zero is end()
+
+    const_iterator(const Node* r) : root(r)
+    {
+    }
+
+    void push(const Node* node, size_t index)
+    {
+        assert(depth < maxDepth);
+        path[depth].node = node;
+        path[depth].index = index;
+        ++depth;
+    }
+
+    void descendFirst(const Node* node)
+    {
+        for (;;) {
+            push(node, 0);
+            if (node->isLeaf) {
+                return;
+            }
+            node = node->children.front().get();
+        }
+    }
+
+    void descendLast(const Node* node)
+    {
+        for (;;) {
+            const size_t last = width(node) - 1;
+            push(node, last);
+            if (node->isLeaf) {
+                return;
+            }
+            node = node->children[last].get();
+        }
+    }
+
+    size_type rank() const
+    {
+        size_type ret = 0;
+        for (int level = 0; level < depth - 1; ++level) {
+            const Node* node = path[level].node;
+            for (size_t i = 0; i < path[level].index; ++i) {
+                ret += node->children[i]->count;
+            }
+        }
+        return ret + path[depth - 1].index;
+    }
+};
+
+template <typename Key, typename T, typename Extent>
+inline typename PersistentMultiMap<Key, T, Extent>::const_iterator& PersistentMultiMap<Key, T, Extent>::const_iterator::operator++()
+{
+    assert(depth > 0);
+    Step& leaf = path[depth - 1];
+    if (++leaf.index < leaf.node->values.size()) {
+        return *this;
+    }
+    // go up until we can go right, then all the way down on the left
+    for (int level = depth - 2; level >= 0; --level) {
+        Step& step = path[level];
+        if (step.index + 1 < step.node->children.size()) {
+            ++step.index;
+            depth = level + 1;
+            descendFirst(step.node->children[step.index].get());
+            return *this;
+        }
+    }
+    depth = 0;
+    return *this;
+}
+
+template <typename Key, typename T, typename Extent>
+inline typename PersistentMultiMap<Key, T, Extent>::const_iterator& PersistentMultiMap<Key, T, Extent>::const_iterator::operator--()
+{
+    if (depth == 0) {
+        assert(root);
+        descendLast(root);
+        return *this;
+    }
+    Step& leaf = path[depth - 1];
+    if (leaf.index > 0) {
+        --leaf.index;
+        return *this;
+    }
+    for (int level = depth - 2; level >= 0; --level) {
+        Step& step = path[level];
+        if (step.index > 0) {
+            --step.index;
+            depth = level + 1;
+            descendLast(step.node->children[step.index].get());
+            return *this;
+        }
+    }
+    assert(false);      // decremented begin()
+    return *this;
+}
+
+template <typename Key, typename T, typename Extent>
+inline typename PersistentMultiMap<Key, T, Extent>::const_iterator PersistentMultiMap<Key, T, Extent>::begin() const
+{
+    const_iterator ret(root.get());
+    if (root) {
+        ret.descendFirst(root.get());
+    }
+    return ret;
+}
+
+/**
+ * Returns false once it gets past hi, so the caller can stop too.
+ */
+template <typename Key, typename T, typename Extent>
+template <typename F>
+inline bool PersistentMultiMap<Key, T, Extent>::overlapping(const Node* node, const Key& lo, const Key& hi, F& f)
+{
+    if (node->isLeaf) {
+        for (const value_type& value : node->values) {
+            if (hi < value.first) {
+                return false;
+            }
+            if (lo < Extent::end(value)) {
+                f(value);
+            }
+        }
+        return true;
+    }
+    for (const NodePtr& child : node->children) {
+        if (lo < child->maxEnd) {
+            if (!overlapping(child.get(), lo, hi, f)) {
+                return false;
+            }
+        } else if (hi < child->maxKey) {
+            // nothing in here overlaps, and everything after starts too late
+            return false;
+        }
+    }
+    return true;
+}
+
+template <typename Key, typename T, typename Extent>
+inline typename PersistentMultiMap<Key, T, Extent>::const_iterator PersistentMultiMap<Key, T, Extent>::bound(const Key& key, bool upper) const
+{
+    const_iterator ret(root.get());
+    const Node* node = root.get();
+    if (!node || (upper ? !(key < node->maxKey) : (node->maxKey < key))) {
+        return ret;  // everything is before key
+    }
+    for (;;) {
+        if (node->isLeaf) {
+            auto it = upper ?
+                std::upper_bound(node->values.begin(), node->values.end(), key, [](const Key& k, const value_type& v) {
+                    return k < v.first;
+                }) :
+                std::lower_bound(node->values.begin(), node->values.end(), key, [](const value_type& v, const Key& k) {
+                    return v.first < k;
+                });
+            ret.push(node, it - node->values.begin());
+            return ret;
+        }
+        // first child that has anything at or after key.
+        size_t i = 0;
+        while (upper ? !(key < node->children[i]->maxKey) : (node->children[i]->maxKey < key)) {
+            ++i;
+        }
+        ret.push(node, i);
+        node = node->children[i].get();
+    }
+}
+
+template <typename Key, typename T, typename Extent>
+inline typename PersistentMultiMap<Key, T, Extent>::const_iterator PersistentMultiMap<Key, T, Extent>::iteratorAt(size_type rank) const
+{
+    const_iterator ret(root.get());
+    if (rank >= size()) {
+        return ret;
+    }
+    const Node* node = root.get();
+    while (!node->isLeaf) {
+        size_t i = 0;
+        while (rank >= node->children[i]->count) {
+            rank -= node->children[i]->count;
+            ++i;
+        }
+        ret.push(node, i);
+        node = node->children[i].get();
+    }
+    ret.push(node, rank);
+    return ret;
+}
+
+template <typename Key, typename T, typename Extent>
+inline void PersistentMultiMap<Key, T, Extent>::refresh(Node* node)
+{
+    if (node->isLeaf) {
+        node->count = node->values.size();
+        if (!node->values.empty()) {
+            node->maxKey = node->values.back().first;
+            node->maxEnd = Extent::end(node->values.front());
+            for (const value_type& value : node->values) {
+                node->maxEnd = std::max(node->maxEnd, Extent::end(value));
+            }
+        }
+    } else {
+        node->count = 0;
+        for (const NodePtr& child : node->children) {
+            node->count += child->count;
+        }
+        if (!node->children.empty()) {
+            node->maxKey = node->children.back()->maxKey;
+            node->maxEnd = node->children.front()->maxEnd;
+            for (const NodePtr& child : node->children) {
+                node->maxEnd = std::max(node->maxEnd, child->maxEnd);
+            }
+        }
+    }
+}
+
+template <typename Key, typename T, typename Extent>
+inline typename PersistentMultiMap<Key, T, Extent>::NodePtr PersistentMultiMap<Key, T, Extent>::split(Node* node)
+{
+    NodePtr right = std::make_shared<Node>();
+    right->isLeaf = node->isLeaf;
+    const size_t half = width(node) / 2;
+    if (node->isLeaf) {
+        right->values.assign(node->values.begin() + half, node->values.end());
+        node->values.resize(half);
+    } else {
+        right->children.assign(node->children.begin() + half, node->children.end());
+        node->children.resize(half);
+    }
+    refresh(node);
+    refresh(right.get());
+    return right;
+}
+
+/**
+ * Returns the new right half if node had to split.
+ * Adds the position of the new element in this sub-tree to rank.
+ */
+template <typename Key, typename T, typename Extent>
+inline typename PersistentMultiMap<Key, T, Extent>::NodePtr PersistentMultiMap<Key, T, Extent>::insert(Node* node, const value_type& value, size_type& rank)
+{
+    if (node->isLeaf) {
+        auto it = std::upper_bound(node->values.begin(), node->values.end(), value.first, [](const Key& k, const value_type& v) {
+            return k < v.first;
+        });
+        rank += it - node->values.begin();
+        node->values.insert(it, value);
+    } else {
+        // after the last child that has anything at or before key
+        size_t i = 0;
+        const size_t last = node->children.size() - 1;
+        while (i < last && !(value.first < node->children[i]->maxKey)) {
+            rank += node->children[i]->count;
+            ++i;
+        }
+        NodePtr right = insert(mutableNode(node->children[i]), value, rank);
+        if (right) {
+            node->children.insert(node->children.begin() + i + 1, right);
+        }
+    }
+    refresh(node);
+    return (width(node) > maxNodeSize) ? split(node) : nullptr;
+}
+
+template <typename Key, typename T, typename Extent>
+inline typename PersistentMultiMap<Key, T, Extent>::const_iterator PersistentMultiMap<Key, T, Extent>::insert(const value_type& value)
+{
+    if (!root) {
+        root = std::make_shared<Node>();
+    }
+    size_type rank = 0;
+    NodePtr right = insert(mutableNode(root), value, rank);
+    if (right) {
+        NodePtr newRoot = std::make_shared<Node>();
+        newRoot->isLeaf = false;
+        newRoot->children.push_back(root);
+        newRoot->children.push_back(right);
+        refresh(newRoot.get());
+        root = newRoot;
+    }
+    return iteratorAt(rank);
+}
+
+/**
+ * Merge a small child with its neighbor, then split again if that's too big.
+ */
+template <typename Key, typename T, typename Extent>
+inline void PersistentMultiMap<Key, T, Extent>::rebalance(Node* node, size_t childIndex)
+{
+    if (node->children.size() < 2) {
+        return;
+    }
+    const size_t left = (childIndex + 1 < node->children.size()) ? childIndex : childIndex - 1;
+    Node* a = mutableNode(node->children[left]);
+    const Node* b = node->children[left + 1].get();
+    if (a->isLeaf) {
+        a->values.insert(a->values.end(), b->values.begin(), b->values.end());
+    } else {
+        a->children.insert(a->children.end(), b->children.begin(), b->children.end());
+    }
+    refresh(a);
+    if (width(a) > maxNodeSize) {
+        node->children[left + 1] = split(a);
+    } else {
+        node->children.erase(node->children.begin() + left + 1);
+    }
+}
+
+template <typename Key, typename T, typename Extent>
+inline void PersistentMultiMap<Key, T, Extent>::erase(Node* node, size_type rank)
+{
+    if (node->isLeaf) {
+        node->values.erase(node->values.begin() + rank);
+    } else {
+        size_t i = 0;
+        while (rank >= node->children[i]->count) {
+            rank -= node->children[i]->count;
+            ++i;
+        }
+        Node* child = mutableNode(node->children[i]);
+        erase(child, rank);
+        if (child->count == 0) {
+            node->children.erase(node->children.begin() + i);
+        } else if (width(child) < minNodeSize) {
+            rebalance(node, i);
+        }
+    }
+    refresh(node);
+}
+
+template <typename Key, typename T, typename Extent>
+inline typename PersistentMultiMap<Key, T, Extent>::const_iterator PersistentMultiMap<Key, T, Extent>::erase(const_iterator it)
+{
+    assert(it.root == root.get());
+    assert(it != end());
+    const size_type rank = it.rank();
+    erase(mutableNode(root), rank);
+    if (root->count == 0) {
+        root.reset();
+    } else {
+        while (!root->isLeaf && root->children.size() == 1) {
+            root = NodePtr(root->children.front());
+        }
+    }
+    return iteratorAt(rank);
+}
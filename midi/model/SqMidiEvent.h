@@ -1,6 +1,7 @@
 #pragma once
 
 #include <stdint.h>
+#include <atomic>
 #include <memory>
 #include <assert.h>
 #include "asserts.h"
@@ -34,6 +35,8 @@ public:
         Test
     };
 
+    using id_t = uint32_t;
+
     Type type = Type::Test;
 
     /**
@@ -49,6 +52,16 @@ public:
 
     virtual void assertValid() const;
 
+    /**
+     * Every event object gets its own id when it is made, and copies
+     * (like clone) get new ones. So it stands for the object, like the
+     * pointer does, but it's small and cheap to hash. Never zero.
+     */
+    id_t getId() const
+    {
+        return id;
+    }
+
     virtual ~MidiEvent()
     {
 #ifndef NDEBUG
@@ -60,19 +73,39 @@ public:
 #endif
 
 protected:
-    MidiEvent()
+    MidiEvent() : id(makeId())
     {
 #ifndef NDEBUG
         ++_count;
 #endif
     }
-    MidiEvent(const MidiEvent& e)
+    MidiEvent(const MidiEvent& e) : id(makeId())
     {
 #ifndef NDEBUG
         ++_count;
 #endif
         this->startTime = e.startTime;
     }
+    MidiEvent& operator=(const MidiEvent& e)
+    {
+        // keeps its own id
+        this->startTime = e.startTime;
+        return *this;
+    }
+
+private:
+    id_t id;
+
+    static id_t makeId()
+    {
+        // events get made on the UI thread and by the file loader
+        static std::atomic<id_t> nextId(1);
+        id_t ret;
+        do {
+            ret = nextId++;
+        } while (ret == 0);
+        return ret;
+    }
 
 public:
     virtual bool isEqualBase(const MidiEvent& other) const
@@ -268,6 +301,7 @@ public:
     {
         type = Type::End;
     }
+    MidiEndEvent& operator=(const MidiEndEvent&) = default;
 
     virtual MidiEventPtr clone() const override;
     MidiEndEventPtr clonee() const;
@@ -6,6 +6,8 @@
 #include "NoteScreenScale.h"
 #include "TimeUtils.h"
 
+#include <algorithm>
+
 extern int _mdb;
 
 MidiEditorContext::MidiEditorContext(MidiSongPtr song, ISeqSettingsPtr stt) : 
@@ -125,6 +127,21 @@ MidiEditorContext::iterator_pair MidiEditorContext::getEvents(float timeLow, flo
         iterator(rawIterators.second, rawIterators.second, lambda));
 }
 
+void MidiEditorContext::getNotesInViewport(std::vector<MidiNoteEventPtr>& notes) const
+{
+    const auto song = getSong();
+    const auto track = song->getTrack(this->trackNumber);
+    track->getNotesOverlapping(m_startTime, m_endTime, notes);
+
+    const float pitchLow = m_pitchLow;
+    const float pitchHigh = m_pitchHigh;
+    const float timeHigh = m_endTime;
+    auto notVisible = [pitchLow, pitchHigh, timeHigh](const MidiNoteEventPtr& note) {
+        return note->pitchCV < pitchLow || note->pitchCV > pitchHigh || note->startTime >= timeHigh;
+    };
+    notes.erase(std::remove_if(notes.begin(), notes.end(), notVisible), notes.end());
+}
+
 bool MidiEditorContext::cursorInViewport() const
 {
     if (m_cursorTime < m_startTime) {
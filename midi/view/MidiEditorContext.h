@@ -132,6 +132,13 @@ public:
     iterator_pair getEvents(float preMargin) const;
     iterator_pair getEvents(float timeLow, float timeHigh, float pitchLow, float pitchHigh) const;
 
+    /**
+     * gets all the notes that show up in the edit context, including
+     * long ones that started before it.
+     * Clears notes first. Fast enough to call every frame.
+     */
+    void getNotesInViewport(std::vector<MidiNoteEventPtr>& notes) const;
+
     std::shared_ptr<MidiSong> getSong() const;
 
     void scrollVertically(float pitchCV);
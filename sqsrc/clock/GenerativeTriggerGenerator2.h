@@ -1,7 +1,11 @@
 #pragma once
 
+#include <atomic>
+#include <memory>
+
 #include "AudioMath.h"
 #include "StochasticGrammar2.h"
+#include "StochasticGrammarTable.h"
 #include "StochasticProductionRule.h"
 #include "TriggerSequencer.h"
 
@@ -40,21 +44,34 @@ private:
 
 /* wraps up some stochastic gnerative grammar stuff feeding
  * a trigger sequencer
+ *
+ * The grammar is played from a StochasticGrammarTable. setGrammar compiles
+ * a new one on the calling (UI) thread and leaves it in pendingTable.
+ * The audio thread picks it up the next time it generates, and hands
+ * the old one back in retiredTable, so it gets deleted on the UI thread too.
  */
 class GenerativeTriggerGenerator2 {
 public:
     GenerativeTriggerGenerator2(AudioMath::RandomUniformFunc r, StochasticGrammarPtr grammar) : _r(r),
-                                                                                                _grammar(grammar) {
+                                                                                                _table(new StochasticGrammarTable(*grammar)) {
         generate();
         _seq = new TriggerSequencer(_data);
     }
 
     ~GenerativeTriggerGenerator2() {
         delete _seq;
+        delete pendingTable.exchange(nullptr);
+        delete retiredTable.exchange(nullptr);
     }
 
+    /**
+     * Call from the UI thread. Takes effect the next time
+     * a new sequence is generated.
+     */
     void setGrammar(StochasticGrammarPtr grammar) {
-        _grammar = grammar;
+        assert(grammar);
+        delete retiredTable.exchange(nullptr);
+        delete pendingTable.exchange(new StochasticGrammarTable(*grammar));
     }
 
     void queueReset() {
@@ -73,9 +90,12 @@ private:
     TriggerSequencer* _seq = nullptr;
     TriggerSequencer::Event _data[33];
     AudioMath::RandomUniformFunc _r;
-    StochasticGrammarPtr _grammar;
+    std::unique_ptr<StochasticGrammarTable> _table;
+    std::atomic<StochasticGrammarTable*> pendingTable = {nullptr};
+    std::atomic<StochasticGrammarTable*> retiredTable = {nullptr};
     bool resetRequested = false;
     void generate();
+    void servicePendingTable();
 };
 
 inline bool GenerativeTriggerGenerator2::updateToMetricTime(double metricTime, float quantizationInterval, bool running) {
@@ -102,14 +122,24 @@ inline bool GenerativeTriggerGenerator2::updateToMetricTime(double metricTime, f
     return _seq->getTriggerAndReset();
 }
 
+inline void GenerativeTriggerGenerator2::servicePendingTable() {
+    StochasticGrammarTable* newTable = pendingTable.exchange(nullptr);
+    if (newTable) {
+        StochasticGrammarTable* oldTable = retiredTable.exchange(_table.release());
+        _table.reset(newTable);
+
+        // Only happens if the UI sends grammars faster than we can play them.
+        // Rare enough that a delete here is fine.
+        delete oldTable;
+    }
+}
+
 inline void GenerativeTriggerGenerator2::generate() {
     //SQINFO("---------- gtg generate new --------------");
-    assert(_grammar);
+    servicePendingTable();
+    assert(_table && !_table->empty());
     GTGEvaluator2 es(_r, _data);
-    es.grammar = _grammar;
-    auto baseRule = es.grammar->getRootRule();
-    assert(baseRule);
-    StochasticProductionRule::evaluate(es, baseRule);
+    _table->evaluate(es);
     es.writeEnd();
     TriggerSequencer::isValid(_data);
 
@@ -0,0 +1,152 @@
+#include "StochasticGrammarTable.h"
+
+#include <algorithm>
+#include <map>
+
+#include "StochasticGrammar2.h"
+
+const int32_t StochasticGrammarTable::terminate;
+
+StochasticGrammarTable::StochasticGrammarTable(const StochasticGrammar& grammar) {
+    // The root rule is the first one, so it will be rule zero.
+    const std::vector<StochasticNote> allLHS = grammar.getAllLHS();
+    std::map<StochasticNote, int32_t> ruleIndex;
+    for (size_t i = 0; i < allLHS.size(); ++i) {
+        ruleIndex.insert(std::make_pair(allLHS[i], int32_t(i)));
+    }
+
+    for (auto note : allLHS) {
+        ConstStochasticProductionRulePtr sourceRule = grammar.getRule(note);
+        assert(sourceRule);
+
+        Rule rule;
+        rule.lhs = note;
+        rule.firstEntry = uint32_t(entries.size());
+        rule.firstColumn = uint32_t(columns.size());
+
+        // Work out the real chance of each entry. The old evaluator picks the first
+        // entry whose running total is over the random number, so if the total
+        // goes over one the later entries get cut short.
+        std::vector<double> chances;
+        std::vector<int32_t> outcomes;
+        double total = 0;
+        for (auto sourceEntry : sourceRule->getEntries()) {
+            const double before = std::min(total, 1.0);
+            total += sourceEntry->probability;
+            chances.push_back(std::min(total, 1.0) - before);
+            outcomes.push_back(int32_t(entries.size()));
+
+            Entry entry;
+            entry.firstSymbol = uint32_t(symbols.size());
+            entry.numSymbols = uint32_t(sourceEntry->rhsProducedNotes.size());
+            entries.push_back(entry);
+            for (auto produced : sourceEntry->rhsProducedNotes) {
+                Symbol symbol;
+                symbol.note = produced;
+                auto it = ruleIndex.find(produced);
+                symbol.rule = (it == ruleIndex.end()) ? terminate : it->second;
+                symbols.push_back(symbol);
+            }
+        }
+        if (total < 1) {
+            chances.push_back(1 - total);
+            outcomes.push_back(terminate);
+        }
+
+        addColumns(chances, outcomes);
+        rule.numColumns = uint32_t(columns.size()) - rule.firstColumn;
+        rules.push_back(rule);
+    }
+}
+
+/**
+ * Vose's method: every column starts as one outcome, then the columns with less than
+ * their share are topped up from the ones with more, until every column is full.
+ */
+void StochasticGrammarTable::addColumns(const std::vector<double>& chances, const std::vector<int32_t>& outcomes) {
+    assert(chances.size() == outcomes.size());
+    assert(!chances.empty());
+
+    const size_t n = chances.size();
+    double total = 0;
+    for (double chance : chances) {
+        total += chance;
+    }
+
+    const size_t first = columns.size();
+    std::vector<double> scaled(n);
+    std::vector<size_t> small;
+    std::vector<size_t> large;
+    for (size_t i = 0; i < n; ++i) {
+        Column column;
+        column.entry = outcomes[i];
+        column.alias = outcomes[i];
+        columns.push_back(column);
+
+        scaled[i] = (total > 0) ? chances[i] * n / total : 1;
+        if (scaled[i] < 1) {
+            small.push_back(i);
+        } else {
+            large.push_back(i);
+        }
+    }
+
+    while (!small.empty() && !large.empty()) {
+        const size_t s = small.back();
+        small.pop_back();
+        const size_t l = large.back();
+
+        columns[first + s].threshold = float(scaled[s]);
+        columns[first + s].alias = outcomes[l];
+        scaled[l] -= 1 - scaled[s];
+        if (scaled[l] < 1) {
+            large.pop_back();
+            small.push_back(l);
+        }
+    }
+    // Anything left over is only off from one by rounding, so gets the whole column.
+    for (size_t i : small) {
+        columns[first + i].threshold = 1;
+    }
+    for (size_t i : large) {
+        columns[first + i].threshold = 1;
+    }
+}
+
+int32_t StochasticGrammarTable::pickEntry(const Rule& rule, float random) const {
+    assert(random >= 0 && random <= 1);
+    const float x = random * rule.numColumns;
+    const uint32_t index = std::min(uint32_t(x), rule.numColumns - 1);
+    const Column& column = columns[rule.firstColumn + index];
+    return (x - index < column.threshold) ? column.entry : column.alias;
+}
+
+int StochasticGrammarTable::_pick(size_t ruleIndex, float random) const {
+    const Rule& rule = rules[ruleIndex];
+    const int32_t entry = pickEntry(rule, random);
+    return (entry == terminate) ? -1 : int(entry - rule.firstEntry);
+}
+
+void StochasticGrammarTable::evaluate(StochasticProductionRule::EvaluationState& es) const {
+    assert(!rules.empty());
+    evaluateRule(es, rules[0]);
+}
+
+void StochasticGrammarTable::evaluateRule(StochasticProductionRule::EvaluationState& es, const Rule& rule) const {
+    const int32_t entryIndex = pickEntry(rule, es.r());
+    if (entryIndex == terminate) {
+        es.writeSymbol(rule.lhs);
+        return;
+    }
+
+    const Entry& entry = entries[entryIndex];
+    const Symbol* symbol = symbols.data() + entry.firstSymbol;
+    const Symbol* end = symbol + entry.numSymbols;
+    for (; symbol != end; ++symbol) {
+        if (symbol->rule == terminate) {
+            es.writeSymbol(symbol->note);
+        } else {
+            evaluateRule(es, rules[symbol->rule]);
+        }
+    }
+}
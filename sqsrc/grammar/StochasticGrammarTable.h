@@ -0,0 +1,89 @@
+#pragma once
+
+#include <stdint.h>
+#include <vector>
+
+#include "StochasticNote.h"
+#include "StochasticProductionRule.h"
+
+class StochasticGrammar;
+
+/**
+ * A StochasticGrammar compiled into flat arrays, for playing.
+ *
+ * Evaluating the StochasticGrammar directly chases shared_ptrs, looks up
+ * every produced note in a map, and picks an entry by adding up the
+ * probabilities one at a time.
+ *
+ * Here each rule is a run of columns in an alias table (Walker / Vose),
+ * so picking an entry is one random number, one multiply and one compare,
+ * no matter how many entries there are. The produced notes already know
+ * which rule (if any) expands them. Evaluation does not allocate.
+ *
+ * Compiling does allocate, so do it off the audio thread.
+ * The chances are exactly the same as StochasticProductionRule::evaluate:
+ * each entry fires with its probability, and whatever is left over
+ * (if the probabilities add up to less than one) makes the rule terminate.
+ */
+class StochasticGrammarTable {
+public:
+    StochasticGrammarTable(const StochasticGrammar&);
+
+    /**
+     * Expands the root rule all the way down to terminals,
+     * and puts them into es. es.grammar is not used.
+     */
+    void evaluate(StochasticProductionRule::EvaluationState& es) const;
+
+    bool empty() const { return rules.empty(); }
+    size_t _numRules() const { return rules.size(); }
+
+    /**
+     * which entry of the rule a random number will pick.
+     * returns -1 for terminate.
+     */
+    int _pick(size_t rule, float random) const;
+
+private:
+    static const int32_t terminate = -1;
+
+    class Rule {
+    public:
+        StochasticNote lhs = {0};
+        uint32_t firstColumn = 0;
+        uint32_t numColumns = 0;
+        uint32_t firstEntry = 0;
+    };
+
+    /**
+     * one column of the alias table. Pick this column's entry if
+     * the fraction is less than threshold, otherwise pick the alias.
+     */
+    class Column {
+    public:
+        float threshold = 1;
+        int32_t entry = terminate;
+        int32_t alias = terminate;
+    };
+
+    class Entry {
+    public:
+        uint32_t firstSymbol = 0;
+        uint32_t numSymbols = 0;
+    };
+
+    class Symbol {
+    public:
+        StochasticNote note = {0};
+        int32_t rule = terminate;  // index of the rule that expands this, or terminate
+    };
+
+    std::vector<Rule> rules;
+    std::vector<Column> columns;
+    std::vector<Entry> entries;
+    std::vector<Symbol> symbols;
+
+    int32_t pickEntry(const Rule&, float random) const;
+    void evaluateRule(StochasticProductionRule::EvaluationState& es, const Rule&) const;
+    void addColumns(const std::vector<double>& chances, const std::vector<int32_t>& outcomes);
+};
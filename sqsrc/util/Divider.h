@@ -1,6 +1,7 @@
 #pragma once
 
 #include <assert.h>
+#include <atomic>
 #include <functional>
 
 /**
@@ -37,4 +38,139 @@ private:
     std::function<void()> lambda = nullptr;
     int divisor = 0;
     int counter = 1;
-};
\ No newline at end of file
+};
+
+/**
+ * Turns on phase staggering for all the FixedDividers made after this.
+ * Off by default, so tests and offline renders are the same every time.
+ * The plugin turns it on when it loads.
+ */
+class DividerStagger
+{
+public:
+    static void enable(bool b)
+    {
+        flag() = b;
+    }
+    static bool isEnabled()
+    {
+        return flag();
+    }
+
+private:
+    static std::atomic<bool>& flag()
+    {
+        static std::atomic<bool> enabled{false};
+        return enabled;
+    }
+};
+
+/**
+ * Like Divider, but the period and the type of the callback are template parameters,
+ * so the callback can be inlined into the caller's process().
+ *
+ * The callback is always called on the first call to step(). After that,
+ * if DividerStagger is enabled, each instance is offset by a different phase,
+ * so that many instances of the same module don't all do their control rate
+ * work on the same sample.
+ *
+ * TFunc is usually a DividerCallback.
+ */
+template <int N, class TFunc>
+class FixedDivider
+{
+public:
+    static_assert(N > 0, "period must be positive");
+
+    void setup(TFunc f)
+    {
+        func = f;
+    }
+
+    /**
+     * @param phase is 0..N-1. The default comes from nextPhase().
+     * Should be called before the first step().
+     */
+    void setPhase(int p)
+    {
+        assert(p >= 0 && p < N);
+        phase = p;
+    }
+
+    void step()
+    {
+        if (--counter == 0) {
+            counter = N;
+            if (first) {
+                first = false;
+                counter -= phase;
+            }
+            func();
+        }
+    }
+
+    static constexpr int getDiv()
+    {
+        return N;
+    }
+
+    /**
+     * Hands out phases round robin, so each new instance of
+     * a module gets the next one. Always 0 if staggering is off.
+     */
+    static int nextPhase()
+    {
+        static std::atomic<unsigned> next{0};
+        return DividerStagger::isEnabled() ? int(next++ % unsigned(N)) : 0;
+    }
+
+private:
+    TFunc func;
+    int counter = 1;
+    int phase = nextPhase();
+    bool first = true;
+};
+
+/**
+ * A callable for FixedDivider that calls a member function.
+ * ex: FixedDivider<4, DividerCallback<MyComposite, &MyComposite::stepn>> divn;
+ *     divn.setup(this);
+ */
+template <class T, void (T::*Method)()>
+class DividerCallback
+{
+public:
+    DividerCallback(T* owner = nullptr) : owner(owner)
+    {
+    }
+
+    void operator()() const
+    {
+        assert(owner);
+        (owner->*Method)();
+    }
+
+private:
+    T* owner;
+};
+
+/**
+ * Same, for a member function that takes the period, like stepn(int n).
+ */
+template <class T, void (T::*Method)(int), int N>
+class DividerCallbackN
+{
+public:
+    DividerCallbackN(T* owner = nullptr) : owner(owner)
+    {
+    }
+
+    void operator()() const
+    {
+        assert(owner);
+        (owner->*Method)(N);
+    }
+
+private:
+    T* owner;
+};
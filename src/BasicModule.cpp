@@ -72,6 +72,7 @@ void BasicModule::process(const ProcessArgs& args)
 struct BasicWidget : ModuleWidget
 {
     BasicWidget(BasicModule *);
+    void appendContextMenu(Menu *menu) override;
  
     Label* addLabel(const Vec& v, const char* str, const NVGcolor& color = SqHelper::COLOR_BLACK)
     {
@@ -87,6 +88,16 @@ struct BasicWidget : ModuleWidget
     void addControls(BasicModule *module, std::shared_ptr<IComposite> icomp);
 };
 
+void BasicWidget::appendContextMenu(Menu *menu)
+{
+    MenuLabel *spacerLabel = new MenuLabel();
+	menu->addChild(spacerLabel);
+
+    SqMenuItem_BooleanParam2 * item = new SqMenuItem_BooleanParam2(module, Comp::LITE_PARAM);
+    item->text = "Lite quality (wavetable)";
+    menu->addChild(item);
+}
+
 void BasicWidget::addJacks(BasicModule *module, std::shared_ptr<IComposite> icomp)
 {
     const float jackX = 14;
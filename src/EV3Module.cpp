@@ -310,6 +310,7 @@ struct EV3Widget : ModuleWidget
     }
 
     void step() override;
+    void appendContextMenu(Menu *menu) override;
  
     EV3PitchDisplay pitchDisplay;
     EV3Module* const module;
@@ -519,6 +520,16 @@ void EV3Widget::makeOutputs(EV3Module *, std::shared_ptr<IComposite> icomp)
     plusTwo = addLabel(Vec(outX + 41, row1Y + rowDY + 20), "+", SqHelper::COLOR_WHITE);
 }
 
+void EV3Widget::appendContextMenu(Menu *menu)
+{
+    MenuLabel *spacerLabel = new MenuLabel();
+    menu->addChild(spacerLabel);
+
+    SqMenuItem_BooleanParam2 * item = new SqMenuItem_BooleanParam2(module, Comp::LITE_PARAM);
+    item->text = "Lite quality (wavetable)";
+    menu->addChild(item);
+}
+
 /**
  * Widget constructor will describe my implementation structure and
  * provide meta-data.
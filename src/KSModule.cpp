@@ -1,10 +1,13 @@
-
 #include <sstream>
 #include "Squinky.hpp"
 
 #ifdef _KS
 #include "WidgetComposite.h"
 #include "KSComposite.h"
+#include "ctrl/SqHelper.h"
+#include "ctrl/SqWidgets.h"
+
+using Comp = KSComposite<WidgetComposite>;
 
 /**
  */
@@ -16,32 +19,37 @@ public:
      *
      * Overrides of Module functions
      */
-    void step() override;
+    void process(const ProcessArgs& args) override;
     void onSampleRateChange() override;
 
-    KSComposite<WidgetComposite> composite;
+    std::shared_ptr<Comp> composite;
 private:
 
 };
 
 void KSModule::onSampleRateChange()
 {
+    composite->onSampleRateChange();
 }
 
 KSModule::KSModule()
-    : Module(composite.NUM_PARAMS,
-    composite.NUM_INPUTS,
-    composite.NUM_OUTPUTS,
-    composite.NUM_LIGHTS),
-    composite(this)
 {
-    onSampleRateChange();
-    composite.init();
+    config(Comp::NUM_PARAMS, Comp::NUM_INPUTS, Comp::NUM_OUTPUTS, Comp::NUM_LIGHTS);
+    configInput(Comp::VOCT_INPUT, "1V/oct");
+    configInput(Comp::GATE_INPUT, "Gate (pluck)");
+    configInput(Comp::EXCITE_INPUT, "Excitation");
+    configOutput(Comp::AUDIO_OUTPUT, "Audio");
+
+    composite = std::make_shared<Comp>(this);
+    std::shared_ptr<IComposite> icomp = Comp::getDescription();
+    SqHelper::setupParams(icomp, this);
+
+    composite->init();
 }
 
-void KSModule::step()
+void KSModule::process(const ProcessArgs& args)
 {
-    composite.step();
+    composite->process(args);
 }
 
 ////////////////////
@@ -52,7 +60,7 @@ struct KCCompositeWidget : ModuleWidget
 {
     KCCompositeWidget(KSModule *);
 
-    Label* addLabel(const Vec& v, const char* str, const NVGcolor& color = COLOR_BLACK)
+    Label* addLabel(const Vec& v, const char* str, const NVGcolor& color = SqHelper::COLOR_BLACK)
     {
         Label* label = new Label();
         label->box.pos = v;
@@ -63,119 +71,93 @@ struct KCCompositeWidget : ModuleWidget
     }
 
     void addJacks(KSModule*);
-    void addKnobs(KSModule*);
-
-#ifdef _TIME_DRAWING
-    void draw(const DrawArgs &args) override
-    {
-        DrawLocker l(drawTimer);
-        ModuleWidget::draw(args);
-    }
-#endif
+    void addKnobs(KSModule*, std::shared_ptr<IComposite> icomp);
 };
 
-void KCCompositeWidget::addJacks(KSModule*)
+void KCCompositeWidget::addJacks(KSModule* module)
 {
-    const float verticalShift = 0;
     const float col1 = 12;
     const float col2 = 46;
     const float col3 = 81;
     const float col4 = 115;
-    const float outputLabelY = 300;
-
-    using CCOMP = KSComposite<WidgetComposite>;
-
-    addInput(Port::create<PJ301MPort>(
-        Vec(col1, 273 + verticalShift),
-        Port::INPUT,
-        module,
-        CCOMP::PITCH_INPUT));
-    addLabel(Vec(9, 255 + verticalShift), "cv");
-
-    addInput(Port::create<PJ301MPort>(
-        Vec(col2, 273 + verticalShift),
-        Port::INPUT,
-        module,
-        CCOMP::FM_INPUT));
-
-    addLabel(Vec(43, 255 + verticalShift), "fm");
-
-    addInput(Port::create<PJ301MPort>(
-        Vec(col3, 273 + verticalShift),
-        Port::INPUT,
-        module,
-        CCOMP::SYNC_INPUT));
-    addLabel(Vec(72, 255 + verticalShift), "sync");
-
-    addInput(Port::create<PJ301MPort>(
-        Vec(col4, 273 + verticalShift),
-        Port::INPUT,
-        module,
-        CCOMP::PW_INPUT));
-    addLabel(Vec(107, 255 + verticalShift), "pwm");
+    const float jackY = 273;
+    const float labelY = 255;
 
-    addOutput(Port::create<PJ301MPort>(
-        Vec(col1, 317 + verticalShift),
-        Port::OUTPUT,
+    addInput(createInput<PJ301MPort>(
+        Vec(col1, jackY),
         module,
-        CCOMP::SIN_OUTPUT));
-    addLabel(Vec(8, outputLabelY + verticalShift), "sin");
+        Comp::VOCT_INPUT));
+    addLabel(Vec(9, labelY), "V/O");
 
-    addOutput(Port::create<PJ301MPort>(
-        Vec(col2, 317 + verticalShift),
-        Port::OUTPUT,
+    addInput(createInput<PJ301MPort>(
+        Vec(col2, jackY),
         module,
-        CCOMP::TRI_OUTPUT));
-    addLabel(Vec(44, outputLabelY + verticalShift), "tri");
+        Comp::GATE_INPUT));
+    addLabel(Vec(40, labelY), "gate");
 
-    addOutput(Port::create<PJ301MPort>(
-        Vec(col3, 317 + verticalShift),
-        Port::OUTPUT,
+    addInput(createInput<PJ301MPort>(
+        Vec(col3, jackY),
         module,
-        CCOMP::SAW_OUTPUT));
-    addLabel(Vec(75, outputLabelY + verticalShift), "saw");
+        Comp::EXCITE_INPUT));
+    addLabel(Vec(74, labelY), "exc");
 
-    addOutput(Port::create<PJ301MPort>(
-        Vec(col4, 317 + verticalShift),
-        Port::OUTPUT,
+    addOutput(createOutput<PJ301MPort>(
+        Vec(col4, jackY),
         module,
-        CCOMP::SQR_OUTPUT));
-    addLabel(Vec(111, outputLabelY + verticalShift), "sqr");
+        Comp::AUDIO_OUTPUT));
+    addLabel(Vec(111, labelY), "out");
 }
 
-
-void KCCompositeWidget::addKnobs(KSModule*)
+void KCCompositeWidget::addKnobs(KSModule* module, std::shared_ptr<IComposite> icomp)
 {
-
+    const float knobX = 12;
+    const float knobX2 = 81;
+    const float knobY = 40;
+    const float dy = 60;
+
+    addParam(SqHelper::createParam<Blue30SnapKnob>(
+        icomp,
+        Vec(knobX, knobY + 0 * dy),
+        module, Comp::OCTAVE_PARAM));
+    addParam(SqHelper::createParam<Blue30SnapKnob>(
+        icomp,
+        Vec(knobX, knobY + 1 * dy),
+        module, Comp::SEMITONE_PARAM));
+    addParam(SqHelper::createParam<RoganSLBlue30>(
+        icomp,
+        Vec(knobX, knobY + 2 * dy),
+        module, Comp::FINE_PARAM));
+
+    addParam(SqHelper::createParam<RoganSLBlue30>(
+        icomp,
+        Vec(knobX2, knobY + 0 * dy),
+        module, Comp::DECAY_PARAM));
+    addParam(SqHelper::createParam<RoganSLBlue30>(
+        icomp,
+        Vec(knobX2, knobY + 1 * dy),
+        module, Comp::DAMPING_PARAM));
 }
+
 /**
  * Widget constructor will describe my implementation structure and
  * provide meta-data.
  * This is not shared by all modules in the DLL, just one
  */
-KCCompositeWidget::KCCompositeWidget(KSModule *module) : ModuleWidget(module)
+KCCompositeWidget::KCCompositeWidget(KSModule *module)
 {
-    box.size = Vec(15 * RACK_GRID_WIDTH, RACK_GRID_HEIGHT);
-    {
-        SVGPanel *panel = new SVGPanel();
-        panel->box.size = box.size;
-        panel->setBackground(SVG::load(assetPlugin(pluginInstance, "res/ks_panel.svg")));
-        addChild(panel);
-    }
+    setModule(module);
+    SqHelper::setPanel(this, "res/ks_panel.svg");
 
+    std::shared_ptr<IComposite> icomp = Comp::getDescription();
     addJacks(module);
-    addKnobs(module);
+    addKnobs(module, icomp);
 
     // screws
-    addChild(Widget::create<ScrewSilver>(Vec(RACK_GRID_WIDTH, 0)));
-    addChild(Widget::create<ScrewSilver>(Vec(box.size.x - 2 * RACK_GRID_WIDTH, 0)));
-    addChild(Widget::create<ScrewSilver>(Vec(RACK_GRID_WIDTH, RACK_GRID_HEIGHT - RACK_GRID_WIDTH)));
-    addChild(Widget::create<ScrewSilver>(Vec(box.size.x - 2 * RACK_GRID_WIDTH, RACK_GRID_HEIGHT - RACK_GRID_WIDTH)));
+    addChild(createWidget<ScrewSilver>(Vec(RACK_GRID_WIDTH, 0)));
+    addChild(createWidget<ScrewSilver>(Vec(box.size.x - 2 * RACK_GRID_WIDTH, 0)));
+    addChild(createWidget<ScrewSilver>(Vec(RACK_GRID_WIDTH, RACK_GRID_HEIGHT - RACK_GRID_WIDTH)));
+    addChild(createWidget<ScrewSilver>(Vec(box.size.x - 2 * RACK_GRID_WIDTH, RACK_GRID_HEIGHT - RACK_GRID_WIDTH)));
 }
 
-
-Model *modelKSModule = Model::create<KSModule,
-    KCCompositeWidget>("Squinky Labs",
-    "squinkylabs-ks",
-    "kitchen sink", RANDOM_TAG);
+Model *modelKSModule = createModel<KSModule, KCCompositeWidget>("squinkylabs-ks");
 #endif
@@ -50,6 +50,9 @@ public:
 
     InstrumentInfoPtr getInstrumentInfo();
     bool isNewInstrument();
+    bool getNewLoadError(std::string& err) {
+        return samp->getNewLoadError_UI(err);
+    }
 
     void dataFromJson(json_t* data) override;
     json_t* dataToJson() override;
@@ -195,6 +198,11 @@ struct SampWidget : ModuleWidget {
             
             theMenu->addChild(delay);
         }
+        {
+            SqMenuItem_BooleanParam2* lazy = new SqMenuItem_BooleanParam2(module, Comp::LAZYLOAD_PARAM);
+            lazy->text = "Load samples when played";
+            theMenu->addChild(lazy);
+        }
     }
 
     void step() override;
@@ -248,6 +256,7 @@ struct SampWidget : ModuleWidget {
 
     InstrumentInfoPtr info;
     std::string curBaseFileName;
+    std::string lateLoadError;  // from a sample that failed to load after the instrument was ready
 
     void pollForStateChange();
     void pollNewState();
@@ -293,8 +302,10 @@ void SampWidget::updateUIForLoading() {
 
 void SampWidget::updateUIForError() {
     std::string s = "Error: ";
-    if (info) {
+    if (info && !info->errorMessage.empty()) {
         s += info->errorMessage;
+    } else {
+        s += lateLoadError;
     }
     textField->setText(s);
 }
@@ -302,8 +313,12 @@ void SampWidget::updateUIForError() {
 void SampWidget::pollForStateChange() {
     if (_module && _module->isNewInstrument()) {
         info = _module->getInstrumentInfo();
+        lateLoadError.clear();
         nextUIState = info->errorMessage.empty() ? State::Loaded : State::Error;
     }
+    if (_module && _module->getNewLoadError(lateLoadError)) {
+        nextUIState = State::Error;
+    }
 }
 
 void SampWidget::pollNewState() {
@@ -1,5 +1,6 @@
 // plugin main
 #include "Squinky.hpp"
+#include "Divider.h"
 //#include "SqTime.h"
 #include "ctrl/SqHelper.h"
 
@@ -13,6 +14,9 @@ Plugin *pluginInstance = nullptr;
 void init (::rack::Plugin *p)
 {
     pluginInstance = p;
+
+    // so many instances of a module don't all do their control rate work on the same sample
+    DividerStagger::enable(true);
     p->addModel(modelWVCOModule);
 }
 
@@ -108,6 +108,10 @@ void SubWidget::appendContextMenu(Menu *menu)
     SqMenuItem_BooleanParam2 * item = new SqMenuItem_BooleanParam2(module, Comp::AGC_PARAM);
     item->text = "AGC";
     menu->addChild(item);
+
+    item = new SqMenuItem_BooleanParam2(module, Comp::LITE_PARAM);
+    item->text = "Lite quality (wavetable)";
+    menu->addChild(item);
 }
 
 const float knobLeftEdge = 18;
@@ -94,16 +94,12 @@ void NoteDisplay::step() {
 }
 
 void NoteDisplay::drawNotes(NVGcontext *vg) {
-    // Get all the events on the screen, and go back two bar so we get tied notes.
-    MidiEditorContext::iterator_pair it = sequencer->context->getEvents(8.f);
+    // Get all the notes on the screen, including long ones that started before it.
+    sequencer->context->getNotesInViewport(visibleNotes);
     auto scaler = sequencer->context->getScaler();
     assert(scaler);
     const int noteHeight = scaler->noteHeight();
-    for (; it.first != it.second; ++it.first) {
-        auto temp = *(it.first);
-        MidiEventPtr evn = temp.second;
-        MidiNoteEventPtr ev = safe_cast<MidiNoteEvent>(evn);
-
+    for (const MidiNoteEventPtr& ev : visibleNotes) {
         const float x = scaler->midiTimeToX(*ev);
         const float y = scaler->midiPitchToY(*ev);
         const float width = scaler->midiTimeTodX(ev->duration);
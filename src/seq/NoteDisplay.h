@@ -55,6 +55,11 @@ private:
 
     std::shared_ptr<class MouseManager> mouseManager;
 
+    /**
+     * Kept around so drawing doesn't allocate every frame.
+     */
+    std::vector<MidiNoteEventPtr> visibleNotes;
+
     void step() override;
 
 
@@ -2,6 +2,7 @@
 #include "MidiLock.h"
 #include "MidiSequencer.h"
 #include "MidiSequencer4.h"
+#include "MidiTrackCodec.h"
 #include "MidiTrack4Options.h"
 #include "MidiSong4.h"
 
@@ -21,7 +22,7 @@ schema for seq++
 
   song:
   {
-      "tk0": <track>,
+      "tk0": <track>,           // base64 string from MidiTrackCodec. Used to be an array of events
       "loop": <loop>
   }
 
@@ -129,29 +130,10 @@ std::string SequencerSerializer::optionTagForSong4(int row, int col)
 
 json_t *SequencerSerializer::toJson(std::shared_ptr<MidiTrack> tk)
 {
-    json_t* track = json_array();
-
-    for (auto ev_iter : *tk) {
-        MidiEventPtr ev = ev_iter.second;
-        json_array_append_new(track, toJson(ev));
-    }
-    return track;
-}
-
-json_t *SequencerSerializer::toJson(std::shared_ptr<MidiEvent> evt)
-{
-    MidiNoteEventPtr note = safe_cast<MidiNoteEvent>(evt);
-    if (note) {
-        return toJson(note);
-    }
-
-    MidiEndEventPtr end = safe_cast<MidiEndEvent>(evt);
-    if (end) {
-        return toJson(end);
-    }
-
-    assert(false);
-    return nullptr;
+    // The whole track goes in one string. Old patches, with an array of
+    // events, are still read by fromJsonTrack.
+    const std::string data = MidiTrackCodec::encode(tk);
+    return json_stringn(data.c_str(), data.size());
 }
 
 json_t* SequencerSerializer::toJson(const SubrangeLoop& lp)
@@ -173,25 +155,6 @@ json_t* SequencerSerializer::toJson(const SubrangeLoop& lp)
  }
 
 
-json_t *SequencerSerializer::toJson(std::shared_ptr<MidiNoteEvent> n)
-{
-    // We could save a little space by omitting type for notes
-    json_t* note = json_object();
-    json_object_set_new(note, "t", json_integer(typeNote));
-    json_object_set_new(note, "s", json_real(n->startTime));
-    json_object_set_new(note, "p", json_real(n->pitchCV));
-    json_object_set_new(note, "d", json_real(n->duration));
-    return note;
-}
-
-json_t *SequencerSerializer::toJson(std::shared_ptr<MidiEndEvent> e)
-{
-    json_t* end = json_object();
-    json_object_set_new(end, "t", json_integer(typeEnd));
-    json_object_set_new(end, "s", json_real(e->startTime));
-    return end;
-}
-
 json_t* SequencerSerializer::toJson(std::shared_ptr<ISeqSettings> settings)
 {
     SeqSettings* rawSettings = dynamic_cast<SeqSettings*>(settings.get());
@@ -399,7 +362,17 @@ MidiSong4Ptr SequencerSerializer::fromJsonSong4(json_t *data)
 
 MidiTrackPtr SequencerSerializer::fromJsonTrack(json_t *data, int index, MidiLockPtr lock)
 {
-    // data here is the track array
+    if (json_is_string(data)) {
+        MidiTrackPtr track = MidiTrackCodec::decode(json_string_value(data), json_string_length(data), lock);
+        if (!track) {
+            WARN("bad track");
+            track = std::make_shared<MidiTrack>(lock);
+            track->insertEnd(4);
+        }
+        return track;
+    }
+
+    // data here is the old track array
     MidiTrackPtr track = std::make_shared<MidiTrack>(lock);
 
     size_t eventCount = json_array_size(data);
@@ -33,9 +33,6 @@ private:
     static json_t *toJson(std::shared_ptr<MidiSong4>);
     static json_t *toJson(std::shared_ptr<MidiTrack>);
     static json_t *toJson(std::shared_ptr<MidiTrack4Options>);
-    static json_t *toJson(std::shared_ptr<MidiNoteEvent>);
-    static json_t *toJson(std::shared_ptr<MidiEndEvent>);
-    static json_t *toJson(std::shared_ptr<MidiEvent>);
     static json_t *toJson(std::shared_ptr<ISeqSettings>);
     static json_t *toJson(const SubrangeLoop& loop);
 
@@ -63,6 +63,11 @@ test : test.exe
 ## Consider fixing this in the future.
 perf : perf.exe
 
+## bench runs the benchmark catalog, and fails if anything got slower than the baseline.
+## ex: make bench BENCH_ARGS="--filter=Samp --csv=new.csv --baseline=old.csv"
+bench : perf.exe
+	./perf.exe --bench $(BENCH_ARGS)
+
 ## cleantest will clean out all the test and perf build products
 cleantest :
 	rm -rfv build_test
@@ -0,0 +1,282 @@
+#include "BenchmarkCatalog.h"
+
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <fstream>
+#include <locale>
+#include <map>
+#include <sstream>
+
+extern void registerCompositeBenchmarks();
+
+std::vector<BenchmarkCatalog::Entry>& BenchmarkCatalog::entries()
+{
+    static std::vector<Entry> theEntries;
+    return theEntries;
+}
+
+void BenchmarkCatalog::add(const std::string& name, const std::vector<int>& channels, Factory factory)
+{
+    // names go into the csv as is
+    assert(name.find_first_of(",\"\n") == std::string::npos);
+    assert(!channels.empty());
+    Entry entry;
+    entry.name = name;
+    entry.channels = channels;
+    entry.factory = factory;
+    entries().push_back(entry);
+}
+
+static bool wanted(const BenchmarkCatalog::Options& options, const std::string& name, int channels)
+{
+    if (!options.filter.empty() && name.find(options.filter) == std::string::npos) {
+        return false;
+    }
+    if (!options.channels.empty() &&
+        std::find(options.channels.begin(), options.channels.end(), channels) == options.channels.end()) {
+        return false;
+    }
+    return true;
+}
+
+/**
+ * nanoseconds per call, for each repetition.
+ */
+static std::vector<double> measure(BenchmarkCatalog::Process process, const BenchmarkCatalog::Options& options)
+{
+    // warm up, and find how many iterations fill up minTime
+    MeasureTime<float>::measureTimeSub(process, 1000);
+    int64_t iterations = 1000;
+    for (;;) {
+        const double elapsed = MeasureTime<float>::measureTimeSub(process, iterations);
+        if (elapsed >= options.minTime) {
+            break;
+        }
+        iterations *= 2;
+    }
+
+    std::vector<double> ret;
+    for (int i = 0; i < options.repetitions; ++i) {
+        const double elapsed = MeasureTime<float>::measureTimeSub(process, iterations);
+        ret.push_back(elapsed * 1000.0 * 1000.0 * 1000.0 / double(iterations));
+    }
+    return ret;
+}
+
+std::vector<BenchmarkCatalog::Result> BenchmarkCatalog::run(const Options& options)
+{
+    assert(options.repetitions > 0);
+    TestBuffers<float>::doInit();
+    const double timerOverhead = options.latency ? MeasureTime<float>::timerOverhead() : 0;
+
+    std::vector<Result> results;
+    for (const Entry& entry : entries()) {
+        for (int channels : entry.channels) {
+            if (!wanted(options, entry.name, channels)) {
+                continue;
+            }
+            Process process = entry.factory(channels);
+
+            std::vector<double> times = measure(process, options);
+            std::sort(times.begin(), times.end());
+
+            Result result;
+            result.name = entry.name;
+            result.channels = channels;
+            result.nsPerSample = times[times.size() / 2];
+            result.minNsPerSample = times[0];
+            result.cpuPercent = result.nsPerSample * 44100 * 100 / (1000.0 * 1000.0 * 1000.0);
+            if (options.latency) {
+                const LatencyHistogram histogram = MeasureTime<float>::measureLatency(process, 20000, true, timerOverhead);
+                result.p99Ns = histogram.percentile(99);
+            }
+            results.push_back(result);
+
+            printf("%-24s %2d ch  %9.1f ns  %7.3f%%", result.name.c_str(), channels, result.nsPerSample, result.cpuPercent);
+            if (options.latency) {
+                printf("  p99=%" PRIu64 " ns", result.p99Ns);
+            }
+            printf("\n");
+            fflush(stdout);
+        }
+    }
+    return results;
+}
+
+/**
+ * The test program runs in a locale that writes 1.5 as 1,5,
+ * so all the files use a stream with the classic locale.
+ */
+static void setClassic(std::ios& stream)
+{
+    stream.imbue(std::locale::classic());
+}
+
+void BenchmarkCatalog::save(const Options& options, const std::vector<Result>& results)
+{
+    if (!options.jsonPath.empty()) {
+        std::ofstream out(options.jsonPath);
+        setClassic(out);
+        out << "[\n";
+        for (size_t i = 0; i < results.size(); ++i) {
+            const Result& r = results[i];
+            out << "  {\"name\": \"" << r.name << "\", \"channels\": " << r.channels
+                << ", \"ns_per_sample\": " << r.nsPerSample
+                << ", \"min_ns_per_sample\": " << r.minNsPerSample
+                << ", \"cpu_percent\": " << r.cpuPercent
+                << ", \"p99_ns\": " << r.p99Ns << "}"
+                << ((i + 1 < results.size()) ? ",\n" : "\n");
+        }
+        out << "]\n";
+        if (!out) {
+            printf("could not write %s\n", options.jsonPath.c_str());
+        }
+    }
+
+    if (!options.csvPath.empty()) {
+        std::ofstream out(options.csvPath);
+        setClassic(out);
+        out << "name,channels,ns_per_sample,min_ns_per_sample,cpu_percent,p99_ns\n";
+        for (const Result& r : results) {
+            out << r.name << "," << r.channels << "," << r.nsPerSample << "," << r.minNsPerSample << ","
+                << r.cpuPercent << "," << r.p99Ns << "\n";
+        }
+        if (!out) {
+            printf("could not write %s\n", options.csvPath.c_str());
+        }
+    }
+}
+
+static std::string key(const std::string& name, int channels)
+{
+    return name + "/" + std::to_string(channels);
+}
+
+int BenchmarkCatalog::compareToBaseline(const Options& options, const std::vector<Result>& results)
+{
+    std::ifstream in(options.baselinePath);
+    if (!in) {
+        printf("could not read baseline %s\n", options.baselinePath.c_str());
+        return int(results.size());
+    }
+
+    // key -> ns per sample
+    std::map<std::string, double> baseline;
+    std::string line;
+    std::getline(in, line);  // header
+    while (std::getline(in, line)) {
+        std::istringstream fields(line);
+        setClassic(fields);
+        std::string name, channels, ns;
+        if (std::getline(fields, name, ',') && std::getline(fields, channels, ',') && std::getline(fields, ns, ',')) {
+            std::istringstream number(ns);
+            setClassic(number);
+            double value = 0;
+            if (number >> value) {
+                baseline[key(name, std::stoi(channels))] = value;
+            }
+        }
+    }
+
+    printf("\ncompared to %s, tolerance %.1f%%\n", options.baselinePath.c_str(), options.tolerancePercent);
+    int regressions = 0;
+    for (const Result& r : results) {
+        auto it = baseline.find(key(r.name, r.channels));
+        if (it == baseline.end()) {
+            printf("  new         %-24s %2d ch\n", r.name.c_str(), r.channels);
+            continue;
+        }
+        const double change = (it->second > 0) ? 100 * (r.nsPerSample - it->second) / it->second : 0;
+        if (change > options.tolerancePercent) {
+            ++regressions;
+            printf("  SLOWER      %-24s %2d ch  %+.1f%% (%.1f -> %.1f ns)\n",
+                   r.name.c_str(), r.channels, change, it->second, r.nsPerSample);
+        } else if (change < -options.tolerancePercent) {
+            printf("  faster      %-24s %2d ch  %+.1f%%\n", r.name.c_str(), r.channels, change);
+        }
+    }
+    printf("%d regression%s\n", regressions, regressions == 1 ? "" : "s");
+    return regressions;
+}
+
+static bool startsWith(const std::string& s, const char* prefix, std::string& rest)
+{
+    const size_t n = strlen(prefix);
+    if (s.compare(0, n, prefix) != 0) {
+        return false;
+    }
+    rest = s.substr(n);
+    return true;
+}
+
+static double toDouble(const std::string& s)
+{
+    std::istringstream in(s);
+    setClassic(in);
+    double ret = 0;
+    in >> ret;
+    return ret;
+}
+
+int BenchmarkCatalog::runCommandLine(int argc, char** argv)
+{
+    Options options;
+    bool list = false;
+    for (int i = 0; i < argc; ++i) {
+        const std::string arg = argv[i];
+        std::string value;
+        if (startsWith(arg, "--filter=", value)) {
+            options.filter = value;
+        } else if (startsWith(arg, "--channels=", value)) {
+            std::istringstream in(value);
+            std::string channels;
+            while (std::getline(in, channels, ',')) {
+                options.channels.push_back(std::atoi(channels.c_str()));
+            }
+        } else if (startsWith(arg, "--reps=", value)) {
+            options.repetitions = std::max(1, std::atoi(value.c_str()));
+        } else if (startsWith(arg, "--min-time=", value)) {
+            options.minTime = toDouble(value);
+        } else if (startsWith(arg, "--json=", value)) {
+            options.jsonPath = value;
+        } else if (startsWith(arg, "--csv=", value)) {
+            options.csvPath = value;
+        } else if (startsWith(arg, "--baseline=", value)) {
+            options.baselinePath = value;
+        } else if (startsWith(arg, "--tolerance=", value)) {
+            options.tolerancePercent = toDouble(value);
+        } else if (arg == "--latency") {
+            options.latency = true;
+        } else if (arg == "--list") {
+            list = true;
+        } else {
+            printf("%s is not a valid benchmark argument\n", arg.c_str());
+            return 2;
+        }
+    }
+
+    registerCompositeBenchmarks();
+    if (list) {
+        for (const Entry& entry : entries()) {
+            printf("%s:", entry.name.c_str());
+            for (int channels : entry.channels) {
+                printf(" %d", channels);
+            }
+            printf("\n");
+        }
+        return 0;
+    }
+
+    const std::vector<Result> results = run(options);
+    if (results.empty()) {
+        printf("nothing matched\n");
+        return 2;
+    }
+    save(options, results);
+    if (!options.baselinePath.empty()) {
+        return compareToBaseline(options, results) ? 1 : 0;
+    }
+    return 0;
+}
@@ -0,0 +1,134 @@
+#pragma once
+
+#include <stdint.h>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "MeasureTime.h"
+#include "TestComposite.h"
+
+/**
+ * class BenchmarkCatalog.
+ *
+ * A registered list of benchmarks, each one run at a list of channel counts.
+ * Unlike the hand written tests in perfTest.cpp, these can be picked with a filter,
+ * repeated, saved as json and csv, and compared to a saved baseline.
+ * So a CPU regression shows up as a failed run instead of a number nobody reads.
+ *
+ * Run with "perf.exe --bench [options]". See runCommandLine.
+ */
+class BenchmarkCatalog
+{
+public:
+    /**
+     * One call processes one sample. Returns something from the outputs,
+     * so the work can't be optimized away.
+     */
+    using Process = std::function<float()>;
+
+    /**
+     * Makes a new instance set up for this many channels, and returns its process function.
+     */
+    using Factory = std::function<Process(int channels)>;
+
+    class Options
+    {
+    public:
+        std::string filter;             // only benchmarks with this in their name
+        std::vector<int> channels;      // only these channel counts. empty is all.
+        int repetitions = 3;
+        double minTime = .25;           // seconds per repetition
+        bool latency = false;           // also get the p99 of an interleaved latency run
+        std::string jsonPath;
+        std::string csvPath;
+        std::string baselinePath;       // a csv from an earlier run
+        double tolerancePercent = 10;
+    };
+
+    class Result
+    {
+    public:
+        std::string name;
+        int channels = 0;
+        double nsPerSample = 0;         // median of the repetitions
+        double minNsPerSample = 0;      // best repetition
+        double cpuPercent = 0;          // of one core, at 44.1k
+        uint64_t p99Ns = 0;             // only if Options::latency
+    };
+
+    static void add(const std::string& name, const std::vector<int>& channels, Factory);
+
+    /**
+     * Adds a composite. make returns a new one, all set up for that many channels.
+     * Each sample puts a new value on input (if input >= 0), runs the composite, and reads output.
+     */
+    template <class Comp>
+    static void addComposite(const std::string& name,
+                             const std::vector<int>& channels,
+                             int input,
+                             int output,
+                             std::function<std::shared_ptr<Comp>(int channels)> make);
+
+    static std::vector<Result> run(const Options&);
+
+    /**
+     * Writes whichever of json and csv the options ask for.
+     */
+    static void save(const Options&, const std::vector<Result>&);
+
+    /**
+     * Compares to the baseline csv, and prints out anything that changed.
+     * @returns the number of benchmarks that got slower by more than the tolerance.
+     */
+    static int compareToBaseline(const Options&, const std::vector<Result>&);
+
+    /**
+     * options:
+     *      --filter=<text> --channels=<n,n...> --reps=<n> --min-time=<seconds> --latency
+     *      --json=<file> --csv=<file> --baseline=<csv file> --tolerance=<percent>
+     *      --list
+     * @returns the exit code. Non-zero for bad arguments, or if anything regressed.
+     */
+    static int runCommandLine(int argc, char** argv);
+
+private:
+    class Entry
+    {
+    public:
+        std::string name;
+        std::vector<int> channels;
+        Factory factory;
+    };
+    static std::vector<Entry>& entries();
+};
+
+template <class Comp>
+inline void BenchmarkCatalog::addComposite(const std::string& name,
+                                           const std::vector<int>& channels,
+                                           int input,
+                                           int output,
+                                           std::function<std::shared_ptr<Comp>(int channels)> make)
+{
+    add(name, channels, [input, output, make](int numChannels) -> Process {
+        std::shared_ptr<Comp> comp = make(numChannels);
+        // patch the output we read, so composites that skip unpatched outputs still run.
+        comp->outputs[output].channels = 1;
+        typename Comp::ProcessArgs args;
+        args.sampleRate = 44100;
+        args.sampleTime = 1.f / 44100.f;
+
+        return [comp, input, output, args]() {
+            if (input >= 0) {
+                comp->inputs[input].setVoltage(TestBuffers<float>::get(), 0);
+            }
+            // Some composites do their work in step, some in process.
+            // The other one is the empty one in TestComposite.
+            TestComposite& base = *comp;
+            base.step();
+            base.process(args);
+            return comp->outputs[output].getVoltage(0);
+        };
+    });
+}
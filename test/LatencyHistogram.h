@@ -0,0 +1,187 @@
+#pragma once
+
+#include <assert.h>
+#include <stdint.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+/**
+ * class LatencyHistogram.
+ *
+ * Collects the time of every call, so we can see the spikes, not just the average.
+ *
+ * Like an HDR histogram: times are kept in nanoseconds, in buckets that are
+ * linear up to 64 ns, and after that each power of two is split into 32 buckets.
+ * So any percentile is within about 3% of the real value, and recording is
+ * just a few shifts and an increment. Min, max and the total are exact.
+ */
+class LatencyHistogram
+{
+public:
+    LatencyHistogram() : buckets(numBuckets, 0)
+    {
+    }
+
+    void record(int64_t nanoseconds)
+    {
+        const uint64_t ns = uint64_t(std::max<int64_t>(nanoseconds, 0));
+        ++buckets[bucketIndex(ns)];
+        ++_count;
+        total += double(ns);
+        _min = std::min(_min, ns);
+        _max = std::max(_max, ns);
+    }
+
+    void clear()
+    {
+        std::fill(buckets.begin(), buckets.end(), 0);
+        _count = 0;
+        total = 0;
+        _min = UINT64_MAX;
+        _max = 0;
+    }
+
+    int64_t count() const { return _count; }
+    double mean() const { return _count ? total / double(_count) : 0; }
+    uint64_t min() const { return _count ? _min : 0; }
+    uint64_t max() const { return _max; }
+
+    /**
+     * @param pct is 0..100
+     * @returns the time (ns) that pct percent of the calls were at or under.
+     */
+    uint64_t percentile(double pct) const
+    {
+        if (!_count) {
+            return 0;
+        }
+        const double wanted = std::max(1.0, pct * double(_count) / 100.0);
+        int64_t sum = 0;
+        for (int i = 0; i < numBuckets; ++i) {
+            sum += buckets[i];
+            if (double(sum) >= wanted) {
+                // top of the bucket, but never more than what we really saw
+                return std::max(_min, std::min(_max, bucketTop(i)));
+            }
+        }
+        return _max;
+    }
+
+    /**
+     * one line of json, with times in whole nanoseconds.
+     * Only integers, because the tests run with a locale that writes 1,5 for 1.5
+     */
+    std::string toJson(const char* name, const char* mode, double overheadNs) const
+    {
+        std::string escaped;
+        for (const char* p = name; *p; ++p) {
+            if (*p == '"' || *p == '\\') {
+                escaped.push_back('\\');
+            }
+            escaped.push_back(*p);
+        }
+        char buffer[512];
+        snprintf(buffer, sizeof(buffer),
+                 "{\"name\": \"%s\", \"mode\": \"%s\", \"calls\": %lld, \"timer_overhead_ns\": %lld, "
+                 "\"mean_ns\": %lld, \"min_ns\": %llu, \"p50_ns\": %llu, \"p99_ns\": %llu, "
+                 "\"p999_ns\": %llu, \"max_ns\": %llu}",
+                 escaped.c_str(), mode, (long long)_count, (long long)std::llround(overheadNs),
+                 (long long)std::llround(mean()), (unsigned long long)min(), (unsigned long long)percentile(50),
+                 (unsigned long long)percentile(99), (unsigned long long)percentile(99.9),
+                 (unsigned long long)max());
+        return buffer;
+    }
+
+    static int64_t nanoseconds()
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                   std::chrono::steady_clock::now().time_since_epoch())
+            .count();
+    }
+
+private:
+    static const int subBits = 5;
+    static const int subBuckets = 1 << subBits;
+    static const int maxShift = 40;      // tops out at 2 ** 46 ns, most of a day
+    static const int numBuckets = (maxShift + 2) * subBuckets;
+
+    std::vector<int64_t> buckets;
+    int64_t _count = 0;
+    double total = 0;
+    uint64_t _min = UINT64_MAX;
+    uint64_t _max = 0;
+
+    static int bucketIndex(uint64_t ns)
+    {
+        int shift = 0;
+        while ((ns >> shift) >= 2 * subBuckets) {
+            ++shift;
+        }
+        shift = std::min(shift, maxShift);
+        const int index = shift * subBuckets + int(std::min<uint64_t>(ns >> shift, 2 * subBuckets - 1));
+        assert(index < numBuckets);
+        return index;
+    }
+
+    static uint64_t bucketTop(int index)
+    {
+        if (index < 2 * subBuckets) {
+            return uint64_t(index);
+        }
+        const int shift = index / subBuckets - 1;
+        const uint64_t sub = uint64_t(index - shift * subBuckets);
+        return ((sub + 1) << shift) - 1;
+    }
+};
+
+/**
+ * Where the latency json goes. One object per line, so it can be
+ * appended to as the tests run, and read back a line at a time.
+ * Until setJsonFile is called there is no report, and MeasureTime
+ * skips the latency measurements.
+ */
+class LatencyReport
+{
+public:
+    /**
+     * starts a new, empty report
+     */
+    static void setJsonFile(const char* path)
+    {
+        jsonPath() = path;
+        FILE* fp = fopen(path, "w");
+        if (fp) {
+            fclose(fp);
+        }
+    }
+
+    static bool isEnabled()
+    {
+        return !jsonPath().empty();
+    }
+
+    static void write(const std::string& json)
+    {
+        if (!isEnabled()) {
+            return;
+        }
+        FILE* fp = fopen(jsonPath().c_str(), "a");
+        if (!fp) {
+            printf("can't write latency report to %s\n", jsonPath().c_str());
+            return;
+        }
+        fprintf(fp, "%s\n", json.c_str());
+        fclose(fp);
+    }
+
+private:
+    static std::string& jsonPath()
+    {
+        static std::string path;
+        return path;
+    }
+};
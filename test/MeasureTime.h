@@ -3,8 +3,10 @@
 #include "SimdBlocks.h"
 
 #include <functional>
+#include <vector>
 #define __STDC_FORMAT_MACROS 
 #include <inttypes.h>
+#include "LatencyHistogram.h"
 #include "TimeStatsCollector.h"
 
 
@@ -71,9 +73,56 @@ public:
                 done = true;
             }
         }
+        if (LatencyReport::isEnabled()) {
+            runLatency(name, func);
+        }
         return percent;
     }
 
+    /**
+     * Times every call to func, and prints and saves the percentiles.
+     * run() only does this when there is a latency report to put it in.
+     * The average from run() hides spikes, and it's the spikes that underflow the audio buffer.
+     *
+     * This is done twice. Once in a tight loop, where everything func touches stays in cache.
+     * Then again "interleaved", where between calls we read through a buffer much bigger
+     * than the cache, the way all the other modules in a patch would.
+     * That is closer to what happens in VCV.
+     */
+    static void runLatency(const char* name, std::function<T()> func, int64_t calls = 100000)
+    {
+        const double overhead = timerOverhead();
+        for (int interleaved = 0; interleaved < 2; ++interleaved) {
+            const char* mode = interleaved ? "interleaved" : "tight";
+            const LatencyHistogram histogram = measureLatency(func, calls, interleaved, overhead);
+            printf("latency %s (%s) ns: p50=%" PRIu64 " p99=%" PRIu64 " p99.9=%" PRIu64 " max=%" PRIu64 "\n",
+                   name, mode,
+                   uint64_t(histogram.percentile(50)),
+                   uint64_t(histogram.percentile(99)),
+                   uint64_t(histogram.percentile(99.9)),
+                   uint64_t(histogram.max()));
+            LatencyReport::write(histogram.toJson(name, mode, overhead));
+        }
+        fflush(stdout);
+    }
+
+    static LatencyHistogram measureLatency(std::function<T()> func, int64_t calls, bool interleaved, double overhead)
+    {
+        LatencyHistogram histogram;
+        const int64_t overheadNs = int64_t(overhead);
+        for (int64_t i = 0; i < calls; ++i) {
+            if (interleaved) {
+                otherModules();
+            }
+            const int64_t t0 = LatencyHistogram::nanoseconds();
+            const T x = func();
+            const int64_t t1 = LatencyHistogram::nanoseconds();
+            TestBuffers<T>::put(x);
+            histogram.record(t1 - t0 - overheadNs);
+        }
+        return histogram;
+    }
+
    /**
     * Run test iterators time, return total seconds.
     */
@@ -89,6 +138,46 @@ public:
         const double elapsed = t1 - t0;
         return elapsed;
     }
+
+    /**
+     * the median time of reading the clock twice, in ns.
+     */
+    static double timerOverhead()
+    {
+        LatencyHistogram histogram;
+        for (int i = 0; i < 10000; ++i) {
+            const int64_t t0 = LatencyHistogram::nanoseconds();
+            const int64_t t1 = LatencyHistogram::nanoseconds();
+            histogram.record(t1 - t0);
+        }
+        return double(histogram.percentile(50));
+    }
+
+private:
+    /**
+     * Pretend to be the other modules in a patch. Reads the next piece of a buffer
+     * that's too big for the cache, which pushes out some of what the module under test uses.
+     */
+    static void otherModules()
+    {
+        static const size_t cacheLine = 64;
+        static const size_t bytesPerCall = 64 * 1024;
+        static const size_t bufferSize = 64 * 1024 * 1024;
+        static std::vector<uint8_t> buffer(bufferSize, 1);
+        static size_t position = 0;
+        static volatile uint8_t sink = 0;
+
+        uint8_t sum = 0;
+        for (size_t i = 0; i < bytesPerCall; i += cacheLine) {
+            sum += buffer[position + i];
+        }
+        sink = sum;
+        (void)sink;
+        position += bytesPerCall;
+        if (position >= bufferSize) {
+            position = 0;
+        }
+    }
 };
 
 /**
@@ -47,6 +47,10 @@ public:
         }
     }
 
+    void setEOC(int track, bool eoc) override
+    {
+    }
+
     void onLockFailed() override
     {
         ++lockConflicts;
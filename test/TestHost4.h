@@ -69,6 +69,9 @@ public:
             cvValue[voice] = cv;
         }
     }
+    void setEOC(int track, bool eoc) override
+    {
+    }
     void onLockFailed() override
     {
         ++lockConflicts;
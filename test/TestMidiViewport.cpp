@@ -131,12 +131,51 @@ static void testDemoSong()
     assertEQ(std::distance(it.first, it.second), numNotes /2);
 }
 
+// a long note that starts before the viewport still shows up
+static void testNotesInViewport()
+{
+    MidiSongPtr song(std::make_shared<MidiSong>());
+    MidiLocker l(song->lock);
+    song->createTrack(0);
+    auto track = song->getTrack(0);
+
+    MidiNoteEventPtr longNote = std::make_shared<MidiNoteEvent>();
+    longNote->startTime = 10;
+    longNote->duration = 100;
+    longNote->pitchCV = 4;
+    track->insertEvent(longNote);
+
+    MidiNoteEventPtr tooHigh = std::make_shared<MidiNoteEvent>();
+    tooHigh->startTime = 95;
+    tooHigh->duration = 1;
+    tooHigh->pitchCV = 11;
+    track->insertEvent(tooHigh);
+
+    MidiNoteEventPtr atEnd = std::make_shared<MidiNoteEvent>();
+    atEnd->startTime = 110;
+    atEnd->duration = 1;
+    atEnd->pitchCV = 4;
+    track->insertEvent(atEnd);
+
+    MidiEditorContext vp(song, nullptr);
+    vp.setStartTime(90);
+    vp.setEndTime(110);
+    vp.setPitchLow(0);
+    vp.setPitchHi(10);
+
+    std::vector<MidiNoteEventPtr> notes;
+    vp.getNotesInViewport(notes);
+    assertEQ(notes.size(), 1);
+    assert(notes[0] == longNote);
+}
+
 void testMidiViewport()
 {
     assertEvCount(0);
     testReleaseSong();
     testEventAccess();
     testEventFilter();
+    testNotesInViewport();
     testDemoSong();
 
     assertEvCount(0);
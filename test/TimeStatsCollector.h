@@ -1,11 +1,12 @@
 #pragma once
+#include "LatencyHistogram.h"
 #include "SqTime.h"
 
 #include <cstdio>
 
 /**
  * Unfinished time class. Meant to be inserted into other code (like VCV Rack).
- * Averages states over time.
+ * Averages states over time, and keeps a histogram of each start/stop, so spikes show up.
  * Will printf states every now and then.
  * Many ways to improve this - printing from a different thread is one.
  */
@@ -36,9 +37,11 @@ public:
         totalTimeFrame += delta;
         if (delta < minTime) {
             minTime = delta;
-        } else if (delta > maxTime) {
+        }
+        if (delta > maxTime) {
             maxTime = delta;
         }
+        histogram.record(int64_t(delta * 1000.0 * 1000.0 * 1000.0));
 
         if (numDataPoints > 1000) {
             const double avgTime = totalTimeFrame / numDataPoints;
@@ -52,6 +55,11 @@ public:
             printf("\nsrTime=%f avtTime=%f\n", srTime, avgTime);
             printf("this block: %f%% min=%f max=%f globalmax=%f running avg=%f\n",
                 ratio * 100, minTime, maxTime, globalMax, runningAvg * 100);
+            printf("this block (ns): p50=%llu p99=%llu p99.9=%llu\n",
+                (unsigned long long) histogram.percentile(50),
+                (unsigned long long) histogram.percentile(99),
+                (unsigned long long) histogram.percentile(99.9));
+            histogram.clear();
             if (globalMax < maxTime) {
                 globalMax = maxTime;
             }
@@ -71,4 +79,5 @@ private:
     double globalMax = -100000000000;
     double totalTimeGlobal = 0;
     int numFramesInTotal = 0;
+    LatencyHistogram histogram;     // each start / stop in the current frame
 };
\ No newline at end of file
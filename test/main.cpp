@@ -8,6 +8,9 @@
 #include <locale>
 #include <string>
 
+#include "BenchmarkCatalog.h"
+#include "LatencyHistogram.h"
+
 extern void testMidiPlayer2();
 extern void testMidiPlayer4();
 extern void testBiquad();
@@ -18,6 +21,7 @@ extern void testLookupTable();
 extern void testSinOscillator();
 extern void testHilbert();
 extern void testAudioMath();
+extern void testCounterRandom();
 extern void initPerf();
 extern void perfTest();
 extern void perfTest2();
@@ -51,6 +55,7 @@ extern void testVCOAlias();
 extern void testSin();
 extern void testRateConversion();
 extern void testDelay();
+extern void testPluckedStringBank();
 extern void testSpline(bool emit);
 extern void testButterLookup();
 extern void testMidiDataModel();
@@ -59,6 +64,7 @@ extern void testReplaceCommand();
 extern void testUndoRedo();
 extern void testMidiViewport();
 extern void testFilteredIterator();
+extern void testPersistentMultiMap();
 extern void testMidiEvents();
 extern void testMidiControllers();
 extern void testMultiLag();
@@ -83,10 +89,12 @@ extern void testCommChannels();
 extern void testLadder();
 extern void testHighpassFilter();
 extern void calQ();
+extern void genBakedTables();
 extern void testDrumTrigger();
 extern void testAudition();
 extern void testStepRecordInput();
 extern void testMidiFile();
+extern void testMidiTrackCodec();
 extern void testNewSongDataDataCommand();
 extern void testScale();
 extern void testTriad();
@@ -99,13 +107,16 @@ extern void testChaos();
 extern void testOnset();
 extern void testOnset2();
 extern void testWVCO();
+extern void testBankActivity();
 extern void testSub();
 extern void testSimd();
 extern void testSimdLookup();
+extern void testSimdDispatch();
 extern void testSimpleQuantizer();
 extern void testDC();
 extern void testSines();
 extern void testBasic();
+extern void testMipMapWaveTables();
 extern void testFilterComposites();
 extern void testClockRecovery();
 extern void testCompCurves();
@@ -128,6 +139,7 @@ extern void testCompressorII();
 extern void testCompressorParamHolder();
 extern void testStreamer();
 extern void testSampComposite();
+extern void testVoicePool();
 extern void testFlac();
 extern void testHeadingTracker();
 extern void do_gc();
@@ -186,19 +198,25 @@ int main(int argc, char** argv) {
     assert(dp == ',');
 
     bool runPerf = false;
+    bool bench = false;
     bool extended = false;
     bool runShaperGen = false;
     bool cq = false;
+    bool bake = false;
     if (argc > 1) {
         std::string arg = argv[1];
         if (arg == "--ext") {
             extended = true;
         } else if (arg == "--perf") {
             runPerf = true;
+        } else if (arg == "--bench") {
+            bench = true;
         } else if (arg == "--shaper") {
             runShaperGen = true;
         } else if (arg == "--calQ") {
             cq = true;
+        } else if (arg == "--bake") {
+            bake = true;
         } else {
             printf("%s is not a valid command line argument\n", arg.c_str());
         }
@@ -225,7 +243,22 @@ int main(int argc, char** argv) {
         return 0;
     }
 
+    if (bake) {
+        genBakedTables();
+        return 0;
+    }
+
+    if (bench) {
+        // --bench [benchmark options]
+        return BenchmarkCatalog::runCommandLine(argc - 2, argv + 2);
+    }
+
     if (runPerf) {
+        // --perf [latency.jsonl]
+        // latency is only measured when asked for, it's a lot of extra calls.
+        if (argc > 2) {
+            LatencyReport::setJsonFile(argv[2]);
+        }
         initPerf();
         perfTest3();
         perfTest2();
@@ -238,6 +271,7 @@ int main(int argc, char** argv) {
     testGateDelay();
 
     testAudioMath();
+    testCounterRandom();
     testCompCurves();
     testIComposite();
 
@@ -272,6 +306,7 @@ int main(int argc, char** argv) {
     testStreamer();
     testHeadingTracker();
     testRegionPrune();
+    testVoicePool();
     testSampComposite();
 
     testFlac();
@@ -285,10 +320,12 @@ int main(int argc, char** argv) {
     testCompCurves();
 
     testBasic();
+    testMipMapWaveTables();
     testSines();
     testDC();
     testSimd();
     testSimdLookup();
+    testSimdDispatch();
 
     testOscSmoother();
 
@@ -304,6 +341,7 @@ int main(int argc, char** argv) {
     testSub();
     simd_testBiquad();
     testWVCO();
+    testBankActivity();
 
     testSimpleQuantizer();
 
@@ -311,6 +349,7 @@ int main(int argc, char** argv) {
     testCommChannels();
     testMidiEvents();
     testFilteredIterator();
+    testPersistentMultiMap();
     testMidiDataModel();
     testMidiSelectionModel();
     testChaos();
@@ -327,6 +366,7 @@ int main(int argc, char** argv) {
     testUndoRedo();
 
     testMidiFile();
+    testMidiTrackCodec();
     testMidiControllers();
     testMidiEditorSelection();
     testMidiEditorNextPrev();
@@ -357,6 +397,7 @@ int main(int argc, char** argv) {
     testSaw();
     testClockMult();
     testDelay();
+    testPluckedStringBank();
     testPoly();
     testSinOscillator();
     testHilbert();
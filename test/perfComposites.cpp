@@ -0,0 +1,352 @@
+/**
+ * The composites in the benchmark catalog.
+ *
+ * Polyphonic ones run at 1, 4 and 16 channels. The rest are mono, so they just run at 1.
+ * Each one starts from its default parameter values, with its main inputs patched.
+ *
+ * This is the one place a composite's default setup gets measured. perfTest, perfTest2 and perfTest3
+ * only keep what isn't here: other waveforms, modes and settings, and the DSP building blocks.
+ */
+
+#include "BenchmarkCatalog.h"
+#include "TestComposite.h"
+#include "tutil.h"
+
+#include "Basic.h"
+#include "Blank.h"
+#include "CHB.h"
+#include "ChaosKitty.h"
+#include "ColoredNoise.h"
+#include "Compressor.h"
+#include "Compressor2.h"
+#include "DividerX.h"
+#include "DrumTrigger.h"
+#include "EV3.h"
+#include "F2_Poly.h"
+#include "F4.h"
+#include "Filt.h"
+#include "FrequencyShifter.h"
+#include "FunVCOComposite.h"
+#include "GMR2.h"
+#include "Gray.h"
+#include "KSComposite.h"
+#include "LFN.h"
+#include "LFNB.h"
+#include "Mix4.h"
+#include "Mix8.h"
+#include "MixM.h"
+#include "MixStereo.h"
+#include "MidiSong4.h"
+#include "Samp.h"
+#include "Seq4.h"
+#include "Shaper.h"
+#include "Sines.h"
+#include "Slew4.h"
+#include "StochasticGrammar2.h"
+#include "Sub.h"
+#include "Super.h"
+#include "Tremolo.h"
+#include "VocalAnimator.h"
+#include "VocalFilter.h"
+#include "WVCO.h"
+#include "daveguide.h"
+
+static const std::vector<int> mono = {1};
+static const std::vector<int> poly = {1, 4, 16};
+static const std::vector<int> sparse = {16};
+
+template <class Comp>
+static std::shared_ptr<Comp> makeDefault()
+{
+    auto comp = std::make_shared<Comp>();
+    initComposite(*comp);
+    return comp;
+}
+
+/**
+ * connects the ports with this many channels, and puts a gate on the gate port
+ */
+template <class Comp>
+static void patch(Comp& comp, int channels, int port, int gatePort = -1)
+{
+    comp.inputs[port].channels = channels;
+    if (gatePort >= 0) {
+        comp.inputs[gatePort].channels = channels;
+        for (int i = 0; i < channels; ++i) {
+            comp.inputs[gatePort].setVoltage(10, i);
+        }
+    }
+}
+
+/**
+ * Like patch, but only the first channel gets a gate, so the other voices are idle.
+ */
+template <class Comp>
+static void patchSparse(Comp& comp, int channels, int port, int gatePort)
+{
+    patch(comp, channels, port, gatePort);
+    for (int i = 1; i < channels; ++i) {
+        comp.inputs[gatePort].setVoltage(0, i);
+    }
+}
+
+/**
+ * A mono composite that takes nothing but its default setup.
+ */
+template <class Comp>
+static void addMono(const char* name, int input, int output)
+{
+    BenchmarkCatalog::addComposite<Comp>(name, mono, input, output, [](int) {
+        return makeDefault<Comp>();
+    });
+}
+
+/**
+ * For the older composites that init themselves in the constructor.
+ */
+template <class Comp>
+static void addConstructed(const char* name, int input, int output)
+{
+    BenchmarkCatalog::addComposite<Comp>(name, mono, input, output, [](int) {
+        return std::make_shared<Comp>();
+    });
+}
+
+/**
+ * A polyphonic composite where the number of channels on one input sets the polyphony.
+ */
+template <class Comp>
+static void addPoly(const char* name, int input, int output, int channelPort, int gatePort = -1)
+{
+    BenchmarkCatalog::addComposite<Comp>(name, poly, input, output, [channelPort, gatePort](int channels) {
+        auto comp = makeDefault<Comp>();
+        patch(*comp, channels, channelPort, gatePort);
+        return comp;
+    });
+}
+
+static void addOscillators()
+{
+    using B = Basic<TestComposite>;
+    addPoly<B>("Basic", -1, B::MAIN_OUTPUT, B::VOCT_INPUT);
+
+    using CK = ChaosKitty<TestComposite>;
+    BenchmarkCatalog::addComposite<CK>("ChaosKitty", mono, -1, CK::MAIN_OUTPUT, [](int) {
+        auto comp = makeDefault<CK>();
+        comp->onSampleRateChange(44100, 1.f / 44100);
+        return comp;
+    });
+
+    using CB = CHB<TestComposite>;
+    addConstructed<CB>("CHB", -1, CB::MIX_OUTPUT);
+
+    using E = EV3<TestComposite>;
+    addConstructed<E>("EV3", -1, E::MIX_OUTPUT);
+
+    using Fun = FunVCOComposite<TestComposite>;
+    BenchmarkCatalog::addComposite<Fun>("FunVCO", mono, -1, Fun::SAW_OUTPUT, [](int) {
+        auto comp = std::make_shared<Fun>();
+        comp->setSampleRate(44100);
+        initComposite(*comp);
+        return comp;
+    });
+
+    using KS = KSComposite<TestComposite>;
+    BenchmarkCatalog::addComposite<KS>("KS", poly, -1, KS::AUDIO_OUTPUT, [](int channels) {
+        auto comp = makeDefault<KS>();
+        comp->params[KS::OCTAVE_PARAM].value = 4;
+        comp->params[KS::DECAY_PARAM].value = 1;
+        comp->params[KS::DAMPING_PARAM].value = 50;
+        patch(*comp, channels, KS::VOCT_INPUT, KS::GATE_INPUT);
+        for (int i = 0; i < channels; ++i) {
+            comp->inputs[KS::VOCT_INPUT].setVoltage(i / 12.f, i);
+        }
+        return comp;
+    });
+
+    using S = Sines<TestComposite>;
+    addPoly<S>("Sines", -1, S::MAIN_OUTPUT, S::VOCT_INPUT, S::GATE_INPUT);
+    BenchmarkCatalog::addComposite<S>("Sines-sparse", sparse, -1, S::MAIN_OUTPUT, [](int channels) {
+        auto comp = makeDefault<S>();
+        patchSparse(*comp, channels, S::VOCT_INPUT, S::GATE_INPUT);
+        return comp;
+    });
+
+    using Sb = Sub<TestComposite>;
+    addPoly<Sb>("Sub", -1, Sb::MAIN_OUTPUT, Sb::VOCT_INPUT);
+
+    using Sp = Super<TestComposite>;
+    addPoly<Sp>("Super", -1, Sp::MAIN_OUTPUT_LEFT, Sp::CV_INPUT);
+
+    using W = WVCO<TestComposite>;
+    addPoly<W>("WVCO", -1, W::MAIN_OUTPUT, W::VOCT_INPUT);
+    BenchmarkCatalog::addComposite<W>("WVCO-sparse", sparse, -1, W::MAIN_OUTPUT, [](int channels) {
+        auto comp = makeDefault<W>();
+        comp->params[W::ADSR_OUTPUT_LEVEL_PARAM].value = 1;
+        patchSparse(*comp, channels, W::VOCT_INPUT, W::GATE_INPUT);
+        return comp;
+    });
+
+    using Dg = Daveguide<TestComposite>;
+    BenchmarkCatalog::addComposite<Dg>("Daveguide", mono, Dg::AUDIO_INPUT, Dg::AUDIO_OUTPUT, [](int) {
+        return std::make_shared<Dg>();
+    });
+}
+
+static void addFilters()
+{
+    using C1 = Compressor<TestComposite>;
+    BenchmarkCatalog::addComposite<C1>("Compressor", poly, C1::LAUDIO_INPUT, C1::LAUDIO_OUTPUT, [](int channels) {
+        auto comp = makeDefault<C1>();
+        comp->params[C1::NOTBYPASS_PARAM].value = 1;
+        patch(*comp, channels, C1::LAUDIO_INPUT);
+        return comp;
+    });
+
+    using C2 = Compressor2<TestComposite>;
+    BenchmarkCatalog::addComposite<C2>("Compressor2", poly, C2::LAUDIO_INPUT, C2::LAUDIO_OUTPUT, [](int channels) {
+        auto comp = makeDefault<C2>();
+        patch(*comp, channels, C2::LAUDIO_INPUT);
+        comp->params[C2::STEREO_PARAM].value = 0;
+        comp->_initParamOnAllChannels(C2::NOTBYPASS_PARAM, 1);
+        comp->_initParamOnAllChannels(C2::RATIO_PARAM, 3);
+
+        // the current channel is only known after it runs a little
+        C2::ProcessArgs args;
+        args.sampleRate = 44100;
+        args.sampleTime = 1.f / 44100.f;
+        for (int i = 0; i < 40; ++i) {
+            comp->process(args);
+        }
+        comp->ui_setAllChannelsToCurrent();
+        return comp;
+    });
+
+    using F2p = F2_Poly<TestComposite>;
+    addPoly<F2p>("F2_Poly", F2p::AUDIO_INPUT, F2p::AUDIO_OUTPUT, F2p::AUDIO_INPUT);
+
+    using F = F4<TestComposite>;
+    addMono<F>("F4", F::AUDIO_INPUT, F::LP_OUTPUT);
+
+    using Fl = Filt<TestComposite>;
+    addPoly<Fl>("Filt", Fl::L_AUDIO_INPUT, Fl::L_AUDIO_OUTPUT, Fl::L_AUDIO_INPUT);
+
+    using Fs = FrequencyShifter<TestComposite>;
+    addMono<Fs>("FrequencyShifter", Fs::AUDIO_INPUT, Fs::SIN_OUTPUT);
+
+    using Sh = Shaper<TestComposite>;
+    addConstructed<Sh>("Shaper", Sh::INPUT_AUDIO0, Sh::OUTPUT_AUDIO0);
+
+    using T = Tremolo<TestComposite>;
+    addMono<T>("Tremolo", T::AUDIO_INPUT, T::AUDIO_OUTPUT);
+
+    using VA = VocalAnimator<TestComposite>;
+    BenchmarkCatalog::addComposite<VA>("VocalAnimator", mono, VA::AUDIO_INPUT, VA::AUDIO_OUTPUT, [](int) {
+        auto comp = std::make_shared<VA>();
+        comp->setSampleRate(44100);
+        initComposite(*comp);
+        return comp;
+    });
+
+    using VF = VocalFilter<TestComposite>;
+    addPoly<VF>("VocalFilter", VF::AUDIO_INPUT, VF::AUDIO_OUTPUT, VF::AUDIO_INPUT);
+}
+
+static void addNoise()
+{
+    using CN = ColoredNoise<TestComposite>;
+    addMono<CN>("ColoredNoise", -1, CN::AUDIO_OUTPUT);
+
+    using L = LFN<TestComposite>;
+    BenchmarkCatalog::addComposite<L>("LFN", mono, -1, L::OUTPUT, [](int) {
+        auto comp = std::make_shared<L>();
+        comp->setSampleTime(1.f / 44100.f);
+        initComposite(*comp);
+        return comp;
+    });
+
+    using LB = LFNB<TestComposite>;
+    addMono<LB>("LFNB", -1, LB::AUDIO0_OUTPUT);
+}
+
+static void addMixers()
+{
+    using M4 = Mix4<TestComposite>;
+    addMono<M4>("Mix4", M4::AUDIO0_INPUT, M4::CHANNEL0_OUTPUT);
+
+    using M8 = Mix8<TestComposite>;
+    addMono<M8>("Mix8", M8::AUDIO0_INPUT, M8::LEFT_OUTPUT);
+
+    using MM = MixM<TestComposite>;
+    addMono<MM>("MixM", MM::AUDIO0_INPUT, MM::LEFT_OUTPUT);
+
+    using MS = MixStereo<TestComposite>;
+    addMono<MS>("MixStereo", MS::AUDIO0_INPUT, MS::CHANNEL0_OUTPUT);
+}
+
+static void addSequencers()
+{
+    using DX = DividerX<TestComposite>;
+    addMono<DX>("DividerX", DX::MAIN_INPUT, DX::FIRST_OUTPUT);
+
+    using DT = DrumTrigger<TestComposite>;
+    addPoly<DT>("DrumTrigger", -1, DT::GATE0_OUTPUT, DT::CV_INPUT, DT::GATE_INPUT);
+
+    using G2 = GMR2<TestComposite>;
+    BenchmarkCatalog::addComposite<G2>("GMR2", mono, G2::CLOCK_INPUT, G2::TRIGGER_OUTPUT, [](int) {
+        auto comp = std::make_shared<G2>();
+        comp->setSampleRate(44100);
+        initComposite(*comp);
+        comp->setGrammar(StochasticGrammar::getDemoGrammar(StochasticGrammar::DemoGrammar::demo));
+        return comp;
+    });
+
+    using Gr = Gray<TestComposite>;
+    addConstructed<Gr>("Gray", Gr::INPUT_CLOCK, Gr::OUTPUT_MIXED);
+
+    using S4 = Seq4<TestComposite>;
+    BenchmarkCatalog::addComposite<S4>("Seq4", mono, S4::CLOCK_INPUT, S4::CV0_OUTPUT, [](int) {
+        auto song = MidiSong4::makeTest(MidiTrack::TestContent::eightQNotes, 0);
+        return std::make_shared<S4>(song);
+    });
+
+    using Sl = Slew4<TestComposite>;
+    addMono<Sl>("Slew4", Sl::INPUT_TRIGGER0, Sl::OUTPUT_MIX0);
+}
+
+static void addSamplers()
+{
+    using Sa = Samp<TestComposite>;
+    BenchmarkCatalog::addComposite<Sa>("Samp", poly, -1, Sa::AUDIO_OUTPUT, [](int channels) {
+        auto comp = makeDefault<Sa>();
+        comp->_setupPerfTest();
+        patch(*comp, channels, Sa::PITCH_INPUT, Sa::GATE_INPUT);
+        return comp;
+    });
+    BenchmarkCatalog::addComposite<Sa>("Samp-sparse", sparse, -1, Sa::AUDIO_OUTPUT, [](int channels) {
+        auto comp = makeDefault<Sa>();
+        comp->_setupPerfTest();
+        patchSparse(*comp, channels, Sa::PITCH_INPUT, Sa::GATE_INPUT);
+        return comp;
+    });
+
+    // does nothing, so this is the overhead of the catalog itself
+    using Bl = Blank<TestComposite>;
+    addMono<Bl>("Blank", -1, 0);
+}
+
+void registerCompositeBenchmarks()
+{
+    static bool registered = false;
+    if (registered) {
+        return;
+    }
+    registered = true;
+
+    addOscillators();
+    addFilters();
+    addNoise();
+    addMixers();
+    addSequencers();
+    addSamplers();
+}
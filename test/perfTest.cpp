@@ -2,6 +2,7 @@
 #include <time.h>
 #include <cmath>
 #include <limits>
+#include <random>
 
 #include "TestComposite.h"
 #include "AudioMath.h"
@@ -9,30 +10,30 @@
 #include "BiquadParams.h"
 #include "BiquadFilter.h"
 #include "BiquadState.h"
-#include "ColoredNoise.h"
+#include "CounterRandom.h"
 #include "CompCurves.h"
-#include "FrequencyShifter.h"
 #include "HilbertFilterDesigner.h"
 #include "LookupTableFactory.h"
 #include "TestComposite.h"
-#include "Tremolo.h"
-#include "VocalAnimator.h"
-#include "VocalFilter.h"
-#include "LFN.h"
-#include "LFNB.h"
-#include "GMR2.h"
 #include "CHB.h"
 #include "FunVCOComposite.h"
 //#include "EV3.h"
 #include "daveguide.h"
 #include "Shaper.h"
 #include "Super.h"
-#include "KSComposite.h"
 #include "Seq.h"
+#include "MidiEditorContext.h"
+#include "MidiFileProxy.h"
+#include "MidiLock.h"
+#include "MidiSelectionModel.h"
+#include "MidiSong.h"
+#include "MidiTrackCodec.h"
+#include "SmfWriter.h"
 
 //#ifndef _MSC_VER
 #if 1
 #include "WVCO.h"
+#include "SimdDispatch.h"
 #include "Sub.h"
 #include "Sines.h"
 #include "Basic.h"
@@ -41,12 +42,6 @@
 extern double overheadInOut;
 extern double overheadOutOnly;
 
-using Shifter = FrequencyShifter<TestComposite>;
-using Animator = VocalAnimator<TestComposite>;
-using VocFilter = VocalFilter<TestComposite>;
-using Colors = ColoredNoise<TestComposite>;
-using Trem = Tremolo<TestComposite>;
-
 
 #include "MeasureTime.h"
 
@@ -202,151 +197,275 @@ static void testSinLookupf()
         }, 1);
 }
 
-static void testSinLookupSimd()
+static void testSinLookupX4()
 {
     auto params = makeSinTable();
-    MeasureTime<float>::run(overheadInOut, "sin approx bgf simd", [params]() {
-       // float_4 d =  lookupSimd(*params, TestBuffers<float>::get(), true); //LookupTable<float>::lookup(*params, TestBuffers<float>::get());
-        float_4 d = sine2(TestBuffers<float>::get());
+    MeasureTime<float>::run(overheadInOut, "sin table lookup X4", [params]() {
+        float_4 d = LookupTable<float>::lookupSimd(*params, float_4(TestBuffers<float>::get()));
         return d[2];
         }, 1);
 }
 
-static void testCompressorLookup()
+static void testSinLookupSimd()
 {
-    CompCurves::Recipe r;
-    r.ratio = 4;
-    r.kneeWidth = 0;
-    auto table = CompCurves::makeCompGainLookup(r);
-    MeasureTime<float>::run(overheadInOut, "non-uniform comp lookup", [table]() {
+    auto params = makeSinTable();
+    MeasureTime<float>::run(overheadInOut, "sin approx bgf simd", [params]() {
        // float_4 d =  lookupSimd(*params, TestBuffers<float>::get(), true); //LookupTable<float>::lookup(*params, TestBuffers<float>::get());
-       // float_4 d = sine2(TestBuffers<float>::get());
-        float d = CompCurves::lookup(table, TestBuffers<float>::get());
-        return d;
+        float_4 d = sine2(TestBuffers<float>::get());
+        return d[2];
         }, 1);
 }
-#endif
-
 
+/**
+ * What a patch load costs in lookup tables: every module asks the ObjectCache
+ * for the standard tables, and then the patch is cleared and they all go away.
+ */
+static void testStandardTablesStartup()
+{
+    const int reps = 2000;
+    const double t0 = SqTime::seconds();
+    for (int i = 0; i < reps; ++i) {
+        auto a = ObjectCache<float>::getAudioTaper();
+        auto b = ObjectCache<float>::getAudioTaper18();
+        auto c = ObjectCache<float>::getBipolarAudioTaper();
+        auto d = ObjectCache<float>::getBipolarAudioTaper30();
+        auto e = ObjectCache<float>::getBipolarAudioTaper42();
+        auto f = ObjectCache<float>::getSinLookup();
+        auto g = ObjectCache<float>::getMixerPanL();
+        auto h = ObjectCache<float>::getMixerPanR();
+        auto j = ObjectCache<float>::getExp2();
+        auto k = ObjectCache<float>::getExp2ExtendedLow();
+        auto l = ObjectCache<float>::getExp2ExtendedHigh();
+        auto m = ObjectCache<float>::getDb2Gain();
+        auto n = ObjectCache<float>::getTanh5();
+    }
+    const double elapsed = SqTime::seconds() - t0;
+    printf("\nmake all standard tables: %f usec\n", elapsed * 1e6 / reps);
 
-static void testSinLookup()
-{
-    auto params = ObjectCache<float>::getSinLookup();
-    MeasureTime<float>::run(overheadInOut, "sin table lookup", [params]() {
-        float d = LookupTable<float>::lookup(*params, TestBuffers<float>::get());
-        return d;
-        }, 1);
+    const double t1 = SqTime::seconds();
+    for (int i = 0; i < reps; ++i) {
+        CHB<TestComposite> chb;
+    }
+    const double elapsed1 = SqTime::seconds() - t1;
+    printf("construct CHB: %f usec\n", elapsed1 * 1e6 / reps);
+    fflush(stdout);
 }
 
-
-static void testShifter()
+/**
+ * Load time for a big MIDI file, with SmfReader and the old way through smf::MidiFile.
+ */
+static void testMidiFileLoad()
 {
-    Shifter fs;
-
-    fs.setSampleRate(44100);
-    fs.init();
+    const char* path = "_perf_test_load.mid";
+    const int numNotes = 50000;
+    {
+        auto lock = std::make_shared<MidiLock>();
+        MidiLocker l(lock);
+        MidiTrackPtr track = std::make_shared<MidiTrack>(lock);
+        for (int i = 0; i < numNotes; ++i) {
+            MidiNoteEventPtr note = std::make_shared<MidiNoteEvent>();
+            note->startTime = .25f * (i / 4);
+            note->duration = .5f;
+            note->pitchCV = PitchUtils::midiToCV(24 + (i * 7) % 80);
+            track->insertEvent(note);
+        }
+        track->insertEnd(.25f * (numNotes / 4 + 4));
+        const double t0 = SqTime::seconds();
+        SmfWriter::write(track, path);
+        printf("\nsave %d notes: %f ms\n", numNotes, (SqTime::seconds() - t0) * 1000);
+    }
 
-    fs.inputs[Shifter::AUDIO_INPUT].setVoltage(0, 0);
+    const int reps = 5;
+    const double t0 = SqTime::seconds();
+    for (int i = 0; i < reps; ++i) {
+        MidiSongPtr song = MidiFileProxy::load(path);
+        assert(song && song->getTrack(0)->size() == numNotes + 1);
+    }
+    const double elapsed = SqTime::seconds() - t0;
+    printf("load %d notes: %f ms\n", numNotes, elapsed * 1000 / reps);
 
-    assert(overheadInOut >= 0);
-    MeasureTime<float>::run(overheadInOut, "shifter", [&fs]() {
-        fs.inputs[Shifter::AUDIO_INPUT].setVoltage(TestBuffers<float>::get(), 0);
-        fs.step();
-        return fs.outputs[Shifter::SIN_OUTPUT].getVoltage(0);
-        }, 1);
+    const double t1 = SqTime::seconds();
+    for (int i = 0; i < reps; ++i) {
+        MidiSongPtr song = MidiFileProxy::loadSmf(path);
+        assert(song && song->getTrack(0)->size() == numNotes + 1);
+    }
+    const double elapsed1 = SqTime::seconds() - t1;
+    printf("load %d notes with smf::MidiFile: %f ms\n", numNotes, elapsed1 * 1000 / reps);
+    fflush(stdout);
+    remove(path);
 }
 
-static void testAnimator()
+/**
+ * Finding the notes to draw for one frame of the piano roll, on a big track.
+ * Compares the interval index with the old way: scan everything that
+ * starts in the viewport or the two bars before it.
+ */
+static void testNoteRedraw()
 {
-    Animator an;
-
-    an.setSampleRate(44100);
-    an.init();
-
-    an.inputs[Shifter::AUDIO_INPUT].setVoltage(0, 0);;
+    const int numNotes = 50000;
+    MidiSongPtr song = std::make_shared<MidiSong>();
+    {
+        MidiLocker l(song->lock);
+        song->createTrack(0);
+        MidiTrackPtr track = song->getTrack(0);
+        for (int i = 0; i < numNotes; ++i) {
+            MidiNoteEventPtr note = std::make_shared<MidiNoteEvent>();
+            note->startTime = .25f * (i / 4);
+            note->duration = (i % 50) ? .5f : 16.f;
+            note->pitchCV = PitchUtils::midiToCV(24 + (i * 7) % 80);
+            track->insertEvent(note);
+        }
+        track->insertEnd(.25f * (numNotes / 4 + 64));
+    }
 
-    MeasureTime<float>::run(overheadInOut, "animator", [&an]() {
-        an.inputs[Shifter::AUDIO_INPUT].setVoltage(TestBuffers<float>::get(), 0);
-        an.step();
-        return an.outputs[Shifter::SIN_OUTPUT].getVoltage(0);
-        }, 1);
+    MidiEditorContext context(song, nullptr);
+    context.setPitchLow(PitchUtils::midiToCV(48));
+    context.setPitchHi(PitchUtils::midiToCV(72));
+
+    const int frames = 1000;
+    const float lastStart = .25f * (numNotes / 4);
+    std::vector<MidiNoteEventPtr> notes;
+    int found = 0;
+    double t0 = SqTime::seconds();
+    for (int i = 0; i < frames; ++i) {
+        const float start = lastStart * i / frames;
+        context.setTimeRange(start, start + 8);
+        context.getNotesInViewport(notes);
+        found += int(notes.size());
+    }
+    double elapsed = SqTime::seconds() - t0;
+    printf("\nredraw %d notes, interval index: %f us per frame (%d notes)\n", numNotes, elapsed * 1e6 / frames, found);
+
+    found = 0;
+    t0 = SqTime::seconds();
+    for (int i = 0; i < frames; ++i) {
+        const float start = lastStart * i / frames;
+        context.setTimeRange(start, start + 8);
+        auto its = context.getEvents(8.f);
+        for (; its.first != its.second; ++its.first) {
+            ++found;
+        }
+    }
+    elapsed = SqTime::seconds() - t0;
+    printf("redraw %d notes, scan from two bars before: %f us per frame (%d notes)\n", numNotes, elapsed * 1e6 / frames, found);
+    fflush(stdout);
 }
 
+/**
+ * Selection operations on a big track: select all, the isSelected
+ * check that drawing does for every visible note, and the clone
+ * that every edit command does.
+ */
+static void testMidiSelection()
+{
+    const int numNotes = 50000;
+    auto lock = std::make_shared<MidiLock>();
+    MidiLocker l(lock);
+    MidiTrackPtr track = std::make_shared<MidiTrack>(lock);
+    for (int i = 0; i < numNotes; ++i) {
+        MidiNoteEventPtr note = std::make_shared<MidiNoteEvent>();
+        note->startTime = .25f * (i / 4);
+        note->duration = .5f;
+        note->pitchCV = PitchUtils::midiToCV(24 + (i * 7) % 80);
+        track->insertEvent(note);
+    }
+    track->insertEnd(.25f * (numNotes / 4 + 4));
+    std::vector<MidiEventPtr> notes;
+    for (auto it : *track) {
+        notes.push_back(it.second);
+    }
 
-static void testVocalFilter()
-{
-    VocFilter an;
-
-    an.setSampleRate(44100);
-    an.init();
+    MidiSelectionModel selection(nullptr);
+    selection.setAuditionSuppressed(true);
+    const int reps = 10;
+    double t0 = SqTime::seconds();
+    for (int i = 0; i < reps; ++i) {
+        selection.selectAll(track);
+    }
+    printf("\nselect all %d notes: %f ms\n", numNotes, (SqTime::seconds() - t0) * 1000 / reps);
 
-    an.inputs[Shifter::AUDIO_INPUT].setVoltage(0, 0);
+    int found = 0;
+    t0 = SqTime::seconds();
+    for (int i = 0; i < reps; ++i) {
+        for (auto note : notes) {
+            found += selection.isSelected(note) ? 1 : 0;
+        }
+    }
+    printf("isSelected: %f ns per note (%d)\n", (SqTime::seconds() - t0) * 1e9 / (reps * double(numNotes)), found);
 
-    MeasureTime<float>::run(overheadInOut, "vocal filter", [&an]() {
-        an.inputs[Shifter::AUDIO_INPUT].setVoltage(TestBuffers<float>::get(), 0);
-        an.step();
-        return an.outputs[Shifter::SIN_OUTPUT].getVoltage(0);
-        }, 1);
+    t0 = SqTime::seconds();
+    for (int i = 0; i < reps; ++i) {
+        auto cloned = selection.clone();
+        found += cloned->size();
+    }
+    printf("clone selection: %f ms\n", (SqTime::seconds() - t0) * 1000 / reps);
+    fflush(stdout);
 }
 
-static void testColors()
-{
-    Colors co;
-
-    co.setSampleRate(44100);
-    co.init();
-
+/**
+ * Save and load of a long track, the way patches store it
+ */
+static void testTrackCodec()
+{
+    const int numNotes = 50000;
+    auto lock = std::make_shared<MidiLock>();
+    MidiLocker l(lock);
+    MidiTrackPtr track = std::make_shared<MidiTrack>(lock);
+    for (int i = 0; i < numNotes; ++i) {
+        MidiNoteEventPtr note = std::make_shared<MidiNoteEvent>();
+        note->startTime = .25f * (i / 4);
+        note->duration = (i % 3) ? .5f : .33f;
+        note->pitchCV = PitchUtils::midiToCV(24 + (i * 7) % 80);
+        track->insertEvent(note);
+    }
+    track->insertEnd(.25f * (numNotes / 4 + 4));
 
-    MeasureTime<float>::run(overheadInOut, "colors", [&co]() {
-        co.step();
-        return co.outputs[Colors::AUDIO_OUTPUT].getVoltage(0);
-        }, 1);
+    const int reps = 10;
+    size_t size = 0;
+    double t0 = SqTime::seconds();
+    for (int i = 0; i < reps; ++i) {
+        size += MidiTrackCodec::encode(track).size();
+    }
+    printf("\nencode %d notes: %f ms, %f chars per note\n", numNotes,
+        (SqTime::seconds() - t0) * 1000 / reps, double(size) / (reps * double(numNotes)));
+
+    const std::string text = MidiTrackCodec::encode(track);
+    int found = 0;
+    t0 = SqTime::seconds();
+    for (int i = 0; i < reps; ++i) {
+        found += MidiTrackCodec::decode(text, lock)->size();
+    }
+    printf("decode: %f ms (%d)\n", (SqTime::seconds() - t0) * 1000 / reps, found);
+    fflush(stdout);
 }
 
-static void testTremolo()
+static void testCompressorLookup()
 {
-    Trem tr;
-
-    tr.setSampleRate(44100);
-    tr.init();
-
-
-    MeasureTime<float>::run(overheadInOut, "trem", [&tr]() {
-        tr.inputs[Trem::AUDIO_INPUT].setVoltage(TestBuffers<float>::get(), 0);
-        tr.step();
-        return tr.outputs[Trem::AUDIO_OUTPUT].getVoltage(0);
+    CompCurves::Recipe r;
+    r.ratio = 4;
+    r.kneeWidth = 0;
+    auto table = CompCurves::makeCompGainLookup(r);
+    MeasureTime<float>::run(overheadInOut, "non-uniform comp lookup", [table]() {
+       // float_4 d =  lookupSimd(*params, TestBuffers<float>::get(), true); //LookupTable<float>::lookup(*params, TestBuffers<float>::get());
+       // float_4 d = sine2(TestBuffers<float>::get());
+        float d = CompCurves::lookup(table, TestBuffers<float>::get());
+        return d;
         }, 1);
 }
+#endif
 
-static void testLFN()
-{
-    LFN<TestComposite> lfn;
 
-    lfn.setSampleTime(1.0f / 44100.f);
-    lfn.init();
 
-    MeasureTime<float>::run(overheadOutOnly, "lfn", [&lfn]() {
-        lfn.step();
-        return lfn.outputs[LFN<TestComposite>::OUTPUT].getVoltage(0);
+static void testSinLookup()
+{
+    auto params = ObjectCache<float>::getSinLookup();
+    MeasureTime<float>::run(overheadInOut, "sin table lookup", [params]() {
+        float d = LookupTable<float>::lookup(*params, TestBuffers<float>::get());
+        return d;
         }, 1);
 }
 
-static void testLFNB()
-{
-    LFNB<TestComposite> lfn;
-
- 
-
- //   lfn.setSampleTime(1.0f / 44100.f);
-    lfn.onSampleRateChange();
-    lfn.init();
-    
 
-    MeasureTime<float>::run(overheadOutOnly, "lfnb", [&lfn]() {
-        lfn.step();
-        return lfn.outputs[LFNB<TestComposite>::AUDIO0_OUTPUT].getVoltage(0);
-        }, 1);
-}
 #if 0
 static void testEvenOrig()
 {
@@ -486,27 +605,6 @@ static void testEvenSqSaw()
 }
 #endif
 
-static void testFun()
-{
-    FunVCOComposite<TestComposite> lfn;
-
-    for (int i = 0; i < lfn.NUM_OUTPUTS; ++i) {
-        lfn.outputs[i].channels = 1;
-    }
-
-    lfn.setSampleRate(44100.f);
-    const bool isAnalog = false;
-    lfn.params[FunVCOComposite<TestComposite>::MODE_PARAM].value = isAnalog ? 1.0f : 0.f;
-
-    MeasureTime<float>::run(overheadOutOnly, "Fun all on, digital", [&lfn]() {
-        lfn.step();
-        return lfn.outputs[FunVCOComposite<TestComposite>::TRI_OUTPUT].getVoltage(0) +
-            lfn.outputs[FunVCOComposite<TestComposite>::SAW_OUTPUT].getVoltage(0) +
-            lfn.outputs[FunVCOComposite<TestComposite>::SIN_OUTPUT].getVoltage(0) +
-            lfn.outputs[FunVCOComposite<TestComposite>::SQR_OUTPUT].getVoltage(0);
-        }, 1);
-}
-
 static void testFunNone()
 {
     FunVCOComposite<TestComposite> lfn;
@@ -581,55 +679,7 @@ static void testFunSq()
         }, 1);
 }
 
-static void testCHBdef()
-{
-    CHB<TestComposite> chb;
-    std::string name = "chbdef ";
-    MeasureTime<float>::run(overheadOutOnly, name.c_str(), [&chb]() {
-        chb.step();
-        return chb.outputs[CHB<TestComposite>::MIX_OUTPUT].getVoltage(0);
-        }, 1);
-}
-
-#if 0
-static void testEV3()
-{
-    EV3<TestComposite> ev3;
-
-    MeasureTime<float>::run(overheadOutOnly, "ev3", [&ev3]() {
-        ev3.step();
-        return ev3.outputs[EV3<TestComposite>::MIX_OUTPUT].value;
-        }, 1);
-}
-#endif
-
-static void testGMR()
-{
-    GMR2<TestComposite> gmr;
-
-    gmr.setSampleRate(44100);
-    gmr.init();
-
-    MeasureTime<float>::run(overheadOutOnly, "gmr2", [&gmr]() {
-        gmr.step();
-        return gmr.outputs[GMR2<TestComposite>::TRIGGER_OUTPUT].getVoltage(0);
-        }, 1);
-}
-
-#if 0
-static void testDG()
-{
-    Daveguide<TestComposite> dg;
 
-   // gmr.setSampleRate(44100);
-   // gmr.init();
-
-    MeasureTime<float>::run(overheadOutOnly, "dg", [&gmr]() {
-        dg.step();
-        return dg.outputs[Daveguide<TestComposite>::AUDIO_OUTPUT].getVoltage(0);
-        }, 1);
-}
-#endif
 
 // 95
 // down to 67 for just the oversampler.
@@ -693,16 +743,18 @@ static void simd_testBiquad()
         }, 1);
 }
 
-static void testWVCOPoly()
+static void testWVCOPoly(SimdDispatch::Level level)
 {
     printf("starting poly svco\n"); fflush(stdout);
+    SimdDispatch::_setLevel(level);
+    std::string name = std::string("wvco poly 8 ") + SimdDispatch::getLevelName(level);
     WVCO<TestComposite> wvco;
 
     wvco.init();
     wvco.inputs[WVCO<TestComposite>::MAIN_OUTPUT].channels = 8;
     wvco.inputs[WVCO<TestComposite>::VOCT_INPUT].channels = 8;
     wvco.params[WVCO<TestComposite>::WAVE_SHAPE_PARAM].value  = 0;
-    MeasureTime<float>::run(overheadOutOnly, "wvco poly 8", [&wvco]() {
+    MeasureTime<float>::run(overheadOutOnly, name.c_str(), [&wvco]() {
         wvco.step();
         return wvco.outputs[WVCO<TestComposite>::MAIN_OUTPUT].getVoltage(0) + 
             wvco.outputs[WVCO<TestComposite>::MAIN_OUTPUT].getVoltage(1) + 
@@ -715,15 +767,16 @@ static void testWVCOPoly()
     }, 1);
 }
 
-static void testBasic(const std::string& name, Basic<TestComposite>::Waves waveform, bool dynamicCV)
+static void testBasic(const std::string& name, Basic<TestComposite>::Waves waveform, bool dynamicCV, bool lite = false)
 {
     printf("starting %s\n", name.c_str()); fflush(stdout);
     Basic<TestComposite> vco;
 
     vco.init();
-    vco.inputs[Basic<TestComposite>::MAIN_OUTPUT].channels = 1;
+    vco.outputs[Basic<TestComposite>::MAIN_OUTPUT].channels = 1;
     vco.inputs[Basic<TestComposite>::VOCT_INPUT].channels = 1;
     vco.params[Basic<TestComposite>::WAVEFORM_PARAM].value = float(waveform);
+    vco.params[Basic<TestComposite>::LITE_PARAM].value = lite ? 1.f : 0.f;
 
 
     Basic<TestComposite>::ProcessArgs args;
@@ -760,6 +813,22 @@ static void testBasic1SqDyn()
 {
    testBasic("basic sq 1 dyn", Basic<TestComposite>::Waves::SQUARE, true);
 }
+static void testBasic1SawLite()
+{
+   testBasic("basic saw 1 lite", Basic<TestComposite>::Waves::SAW, false, true);
+}
+static void testBasic1SqLite()
+{
+   testBasic("basic sq 1 lite", Basic<TestComposite>::Waves::SQUARE, false, true);
+}
+static void testBasic1Even()
+{
+   testBasic("basic even 1", Basic<TestComposite>::Waves::EVEN, false);
+}
+static void testBasic1EvenLite()
+{
+   testBasic("basic even 1 lite", Basic<TestComposite>::Waves::EVEN, false, true);
+}
 
 static void testBasic1Sin()
 {
@@ -767,7 +836,7 @@ static void testBasic1Sin()
     Basic<TestComposite> vco;
 
     vco.init();
-    vco.inputs[Basic<TestComposite>::MAIN_OUTPUT].channels = 1;
+    vco.outputs[Basic<TestComposite>::MAIN_OUTPUT].channels = 1;
     vco.inputs[Basic<TestComposite>::VOCT_INPUT].channels = 1;
     vco.params[Basic<TestComposite>::WAVEFORM_PARAM].value = float(Basic<TestComposite>::Waves::SIN);
 
@@ -788,7 +857,7 @@ static void testBasic1Saw()
     Basic<TestComposite> vco;
 
     vco.init();
-    vco.inputs[Basic<TestComposite>::MAIN_OUTPUT].channels = 1;
+    vco.outputs[Basic<TestComposite>::MAIN_OUTPUT].channels = 1;
     vco.inputs[Basic<TestComposite>::VOCT_INPUT].channels = 1;
     vco.params[Basic<TestComposite>::WAVEFORM_PARAM].value = float(Basic<TestComposite>::Waves::SAW);
 
@@ -883,65 +952,22 @@ static void testOrgan12()
     }, 1);
 }
 
-static void testSubMono()
-{
-    Sub<TestComposite> sub;
-
-    sub.init();
-    sub.inputs[Sub<TestComposite>::MAIN_OUTPUT].channels = 1;
-    sub.inputs[Sub<TestComposite>::VOCT_INPUT].channels = 1;
-
-    MeasureTime<float>::run(overheadOutOnly, "Sub mono", [&sub]() {
-        sub.step();
-        return sub.outputs[WVCO<TestComposite>::MAIN_OUTPUT].getVoltage(0);
-    }, 1);
-}
-
-static void testSubPoly()
+static void testSubPoly(bool lite = false)
 {
     Sub<TestComposite> sub;
 
     sub.init();
     sub.inputs[Sub<TestComposite>::MAIN_OUTPUT].channels = 8;
     sub.inputs[Sub<TestComposite>::VOCT_INPUT].channels = 8;
+    sub.params[Sub<TestComposite>::LITE_PARAM].value = lite ? 1.f : 0.f;
 
-    MeasureTime<float>::run(overheadOutOnly, "Sub poly 8", [&sub]() {
+    MeasureTime<float>::run(overheadOutOnly, lite ? "Sub poly 8 lite" : "Sub poly 8", [&sub]() {
         sub.step();
         return sub.outputs[WVCO<TestComposite>::MAIN_OUTPUT].getVoltage(0);
     }, 1);
 }
 #endif
 
-static void testSuper()
-{
-    Super<TestComposite> super;
-
-    MeasureTime<float>::run(overheadOutOnly, "super", [&super]() {
-        super.step();
-        return super.outputs[Super<TestComposite>::MAIN_OUTPUT_LEFT].getVoltage(0);
-    }, 1);
-}
-
-
-static void testSuperPoly()
-{
-    Super<TestComposite> super;
-
-    super.inputs[Super<TestComposite>::MAIN_OUTPUT_LEFT].channels = 8;
-    super.inputs[Super<TestComposite>::CV_INPUT].channels = 8;
-    MeasureTime<float>::run(overheadOutOnly, "super poly 8 1X", [&super]() {
-        super.step();
-        return super.outputs[Super<TestComposite>::MAIN_OUTPUT_LEFT].getVoltage(0) + 
-            super.outputs[Super<TestComposite>::MAIN_OUTPUT_LEFT].getVoltage(1) + 
-            super.outputs[Super<TestComposite>::MAIN_OUTPUT_LEFT].getVoltage(2) + 
-            super.outputs[Super<TestComposite>::MAIN_OUTPUT_LEFT].getVoltage(3) + 
-            super.outputs[Super<TestComposite>::MAIN_OUTPUT_LEFT].getVoltage(4) + 
-            super.outputs[Super<TestComposite>::MAIN_OUTPUT_LEFT].getVoltage(5) + 
-            super.outputs[Super<TestComposite>::MAIN_OUTPUT_LEFT].getVoltage(6) + 
-            super.outputs[Super<TestComposite>::MAIN_OUTPUT_LEFT].getVoltage(7);
-    }, 1);
-}
-
 static void testSuperStereo()
 {
     Super<TestComposite> super;
@@ -1011,14 +1037,15 @@ static void testSuper2()
 }
 #endif
 
-static void testKS()
+// the scalar delay line KS and Daveguide used to run, for comparison
+static void testRecirculatingDelay()
 {
-    KSComposite<TestComposite> gmr;
+    RecirculatingFractionalDelay delay(4096);
+    delay.setDelay(100.5f);
+    delay.setFeedback(.99f);
 
-    MeasureTime<float>::run(overheadOutOnly, "ks", [&gmr]() {
-       // gmr.inputs[KSComposite<TestComposite>::INPUT_AUDIO].value = TestBuffers<float>::get();
-        gmr.step();
-        return gmr.outputs[KSComposite<TestComposite>::SQR_OUTPUT].getVoltage(0);
+    MeasureTime<float>::run(overheadInOut, "recirculating delay mono", [&delay]() {
+        return delay.run(TestBuffers<float>::get());
         }, 1);
 }
 
@@ -1135,73 +1162,30 @@ static void testAttenuverters()
 }
 #endif
 
-#if 0
-static void testNoise(bool useDefault)
+/**
+ * noise throughput. The CounterRandom block calls make eight numbers each.
+ */
+static void testRandom()
 {
-
-    std::default_random_engine defaultGenerator{99};
-    std::random_device rd{};
-    std::mt19937 gen{rd()};
+    std::default_random_engine generator{57};
     std::normal_distribution<double> distribution{0, 1.0};
-
-    std::string title = useDefault ? "default random" : "fancy random";
-
-    MeasureTime<float>::run(overheadOutOnly, title.c_str(), [useDefault, &distribution, &defaultGenerator, &gen]() {
-        if (useDefault) return distribution(defaultGenerator);
-        else return distribution(gen);
+    MeasureTime<float>::run(overheadOutOnly, "std normal_distribution", [&distribution, &generator]() {
+        return float(distribution(generator));
         }, 1);
-}
-
 
-static uint64_t xoroshiro128plus_state[2] = {};
-
-static uint64_t rotl(const uint64_t x, int k)
-{
-    return (x << k) | (x >> (64 - k));
-}
-
-static uint64_t xoroshiro128plus_next(void)
-{
-    const uint64_t s0 = xoroshiro128plus_state[0];
-    uint64_t s1 = xoroshiro128plus_state[1];
-    const uint64_t result = s0 + s1;
-
-    s1 ^= s0;
-    xoroshiro128plus_state[0] = rotl(s0, 55) ^ s1 ^ (s1 << 14); // a, b
-    xoroshiro128plus_state[1] = rotl(s1, 36); // c
-
-    return result;
-}
-
-float randomUniformX()
-{
-    // 24 bits of granularity is the best that can be done with floats while ensuring that the return value lies in [0.0, 1.0).
-    return (xoroshiro128plus_next() >> (64 - 24)) / powf(2, 24);
-}
-
-float randomNormalX()
-{
-    // Box-Muller transform
-    float radius = sqrtf(-2.f * logf(1.f - randomUniformX()));
-    float theta = 2.f * M_PI * randomUniformX();
-    return radius * sinf(theta);
-
-    // // Central Limit Theorem
-    // const int n = 8;
-    // float sum = 0.0;
-    // for (int i = 0; i < n; i++) {
-    // 	sum += randomUniform();
-    // }
-    // return (sum - n / 2.f) / sqrtf(n / 12.f);
-}
-
-static void testNormal()
-{
-    MeasureTime<float>::run(overheadOutOnly, "normal", []() {
-        return randomNormalX();
+    CounterRandom random(57);
+    MeasureTime<float>::run(overheadOutOnly, "CounterRandom gaussian", [&random]() {
+        return random.gaussian();
+        }, 1);
+    MeasureTime<float>::run(overheadOutOnly, "CounterRandom gaussian8 (8 values)", [&random]() {
+        const float_8 x = random.gaussian8();
+        return x.lo[0] + x.hi[3];
+        }, 1);
+    MeasureTime<float>::run(overheadOutOnly, "CounterRandom uniform8 (8 values)", [&random]() {
+        const float_8 x = random.uniform8();
+        return x.lo[0] + x.hi[3];
         }, 1);
 }
-#endif
 
 void dummy()
 {
@@ -1217,16 +1201,11 @@ void perfTest()
     assert(overheadInOut > 0);
     assert(overheadOutOnly > 0);
 
-     testVocalFilter();
-#if 0
-    testColors();
-   
-    testAnimator();
-    testTremolo();
-  
-    testShifter();
-    testGMR();
-#endif
+     testStandardTablesStartup();
+     testMidiFileLoad();
+     testNoteRedraw();
+     testMidiSelection();
+     testTrackCodec();
 #ifndef _MSC_VER
     testBasic1Tri();
     testBasic1TriDyn();
@@ -1234,18 +1213,23 @@ void perfTest()
     testBasic1Saw();
     testBasic1Sq();
     testBasic1SqDyn();
+    testBasic1SawLite();
+    testBasic1SqLite();
+    testBasic1Even();
+    testBasic1EvenLite();
     testOrgan1();
     testOrgan4();
     testOrgan4VCO();
     testOrgan12();
-    testSuper();
-    testSuperPoly();
-    testWVCOPoly();
-    testSubMono();
-    testSubPoly();
+    testWVCOPoly(SimdDispatch::Level::SSE);
+    if (SimdDispatch::cpuHasAVX2()) {
+        testWVCOPoly(SimdDispatch::Level::AVX2);
+    }
+    testSubPoly(true);
     simd_testBiquad();
     testSinLookup();
     testSinLookupf();
+    testSinLookupX4();
     testSinLookupSimd();
     simd_testSin();
     testCompressorLookup();
@@ -1258,13 +1242,11 @@ void perfTest()
     testSuper2();
     testSuper2Stereo();
     testSuper3();
-  //  testKS();
+    testRecirculatingDelay();
   //  testShaper1a();
-    testLFN();
-    testLFNB();
+    testRandom();
 
 
-    testCHBdef();
 #if 0
     testShaper1b();
     testShaper1c();
@@ -1274,7 +1256,6 @@ void perfTest()
     testShaper5();
 #endif
 
-   // testEV3();
 
     testFunSaw(true);
 #if 0
@@ -1282,7 +1263,6 @@ void perfTest()
     testFunSin(true);
     testFunSin(false);
     testFunSq();
-    testFun();
     testFunNone();
 #endif
 
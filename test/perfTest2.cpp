@@ -1,17 +1,11 @@
 #include "Compressor.h"
 #include "Compressor2.h"
-#include "DrumTrigger.h"
 #include "F2_Poly.h"
 #include "Filt.h"
 #include "LookupTable.h"
 #include "MeasureTime.h"
-#include "Mix4.h"
-#include "Mix8.h"
-#include "MixM.h"
-#include "MixStereo.h"
 #include "MultiLag.h"
 #include "ObjectCache.h"
-#include "Slew4.h"
 #include "TestComposite.h"
 #include "tutil.h"
 
@@ -138,59 +132,7 @@ static void testNonUniform() {
     abort();
 }
 
-using Slewer = Slew4<TestComposite>;
-
-static void testSlew4() {
-    Slewer fs;
-
-    fs.init();
-
-    fs.inputs[Slewer::INPUT_AUDIO0].setVoltage(0, 0);
-
-    assert(overheadInOut >= 0);
-    MeasureTime<float>::run(
-        overheadInOut, "Slade", [&fs]() {
-            fs.inputs[Slewer::INPUT_TRIGGER0].setVoltage(TestBuffers<float>::get(), 0);
-            fs.step();
-            return fs.outputs[Slewer::OUTPUT0].getVoltage(0);
-        },
-        1);
-}
-
-using DT = DrumTrigger<TestComposite>;
-static void testDrumTrigger() {
-    DT fs;
-    fs.init();
-    fs.inputs[DT::CV_INPUT].channels = 1;
-    fs.inputs[DT::CV_INPUT].channels = 8;
-    fs.outputs[DT::GATE0_OUTPUT].channels = 1;
-    fs.outputs[DT::GATE0_OUTPUT].channels = 8;
-    assert(overheadInOut >= 0);
-    MeasureTime<float>::run(
-        overheadInOut, "Polygate", [&fs]() {
-            fs.inputs[DT::CV_INPUT].setVoltage(TestBuffers<float>::get(), 0);
-            fs.step();
-            return fs.outputs[DT::GATE0_OUTPUT].getVoltage(0);
-        },
-        1);
-}
-
 using Filter = Filt<TestComposite>;
-static void testFilt() {
-    Filter fs;
-    fs.init();
-    fs.inputs[Filter::L_AUDIO_INPUT].channels = 1;
-    fs.outputs[Filter::L_AUDIO_OUTPUT].channels = 1;
-    assert(overheadInOut >= 0);
-    MeasureTime<float>::run(
-        overheadInOut, "filt", [&fs]() {
-            fs.inputs[Filter::L_AUDIO_INPUT].setVoltage(TestBuffers<float>::get(), 0);
-            fs.step();
-            return fs.outputs[Filter::L_AUDIO_OUTPUT].getVoltage(0);
-        },
-        1);
-}
-
 static void testFilt2() {
     Filter fs;
     fs.init();
@@ -207,92 +149,19 @@ static void testFilt2() {
         1);
 }
 
-using Mixer8 = Mix8<TestComposite>;
-static void testMix8() {
-    Mixer8 fs;
+static void testLadderVoicing(LadderFilter<float>::Voicing voicing) {
+    LadderFilter<float> filter;
+    filter.setType(LadderFilter<float>::Types::_2HP1LP);
+    filter.setVoicing(voicing);
+    filter.setNormalizedFc(.02f);
+    filter.setFeedback(2.5f);
+    filter.setVolume(.5f);
 
-    fs.init();
-
-    fs.inputs[fs.AUDIO0_INPUT].setVoltage(0, 0);
-
-    assert(overheadInOut >= 0);
+    const std::string name = "ladder " + LadderFilter<float>::getVoicingNames()[int(voicing)];
     MeasureTime<float>::run(
-        overheadInOut, "mix8", [&fs]() {
-            fs.inputs[Slewer::INPUT_TRIGGER0].setVoltage(TestBuffers<float>::get(), 0);
-            fs.step();
-            return fs.outputs[Slewer::OUTPUT0].getVoltage(0);
-        },
-        1);
-}
-
-using Mixer4 = Mix4<TestComposite>;
-static void testMix4() {
-    Mixer4 fs;
-    fs.init();
-    fs.inputs[fs.AUDIO0_INPUT].setVoltage(0, 0);
-
-    assert(overheadInOut >= 0);
-    MeasureTime<float>::run(
-        overheadInOut, "mix4", [&fs]() {
-            fs.inputs[Slewer::INPUT_TRIGGER0].setVoltage(TestBuffers<float>::get(), 0);
-            fs.step();
-            return fs.outputs[Slewer::OUTPUT0].getVoltage(0);
-        },
-        1);
-}
-
-using MixerSt = MixStereo<TestComposite>;
-static void testMixStereo() {
-    MixerSt fs;
-    fs.init();
-    fs.inputs[fs.AUDIO0_INPUT].setVoltage(0, 0);
-
-    assert(overheadInOut >= 0);
-    MeasureTime<float>::run(
-        overheadInOut, "mix stereo", [&fs]() {
-            fs.inputs[Slewer::INPUT_TRIGGER0].setVoltage(TestBuffers<float>::get(), 0);
-            fs.step();
-            return fs.outputs[Slewer::OUTPUT0].getVoltage(0);
-        },
-        1);
-}
-
-using MixerM = MixM<TestComposite>;
-static void testMixM() {
-    MixerM fs;
-
-    fs.init();
-
-    fs.inputs[fs.AUDIO0_INPUT].setVoltage(0, 0);
-
-    assert(overheadInOut >= 0);
-    MeasureTime<float>::run(
-        overheadInOut, "mixM", [&fs]() {
-            fs.inputs[Slewer::INPUT_TRIGGER0].setVoltage(TestBuffers<float>::get());
-            fs.step();
-            return fs.outputs[Slewer::OUTPUT0].getVoltage(0);
-        },
-        1);
-}
-
-static void testF2_Poly1() {
-    using Comp = F2_Poly<TestComposite>;
-    Comp comp;
-
-    comp.init();
-
-    comp.inputs[Comp::AUDIO_INPUT].setVoltage(0, 0);
-    comp.inputs[Comp::AUDIO_INPUT].channels = 1;
-
-    Comp::ProcessArgs args;
-    args.sampleTime = 1.f / 44100.f;
-    args.sampleRate = 44100;
-
-    MeasureTime<float>::run(
-        overheadInOut, "testF2:a mono 12/Lim", [&comp, args]() {
-            comp.inputs[Comp::AUDIO_INPUT].setVoltage(TestBuffers<float>::get());
-            comp.process(args);
-            return comp.outputs[Comp::AUDIO_OUTPUT].getVoltage(0);
+        overheadInOut, name.c_str(), [&filter]() {
+            filter.run(TestBuffers<float>::get());
+            return filter.getOutput();
         },
         1);
 }
@@ -783,7 +652,6 @@ void perfTest2() {
     testCompKnee16Hard();
 
     testF2_24l();
-    testF2_Poly1();
     testF2_Poly16();
     testF2_12nl();
     testF2_24l();
@@ -791,14 +659,10 @@ void perfTest2() {
     testF2_24l_4();
     testF2_g();
 
-    testDrumTrigger();
-    testFilt();
     testFilt2();
-    testSlew4();
-    testMixStereo();
-    testMix8();
-    testMix4();
-    testMixM();
+    for (int i = 0; i < int(LadderFilter<float>::Voicing::NUM_VOICINGS); ++i) {
+        testLadderVoicing(LadderFilter<float>::Voicing(i));
+    }
 
     testUniformLookup();
     testNonUniform();
@@ -1,7 +1,12 @@
 
 
 #include "MeasureTime.h"
+#include "CompiledInstrument.h"
+#include "SInstrument.h"
+#include "SParse.h"
+#include "SamplerErrorContext.h"
 #include "Samp.h"
+#include "SqTime.h"
 
 extern double overheadOutOnly;
 extern double overheadInOut;
@@ -27,53 +32,6 @@ static void testSamp1() {
         1);
 }
 
-static void testSamp2() {
-    using Comp = Samp<TestComposite>;
-    Comp comp;
-
-    comp.init();
-    comp._setupPerfTest();
-    comp.inputs[Comp::PITCH_INPUT].channels = 1;
-    comp.inputs[Comp::GATE_INPUT].channels = 1;
-    comp.inputs[Comp::GATE_INPUT].setVoltage(10, 0);  // 10v gate in input 0
-
-    Comp::ProcessArgs args;
-    args.sampleTime = 1.f / 44100.f;
-    args.sampleRate = 44100;
-    MeasureTime<float>::run(
-        overheadInOut, "sampler play one note", [&comp, args]() {
-            // comp.inputs[Comp::A_INPUT].setVoltage(TestBuffers<float>::get());
-            comp.process(args);
-            return comp.outputs[Comp::AUDIO_OUTPUT].getVoltage(0);
-        },
-        1);
-}
-
-static void testSamp3() {
-    using Comp = Samp<TestComposite>;
-    Comp comp;
-
-    comp.init();
-    comp._setupPerfTest();
-    comp.inputs[Comp::PITCH_INPUT].channels = 16;
-    comp.inputs[Comp::GATE_INPUT].channels = 16;
-
-    for (int i = 0; i < 16; ++i) {
-        comp.inputs[Comp::GATE_INPUT].setVoltage(10, i);  // 10v gate in input 0
-    }
-
-    Comp::ProcessArgs args;
-    args.sampleTime = 1.f / 44100.f;
-    args.sampleRate = 44100;
-    MeasureTime<float>::run(
-        overheadInOut, "sampler play 16 note", [&comp, args]() {
-            // comp.inputs[Comp::A_INPUT].setVoltage(TestBuffers<float>::get());
-            comp.process(args);
-            return comp.outputs[Comp::AUDIO_OUTPUT].getVoltage(0);
-        },
-        1);
-}
-
 static void testSamp4() {
     using Comp = Samp<TestComposite>;
     Comp comp;
@@ -102,39 +60,80 @@ static void testSamp4() {
         1);
 }
 
-static void testSamp5() {
-    using Comp = Samp<TestComposite>;
-    Comp comp;
-
-    comp.init();
-    comp._setupPerfTest();
-    comp.inputs[Comp::PITCH_INPUT].channels = 4;
-    comp.inputs[Comp::GATE_INPUT].channels = 4;
-  //  comp.inputs[Comp::FM_INPUT].channels = 1;
+/**
+ * A piano-ish patch: one region per key and velocity layer, two round robins each.
+ */
+static std::string makePianoPatch() {
+    std::string patch;
+    for (int key = 21; key <= 108; ++key) {
+        for (int layer = 0; layer < 4; ++layer) {
+            const std::string lovel = std::to_string(layer * 32 + 1);
+            const std::string hivel = std::to_string(std::min(127, layer * 32 + 32));
+            for (int rr = 1; rr <= 2; ++rr) {
+                patch += "<region> key=" + std::to_string(key) + " lovel=" + lovel + " hivel=" + hivel +
+                         " seq_length=2 seq_position=" + std::to_string(rr) + " sample=a\n";
+            }
+        }
+    }
+    return patch;
+}
 
-    for (int i = 0; i < 4; ++i) {
-        comp.inputs[Comp::GATE_INPUT].setVoltage(10, i);  // 10v gate in input 0
-        
+/**
+ * How long it takes to load a big instrument, not counting the samples.
+ * Parse and compile are timed separately.
+ */
+static void testSfzCompile() {
+    const std::string patch = makePianoPatch();
+    const int reps = 50;
+    double parseTime = 0;
+    double compileTime = 0;
+    size_t regions = 0;
+    for (int i = 0; i < reps; ++i) {
+        SInstrumentPtr inst = std::make_shared<SInstrument>();
+        const double t0 = SqTime::seconds();
+        auto err = SParse::go(patch, inst);
+        const double t1 = SqTime::seconds();
+        assert(err.empty());
+
+        SamplerErrorContext errc;
+        CompiledInstrumentPtr cinst = CompiledInstrument::make(errc, inst);
+        const double t2 = SqTime::seconds();
+        parseTime += t1 - t0;
+        compileTime += t2 - t1;
+        regions = cinst->_pool().size();
     }
+    printf("\nsfz parse %d regions: %f ms\n", int(regions), parseTime * 1000 / reps);
+    printf("sfz compile %d regions: %f ms\n", int(regions), compileTime * 1000 / reps);
+    fflush(stdout);
+}
 
-    Comp::ProcessArgs args;
-    args.sampleTime = 1.f / 44100.f;
-    args.sampleRate = 44100;
-    MeasureTime<float>::run(
-        overheadInOut, "sampler play 4 note with no mod", [&comp, args]() {
-           // comp.inputs[Comp::FM_INPUT].setVoltage(TestBuffers<float>::get());
+static void testRegionPoolPlay() {
+    SInstrumentPtr inst = std::make_shared<SInstrument>();
+    auto err = SParse::go(makePianoPatch(), inst);
+    assert(err.empty());
+    SamplerErrorContext errc;
+    CompiledInstrumentPtr cinst = CompiledInstrument::make(errc, inst);
+    RegionPool& pool = cinst->_pool();
 
-            comp.process(args);
-            return comp.outputs[Comp::AUDIO_OUTPUT].getVoltage(0);
+    VoicePlayParameter params;
+    int note = 0;
+    MeasureTime<float>::run(
+        overheadOutOnly, "region pool play", [&pool, &params, &note]() {
+            params.midiPitch = 21 + (note % 88);
+            params.midiVelocity = 1 + ((note * 7) % 127);
+            ++note;
+            bool didKS = false;
+            const CompiledRegion* region = pool.play(params, .5f, didKS);
+            return region ? float(region->lokey) : 0.f;
         },
         1);
 }
+
 void perfTest3() {
     assert(overheadInOut > 0);
     assert(overheadOutOnly > 0);
   //  testSamp1();
-  //  testSamp2();
-    testSamp3();
     testSamp4();
-     testSamp5();
+    testRegionPoolPlay();
+    testSfzCompile();
 }
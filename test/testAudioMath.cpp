@@ -8,6 +8,7 @@
 #include "asserts.h"
 
 #ifndef _MSC_VER
+#include "ParamScalers.h"
 #include "SimdBlocks.h"
 #endif
 
@@ -295,6 +296,56 @@ static void testWrapPhase2() {
 
     simd_assertEQ(SimdBlocks::wrapPhase01(-.1), float_4(.9));
 }
+
+/**
+ * The value type scalers must match the ScaleFun ones they replace,
+ * and the float_4 versions must match the float ones.
+ */
+template <class TScaler>
+static void testParamScaler(AudioMath::ScaleFun<float> ref, const TScaler& scaler, float tolerance) {
+    const float values[] = {-12, -5, -2.5, -1, -.3f, 0, .25, .7f, 1, 3, 5, 12};
+    const float trims[] = {-1, -.5, -.25, 0, .1f, .25, .5, 1};
+    for (float cv : values) {
+        for (float knob : values) {
+            for (float trim : trims) {
+                const float expected = ref(cv, knob, trim);
+                assertEQ(scaler(cv, knob, trim), expected);
+                const float_4 x = scaler(float_4(cv), float_4(knob), float_4(trim));
+                for (int i = 0; i < 4; ++i) {
+                    assertClose(x[i], expected, tolerance);
+                }
+            }
+        }
+    }
+}
+
+static void testParamScalers() {
+    testParamScaler(AudioMath::makeLinearScaler<float>(0, 1), LinearScaler(0, 1), .00001);
+    testParamScaler(AudioMath::makeLinearScaler<float>(-18, 0), LinearScaler(-18, 0), .00001);
+    testParamScaler(AudioMath::makeLinearScaler<float>(1.2f, 75), LinearScaler(1.2f, 75), .00001);
+    testParamScaler(AudioMath::makeScalerWithBipolarAudioTrim(-5, 5), BipolarAudioTrimScaler(-5, 5), .0001);
+    testParamScaler(AudioMath::makeScalerWithBipolarAudioTrim(0, 4), BipolarAudioTrimScaler(0, 4), .0001);
+
+    // different lanes are independent
+    LinearScaler lin(3, 4);
+    const float_4 x = lin(float_4(-5, 5, 0, 0), float_4(0, 0, -5, 5), float_4(1, 1, 1, 1));
+    simd_assertEQ(x, float_4(3, 4, 3, 4));
+}
+
+static void testAudioTaperScaler() {
+    AudioMath::SimpleScaleFun<float> ref = AudioMath::makeSimpleScalerAudioTaper(0, 35);
+    AudioTaperScaler scaler(0, 35);
+    const float values[] = {-12, -5, -2.5, -1, -.3f, 0, .25, .7f, 1, 3, 5, 12};
+    for (float cv : values) {
+        for (float knob : values) {
+            const float expected = ref(cv, knob);
+            assertEQ(scaler(cv, knob), expected);
+            const float_4 x = scaler(float_4(cv), float_4(knob));
+            assertClose(x[0], expected, .0001);
+            assertClose(x[3], expected, .0001);
+        }
+    }
+}
 #endif
 
 static void testNormalizeProduct() {
@@ -470,6 +521,8 @@ void testAudioMath() {
     testFoldSSE3();
     testWrapPhase();
     testWrapPhase2();
+    testParamScalers();
+    testAudioTaperScaler();
 #endif
     testRandom1();
     testRandom2();
@@ -0,0 +1,219 @@
+
+#include "TestComposite.h"
+
+#include "BankActivity.h"
+#include "Basic.h"
+#include "Samp.h"
+#include "Sines.h"
+#include "WVCO.h"
+#include "asserts.h"
+#include "tutil.h"
+
+static const float_4 gateOff = float_4::zero();
+static const float_4 gateOn = float_4::mask();
+
+static void testBankActivity0()
+{
+    BankActivity a;
+    for (int bank = 0; bank < 4; ++bank) {
+        assert(!a.isAsleep(bank));
+        assert(a.run(bank, gateOff));
+    }
+}
+
+static void testBankActivitySleep()
+{
+    BankActivity a;
+
+    // still ringing, stays awake
+    assert(!a.update(1, gateOff, float_4(0, 0, .1f, 0)));
+    assert(!a.isAsleep(1));
+
+    // one gate on, stays awake
+    float_4 gates = gateOff;
+    gates[3] = gateOn[0];
+    assert(!a.update(1, gates, float_4::zero()));
+    assert(!a.isAsleep(1));
+
+    // silent, so goes to sleep. only reports it once.
+    assert(a.update(1, gateOff, float_4(BankActivity::silenceLevel())));
+    assert(a.isAsleep(1));
+    assert(!a.update(1, gateOff, float_4::zero()));
+    assert(!a.run(1, gateOff));
+
+    // the other banks are not affected
+    assert(!a.isAsleep(0));
+    assert(!a.isAsleep(2));
+
+    // any gate wakes it
+    assert(a.run(1, gates));
+    assert(!a.isAsleep(1));
+}
+
+static void testBankActivityWakeAll()
+{
+    BankActivity a;
+    for (int bank = 0; bank < 4; ++bank) {
+        a.update(bank, gateOff, float_4::zero());
+        assert(a.isAsleep(bank));
+    }
+    a.wakeAll();
+    for (int bank = 0; bank < 4; ++bank) {
+        assert(!a.isAsleep(bank));
+    }
+}
+
+/**
+ * Runs the composite and returns the biggest output on any channel.
+ */
+template <class Comp>
+static float runAndGetPeak(Comp& comp, int numChannels, int samples, int output = Comp::MAIN_OUTPUT)
+{
+    typename Comp::ProcessArgs args;
+    args.sampleRate = 44100;
+    args.sampleTime = 1.f / 44100.f;
+    float peak = 0;
+    for (int i = 0; i < samples; ++i) {
+        TestComposite& base = comp;
+        base.step();
+        base.process(args);
+        for (int ch = 0; ch < numChannels; ++ch) {
+            peak = std::max(peak, std::abs(comp.outputs[output].getVoltage(ch)));
+        }
+    }
+    return peak;
+}
+
+template <class Comp>
+static void setGates(Comp& comp, int numChannels, float v)
+{
+    for (int ch = 0; ch < numChannels; ++ch) {
+        comp.inputs[Comp::GATE_INPUT].setVoltage(v, ch);
+    }
+}
+
+/**
+ * Plays notes, lets them go silent (and go to sleep), then plays again.
+ * @param numBanks is how many banks of voices the composite runs.
+ * @param wakeBank is the bank that should play the note from channel 5.
+ */
+template <class Comp>
+static void testSleepAndWake(Comp& comp, int numBanks = 2, int wakeBank = 1,
+                             int pitchInput = Comp::VOCT_INPUT, int output = Comp::MAIN_OUTPUT)
+{
+    const int numChannels = 8;
+    comp.inputs[pitchInput].channels = numChannels;
+    comp.inputs[Comp::GATE_INPUT].channels = numChannels;
+    comp.outputs[output].channels = 1;
+
+    setGates(comp, numChannels, 10);
+    assertGT(runAndGetPeak(comp, numChannels, 4000, output), .1);
+    for (int bank = 0; bank < numChannels / 4; ++bank) {
+        assert(!comp._isAsleep(bank));
+    }
+
+    // after a long release everything is silent, and asleep
+    setGates(comp, numChannels, 0);
+    runAndGetPeak(comp, numChannels, 4 * 44100, output);
+    assertEQ(runAndGetPeak(comp, numChannels, 1000, output), 0);
+    for (int bank = 0; bank < numBanks; ++bank) {
+        assert(comp._isAsleep(bank));
+    }
+
+    // only one bank wakes up and plays
+    comp.inputs[Comp::GATE_INPUT].setVoltage(10, 5);
+    assertGT(runAndGetPeak(comp, numChannels, 4000, output), .1);
+    for (int bank = 0; bank < numBanks; ++bank) {
+        assertEQ(comp._isAsleep(bank), (bank != wakeBank));
+    }
+    for (int ch = 0; ch < 4; ++ch) {
+        assertEQ(comp.outputs[output].getVoltage(ch), 0);
+    }
+}
+
+static void testWVCOSleep()
+{
+    using Comp = WVCO<TestComposite>;
+    Comp comp;
+    initComposite(comp);
+    comp.params[Comp::ADSR_OUTPUT_LEVEL_PARAM].value = 1;
+    comp.params[Comp::ATTACK_PARAM].value = 0;
+    comp.params[Comp::RELEASE_PARAM].value = 0;
+    testSleepAndWake(comp);
+}
+
+static void testSinesSleep()
+{
+    using Comp = Sines<TestComposite>;
+    Comp comp;
+    initComposite(comp);
+    testSleepAndWake(comp);
+}
+
+static void testSampSleep()
+{
+    using Comp = Samp<TestComposite>;
+    Comp comp;
+    initComposite(comp);
+    comp._setupPerfTest();
+    // Samp has eight banks of voices, shared by all the channels. They are
+    // allocated from the bottom, so the note from channel 5 plays in bank 0.
+    testSleepAndWake(comp, 8, 0, Comp::PITCH_INPUT, Comp::AUDIO_OUTPUT);
+}
+
+/**
+ * Basic has no gates, so the only time it sleeps is when its output is unpatched.
+ * Then the oscillators stop where they are, and carry on from there when patched again.
+ */
+static void testBasicUnpatched()
+{
+    using Comp = Basic<TestComposite>;
+    Comp comp;
+    Comp ref;
+    for (Comp* c : {&comp, &ref}) {
+        initComposite(*c);
+        c->params[Comp::WAVEFORM_PARAM].value = float(Comp::Waves::SAW);
+        c->inputs[Comp::VOCT_INPUT].channels = 1;
+        c->outputs[Comp::MAIN_OUTPUT].channels = 1;
+    }
+
+    Comp::ProcessArgs args;
+    args.sampleRate = 44100;
+    args.sampleTime = 1.f / 44100.f;
+    for (int i = 0; i < 100; ++i) {
+        comp.process(args);
+        ref.process(args);
+        assertEQ(comp.outputs[Comp::MAIN_OUTPUT].getVoltage(0), ref.outputs[Comp::MAIN_OUTPUT].getVoltage(0));
+    }
+
+    // unpatched, so nothing runs. A multiple of 16 samples keeps the dividers lined up with ref.
+    comp.outputs[Comp::MAIN_OUTPUT].channels = 0;
+    const float lastOutput = comp.outputs[Comp::MAIN_OUTPUT].getVoltage(0);
+    for (int i = 0; i < 64; ++i) {
+        comp.process(args);
+    }
+    assertEQ(comp.outputs[Comp::MAIN_OUTPUT].getVoltage(0), lastOutput);
+
+    // patched again, picks up right where ref is.
+    comp.outputs[Comp::MAIN_OUTPUT].channels = 1;
+    float biggest = 0;
+    for (int i = 0; i < 1000; ++i) {
+        comp.process(args);
+        ref.process(args);
+        const float x = comp.outputs[Comp::MAIN_OUTPUT].getVoltage(0);
+        assertEQ(x, ref.outputs[Comp::MAIN_OUTPUT].getVoltage(0));
+        biggest = std::max(biggest, std::abs(x));
+    }
+    assertGT(biggest, 1);
+}
+
+void testBankActivity()
+{
+    testBankActivity0();
+    testBankActivitySleep();
+    testBankActivityWakeAll();
+    testWVCOSleep();
+    testSinesSleep();
+    testSampSleep();
+    testBasicUnpatched();
+}
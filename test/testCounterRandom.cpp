@@ -0,0 +1,123 @@
+#include "CounterRandom.h"
+#include "asserts.h"
+
+static void testSameSeed()
+{
+    CounterRandom a(1234);
+    CounterRandom b(1234);
+    for (int i = 0; i < 1000; ++i) {
+        assertEQ(a.uniform(), b.uniform());
+    }
+
+    // setSeed must rewind
+    a.setSeed(1234);
+    CounterRandom c(1234);
+    for (int i = 0; i < 1000; ++i) {
+        assertEQ(a.gaussian(), c.gaussian());
+    }
+    assertEQ(a.getSeed(), 1234);
+}
+
+static void testDifferentSeed()
+{
+    CounterRandom a(1);
+    CounterRandom b(2);
+    int same = 0;
+    for (int i = 0; i < 1000; ++i) {
+        if (a.uniform() == b.uniform()) {
+            ++same;
+        }
+    }
+    assertLT(same, 3);
+
+    // default seeds should all be different
+    CounterRandom d1;
+    CounterRandom d2;
+    assert(d1.getSeed() != d2.getSeed());
+}
+
+static void testUniform()
+{
+    CounterRandom random(99);
+    const int n = 100000;
+    double sum = 0;
+    float low = 1;
+    float high = 0;
+    for (int i = 0; i < n; ++i) {
+        const float x = random.uniform();
+        assertGE(x, 0);
+        assertLT(x, 1);
+        sum += x;
+        low = std::min(low, x);
+        high = std::max(high, x);
+    }
+    assertClose(sum / n, .5, .01);
+    assertLT(low, .001);
+    assertGT(high, .999);
+}
+
+static void testGaussian()
+{
+    CounterRandom random(99);
+    const int n = 100000;
+    double sum = 0;
+    double sumSq = 0;
+    for (int i = 0; i < n; ++i) {
+        const float x = random.gaussian();
+        assert(std::isfinite(x));
+        sum += x;
+        sumSq += x * x;
+    }
+    const double mean = sum / n;
+    const double variance = sumSq / n - mean * mean;
+    assertClose(mean, 0, .02);
+    assertClose(variance, 1, .02);
+}
+
+/**
+ * the single value calls hand out the block values in order
+ */
+static void testScalarMatchesBlock()
+{
+    CounterRandom a(7);
+    CounterRandom b(7);
+    for (int block = 0; block < 10; ++block) {
+        float x[8];
+        a.uniform8().store(x);
+        for (int i = 0; i < 8; ++i) {
+            assertEQ(x[i], b.uniform());
+        }
+    }
+
+    a.setSeed(7);
+    b.setSeed(7);
+    for (int block = 0; block < 10; ++block) {
+        float x[8];
+        a.gaussian8().store(x);
+        for (int i = 0; i < 8; ++i) {
+            assertEQ(x[i], b.gaussian());
+        }
+    }
+}
+
+static void testUniformFunc()
+{
+    auto f = CounterRandom::makeUniformFunc(55);
+    auto g = CounterRandom::makeUniformFunc(55);
+    CounterRandom random(55);
+    for (int i = 0; i < 100; ++i) {
+        const float x = f();
+        assertEQ(x, g());
+        assertEQ(x, random.uniform());
+    }
+}
+
+void testCounterRandom()
+{
+    testSameSeed();
+    testDifferentSeed();
+    testUniform();
+    testGaussian();
+    testScalarMatchesBlock();
+    testUniformFunc();
+}
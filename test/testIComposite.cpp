@@ -17,6 +17,7 @@
 //#include "GMR.h"
 #include "GMR2.h"
 #include "Gray.h"
+#include "KSComposite.h"
 #include "LFN.h"
 #include "LFNB.h"
 #include "Mix4.h"
@@ -88,6 +89,7 @@ void testIComposite() {
     test<DrumTrigger<TestComposite>>();
     test<ChaosKitty<TestComposite>>();
     test<Daveguide<TestComposite>>();
+    test<KSComposite<TestComposite>>();
 
     test<WVCO<TestComposite>>();
     test<Sub<TestComposite>>();
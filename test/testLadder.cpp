@@ -109,6 +109,58 @@ static void testLadderTypes()
     }
 }
 
+static std::vector<float> runLadder(LadderFilter<float>& f)
+{
+    f.setNormalizedFc(.05f);
+    f.setFeedback(2);
+    f.setVolume(.5f);
+    std::vector<float> ret;
+    for (int i = 0; i < 200; ++i) {
+        f.run((i & 16) ? 2.f : -2.f);
+        ret.push_back(f.getOutput());
+    }
+    return ret;
+}
+
+// the process function should not depend on the order type and voicing are set
+static void testLadderTypesVoicings()
+{
+    using Filter = LadderFilter<float>;
+    for (int type = 0; type < (int)Filter::Types::NUM_TYPES; ++type) {
+        for (int voicing = 0; voicing < (int)Filter::Voicing::NUM_VOICINGS; ++voicing) {
+            Filter f1;
+            f1.setType(Filter::Types(type));
+            f1.setVoicing(Filter::Voicing(voicing));
+
+            Filter f2;
+            f2.setVoicing(Filter::Voicing(voicing));
+            f2.setType(Filter::Types(type));
+
+            auto out1 = runLadder(f1);
+            auto out2 = runLadder(f2);
+            assert(out1 == out2);
+            for (float x : out1) {
+                assert(std::abs(x) < 20);
+            }
+        }
+    }
+}
+
+// 4P LP is the only type where the output taps change at run time
+static void testLadderSlope()
+{
+    using Filter = LadderFilter<float>;
+    Filter f1;
+    f1.setType(Filter::Types::_4PLP);
+    f1.setSlope(0);
+
+    Filter f2;
+    f2.setType(Filter::Types::_4PLP);
+    f2.setSlope(3);
+
+    assert(runLadder(f1) != runLadder(f2));
+}
+
 // if not 4P LP, will all be zero
 static void testLED0()
 {
@@ -765,6 +817,8 @@ void testLadder()
     testLadderDCf(1000);
     testLadderDCd(1000);
     testLadderTypes();
+    testLadderTypesVoicings();
+    testLadderSlope();
     testLED0();
     testLED1();
     testLED2();
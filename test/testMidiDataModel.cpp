@@ -366,6 +366,90 @@ static void testPitchRoundTrip()
     assertEQ(PitchUtils::semitoneToCV(x), 0);
 }
 
+static void testNotesOverlapping()
+{
+    auto lock = MidiLock::make();
+    MidiTrack mt(lock);
+    MidiLocker l(lock);
+
+    // long note that starts way before
+    MidiNoteEventPtr longNote = std::make_shared<MidiNoteEvent>();
+    longNote->startTime = 10;
+    longNote->duration = 95;
+    mt.insertEvent(longNote);
+
+    // ends right at the start of the range
+    MidiNoteEventPtr before = std::make_shared<MidiNoteEvent>();
+    before->startTime = 99;
+    before->duration = 1;
+    mt.insertEvent(before);
+
+    // starts right at the end of the range
+    MidiNoteEventPtr atEnd = std::make_shared<MidiNoteEvent>();
+    atEnd->startTime = 110;
+    atEnd->duration = 1;
+    mt.insertEvent(atEnd);
+
+    MidiNoteEventPtr after = std::make_shared<MidiNoteEvent>();
+    after->startTime = 111;
+    after->duration = 1;
+    mt.insertEvent(after);
+
+    MidiTestEventPtr tev = std::make_shared<MidiTestEvent>();
+    tev->startTime = 105;
+    mt.insertEvent(tev);
+
+    std::vector<MidiNoteEventPtr> notes;
+    mt.getNotesOverlapping(100, 110, notes);
+    assertEQ(notes.size(), 2);
+    assert(notes[0] == longNote);
+    assert(notes[1] == atEnd);
+
+    // a single point finds what is playing then
+    mt.getNotesOverlapping(99.5f, 99.5f, notes);
+    assertEQ(notes.size(), 2);
+    assert(notes[0] == longNote);
+    assert(notes[1] == before);
+
+    mt.getNotesOverlapping(200, 300, notes);
+    assertEQ(notes.size(), 0);
+}
+
+// compare with brute force on a track big enough to have a deep tree
+static void testNotesOverlappingBig()
+{
+    auto lock = MidiLock::make();
+    MidiTrack mt(lock);
+    MidiLocker l(lock);
+    for (int i = 0; i < 2000; ++i) {
+        MidiNoteEventPtr note = std::make_shared<MidiNoteEvent>();
+        note->startTime = float(i % 500);
+        note->duration = (i % 7 == 0) ? 40.f : .5f;
+        note->pitchCV = float(i % 10) / 12.f;
+        mt.insertEvent(note);
+    }
+    // delete some, so the index has to keep up with erase
+    for (int i = 0; i < 200; ++i) {
+        mt.deleteEvent(*mt.begin()->second);
+    }
+
+    std::vector<MidiNoteEventPtr> notes;
+    for (float start = 0; start < 520; start += 13.5f) {
+        const float end = start + 7;
+        mt.getNotesOverlapping(start, end, notes);
+        size_t expected = 0;
+        for (auto it : mt) {
+            MidiNoteEventPtr note = safe_cast<MidiNoteEvent>(it.second);
+            if (note->startTime <= end && note->startTime + note->duration > start) {
+                assert(expected < notes.size());
+                assert(notes[expected] == note);
+                ++expected;
+            }
+        }
+        assertEQ(notes.size(), expected);
+    }
+}
+
 void testMidiDataModel()
 {
     assertNoMidi();     // check for leaks
@@ -380,6 +464,8 @@ void testMidiDataModel()
     testNoteTimeRange0Mixed();
     testTimeRange1();
     testNoteTimeRange1();
+    testNotesOverlapping();
+    testNotesOverlappingBig();
     testSameTime();
     testSeekTime1();
     testSeekTime2();
@@ -1,11 +1,17 @@
 
 #define __STDC_WANT_LIB_EXT1__ 1        // to get tempnam_s
+#include "MidiFile.h"
+#include "MidiLock.h"
 #include "MidiSong.h"
 #include "MidiTrack.h"
 #include "MidiFileProxy.h"
+#include "SmfReader.h"
+#include "SmfWriter.h"
 #include "asserts.h"
 //#include <filesystem>
 
+#include <random>
+#include <sstream>
 #include <stdio.h>
 #include <sys/types.h>
 #include <sys/stat.h>
@@ -57,6 +63,248 @@ static void compareSongs(MidiSongPtr song1, MidiSongPtr song2)
     }
 }
 
+/**
+ * times get rounded down to a whole tick when we save, so
+ * comparing with the original needs a tolerance
+ */
+static void compareTimes(float t1, float t2, float tolerance)
+{
+    if (tolerance) {
+        assertClose(t1, t2, tolerance);
+    } else {
+        assertEQ(t1, t2);
+    }
+}
+
+static void compareTracks(MidiTrackPtr track1, MidiTrackPtr track2, float tolerance = 0)
+{
+    assertEQ(track1->size(), track2->size());
+    MidiTrack::const_iterator it2 = track2->begin();
+    for (auto it : *track1) {
+        MidiEventPtr ev1 = it.second;
+        MidiEventPtr ev2 = it2->second;
+        assert(ev1->type == ev2->type);
+        compareTimes(ev1->startTime, ev2->startTime, tolerance);
+        MidiNoteEventPtr note1 = safe_cast<MidiNoteEvent>(ev1);
+        if (note1) {
+            MidiNoteEventPtr note2 = safe_cast<MidiNoteEvent>(ev2);
+            assertClose(note1->pitchCV, note2->pitchCV, .0001);
+            compareTimes(note1->duration, note2->duration, tolerance);
+        }
+        ++it2;
+    }
+}
+
+/**
+ * Reads data through smf::MidiFile, the way MidiFileProxy::loadSmf does.
+ */
+static MidiTrackPtr readSmf(const std::vector<uint8_t>& data)
+{
+    std::stringstream stream(std::string(data.begin(), data.end()));
+    smf::MidiFile midiFile;
+    assert(midiFile.read(stream));
+    midiFile.makeAbsoluteTicks();
+    midiFile.linkNotePairs();
+
+    MidiSongPtr song = std::make_shared<MidiSong>();
+    return MidiFileProxy::getFirst(song, midiFile);
+}
+
+static MidiTrackPtr readFast(const std::vector<uint8_t>& data, SmfReader::Status expected = SmfReader::Status::ok)
+{
+    auto lock = std::make_shared<MidiLock>();
+    MidiTrackPtr track;
+    const SmfReader::Status status = SmfReader::read(data.data(), data.size(), lock, track);
+    assert(status == expected);
+    if (track) {
+        MidiLocker l(lock);
+        track->assertValid();
+    }
+    return track;
+}
+
+static void testReaderSameAsSmf()
+{
+#if defined(_MSC_VER)
+    const char* path = "..\\..\\test\\test1.mid";
+#else
+    const char* path = "./test/test1.mid";
+#endif
+    MidiSongPtr song = MidiFileProxy::load(path);
+    MidiSongPtr song2 = MidiFileProxy::loadSmf(path);
+    assert(song && song2);
+    compareTracks(song->getTrack(0), song2->getTrack(0));
+}
+
+static void testWriteRead(MidiTrackPtr track)
+{
+    std::vector<uint8_t> data;
+    SmfWriter::write(track, data);
+
+    // the third party reader should agree with us, and with the original.
+    MidiTrackPtr fast = readFast(data);
+    MidiTrackPtr slow = readSmf(data);
+    compareTracks(fast, slow);
+    compareTracks(track, fast, 1.f / SmfWriter::ppq);
+}
+
+static void testWriteRead()
+{
+    auto lock = std::make_shared<MidiLock>();
+    MidiLocker l(lock);
+    testWriteRead(MidiTrack::makeTest(MidiTrack::TestContent::FourTouchingQuarters, lock));
+    testWriteRead(MidiTrack::makeTest(MidiTrack::TestContent::FourAlmostTouchingQuarters, lock));
+    testWriteRead(MidiTrack::makeTest(MidiTrack::TestContent::eightQNotesCMaj, lock));
+}
+
+/**
+ * lots of random overlapping notes, on a sixteenth note grid so
+ * all the times survive the trip through ticks.
+ */
+static void testWriteReadBig()
+{
+    auto lock = std::make_shared<MidiLock>();
+    MidiLocker l(lock);
+    MidiTrackPtr track = std::make_shared<MidiTrack>(lock);
+    std::mt19937 gen(1234);
+    const int numNotes = 5000;
+    for (int i = 0; i < numNotes; ++i) {
+        MidiNoteEventPtr note = std::make_shared<MidiNoteEvent>();
+        note->startTime = .25f * (i / 3);
+        note->duration = .25f * (1 + gen() % 8);
+        // a key doesn't come around again for 8 quarter notes, so notes on the same key never overlap
+        note->pitchCV = PitchUtils::midiToCV(20 + i % 96);
+        track->insertEvent(note);
+    }
+    track->insertEnd(.25f * (numNotes / 3 + 10));
+    testWriteRead(track);
+}
+
+class SmfBuilder
+{
+public:
+    SmfBuilder(int numTracks)
+    {
+        add({'M', 'T', 'h', 'd', 0, 0, 0, 6, 0, 1, 0, uint8_t(numTracks), 0, 96});
+    }
+    void beginTrack()
+    {
+        add({'M', 'T', 'r', 'k', 0, 0, 0, 0});
+        trackStart = data.size();
+    }
+    void endTrack()
+    {
+        const size_t length = data.size() - trackStart;
+        data[trackStart - 1] = uint8_t(length);
+        data[trackStart - 2] = uint8_t(length >> 8);
+    }
+    void add(std::initializer_list<uint8_t> bytes)
+    {
+        data.insert(data.end(), bytes);
+    }
+
+    std::vector<uint8_t> data;
+    size_t trackStart = 0;
+};
+
+static void testReaderEvents()
+{
+    SmfBuilder smf(2);
+
+    // first track has no notes - just a name and tempo
+    smf.beginTrack();
+    smf.add({0, 0xff, 0x03, 3, 'a', 'b', 'c'});
+    smf.add({0, 0xff, 0x51, 3, 7, 0xa1, 0x20});
+    smf.add({0, 0xff, 0x2f, 0});
+    smf.endTrack();
+
+    smf.beginTrack();
+    smf.add({0, 0x90, 60, 100});            // c4 on, channel 1
+    smf.add({0, 61, 100});                  // running status c#4 on
+    smf.add({0, 0xf0, 3, 1, 2, 0xf7});      // sysex
+    smf.add({0, 0xc0, 5});                  // program change has one data byte
+    smf.add({0, 0x91, 60, 100});            // c4 on, channel 2
+    smf.add({48, 0x80, 60, 0});             // c4 off channel 1, after an eighth note
+    smf.add({48, 0x90, 61, 0});             // c#4 off, as note on with zero velocity
+    smf.add({0, 0x81, 60, 0});              // c4 off, channel 2
+    smf.add({0, 0x90, 62, 100});            // never turned off
+    smf.add({0x81, 0x40, 0xff, 0x2f, 0});   // end, 192 ticks later
+    smf.endTrack();
+
+    MidiTrackPtr track = readFast(smf.data);
+    auto events = track->_testGetVector();
+    assertEQ(events.size(), 5);
+
+    MidiNoteEventPtr note = safe_cast<MidiNoteEvent>(events[0]);
+    assertEQ(note->startTime, 0);
+    assertEQ(note->pitchCV, PitchUtils::midiToCV(60));
+    assertEQ(note->duration, .5);
+
+    note = safe_cast<MidiNoteEvent>(events[1]);
+    assertEQ(note->pitchCV, PitchUtils::midiToCV(61));
+    assertEQ(note->duration, 1);
+
+    note = safe_cast<MidiNoteEvent>(events[2]);
+    assertEQ(note->pitchCV, PitchUtils::midiToCV(60));
+    assertEQ(note->duration, 1);
+
+    // the note that was never turned off plays to the end of the track
+    note = safe_cast<MidiNoteEvent>(events[3]);
+    assertEQ(note->startTime, 1);
+    assertEQ(note->pitchCV, PitchUtils::midiToCV(62));
+    assertEQ(note->duration, 2);
+
+    assert(events[4]->type == MidiEvent::Type::End);
+    assertEQ(events[4]->startTime, 3);
+}
+
+static void testReaderEndQuantized()
+{
+    SmfBuilder smf(1);
+    smf.beginTrack();
+    smf.add({0, 0x90, 60, 100});
+    smf.add({10, 0x80, 60, 0});
+    smf.add({10, 0xff, 0x2f, 0});
+    smf.endTrack();
+
+    MidiTrackPtr track = readFast(smf.data);
+    assertEQ(track->getLength(), .25f);
+    compareTracks(track, readSmf(smf.data));
+}
+
+static void testReaderNoNotes()
+{
+    SmfBuilder smf(1);
+    smf.beginTrack();
+    smf.add({0, 0xff, 0x2f, 0});
+    smf.endTrack();
+    MidiTrackPtr track = readFast(smf.data, SmfReader::Status::noNotes);
+    assert(!track);
+}
+
+static void testReaderNotSupported()
+{
+    // SMPTE time
+    SmfBuilder smpte(1);
+    smpte.data[12] = 0xe7;
+    smpte.beginTrack();
+    smpte.add({0, 0x90, 60, 100, 10, 0x80, 60, 0, 0, 0xff, 0x2f, 0});
+    smpte.endTrack();
+    readFast(smpte.data, SmfReader::Status::notSupported);
+
+    // track runs off the end of the file
+    SmfBuilder truncated(1);
+    truncated.beginTrack();
+    truncated.add({0, 0x90, 60, 100, 10, 0x80, 60, 0, 0, 0xff, 0x2f, 0});
+    truncated.endTrack();
+    truncated.data.resize(truncated.data.size() - 4);
+    readFast(truncated.data, SmfReader::Status::notSupported);
+
+    // not a MIDI file
+    std::vector<uint8_t> junk = {'R', 'I', 'F', 'F', 0, 0, 0, 0};
+    readFast(junk, SmfReader::Status::notSupported);
+}
+
 #ifndef ARCH_LIN
 #define _TMPNAM
 #endif
@@ -87,6 +335,13 @@ static void test2()
 void testMidiFile()
 {
     test1();
+    testReaderSameAsSmf();
+    testWriteRead();
+    testWriteReadBig();
+    testReaderEvents();
+    testReaderEndQuantized();
+    testReaderNoNotes();
+    testReaderNotSupported();
 #if defined(_TMPNAM) && defined(_MSC_VER)
     test2();
 #endif
@@ -1,8 +1,11 @@
+#include "FlatIdSet.h"
 #include "MidiLock.h"
 #include "MidiSequencer.h"
 #include "TestAuditionHost.h"
 
 #include <memory>
+#include <random>
+#include <set>
 
 static void testExtendSelection()
 {
@@ -175,6 +178,92 @@ static void testSelectionSelectAll2()
 
 }
 
+static void testSelectionIsSelected()
+{
+    auto a = std::make_shared<TestAuditionHost>();
+    MidiSelectionModel sel(a);
+    MidiNoteEventPtr note1 = std::make_shared<MidiNoteEvent>();
+    note1->startTime = 1;
+    MidiEventPtr clone1 = note1->clone();
+    assert(note1->getId() != clone1->getId());
+
+    sel.select(note1);
+    assert(sel.isSelected(note1));
+    assert(!sel.isSelected(clone1));        // same value, different object
+    assert(sel.isSelectedDeep(clone1));
+
+    // removing by value takes out the one that is there
+    sel.removeFromSelection(clone1);
+    assert(sel.empty());
+    assert(!sel.isSelected(note1));
+}
+
+static void testSelectionBulk()
+{
+    auto a = std::make_shared<TestAuditionHost>();
+    MidiSelectionModel sel(a);
+
+    std::vector<MidiEventPtr> events;
+    for (int i = 9; i >= 0; --i) {
+        MidiNoteEventPtr note = std::make_shared<MidiNoteEvent>();
+        note->startTime = float(i % 5);
+        note->pitchCV = float(i) / 12.f;
+        events.push_back(note);
+    }
+    sel.extendSelection(events[3]);
+    a->reset();
+
+    // one is already in, and one is a copy of another
+    events.push_back(events[5]->clone());
+    sel.extendSelection(events);
+    assertEQ(sel.size(), 10);
+    assertEQ(a->count(), 9);
+    for (auto ev : events) {
+        assert(sel.isSelectedDeep(ev));
+    }
+    assert(!sel.isSelected(events.back()));
+
+    // should come out in order
+    auto v = sel.asVector();
+    for (size_t i = 1; i < v.size(); ++i) {
+        assert(*v[i - 1] < *v[i]);
+    }
+
+    // and clone the same way
+    auto cloned = sel.clone();
+    assertEQ(cloned->size(), 10);
+    auto vc = cloned->asVector();
+    for (size_t i = 0; i < v.size(); ++i) {
+        assert(*vc[i] == *v[i]);
+        assert(cloned->isSelected(vc[i]));
+        assert(!cloned->isSelected(v[i]));
+    }
+}
+
+static void testFlatIdSet()
+{
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<uint32_t> ids(1, 3000);
+    FlatIdSet set;
+    std::set<uint32_t> ref;
+    assert(set.empty());
+    for (int i = 0; i < 50000; ++i) {
+        const uint32_t id = ids(gen);
+        if (i % 3) {
+            assertEQ(set.insert(id), ref.insert(id).second);
+        } else {
+            assertEQ(set.erase(id), (ref.erase(id) == 1));
+        }
+        assertEQ(set.size(), ref.size());
+    }
+    for (uint32_t id = 1; id <= 3000; ++id) {
+        assertEQ(set.contains(id), (ref.count(id) == 1));
+    }
+    set.clear();
+    assert(set.empty());
+    assert(!set.contains(*ref.begin()));
+}
+
 void testMidiSelectionModel()
 {
     testExtendSelection();
@@ -184,4 +273,7 @@ void testMidiSelectionModel()
     testSelectionAddTwice();
     testSelectionSelectAll();
     testSelectionSelectAll2();
+    testSelectionIsSelected();
+    testSelectionBulk();
+    testFlatIdSet();
 }
\ No newline at end of file
@@ -0,0 +1,132 @@
+#include "MidiLock.h"
+#include "MidiTrack.h"
+#include "MidiTrackCodec.h"
+#include "PitchUtils.h"
+#include "asserts.h"
+
+#include <random>
+
+/**
+ * encode and decode must give back exactly the same track
+ */
+static void assertRoundTrip(MidiTrackPtr track)
+{
+    const std::string text = MidiTrackCodec::encode(track);
+    assertEQ(text.size() % 4, 0);
+    MidiTrackPtr track2 = MidiTrackCodec::decode(text, track->lock);
+    assert(track2);
+    track2->assertValid();
+    assertEQ(track2->size(), track->size());
+
+    auto it2 = track2->begin();
+    for (auto it : *track) {
+        MidiEventPtr ev1 = it.second;
+        MidiEventPtr ev2 = it2->second;
+        assert(*ev1 == *ev2);
+        assertEQ(it.first, it2->first);
+
+        // must be exact, not just close
+        MidiNoteEventPtr note1 = safe_cast<MidiNoteEvent>(ev1);
+        MidiNoteEventPtr note2 = safe_cast<MidiNoteEvent>(ev2);
+        assertEQ(!!note1, !!note2);
+        if (note1) {
+            assert(note1->pitchCV == note2->pitchCV);
+            assert(note1->duration == note2->duration);
+        }
+        ++it2;
+    }
+}
+
+static void testRoundTripSimple()
+{
+    auto lock = std::make_shared<MidiLock>();
+    MidiLocker l(lock);
+    assertRoundTrip(MidiTrack::makeTest(MidiTrack::TestContent::empty, lock));
+    assertRoundTrip(MidiTrack::makeTest(MidiTrack::TestContent::oneNote123, lock));
+    assertRoundTrip(MidiTrack::makeTest(MidiTrack::TestContent::oneQ1_75, lock));
+    assertRoundTrip(MidiTrack::makeTest(MidiTrack::TestContent::FourAlmostTouchingQuarters_12, lock));
+    assertRoundTrip(MidiTrack::makeTest(MidiTrack::TestContent::FourTouchingQuartersOct, lock));
+    assertRoundTrip(MidiTrack::makeTest(MidiTrack::TestContent::eightQNotesCMaj, lock));
+}
+
+/**
+ * notes on and off the grid, with all kinds of pitches.
+ * Lots of sizes, so the base64 padding gets exercised
+ */
+static void testRoundTripRandom()
+{
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<int> ticks(0, 1000);
+    std::uniform_int_distribution<int> semis(0, 100);
+    std::uniform_real_distribution<float> anything(-5, 5);
+    std::uniform_int_distribution<int> coin(0, 3);
+
+    auto lock = std::make_shared<MidiLock>();
+    MidiLocker l(lock);
+    for (int size = 0; size < 40; ++size) {
+        MidiTrackPtr track = std::make_shared<MidiTrack>(lock);
+        track->insertEnd(1000);
+        for (int i = 0; i < size; ++i) {
+            MidiNoteEventPtr note = std::make_shared<MidiNoteEvent>();
+            note->startTime = coin(gen) ? float(ticks(gen)) / 16 : std::abs(anything(gen)) * 100;
+            note->pitchCV = coin(gen) ? PitchUtils::semitoneToCV(semis(gen)) : anything(gen);
+            note->duration = coin(gen) ? float(ticks(gen) + 1) / 12 : std::abs(anything(gen)) + .001f;
+            track->insertEvent(note);
+        }
+        assertRoundTrip(track);
+    }
+}
+
+static void testSmall()
+{
+    auto lock = std::make_shared<MidiLock>();
+    MidiLocker l(lock);
+    MidiTrackPtr track = std::make_shared<MidiTrack>(lock);
+    const int notes = 1000;
+    track->insertEnd(notes);
+    for (int i = 0; i < notes; ++i) {
+        MidiNoteEventPtr note = std::make_shared<MidiNoteEvent>();
+        note->startTime = float(i) + .25f * (i % 3);
+        note->pitchCV = PitchUtils::semitoneToCV(48 + (i % 24));
+        note->duration = .5f;
+        track->insertEvent(note);
+    }
+
+    // on grid notes should only be a few bytes each.
+    // The old json was over 50 characters a note
+    const std::string text = MidiTrackCodec::encode(track);
+    assertLT(text.size(), notes * 10);
+    assertRoundTrip(track);
+}
+
+static void testBadText()
+{
+    auto lock = std::make_shared<MidiLock>();
+    MidiLocker l(lock);
+    MidiTrackPtr track = MidiTrack::makeTest(MidiTrack::TestContent::eightQNotesCMaj, lock);
+    const std::string text = MidiTrackCodec::encode(track);
+
+    assert(!MidiTrackCodec::decode("", lock));
+    assert(!MidiTrackCodec::decode("not base64!", lock));
+
+    // every truncation must fail, not crash
+    for (size_t length = 0; length < text.size(); ++length) {
+        assert(!MidiTrackCodec::decode(text.data(), length, lock));
+    }
+
+    // extra stuff on the end
+    assert(!MidiTrackCodec::decode(text + "AAAA", lock));
+
+    // future version
+    std::string future = text;
+    future[0] = 'B';
+    assert(!MidiTrackCodec::decode(future, lock));
+}
+
+void testMidiTrackCodec()
+{
+    testRoundTripSimple();
+    testRoundTripRandom();
+    testSmall();
+    testBadText();
+}
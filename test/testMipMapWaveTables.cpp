@@ -0,0 +1,263 @@
+
+#include "BasicVCO.h"
+#include "MinBLEPVCO.h"
+#include "MipMapWaveTables.h"
+#include "SubVCO.h"
+
+#include "asserts.h"
+
+using Wave = MipMapWaveTables::Waveform;
+using SubVCO = VoltageControlledOscillator<16, 16, rack::simd::float_4, rack::simd::int32_4>;
+
+static const float sampleRate = 44100;
+static const float sampleTime = 1.f / sampleRate;
+
+static void testLevelFor()
+{
+    assertEQ(MipMapWaveTables::levelFor(.3f), 0);
+    assertEQ(MipMapWaveTables::levelFor(.2f), 1);
+    assertEQ(MipMapWaveTables::levelFor(.001f), 8);
+    assertEQ(MipMapWaveTables::levelFor(0), MipMapWaveTables::numLevels - 1);
+
+    for (float f = .5f; f > 1e-5f; f *= .93f) {
+        const int level = MipMapWaveTables::levelFor(f);
+        const float topHarmonicFreq = f * (1 << level);
+        assertLE(topHarmonicFreq, .5f);
+        if (level < MipMapWaveTables::numLevels - 1) {
+            // and it's the best we can do
+            assertGT(2 * topHarmonicFreq, .5f);
+        }
+    }
+
+    float_4 f(.3f, .2f, .001f, 0);
+    int32_4 levels = MipMapWaveTables::levelFor(f);
+    for (int i = 0; i < 4; ++i) {
+        assertEQ(levels[i], MipMapWaveTables::levelFor(f[i]));
+    }
+}
+
+static void testTableValues()
+{
+    auto tables = MipMapWaveTables::get();
+    const int top = MipMapWaveTables::numLevels - 1;
+
+    // at level zero everything is just the fundamental
+    assertClose(tables->lookup(Wave::SAW, 0, .25f), -2 / AudioMath::Pi, .001);
+    assertClose(tables->lookup(Wave::SQUARE, 0, .25f), 4 / AudioMath::Pi, .001);
+    assertClose(tables->lookup(Wave::EVEN, 0, 0), 1.27, .001);
+
+    // top level should be very close to the ideal waveforms
+    assertClose(tables->lookup(Wave::SAW, top, .25f), -.5, .01);
+    assertClose(tables->lookup(Wave::SAW, top, .75f), .5, .01);
+    assertClose(tables->lookup(Wave::SQUARE, top, .25f), 1, .01);
+    assertClose(tables->lookup(Wave::SQUARE, top, .75f), -1, .01);
+    assertClose(tables->lookup(Wave::TRI, top, .25f), 1, .01);
+    assertClose(tables->lookup(Wave::TRI, top, .5f), 0, .01);
+    assertClose(tables->lookup(Wave::TRI, top, .75f), -1, .01);
+
+    // double saw at .25 is -.5, plus the cosine fundamental
+    const double expectedEven = -.5 + 1.27 * std::cos(2 * AudioMath::Pi * .125);
+    assertClose(tables->lookup(Wave::EVEN, top, .125f), expectedEven, .01);
+
+    // phase wraps
+    assertClose(tables->lookup(Wave::SAW, top, 1.25f), tables->lookup(Wave::SAW, top, .25f), .0001);
+    assertClose(tables->lookup(Wave::SAW, top, -.75f), tables->lookup(Wave::SAW, top, .25f), .0001);
+}
+
+static void testLookupSimd()
+{
+    auto tables = MipMapWaveTables::get();
+    const float_4 phase(-.3f, .1f, .999f, 1.7f);
+    const int32_4 level(0, 3, 9, 5);
+    for (int wf = 0; wf < int(Wave::END); ++wf) {
+        const float_4 x = tables->lookup(Wave(wf), level, phase);
+        for (int i = 0; i < 4; ++i) {
+            assertClose(x[i], tables->lookup(Wave(wf), level[i], phase[i]), .00001);
+        }
+    }
+}
+
+static void testShared()
+{
+    auto a = MipMapWaveTables::get();
+    auto b = MipMapWaveTables::get();
+    assert(a == b);
+    a.reset();
+    b.reset();
+
+    auto c = MipMapWaveTables::get();
+    assertClose(c->lookup(Wave::SAW, 9, .25f), -.5, .01);
+}
+
+/**
+ * Correlation of two signals. 1 means the same shape and phase.
+ * Also returns the ratio of their RMS levels.
+ */
+static double correlate(const std::vector<float>& a, const std::vector<float>& b, double& levelRatio)
+{
+    assertEQ(a.size(), b.size());
+    double meanA = 0, meanB = 0;
+    for (size_t i = 0; i < a.size(); ++i) {
+        meanA += a[i];
+        meanB += b[i];
+    }
+    meanA /= a.size();
+    meanB /= b.size();
+
+    double ab = 0, aa = 0, bb = 0;
+    for (size_t i = 0; i < a.size(); ++i) {
+        const double x = a[i] - meanA;
+        const double y = b[i] - meanB;
+        ab += x * y;
+        aa += x * x;
+        bb += y * y;
+    }
+    levelRatio = std::sqrt(bb / aa);
+    return ab / std::sqrt(aa * bb);
+}
+
+static void assertSameWaveform(const std::vector<float>& minBlep, const std::vector<float>& lite)
+{
+    double levelRatio = 0;
+    const double correlation = correlate(minBlep, lite, levelRatio);
+
+    // not exact, since the mip levels roll off sooner than MinBLEP,
+    // and the bleps lag a little.
+    assertGT(correlation, .9);
+    assertClose(levelRatio, 1, .05);
+}
+
+static const int settleSamples = 4000;
+static const int testSamples = 4000;
+
+static std::vector<float> renderBasic(BasicVCO::Waveform wf, bool lite, float pitch)
+{
+    BasicVCO vco;
+    vco.setPitch(float_4(pitch), sampleTime, sampleRate);
+    vco.setPw(float_4(.3f));
+    auto proc = vco.getProcPointer(wf, lite);
+    std::vector<float> ret;
+    for (int i = 0; i < settleSamples + testSamples; ++i) {
+        const float_4 x = (vco.*proc)(sampleTime);
+        if (i >= settleSamples) {
+            ret.push_back(x[0]);
+        }
+    }
+    return ret;
+}
+
+static void testBasicLite(BasicVCO::Waveform wf)
+{
+    for (float pitch : {-2.f, 0.f, 2.f}) {
+        auto minBlep = renderBasic(wf, false, pitch);
+        auto lite = renderBasic(wf, true, pitch);
+        assertSameWaveform(minBlep, lite);
+    }
+}
+
+static void testBasicLite()
+{
+    testBasicLite(BasicVCO::Waveform::SAW);
+    testBasicLite(BasicVCO::Waveform::SQUARE);
+    testBasicLite(BasicVCO::Waveform::EVEN);
+    testBasicLite(BasicVCO::Waveform::TRI_CLEAN);
+}
+
+// side: -1 for main, or the sub index
+static std::vector<float> renderSub(bool isSaw, bool lite, int side)
+{
+    SubVCO osc;
+    osc.index = 0;
+    osc.setLite(lite);
+    const float_4 sawMask = isSaw ? float_4::mask() : float_4(0);
+    osc.setWaveform(sawMask, sawMask);
+    osc.setupSub(1, float_4(0), int32_4(3), int32_4(5));
+    osc.setPW(float_4(.4f));
+    osc.computeOffsetCorrection(sampleTime);
+
+    std::vector<float> ret;
+    for (int i = 0; i < settleSamples + testSamples; ++i) {
+        osc.process(sampleTime, 0);
+        if (i >= settleSamples) {
+            ret.push_back(side < 0 ? osc.main()[0] : osc.sub(side)[0]);
+        }
+    }
+    return ret;
+}
+
+static void testSubLite()
+{
+    for (int side = -1; side < 2; ++side) {
+        assertSameWaveform(renderSub(true, false, side), renderSub(true, true, side));
+        assertSameWaveform(renderSub(false, false, side), renderSub(false, true, side));
+    }
+}
+
+static std::vector<float> renderMinBLEPVCO(MinBLEPVCO::Waveform wf, bool lite, float normalizedFreq)
+{
+    MinBLEPVCO osc;
+    osc.setWaveform(wf);
+    osc.setLite(lite);
+    osc.setPulseWidth(.3f);
+    osc.setNormalizedFreq(normalizedFreq, sampleTime);
+
+    std::vector<float> ret;
+    for (int i = 0; i < settleSamples + testSamples; ++i) {
+        osc.step();
+        if (i >= settleSamples) {
+            ret.push_back(osc.getOutput());
+        }
+    }
+    return ret;
+}
+
+static void testMinBLEPVCOLite()
+{
+    for (int wf = 0; wf < int(MinBLEPVCO::Waveform::END); ++wf) {
+        for (float f : {.001f, .01f, .05f}) {
+            auto minBlep = renderMinBLEPVCO(MinBLEPVCO::Waveform(wf), false, f);
+            auto lite = renderMinBLEPVCO(MinBLEPVCO::Waveform(wf), true, f);
+            assertSameWaveform(minBlep, lite);
+        }
+    }
+}
+
+static void testMinBLEPVCOLiteSync()
+{
+    MinBLEPVCO master;
+    MinBLEPVCO slave;
+    master.setLite(true);
+    slave.setLite(true);
+    master.setNormalizedFreq(.1f, sampleTime);
+    slave.setNormalizedFreq(.0123f, sampleTime);
+
+    int callbackCount = 0;
+    master.setSyncCallback([&callbackCount, &slave](float p) {
+        assert(p <= 0 && p >= -1);
+        callbackCount++;
+        slave.onMasterSync(p);
+    });
+    slave.setSyncEnabled(true);
+
+    // with sync the slave saw never gets far from the bottom
+    float maxOutput = -100;
+    for (int i = 0; i < 1000; ++i) {
+        master.step();
+        slave.step();
+        maxOutput = std::max(maxOutput, slave.getOutput());
+    }
+    assertEQ(callbackCount, 100);
+    assertLT(maxOutput, 1);
+}
+
+void testMipMapWaveTables()
+{
+    testLevelFor();
+    testTableValues();
+    testLookupSimd();
+    testShared();
+    testBasicLite();
+    testSubLite();
+    testMinBLEPVCOLite();
+    testMinBLEPVCOLiteSync();
+}
@@ -1,9 +1,130 @@
 
 #include "asserts.h"
+#include "BakedLookupTables.h"
+#include "LookupTableFactory.h"
 #include "ObjectCache.h"
 
+#include <fstream>
+#include <locale>
+#include <sstream>
+
 extern int _numLookupParams;
 
+// in the same order as BakedLookupTables::Id
+static const char* const bakedNames[BakedLookupTables::NumTables] = {
+    "audioTaper",
+    "audioTaper18",
+    "bipolarAudioTaper",
+    "bipolarAudioTaper30",
+    "bipolarAudioTaper42",
+    "sin",
+    "mixerPanL",
+    "mixerPanR",
+    "exp2",
+    "exp2ExLow",
+    "exp2ExHigh",
+    "db2Gain",
+    "tanh5"
+};
+
+static std::string floatLiteral(float x)
+{
+    std::ostringstream s;
+    s.imbue(std::locale::classic());
+    s.precision(9);         // enough for every float to survive the round trip
+    s << x;
+    std::string ret = s.str();
+    if (ret.find_first_of(".e") == std::string::npos) {
+        ret += ".0";
+    }
+    return ret + "f";
+}
+
+/**
+ * Writes BakedLookupTables.cpp.
+ * Run with "test.exe --bake" from the root of the repo.
+ */
+void genBakedTables()
+{
+    const char* fileName = "dsp/utils/BakedLookupTables.cpp";
+    std::ofstream out(fileName);
+    if (!out.good()) {
+        printf("can't write %s. Must run from root of repo\n", fileName);
+        return;
+    }
+    out.imbue(std::locale::classic());
+
+    out << "// Generated by \"test.exe --bake\". Do not edit by hand.\n";
+    out << "// See BakedLookupTables.h\n\n";
+    out << "#include \"BakedLookupTables.h\"\n";
+
+    for (int id = 0; id < BakedLookupTables::NumTables; ++id) {
+        LookupTableParams<float> params;
+        LookupTableFactory<float>::makeStandard(params, BakedLookupTables::Id(id));
+        const int numEntries = (params.numBins_i + 1) * 2;
+
+        out << "\nalignas(16) static const float " << bakedNames[id] << "Entries[" << numEntries << "] = {";
+        for (int i = 0; i < numEntries; ++i) {
+            out << (((i % 8) == 0) ? "\n    " : " ") << floatLiteral(params.entries[i]);
+            if (i != numEntries - 1) {
+                out << ",";
+            }
+        }
+        out << "\n};\n";
+    }
+
+    out << "\nconst BakedLookupTable BakedLookupTables::tables[BakedLookupTables::NumTables] = {\n";
+    for (int id = 0; id < BakedLookupTables::NumTables; ++id) {
+        LookupTableParams<float> params;
+        LookupTableFactory<float>::makeStandard(params, BakedLookupTables::Id(id));
+        out << "    {\"" << bakedNames[id] << "\", " << params.numBins_i << ", " << floatLiteral(params.a) << ", " << floatLiteral(params.b) << ", " << floatLiteral(params.xMin) << ", " << floatLiteral(params.xMax) << ", " << bakedNames[id] << "Entries}";
+        out << ((id == BakedLookupTables::NumTables - 1) ? "\n" : ",\n");
+    }
+    out << "};\n";
+    printf("wrote %s\n", fileName);
+}
+
+/**
+ * If this fails, LookupTableFactory has changed since the
+ * tables were baked. Run test.exe --bake to fix it.
+ */
+static void testBakedTablesUpToDate()
+{
+    for (int id = 0; id < BakedLookupTables::NumTables; ++id) {
+        const BakedLookupTable& baked = BakedLookupTables::get(BakedLookupTables::Id(id));
+        assertEQ(std::string(baked.name), std::string(bakedNames[id]));
+        assertEQ((size_t(baked.entries) % 16), 0);
+
+        LookupTableParams<float> params;
+        LookupTableFactory<float>::makeStandard(params, BakedLookupTables::Id(id));
+        assertEQ(baked.numBins, params.numBins_i);
+        assertEQ(baked.a, params.a);
+        assertEQ(baked.b, params.b);
+        assertEQ(baked.xMin, params.xMin);
+        assertEQ(baked.xMax, params.xMax);
+
+        // allow for a little difference in math libraries
+        for (int i = 0; i < (params.numBins_i + 1) * 2; ++i) {
+            const float expected = params.entries[i];
+            assertClose(baked.entries[i], expected, 1e-6 + std::abs(expected) * 1e-6);
+        }
+    }
+}
+
+static void testBakedTablesMatchLookup()
+{
+    // the float table we get is the same one we would have built
+    auto baked = ObjectCache<float>::getExp2();
+    assert(!baked->ownsEntries);
+
+    LookupTableParams<float> built;
+    LookupTableFactory<float>::makeExp2(built);
+    assert(built.ownsEntries);
+    for (float x = built.xMin; x <= built.xMax; x += .01f) {
+        assertClose(LookupTable<float>::lookup(*baked, x), LookupTable<float>::lookup(built, x), .0001);
+    }
+}
+
 template <typename T>
 static void testBipolar()
 {
@@ -249,6 +370,9 @@ static void test()
 
 void testObjectCache()
 {
+    assertEQ(_numLookupParams, 0);
+    testBakedTablesUpToDate();
+    testBakedTablesMatchLookup();
     assertEQ(_numLookupParams, 0);
     test<float>();
     test<double>();
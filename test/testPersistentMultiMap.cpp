@@ -0,0 +1,229 @@
+#include <assert.h>
+#include <map>
+#include <random>
+#include <vector>
+
+#include "asserts.h"
+#include "PersistentMultiMap.h"
+
+using Map = PersistentMultiMap<float, int>;
+using StdMap = std::multimap<float, int>;
+
+static void assertSame(const Map& map, const StdMap& ref)
+{
+    assertEQ(map.size(), ref.size());
+    assertEQ(map.empty(), ref.empty());
+
+    auto it = map.begin();
+    for (auto refIt : ref) {
+        assert(it != map.end());
+        assertEQ(it->first, refIt.first);
+        assertEQ(it->second, refIt.second);
+        ++it;
+    }
+    assert(it == map.end());
+
+    // and backwards
+    auto rit = map.rbegin();
+    for (auto refIt = ref.rbegin(); refIt != ref.rend(); ++refIt) {
+        assert(rit != map.rend());
+        assertEQ(rit->second, refIt->second);
+        ++rit;
+    }
+    assert(rit == map.rend());
+}
+
+static void testEmpty()
+{
+    Map map;
+    assert(map.empty());
+    assertEQ(map.size(), 0);
+    assert(map.begin() == map.end());
+    assert(map.rbegin() == map.rend());
+    assert(map.lower_bound(1) == map.end());
+    assert(map.upper_bound(1) == map.end());
+}
+
+static void testInsert()
+{
+    Map map;
+    auto it = map.insert(Map::value_type(2.f, 20));
+    assert(it == map.begin());
+    assertEQ(it->second, 20);
+
+    it = map.insert(Map::value_type(1.f, 10));
+    assert(it == map.begin());
+    assertEQ(it->second, 10);
+
+    // same key goes after
+    it = map.insert(Map::value_type(1.f, 11));
+    assertEQ(it->second, 11);
+    --it;
+    assertEQ(it->second, 10);
+
+    StdMap ref = {{1.f, 10}, {1.f, 11}, {2.f, 20}};
+    assertSame(map, ref);
+}
+
+static void testBounds()
+{
+    Map map;
+    for (int i = 0; i < 1000; ++i) {
+        map.insert(Map::value_type(float(i / 4), i));
+    }
+    auto range = map.equal_range(100);
+    assertEQ(range.first->second, 400);
+    assertEQ(range.second->second, 404);
+
+    assertEQ(map.lower_bound(99.5f)->second, 400);
+    assertEQ(map.upper_bound(99.5f)->second, 400);
+    assertEQ(map.lower_bound(-1)->second, 0);
+    assert(map.lower_bound(250) == map.end());
+    assert(map.upper_bound(249) == map.end());
+
+    // step back from end to the last one
+    auto it = map.end();
+    --it;
+    assertEQ(it->second, 999);
+}
+
+static void testErase()
+{
+    Map map;
+    for (int i = 0; i < 500; ++i) {
+        map.insert(Map::value_type(float(i), i));
+    }
+
+    // erase every other one
+    auto it = map.begin();
+    while (it != map.end()) {
+        it = map.erase(it);
+        if (it != map.end()) {
+            ++it;
+        }
+    }
+    assertEQ(map.size(), 250);
+    assertEQ(map.begin()->second, 1);
+
+    // and the rest
+    while (!map.empty()) {
+        it = map.erase(map.begin());
+    }
+    assert(it == map.end());
+}
+
+static void testRandom()
+{
+    std::mt19937 gen(1234);
+    std::uniform_int_distribution<int> keys(0, 200);
+    std::uniform_int_distribution<int> coin(0, 2);
+
+    Map map;
+    StdMap ref;
+    for (int i = 0; i < 20000; ++i) {
+        const float key = float(keys(gen)) / 4;
+        if (coin(gen) || ref.empty()) {
+            map.insert(Map::value_type(key, i));
+            ref.insert(StdMap::value_type(key, i));
+        } else {
+            // erase the first one at or after key, or the first one
+            auto it = map.lower_bound(key);
+            auto refIt = ref.lower_bound(key);
+            if (refIt == ref.end()) {
+                assert(it == map.end());
+                it = map.begin();
+                refIt = ref.begin();
+            }
+            assertEQ(it->second, refIt->second);
+            it = map.erase(it);
+            refIt = ref.erase(refIt);
+            if (refIt == ref.end()) {
+                assert(it == map.end());
+            } else {
+                assertEQ(it->second, refIt->second);
+            }
+        }
+    }
+    assertSame(map, ref);
+}
+
+static void testSnapshot()
+{
+    Map map;
+    StdMap ref;
+    for (int i = 0; i < 1000; ++i) {
+        map.insert(Map::value_type(float(i), i));
+        ref.insert(StdMap::value_type(float(i), i));
+    }
+
+    Map snapshot = map;
+    assert(snapshot.isSameTree(map));
+
+    map.erase(map.lower_bound(500));
+    map.insert(Map::value_type(2000.f, 2000));
+    assert(!snapshot.isSameTree(map));
+    assertEQ(map.size(), 1000);
+
+    // the snapshot didn't change
+    assertSame(snapshot, ref);
+
+    // edit the snapshot, and the map doesn't see it
+    snapshot.erase(snapshot.begin());
+    assertEQ(map.begin()->second, 0);
+
+    map = snapshot;
+    assert(map.isSameTree(snapshot));
+    assertEQ(map.size(), 999);
+}
+
+class Span
+{
+public:
+    static float end(const std::pair<float, int>& value)
+    {
+        return value.first + float(value.second % 10);
+    }
+};
+
+static void testOverlapping()
+{
+    std::mt19937 gen(5678);
+    std::uniform_int_distribution<int> keys(0, 400);
+    std::uniform_int_distribution<int> values(0, 1000);
+
+    PersistentMultiMap<float, int, Span> map;
+    for (int i = 0; i < 3000; ++i) {
+        map.insert(std::make_pair(float(keys(gen)), values(gen)));
+    }
+    // erase some, so the ends have to be kept up to date
+    for (int i = 0; i < 1000; ++i) {
+        auto it = map.lower_bound(float(keys(gen)));
+        map.erase((it == map.end()) ? map.begin() : it);
+    }
+
+    for (float lo = -20; lo < 420; lo += 3.5f) {
+        const float hi = lo + 2;
+        std::vector<int> found;
+        map.forEachOverlapping(lo, hi, [&found](const std::pair<float, int>& value) {
+            found.push_back(value.second);
+        });
+        std::vector<int> expected;
+        for (auto it : map) {
+            if (it.first <= hi && Span::end(it) > lo) {
+                expected.push_back(it.second);
+            }
+        }
+        assert(found == expected);
+    }
+}
+
+void testPersistentMultiMap()
+{
+    testEmpty();
+    testInsert();
+    testBounds();
+    testErase();
+    testRandom();
+    testSnapshot();
+    testOverlapping();
+}
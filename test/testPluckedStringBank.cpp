@@ -0,0 +1,263 @@
+
+#include "TestComposite.h"
+#include "KSComposite.h"
+#include "PluckedStringBank.h"
+
+#include "asserts.h"
+#include "tutil.h"
+
+static void testLength()
+{
+    PluckedStringBank bank(100);
+    assertEQ(bank._getLength(), 128);
+
+    bank.setMaxDelay(2000);
+    assertEQ(bank._getLength(), 2048);
+
+    // needs room for the interpolator
+    bank.setMaxDelay(2048);
+    assertEQ(bank._getLength(), 4096);
+}
+
+static void testReserve()
+{
+    PluckedStringBank bank(100);
+    bank.reserve(10000);
+    const float* memory = bank._getMemory();
+
+    // changing the length inside what was reserved doesn't allocate
+    bank.setMaxDelay(5000);
+    assertEQ(bank._getLength(), 8192);
+    bank.setMaxDelay(100);
+    assertEQ(bank._getLength(), 128);
+    assert(bank._getMemory() == memory);
+
+    // and the shorter string still works
+    bank.setFeedback(float_4(1));
+    bank.setFreq(float_4(1.f / 10));
+    for (int i = 0; i < 50; ++i) {
+        const float_4 x = bank.process(float_4(i == 0 ? 1.f : 0.f));
+        const float expected = ((i > 0) && (i % 10) == 0) ? 1.f : 0.f;
+        assertClose(x[0], expected, .0001);
+    }
+}
+
+static void testSilentUntilPlucked()
+{
+    PluckedStringBank bank;
+    bank.setFeedback(float_4(1));
+    bank.setFreq(float_4(.01f));
+    for (int i = 0; i < 1000; ++i) {
+        const float_4 x = bank.process(float_4(0));
+        simd_assertEQ(x, float_4(0));
+    }
+}
+
+static void testDelayClamped()
+{
+    PluckedStringBank bank(1000);
+    bank.setFreq(float_4(.9f, 0, .01f, 1e-6f));
+    const float_4 delay = bank._getDelay();
+    assertEQ(delay[0], 2);
+    assertLT(delay[1], bank._getLength());
+    assertClose(delay[2], 100, .0001);
+    assertEQ(delay[3], delay[1]);
+}
+
+/**
+ * Impulse in, with no damping and unity feedback.
+ * Should come out delay samples later, over and over.
+ */
+static void testImpulse()
+{
+    PluckedStringBank bank;
+    bank.setFeedback(float_4(1));
+    bank.setFreq(float_4(1.f / 10, 1.f / 20, 1.f / 30, 1.f / 40));
+
+    for (int i = 0; i < 200; ++i) {
+        const float_4 x = bank.process(float_4(i == 0 ? 1.f : 0.f));
+        for (int lane = 0; lane < 4; ++lane) {
+            const int period = 10 * (lane + 1);
+            const float expected = ((i > 0) && (i % period) == 0) ? 1.f : 0.f;
+            assertClose(x[lane], expected, .0001);
+        }
+    }
+}
+
+static void testPluckOneLane()
+{
+    PluckedStringBank bank;
+    bank.setFeedback(float_4(1));
+    bank.setFreq(float_4(.01f));
+    bank.pluck(2, 1);
+
+    float_4 peak = 0;
+    for (int i = 0; i < 1000; ++i) {
+        const float_4 x = bank.process(float_4(0));
+        peak = SimdBlocks::max(peak, rack::simd::abs(x));
+    }
+    assertEQ(peak[0], 0);
+    assertEQ(peak[1], 0);
+    assertGT(peak[2], .5);
+    assertLT(peak[2], 2);
+    assertEQ(peak[3], 0);
+}
+
+/**
+ * Returns the frequency of each string, from the upward zero crossings.
+ */
+static float_4 measureFreq(float_4 normalizedFreq, float damping)
+{
+    PluckedStringBank bank(4000);
+    bank.setDamping(float_4(damping));
+    bank.setFeedback(float_4(1));
+    bank.setFreq(normalizedFreq);
+    for (int lane = 0; lane < 4; ++lane) {
+        bank.pluck(lane, 1);
+    }
+
+    // Let each string settle down to mostly fundamental before we look for
+    // zero crossings. The harmonics of long strings take a lot longer to die out.
+    int settle[4];
+    int end = 0;
+    const int window = 20000;
+    for (int lane = 0; lane < 4; ++lane) {
+        const float period = 1 / normalizedFreq[lane];
+        settle[lane] = int(period * std::max(40.f, .25f * period * period));
+        end = std::max(end, settle[lane] + window);
+    }
+
+    float_4 last = 0;
+    float firstCrossing[4] = {-1, -1, -1, -1};
+    float lastCrossing[4] = {};
+    int crossings[4] = {};
+    for (int i = 0; i < end; ++i) {
+        const float_4 x = bank.process(float_4(0));
+        for (int lane = 0; lane < 4; ++lane) {
+            if (i > settle[lane] && i < settle[lane] + window && last[lane] < 0 && x[lane] >= 0) {
+                const float t = i - 1 + last[lane] / (last[lane] - x[lane]);
+                if (firstCrossing[lane] < 0) {
+                    firstCrossing[lane] = t;
+                } else {
+                    crossings[lane]++;
+                }
+                lastCrossing[lane] = t;
+            }
+        }
+        last = x;
+    }
+
+    float_4 ret;
+    for (int lane = 0; lane < 4; ++lane) {
+        assertGT(crossings[lane], 10);
+        ret[lane] = crossings[lane] / (lastCrossing[lane] - firstCrossing[lane]);
+    }
+    return ret;
+}
+
+static void testTuning(float damping)
+{
+    // some fractional periods, including some short ones
+    const float_4 f(1.f / 100.5f, 1.f / 51.25f, 1.f / 13.7f, 440.f / 44100.f);
+    const float_4 measured = measureFreq(f, damping);
+    for (int lane = 0; lane < 4; ++lane) {
+        // .1% is under 2 cents. The interpolator's phase delay drifts a little
+        // at high pitches, so the 3k one is only within 5 cents.
+        const float tolerance = (lane == 2) ? .003f : .001f;
+        assertClose(measured[lane] / f[lane], 1, tolerance);
+    }
+}
+
+static void testTuning()
+{
+    testTuning(.5f);
+    testTuning(.25f);
+}
+
+static void testDecay()
+{
+    PluckedStringBank bank;
+    bank.setDamping(float_4(0, .1f, .5f, .5f));
+    bank.setFeedback(float_4(.99f, .99f, .99f, .9f));
+    bank.setFreq(float_4(.01f));
+    for (int lane = 0; lane < 4; ++lane) {
+        bank.pluck(lane, 1);
+    }
+
+    // energy in the first and second 1000 samples
+    double early[4] = {};
+    double late[4] = {};
+    for (int i = 0; i < 2000; ++i) {
+        const float_4 x = bank.process(float_4(0));
+        for (int lane = 0; lane < 4; ++lane) {
+            (i < 1000 ? early : late)[lane] += x[lane] * x[lane];
+        }
+    }
+    for (int lane = 0; lane < 4; ++lane) {
+        assertLT(late[lane], early[lane]);
+    }
+    // more damping and less feedback decay faster
+    assertLT(late[1] / early[1], late[0] / early[0]);
+    assertLT(late[2] / early[2], late[1] / early[1]);
+    assertLT(late[3] / early[3], late[2] / early[2]);
+}
+
+using Comp = KSComposite<TestComposite>;
+
+static void testComposite(int channels)
+{
+    Comp ks;
+    initComposite(ks);
+    ks.inputs[Comp::VOCT_INPUT].channels = channels;
+    ks.inputs[Comp::GATE_INPUT].channels = channels;
+    ks.outputs[Comp::AUDIO_OUTPUT].channels = 1;
+
+    TestComposite::ProcessArgs args;
+    for (int i = 0; i < 100; ++i) {
+        ks.process(args);
+    }
+    assertEQ(ks.outputs[Comp::AUDIO_OUTPUT].channels, channels);
+    for (int i = 0; i < channels; ++i) {
+        assertEQ(ks.outputs[Comp::AUDIO_OUTPUT].getVoltage(i), 0);
+    }
+
+    // pluck every other channel
+    for (int i = 0; i < channels; i += 2) {
+        ks.inputs[Comp::GATE_INPUT].setVoltage(10, i);
+    }
+    float peak[16] = {};
+    for (int i = 0; i < 1000; ++i) {
+        ks.process(args);
+        for (int ch = 0; ch < channels; ++ch) {
+            peak[ch] = std::max(peak[ch], std::abs(ks.outputs[Comp::AUDIO_OUTPUT].getVoltage(ch)));
+        }
+    }
+    for (int ch = 0; ch < channels; ++ch) {
+        if (ch % 2) {
+            assertEQ(peak[ch], 0);
+        } else {
+            assertGT(peak[ch], 2);
+            assertLT(peak[ch], 10);
+        }
+    }
+}
+
+static void testComposite()
+{
+    testComposite(1);
+    testComposite(7);
+    testComposite(16);
+}
+
+void testPluckedStringBank()
+{
+    testLength();
+    testReserve();
+    testSilentUntilPlucked();
+    testDelayClamped();
+    testImpulse();
+    testPluckOneLane();
+    testTuning();
+    testDecay();
+    testComposite();
+}
@@ -675,6 +675,57 @@ static void testAutoTriads2()
 #endif
 }
 
+// undo and redo should give back the very same events
+static void testUndoSnapshot()
+{
+    MidiSongPtr ms = MidiSong::makeTest(MidiTrack::TestContent::eightQNotes, 0);
+    MidiSequencerPtr seq = MidiSequencer::make(ms, std::make_shared<TestSettings>(), std::make_shared<TestAuditionHost>());
+    MidiTrackPtr track = ms->getTrack(0);
+    const auto original = track->_testGetVector();
+
+    seq->selection->selectAll(track);
+    auto cmd = ReplaceDataCommand::makeChangePitchCommand(seq, 1);
+    seq->undo->execute(seq, cmd);
+    const auto changed = track->_testGetVector();
+    assertEQ(changed.size(), original.size());
+    assert(changed[0] != original[0]);
+
+    seq->undo->undo(seq);
+    seq->assertValid();
+    assert(track->_testGetVector() == original);
+    assertEQ(seq->selection->size(), 8);
+
+    seq->undo->redo(seq);
+    seq->assertValid();
+    assert(track->_testGetVector() == changed);
+    assertEQ(seq->selection->size(), 8);
+}
+
+// if the track changes behind the command's back, undo still works
+static void testUndoAfterOtherEdit()
+{
+    MidiSongPtr ms = MidiSong::makeTest(MidiTrack::TestContent::eightQNotes, 0);
+    MidiSequencerPtr seq = MidiSequencer::make(ms, std::make_shared<TestSettings>(), std::make_shared<TestAuditionHost>());
+    MidiTrackPtr track = ms->getTrack(0);
+
+    seq->selection->select(track->getFirstNote());
+    auto cmd = ReplaceDataCommand::makeChangePitchCommand(seq, 1);
+    cmd->execute(seq, nullptr);
+
+    MidiNoteEventPtr extra = std::make_shared<MidiNoteEvent>();
+    extra->startTime = 1.5f;
+    {
+        MidiLocker l(ms->lock);
+        track->insertEvent(extra);
+    }
+
+    cmd->undo(seq, nullptr);
+    seq->assertValid();
+    assertEQ(track->size(), 10);
+    assertClose(track->getFirstNote()->pitchCV, -1, .001);
+    assert(track->findEventDeep(*extra) != track->end());
+}
+
 void testReplaceCommand()
 {
     test0();
@@ -682,6 +733,8 @@ void testReplaceCommand()
     test2();
 
     testTrans();
+    testUndoSnapshot();
+    testUndoAfterOtherEdit();
     testTrackLength();
     testTrackLength2();
     testInsert();
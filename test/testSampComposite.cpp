@@ -57,6 +57,109 @@ static void testSampCompositeError() {
     assertEQ(inst->errorMessage, "can't open abcdef");
 }
 
+static float processAndGetOutput(Comp& comp, int times, int channel = 0) {
+    Comp::ProcessArgs args;
+    args.sampleRate = 44100;
+    args.sampleTime = 1.f / 44100.f;
+    for (int i = 0; i < times; ++i) {
+        comp.process(args);
+    }
+    return comp.outputs[Comp::AUDIO_OUTPUT].getVoltage(channel);
+}
+
+// re-triggering a channel starts a new voice, and lets the old one ring out
+static void testSampRetriggerTail() {
+    Comp comp;
+    initComposite(comp);
+    comp._setupPerfTest();
+    comp.inputs[Comp::PITCH_INPUT].channels = 1;
+    comp.outputs[Comp::AUDIO_OUTPUT].channels = 1;
+
+    comp.inputs[Comp::GATE_INPUT].setVoltage(10, 0);
+    const float oneNote = processAndGetOutput(comp, 4000);
+    assertGT(oneNote, .1);
+
+    comp.inputs[Comp::GATE_INPUT].setVoltage(0, 0);
+    processAndGetOutput(comp, 10);
+    comp.inputs[Comp::GATE_INPUT].setVoltage(10, 0);
+    const float twoNotes = processAndGetOutput(comp, 500);
+    assertGT(twoNotes, 1.5f * oneNote);
+
+    // after the tail is gone, just the new one
+    const float laterNote = processAndGetOutput(comp, 44100);
+    assertClose(laterNote, oneNote, .01);
+}
+
+// more than 16 notes can be sounding at once
+static void testSamp32Voices() {
+    Comp comp;
+    initComposite(comp);
+    comp._setupPerfTest();
+    comp.inputs[Comp::PITCH_INPUT].channels = 16;
+    comp.outputs[Comp::AUDIO_OUTPUT].channels = 16;
+
+    for (int i = 0; i < 16; ++i) {
+        comp.inputs[Comp::GATE_INPUT].setVoltage(10, i);
+    }
+    const float oneNote = processAndGetOutput(comp, 4000, 15);
+    for (int i = 0; i < 16; ++i) {
+        comp.inputs[Comp::GATE_INPUT].setVoltage(0, i);
+    }
+    processAndGetOutput(comp, 10);
+    for (int i = 0; i < 16; ++i) {
+        comp.inputs[Comp::GATE_INPUT].setVoltage(10, i);
+    }
+    processAndGetOutput(comp, 500);
+    for (int i = 0; i < 16; ++i) {
+        assertGT(comp.outputs[Comp::AUDIO_OUTPUT].getVoltage(i), 1.5f * oneNote);
+    }
+}
+
+// When every voice is busy, a new note steals the oldest tail, even if it belongs
+// to another channel. After that the voice must follow its new channel.
+static void testSampStealFromOtherChannel() {
+    Comp comp;
+    initComposite(comp);
+    comp._setupPerfTest();
+    comp.inputs[Comp::PITCH_INPUT].channels = 16;
+    comp.outputs[Comp::AUDIO_OUTPUT].channels = 16;
+    comp.params[Comp::PITCH_TRIM_PARAM].value = 1;
+    comp.inputs[Comp::FM_INPUT].setVoltage(1, 3);
+
+    // 16 notes, then 16 more, so there are 16 tails and 16 held voices
+    for (int i = 0; i < 16; ++i) {
+        comp.inputs[Comp::GATE_INPUT].setVoltage(10, i);
+    }
+    processAndGetOutput(comp, 4000);
+    for (int i = 0; i < 16; ++i) {
+        comp.inputs[Comp::GATE_INPUT].setVoltage(0, i);
+    }
+    processAndGetOutput(comp, 10);
+    for (int i = 0; i < 16; ++i) {
+        comp.inputs[Comp::GATE_INPUT].setVoltage(10, i);
+    }
+    processAndGetOutput(comp, 100);
+
+    // now channel 3 plays again. All the tails are the same, so it
+    // steals the oldest one, which is channel 0's
+    comp.inputs[Comp::GATE_INPUT].setVoltage(0, 3);
+    processAndGetOutput(comp, 10);
+    comp.inputs[Comp::GATE_INPUT].setVoltage(10, 3);
+    processAndGetOutput(comp, 400);
+
+    // the stolen voice uses channel 3's FM
+    assertClose(comp._getTranspose(3), 2, .0001f);
+    assertClose(comp._getTranspose(0), 1, .0001f);
+
+    // channel 0 lost its tail, channel 1 still has one,
+    // and channel 3 has the new note and two tails.
+    const float out0 = comp.outputs[Comp::AUDIO_OUTPUT].getVoltage(0);
+    const float out1 = comp.outputs[Comp::AUDIO_OUTPUT].getVoltage(1);
+    const float out3 = comp.outputs[Comp::AUDIO_OUTPUT].getVoltage(3);
+    assertGT(out1, 1.2f * out0);
+    assertGT(out3, 1.2f * out1);
+}
+
 static void testSchemaUpdate(float oldPitch, float newOctave, float newPitch) {
     Comp comp;
     initComposite(comp);
@@ -102,6 +205,9 @@ void testSampComposite() {
     //SQWARN("start testSampComposite 101 ");
     testSampComposite0();
     //SQWARN("start testSampComposite 103");
+    testSampRetriggerTail();
+    testSamp32Voices();
+    testSampStealFromOtherChannel();
 
 #ifdef _MSC_VER
     testSampCompositeError();
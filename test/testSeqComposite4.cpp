@@ -334,6 +334,79 @@ static void testSelectSectionWithCVPoly()
 }
 
 
+static void testEventBuffer()
+{
+    MidiPlayerEventBuffer buffer;
+    assertEQ(buffer.size(), 0);
+    assertEQ(buffer.getSampleOffset(), 0);
+
+    buffer.setSampleOffset(3);
+    buffer.pushCV(1, 2, 4.5f);
+    buffer.pushGate(1, 2, true);
+    buffer.setSampleOffset(0);
+    buffer.pushGate(3, 15, false);
+    assertEQ(buffer.size(), 3);
+
+    // sort puts them in time order, but keeps the CV before the gate
+    buffer.sort();
+    assertEQ(buffer[0].sampleOffset, 0);
+    assertEQ(buffer[0].track, 3);
+    assertEQ(buffer[0].voice, 15);
+    assertEQ(buffer[0].value, 0);
+
+    assertEQ(buffer[1].sampleOffset, 3);
+    assertEQ(int(buffer[1].type), int(MidiPlayerEventBuffer::Type::CV));
+    assertEQ(buffer[1].value, 4.5f);
+    assertEQ(buffer[2].sampleOffset, 3);
+    assertEQ(int(buffer[2].type), int(MidiPlayerEventBuffer::Type::Gate));
+    assertEQ(buffer[2].value, 1);
+
+    buffer.setSampleOffset(2);
+    buffer.clear();
+    assertEQ(buffer.size(), 0);
+    assertEQ(buffer.getSampleOffset(), 0);
+}
+
+static void testEventBufferOverflow()
+{
+    MidiPlayerEventBuffer buffer;
+    for (int i = 0; i < MidiPlayerEventBuffer::maxEvents + 5; ++i) {
+        buffer.pushGate(0, 0, true);
+    }
+    assertEQ(buffer.size(), MidiPlayerEventBuffer::maxEvents);
+    assertEQ(buffer._getOverflowCount(), 5);
+}
+
+/**
+ * Clocks the first note in on each sample of a block.
+ * The gate should always come out the same number
+ * of samples after the clock, no matter where in the block it came.
+ */
+static void testClockToGateLatency(int phase)
+{
+    const auto rate = SeqClock::ClockRate::Div64;
+    Sq4Ptr comp = make(rate, 4, true, -1);
+    stepN(comp, 16);
+    stepN(comp, phase);
+    assertLT(comp->outputs[comp->GATE0_OUTPUT].getVoltage(0), 5);
+
+    comp->inputs[Sq4::CLOCK_INPUT].setVoltage(10, 0);
+    int latency = 0;
+    while (comp->outputs[comp->GATE0_OUTPUT].getVoltage(0) < 5) {
+        comp->step();
+        ++latency;
+        assertLT(latency, 100);
+    }
+    assertEQ(latency, Sq4::blockSize + 1);
+}
+
+static void testClockToGateLatency()
+{
+    for (int phase = 0; phase < Sq4::blockSize; ++phase) {
+        testClockToGateLatency(phase);
+    }
+}
+
 static void testLabels()
 {
     auto x = Sq4::getPolyLabels();
@@ -350,4 +423,7 @@ void testSeqComposite4()
     testLabels();
     testSelectSectionWithCV();
     testSelectSectionWithCVPoly();
+    testEventBuffer();
+    testEventBufferOverflow();
+    testClockToGateLatency();
 }
\ No newline at end of file
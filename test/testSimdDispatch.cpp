@@ -0,0 +1,343 @@
+
+#include "Cmprsr.h"
+#include "CompiledInstrument.h"
+#include "SInstrument.h"
+#include "SParse.h"
+#include "Sampler4vx.h"
+#include "SamplerErrorContext.h"
+#include "simd8.h"
+#include "SimdDispatch.h"
+#include "StateVariableFilter2.h"
+#include "TestComposite.h"
+#include "WaveLoader.h"
+#include "WVCO.h"
+#include "tutil.h"
+
+#include "asserts.h"
+
+static void testFloat8()
+{
+    float data[8] = {1, 2, 3, 4, 5, 6, 7, 8};
+    float_8 x = float_8::load(data);
+    assertEQ(x[0], 1);
+    assertEQ(x[7], 8);
+
+    float_8 y = x + float_8(1);
+    assertEQ(y[3], 5);
+    assertEQ(y[4], 6);
+
+    y = x * float_8(2) - float_8(1);
+    assertEQ(y[0], 1);
+    assertEQ(y[7], 15);
+
+    float_8 mask = x > float_8(4);
+    float_8 z = SimdBlocks8::ifelse(mask, float_8(10), float_8(-10));
+    assertEQ(z[3], -10);
+    assertEQ(z[4], 10);
+
+    float out[8];
+    z.store(out);
+    assertEQ(out[0], -10);
+    assertEQ(out[7], 10);
+}
+
+static void fillPhases(float* data, int size)
+{
+    const float twoPi = 2 * 3.141592653589793238f;
+    for (int i = 0; i < size; ++i) {
+        data[i] = twoPi * float(i) / float(size - 1);
+    }
+}
+
+static void testSinKernel(SimdDispatch::Level level)
+{
+    SimdDispatch::_setLevel(level);
+    assert(SimdDispatch::getLevel() == level);
+
+    const int size = 256;
+    float data[size];
+    fillPhases(data, size);
+    SimdDispatch::kernels().sinTwoPi(data, size);
+
+    float expected[size];
+    fillPhases(expected, size);
+    for (int i = 0; i < size; i += 4) {
+        float_4 x = float_4::load(expected + i);
+        SimdBlocks::sinTwoPi(x).store(expected + i);
+    }
+
+    for (int i = 0; i < size; ++i) {
+        assertEQ(data[i], expected[i]);
+    }
+}
+
+static std::vector<float> renderWVCO(SimdDispatch::Level level, int waveform)
+{
+    SimdDispatch::_setLevel(level);
+    using Comp = WVCO<TestComposite>;
+    Comp wvco;
+    initComposite(wvco);
+    wvco.inputs[Comp::VOCT_INPUT].channels = 16;
+    for (int i = 0; i < 16; ++i) {
+        wvco.inputs[Comp::VOCT_INPUT].setVoltage(float(i) * .1f, i);
+    }
+    wvco.params[Comp::WAVE_SHAPE_PARAM].value = float(waveform);
+    wvco.params[Comp::WAVESHAPE_GAIN_PARAM].value = 50;
+
+    std::vector<float> ret;
+    for (int i = 0; i < 1000; ++i) {
+        wvco.step();
+        for (int ch = 0; ch < 16; ++ch) {
+            ret.push_back(wvco.outputs[Comp::MAIN_OUTPUT].getVoltage(ch));
+        }
+    }
+    return ret;
+}
+
+static void testWVCOSameAllLevels(int waveform)
+{
+    if (!SimdDispatch::cpuHasAVX2()) {
+        return;
+    }
+    auto sse = renderWVCO(SimdDispatch::Level::SSE, waveform);
+    auto avx = renderWVCO(SimdDispatch::Level::AVX2, waveform);
+    assertEQ(sse.size(), avx.size());
+    for (size_t i = 0; i < sse.size(); ++i) {
+        assertEQ(sse[i], avx[i]);
+    }
+}
+
+static void setupDsp(WVCODsp& dsp, WVCODsp::WaveForm waveform, bool doFM)
+{
+    dsp.waveform = waveform;
+    dsp.normalizedFreq = float_4(.001f, .013f, .05f, .21f);
+    dsp.correctedWaveShapeMultiplier = float_4(1, 2.5f, 4, 11);
+    dsp.feedback = float_4(0, .1f, .3f, .6f);
+    dsp.fmInput = float_4(0, 1.3f, -.4f, 2);
+    dsp.waveformOffset = float_4(.1f);
+    dsp.outputLevel = float_4(.8f);
+    dsp.setDoFM(doFM);
+    dsp.setSyncEnable(true);
+}
+
+// The sin block kernels must give exactly what the
+// general float_4 code in WVCODsp gives
+static void testSinBlockSameAsGeneric(SimdDispatch::Level level, WVCODsp::WaveForm waveform, bool doFM)
+{
+    SimdDispatch::_setLevel(level);
+    WVCODsp block;
+    WVCODsp generic;
+    setupDsp(block, waveform, doFM);
+    setupDsp(generic, waveform, doFM);
+    assert(block.canUseSinBlock(false));
+
+    for (int i = 0; i < 2000; ++i) {
+        // a slow square wave into sync, so it actually syncs some times
+        const float_4 sync = ((i / 37) & 1) ? float_4(1) : float_4(-1);
+        const float_4 x = block.step(sync, false);
+        const float_4 y = generic.stepGeneric(sync, false);
+        for (int j = 0; j < 4; ++j) {
+            assertEQ(x[j], y[j]);
+        }
+    }
+}
+
+static void setupCmprsr(Cmprsr& comp, int bank, bool linked)
+{
+    comp.setIsPolyCV(true);
+    comp.setNumChannels(4);
+    comp.setLinked(linked);
+    Cmprsr::Ratios r[4] = {Cmprsr::Ratios::HardLimit, Cmprsr::Ratios::_2_1_soft, Cmprsr::Ratios::_4_1_hard, Cmprsr::Ratios::_20_1_soft};
+    comp.setCurvePoly(r);
+
+    // zero attack is instant, .5 ms uses the attack filter
+    comp.setTimesPoly(float_4(0, .5f, 3, 10 + bank), float_4(50, 100, 200, 400), 1.f / 44100.f);
+    comp.setThresholdPoly(float_4(1, 2, 3, 4));
+}
+
+static void testEnvelopeKernel(SimdDispatch::Level level, bool linked)
+{
+    SimdDispatch::_setLevel(level);
+
+    // odd number of banks, so the AVX2 kernel has one left over
+    const int numBanks = 3;
+    Cmprsr kernelComp[numBanks];
+    Cmprsr refComp[numBanks];
+    for (int bank = 0; bank < numBanks; ++bank) {
+        setupCmprsr(kernelComp[bank], bank, linked);
+        setupCmprsr(refComp[bank], bank, linked);
+    }
+
+    for (int i = 0; i < 5000; ++i) {
+        SimdDispatch::EnvelopeBank banks[numBanks];
+        float_4 input[numBanks];
+        for (int bank = 0; bank < numBanks; ++bank) {
+            // bursts of sine, so it attacks and releases
+            const float level = ((i / 500) & 1) ? 8.f : .5f;
+            input[bank] = float_4(level * std::sin(float(i + bank) * .05f));
+            input[bank][1] *= .3f;
+            kernelComp[bank].prepareEnvelopeBlock(banks[bank], input[bank]);
+        }
+        SimdDispatch::kernels().detectEnvelope(banks, numBanks);
+        for (int bank = 0; bank < numBanks; ++bank) {
+            const float_4 x = kernelComp[bank].finishEnvelopeBlock(input[bank]);
+            const float_4 y = refComp[bank].stepPoly(input[bank], input[bank]);
+            for (int j = 0; j < 4; ++j) {
+                assertEQ(x[j], y[j]);
+            }
+        }
+    }
+}
+
+static void testSvfKernel(SimdDispatch::Level level, StateVariableFilter2<float_4>::Mode mode)
+{
+    SimdDispatch::_setLevel(level);
+
+    const int numBanks = 3;
+    StateVariableFilterParams2<float_4> params[numBanks];
+    StateVariableFilterState2<float_4> kernelState[numBanks];
+    StateVariableFilterState2<float_4> refState[numBanks];
+    for (int bank = 0; bank < numBanks; ++bank) {
+        params[bank].setFreq(float_4(.001f, .01f, .03f, .1f) * float(bank + 1));
+        params[bank].setQ(float_4(.7f, 2, 5, 20));
+    }
+    auto ref = StateVariableFilter2<float_4>::getProcPointer(mode, 4);
+
+    for (int i = 0; i < 2000; ++i) {
+        SimdDispatch::SvfBank banks[numBanks];
+        float_4 input[numBanks];
+        float_4 output[numBanks];
+        for (int bank = 0; bank < numBanks; ++bank) {
+            input[bank] = float_4(((i / (10 + bank)) & 1) ? 1.f : -1.f);
+            banks[bank].input = &input[bank][0];
+            banks[bank].z1 = &kernelState[bank].z1[0];
+            banks[bank].z2 = &kernelState[bank].z2[0];
+            banks[bank].fcGain = &params[bank]._fcGain()[0];
+            banks[bank].qGain = &params[bank]._qGain()[0];
+            banks[bank].output = &output[bank][0];
+        }
+        SimdDispatch::kernels().svf4x(banks, numBanks, int(mode));
+        for (int bank = 0; bank < numBanks; ++bank) {
+            const float_4 y = ref(input[bank], refState[bank], params[bank]);
+            for (int j = 0; j < 4; ++j) {
+                assertEQ(output[bank][j], y[j]);
+            }
+        }
+    }
+}
+
+static std::shared_ptr<Sampler4vx> makeSampler(WaveLoaderPtr w, const char* sfz)
+{
+    SInstrumentPtr inst = std::make_shared<SInstrument>();
+    auto perr = SParse::go(sfz, inst);
+    assert(perr.empty());
+
+    SamplerErrorContext errc;
+    auto ci = CompiledInstrument::make(errc, inst);
+    assert(ci);
+
+    auto ret = std::make_shared<Sampler4vx>();
+    ret->setLoader(w);
+    ret->setNumVoices(4);
+    ret->setPatch(ci);
+    return ret;
+}
+
+static void testSampleKernel(SimdDispatch::Level level)
+{
+    SimdDispatch::_setLevel(level);
+
+    WaveLoaderPtr w = std::make_shared<WaveLoader>();
+    w->_setTestMode(WaveLoader::Tests::RampOneSec);
+
+    const char* plain = "<region>sample=r1 ampeg_release=.05";
+    const char* looped = "<region>sample=r1 ampeg_release=.05 loop_mode=loop_continuous loop_start=1000 loop_end=2000";
+    const char* oneShot = "<region>sample=r1 loop_mode=one_shot";
+
+    // odd number of banks, so the AVX2 kernel has one left over. One pair mixes a one shot with a normal region.
+    const int numBanks = 5;
+    const char* sfz[numBanks] = {plain, looped, plain, oneShot, looped};
+    std::shared_ptr<Sampler4vx> kernelSamp[numBanks];
+    std::shared_ptr<Sampler4vx> refSamp[numBanks];
+    for (int bank = 0; bank < numBanks; ++bank) {
+        kernelSamp[bank] = makeSampler(w, sfz[bank]);
+        refSamp[bank] = makeSampler(w, sfz[bank]);
+        for (int channel = 0; channel < 4; ++channel) {
+            const int midiPitch = 60 + 7 * channel + bank;
+            kernelSamp[bank]->note_on(channel, midiPitch, 60, 44100);
+            refSamp[bank]->note_on(channel, midiPitch, 60, 44100);
+        }
+        // up an octave, so the short ones run off the end
+        kernelSamp[bank]->setExpFM(float_4(1));
+        refSamp[bank]->setExpFM(float_4(1));
+    }
+
+    const float sampleTime = 1.f / 44100.f;
+    float biggest = 0;
+    // long enough that the banks that don't loop run out of samples.
+    for (int i = 0; i < 24000; ++i) {
+        const float_4 gates = (i < 4000) ? SimdBlocks::maskTrue() : SimdBlocks::maskFalse();
+        SimdDispatch::SampleBank banks[numBanks];
+        float_4 lfm[numBanks];
+        for (int bank = 0; bank < numBanks; ++bank) {
+            lfm[bank] = float_4(0, .1f, .2f, .3f) * std::sin(float(i + bank) * .01f);
+            const bool playing = kernelSamp[bank]->prepareBlock(banks[bank], gates, sampleTime, lfm[bank]);
+            assert(playing);
+        }
+        SimdDispatch::kernels().sampleStep(banks, numBanks, Sampler4vx::_outputGain()[0], sampleTime);
+        for (int bank = 0; bank < numBanks; ++bank) {
+            const float_4 x = kernelSamp[bank]->finishBlock();
+            const float_4 y = refSamp[bank]->step(gates, sampleTime, lfm[bank], true);
+            const float_4 xLevel = kernelSamp[bank]->getLevel();
+            const float_4 yLevel = refSamp[bank]->getLevel();
+            for (int j = 0; j < 4; ++j) {
+                assertEQ(x[j], y[j]);
+                assertEQ(xLevel[j], yLevel[j]);
+                biggest = std::max(biggest, std::abs(x[j]));
+            }
+        }
+    }
+    assertGT(biggest, 1);
+}
+
+static void testKernelsSameAsReference(SimdDispatch::Level level)
+{
+    testSinBlockSameAsGeneric(level, WVCODsp::WaveForm::Sine, false);
+    testSinBlockSameAsGeneric(level, WVCODsp::WaveForm::Sine, true);
+    testSinBlockSameAsGeneric(level, WVCODsp::WaveForm::Fold, false);
+    testSinBlockSameAsGeneric(level, WVCODsp::WaveForm::Fold, true);
+
+    testEnvelopeKernel(level, false);
+    testEnvelopeKernel(level, true);
+
+    using Mode = StateVariableFilter2<float_4>::Mode;
+    testSvfKernel(level, Mode::LowPass);
+    testSvfKernel(level, Mode::BandPass);
+    testSvfKernel(level, Mode::HighPass);
+    testSvfKernel(level, Mode::Notch);
+
+    testSampleKernel(level);
+}
+
+void testSimdDispatch()
+{
+    const SimdDispatch::Level initialLevel = SimdDispatch::getLevel();
+    if (SimdDispatch::cpuHasAVX2()) {
+        assert(initialLevel == SimdDispatch::Level::AVX2);
+    }
+
+    testFloat8();
+    testSinKernel(SimdDispatch::Level::SSE);
+    if (SimdDispatch::cpuHasAVX2()) {
+        testSinKernel(SimdDispatch::Level::AVX2);
+    }
+    testWVCOSameAllLevels(0);
+    testWVCOSameAllLevels(1);
+
+    testKernelsSameAsReference(SimdDispatch::Level::SSE);
+    if (SimdDispatch::cpuHasAVX2()) {
+        testKernelsSameAsReference(SimdDispatch::Level::AVX2);
+    }
+
+    SimdDispatch::_setLevel(initialLevel);
+}
@@ -1,5 +1,7 @@
 
 #include "LookupTableFactory.h"
+#include "NonUniformLookupTable.h"
+#include "ObjectCache.h"
 #include "asserts.h"
 
 #include "simd.h"
@@ -153,8 +155,70 @@ static void compareSecond()
     assertClose(maxErr, 0, .03);
 }
 
+/**
+ * lookupSimd should match lookup exactly, including
+ * inputs that are outside the domain.
+ */
+static void testLookupSimd(std::shared_ptr<LookupTableParams<float>> params)
+{
+    const float range = params->xMax - params->xMin;
+    const float start = params->xMin - range * .1f;
+    const int steps = 1000;
+    for (int i = 0; i < steps; i += 4) {
+        float_4 x;
+        for (int lane = 0; lane < 4; ++lane) {
+            x[lane] = start + (i + lane) * range * 1.2f / steps;
+        }
+        const float_4 y = LookupTable<float>::lookupSimd(*params, x, true);
+        for (int lane = 0; lane < 4; ++lane) {
+            assertEQ(y[lane], LookupTable<float>::lookup(*params, x[lane], true));
+        }
+    }
+}
+
+static void testLookupSimd()
+{
+    testLookupSimd(ObjectCache<float>::getExp2());
+    testLookupSimd(ObjectCache<float>::getDb2Gain());
+    testLookupSimd(ObjectCache<float>::getAudioTaper());
+    testLookupSimd(ObjectCache<float>::getBipolarAudioTaper());
+    testLookupSimd(ObjectCache<float>::getTanh5());
+    testLookupSimd(ObjectCache<float>::getSinLookup());
+    testLookupSimd(ObjectCache<float>::getMixerPanL());
+}
+
+static void testNonUniformSimd(int size)
+{
+    NonUniformLookupTableParams<float> params;
+    for (int i = 0; i < size; ++i) {
+        // uneven spacing, non-linear y
+        const float x = float(i * i) * .01f;
+        NonUniformLookupTable<float>::addPoint(params, x, std::sqrt(x) + 1);
+    }
+    NonUniformLookupTable<float>::finalize(params);
+
+    const float xMax = float((size - 1) * (size - 1)) * .01f;
+    for (int i = -40; i < 1040; i += 4) {
+        float_4 x;
+        for (int lane = 0; lane < 4; ++lane) {
+            x[lane] = (i + lane) * xMax / 1000;
+        }
+        // also hit the points exactly
+        x[3] = float((i / 4) % size) * float((i / 4) % size) * .01f;
+        const float_4 y = NonUniformLookupTable<float>::lookupSimd(params, x);
+        for (int lane = 0; lane < 4; ++lane) {
+            assertEQ(y[lane], NonUniformLookupTable<float>::lookup(params, x[lane]));
+        }
+    }
+}
+
 void testSimdLookup()
 {
+    testLookupSimd();
+    testNonUniformSimd(3);
+    testNonUniformSimd(14);
+    testNonUniformSimd(100);
+
    // test0();
     compare();
     compare3();
@@ -156,6 +156,39 @@ static void test2P()
     }
 }
 
+/**
+ * The float_4 filter should give exactly the same
+ * result as four scalar filters.
+ */
+static void testSimd(StateVariableFilterParams<float>::Mode mode)
+{
+    const float freq[4] = {.001f, .01f, .1f, .4f};
+    const float q[4] = {.7f, 2, 15, .5f};
+
+    StateVariableFilterParams<float_4> params4;
+    StateVariableFilterState<float_4> state4;
+    params4.setMode(StateVariableFilterParams<float_4>::Mode(int(mode)));
+    params4.setFreq(float_4::load(freq));
+    params4.setQ(float_4::load(q));
+
+    StateVariableFilterParams<float> params[4];
+    StateVariableFilterState<float> state[4];
+    for (int i = 0; i < 4; ++i) {
+        params[i].setMode(mode);
+        params[i].setFreq(freq[i]);
+        params[i].setQ(q[i]);
+    }
+
+    for (int n = 0; n < 200; ++n) {
+        const float input = (n & 8) ? 1.f : -1.f;
+        const float_4 output4 = StateVariableFilter<float_4>::run(input, state4, params4);
+        for (int i = 0; i < 4; ++i) {
+            const float output = StateVariableFilter<float>::run(input, state[i], params[i]);
+            assertEQ(output4[i], output);
+        }
+    }
+}
+
 void testStateVariable()
 {
     test<float>();
@@ -163,4 +196,8 @@ void testStateVariable()
     testBandpass();
     test2P();
     test4P();
-}
\ No newline at end of file
+    testSimd(StateVariableFilterParams<float>::Mode::LowPass);
+    testSimd(StateVariableFilterParams<float>::Mode::BandPass);
+    testSimd(StateVariableFilterParams<float>::Mode::HiPass);
+    testSimd(StateVariableFilterParams<float>::Mode::Notch);
+}
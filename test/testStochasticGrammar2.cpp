@@ -1,8 +1,12 @@
+#include "GenerativeTriggerGenerator2.h"
 #include "StochasticGrammar2.h"
+#include "StochasticGrammarTable.h"
 #include "StochasticNote.h"
 #include "StochasticProductionRule.h"
 #include "asserts.h"
 
+#include <map>
+
 static void test0() {
     StochasticDisplayNote n(StochasticDisplayNote::Durations::half);
     assertEQnp(n.duration, StochasticDisplayNote::Durations::half);
@@ -229,6 +233,123 @@ static void testDemos() {
     assert(gmr->isValid());
 }
 
+static StochasticGrammarPtr makeOneRuleGrammar(double p0, double p1) {
+    auto grammar = std::make_shared<StochasticGrammar>();
+    auto rule = std::make_shared<StochasticProductionRule>(StochasticNote::quarter());
+
+    auto entry = StochasticProductionRuleEntry::make();
+    entry->rhsProducedNotes.push_back(StochasticNote::eighth());
+    entry->rhsProducedNotes.push_back(StochasticNote::eighth());
+    entry->probability = p0;
+    rule->addEntry(entry);
+
+    entry = StochasticProductionRuleEntry::make();
+    for (int i = 0; i < 4; ++i) {
+        entry->rhsProducedNotes.push_back(StochasticNote::sixteenth());
+    }
+    entry->probability = p1;
+    rule->addEntry(entry);
+
+    grammar->addRule(rule);
+    return grammar;
+}
+
+/**
+ * sweep the random number over 0..1, and the table should
+ * pick each entry as often as the old evaluator would
+ */
+static void testTableChances(double p0, double p1, double expected0, double expected1) {
+    auto grammar = makeOneRuleGrammar(p0, p1);
+    StochasticGrammarTable table(*grammar);
+    assertEQ(table._numRules(), 1);
+
+    const int steps = 100000;
+    std::map<int, int> counts;
+    for (int i = 0; i < steps; ++i) {
+        const float r = (i + .5f) / steps;
+        counts[table._pick(0, r)]++;
+    }
+    assertClose(double(counts[0]) / steps, expected0, .001);
+    assertClose(double(counts[1]) / steps, expected1, .001);
+    assertClose(double(counts[-1]) / steps, 1 - (expected0 + expected1), .001);
+
+    // the ends of the range are ok, too
+    table._pick(0, 0);
+    table._pick(0, 1);
+}
+
+static void testTableChances() {
+    testTableChances(.5, .25, .5, .25);
+    testTableChances(.1, .9, .1, .9);
+    testTableChances(0, .3, 0, .3);
+    testTableChances(.7, .7, .7, .3);  // more than one - second entry gets cut short
+    testTableChances(1, .5, 1, 0);
+}
+
+class TableTestEvaluator : public StochasticProductionRule::EvaluationState {
+public:
+    TableTestEvaluator(AudioMath::RandomUniformFunc xr) : StochasticProductionRule::EvaluationState(xr) {
+    }
+    void writeSymbol(const StochasticNote& sym) override {
+        durations[sym.duration]++;
+        total += sym.duration;
+    }
+    std::map<int, int> durations;
+    int total = 0;
+};
+
+/**
+ * the table should make the same kinds of notes as the grammar, as often
+ */
+static void testTableSameAsGrammar(StochasticGrammar::DemoGrammar demo) {
+    auto grammar = StochasticGrammar::getDemoGrammar(demo);
+    StochasticGrammarTable table(*grammar);
+    const int rootDuration = grammar->getRootRule()->lhs.duration;
+
+    const int iterations = 20000;
+    TableTestEvaluator esGrammar(AudioMath::random());
+    esGrammar.grammar = grammar;
+    TableTestEvaluator esTable(AudioMath::random());
+    for (int i = 0; i < iterations; ++i) {
+        StochasticProductionRule::evaluate(esGrammar, grammar->getRootRule());
+        table.evaluate(esTable);
+        assertEQ(esTable.total, (i + 1) * rootDuration);
+    }
+    assertEQ(esGrammar.total, esTable.total);
+
+    assertEQ(esGrammar.durations.size(), esTable.durations.size());
+    for (auto it : esGrammar.durations) {
+        const double expected = double(it.second) / iterations;
+        const double actual = double(esTable.durations[it.first]) / iterations;
+        assertClose(actual, expected, .03 + expected * .03);
+    }
+}
+
+static void testTableSameAsGrammar() {
+    testTableSameAsGrammar(StochasticGrammar::DemoGrammar::simple);
+    testTableSameAsGrammar(StochasticGrammar::DemoGrammar::demo);
+    testTableSameAsGrammar(StochasticGrammar::DemoGrammar::quarters);
+    testTableSameAsGrammar(StochasticGrammar::DemoGrammar::x25);
+}
+
+static void testSetGrammar() {
+    auto grammar = StochasticGrammar::getDemoGrammar(StochasticGrammar::DemoGrammar::quarters);
+    GenerativeTriggerGenerator2 gtg(AudioMath::random(), grammar);
+
+    // change it a few times without ever playing.
+    gtg.setGrammar(StochasticGrammar::getDemoGrammar(StochasticGrammar::DemoGrammar::demo));
+    gtg.setGrammar(StochasticGrammar::getDemoGrammar(StochasticGrammar::DemoGrammar::x25));
+
+    bool triggered = false;
+    for (int i = 0; i < 1000; ++i) {
+        triggered |= gtg.updateToMetricTime(i * .25, .25f, true);
+        if (i == 500) {
+            gtg.setGrammar(grammar);
+        }
+    }
+    assert(triggered);
+}
+
 void testStochasticGrammar2() {
     test0();
     testNoteDurations();
@@ -239,4 +360,7 @@ void testStochasticGrammar2() {
     testNoteFromText();
     testLHS();
     testDemos();
+    testTableChances();
+    testTableSameAsGrammar();
+    testSetGrammar();
 }
\ No newline at end of file
@@ -25,7 +25,99 @@ static void testDiv0()
     assert(called);
 }
 
+class DivTester
+{
+public:
+    void count() { ++calls; }
+    void countN(int n) { lastN = n; ++calls; }
+    int calls = 0;
+    int lastN = 0;
+};
+
+static void testFixedDiv0()
+{
+    using D3 = FixedDivider<3, DividerCallback<DivTester, &DivTester::count>>;
+    DivTester t;
+    D3 d;
+    d.setup(&t);
+    d.setPhase(0);
+    assertEQ(d.getDiv(), 3);
+
+    // fires on first call, then every third, like Divider
+    d.step();
+    assertEQ(t.calls, 1);
+    d.step();
+    d.step();
+    assertEQ(t.calls, 1);
+    d.step();
+    assertEQ(t.calls, 2);
+    for (int i = 0; i < 300; ++i) {
+        d.step();
+    }
+    assertEQ(t.calls, 102);
+
+    // stagger is off by default, so every instance is the same
+    for (int i = 0; i < 10; ++i) {
+        assertEQ(D3::nextPhase(), 0);
+    }
+}
+
+static void testFixedDivPhase()
+{
+    DivTester t;
+    FixedDivider<4, DividerCallbackN<DivTester, &DivTester::countN, 4>> d;
+    d.setup(&t);
+    d.setPhase(3);
+
+    // still fires first, but the second one is early
+    d.step();
+    assertEQ(t.calls, 1);
+    assertEQ(t.lastN, 4);
+    d.step();
+    assertEQ(t.calls, 2);
+    for (int i = 0; i < 3; ++i) {
+        d.step();
+    }
+    assertEQ(t.calls, 2);
+    d.step();
+    assertEQ(t.calls, 3);
+}
+
+/**
+ * with stagger on, new instances get different phases, so they don't all fire together
+ */
+static void testFixedDivStagger()
+{
+    using D = FixedDivider<4, DividerCallback<DivTester, &DivTester::count>>;
+    const int numInstances = 8;
+    DividerStagger::enable(true);
+    DivTester t[numInstances];
+    D d[numInstances];
+    DividerStagger::enable(false);
+    for (int i = 0; i < numInstances; ++i) {
+        d[i].setup(t + i);
+    }
+
+    for (int sample = 0; sample < 401; ++sample) {
+        int fired = 0;
+        for (int i = 0; i < numInstances; ++i) {
+            const int before = t[i].calls;
+            d[i].step();
+            fired += t[i].calls - before;
+        }
+        if (sample > 0) {
+            assertEQ(fired, numInstances / 4);
+        }
+    }
+    for (int i = 0; i < numInstances; ++i) {
+        assertEQ(t[i].calls, 101);
+    }
+}
+
 void testUtils()
 {
     testDiv0();
+    testFixedDiv0();
+    testFixedDivPhase();
+    testFixedDivStagger();
 }
\ No newline at end of file
@@ -1,7 +1,9 @@
 
 #include "Analyzer.h"
 #include "asserts.h"
+#include "BasicVCO.h"
 #include "FunVCO.h"
+#include "MinBLEPVCO.h"
 #include "SawOscillator.h"
 #include "SinOscillator.h"
 #include "TestComposite.h"
@@ -262,7 +264,10 @@ double WeightA(double mag, double f)
     return Ra * mag;
 }
 
-void testAlias(std::function<float()> func, double fundamental, int numSamples)
+/**
+ * returns the ratio of alias energy to signal energy, in dB
+ */
+double testAlias(std::function<float()> func, double fundamental, int numSamples)
 {
    // printf("test alias fundamental=%f,%f,%f\n", fundamental, fundamental * 2, fundamental * 3);
     FFTDataCpx spectrum(numSamples);
@@ -325,6 +330,7 @@ void testAlias(std::function<float()> func, double fundamental, int numSamples)
         AudioMath::db(totalAlias / totalSignal),
         2 + AudioMath::db(totalAliasA / totalSignalA)
     );
+    return AudioMath::db(totalAlias / totalSignal);
 }
 
 void printHeader(const char * label, double desired, double actual)
@@ -423,6 +429,77 @@ static void testAliasFun(double normalizedFreq)
 }
 
 
+static double testAliasMinBLEPVCO(double normalizedFreq, MinBLEPVCO::Waveform wf, bool lite)
+{
+    double freq = Analyzer::makeEvenPeriod(sampleRate * normalizedFreq, sampleRate, numSamples);
+    printHeader(lite ? "MinBLEPVCO lite" : "MinBLEPVCO", sampleRate * normalizedFreq, freq);
+
+    MinBLEPVCO vco;
+    vco.setWaveform(wf);
+    vco.setLite(lite);
+    vco.setNormalizedFreq(float(freq / sampleRate), 1.f / sampleRate);
+    return testAlias([&vco]() {
+        vco.step();
+        return vco.getOutput();
+        }, freq, numSamples);
+}
+
+static double testAliasBasic(double normalizedFreq, BasicVCO::Waveform wf, bool lite)
+{
+    // BasicVCO only takes pitch, and exp2 is not exact, so let the analyzer adjust the bins
+    double freq = Analyzer::makeEvenPeriod(sampleRate * normalizedFreq, sampleRate, numSamples);
+    printHeader(lite ? "BasicVCO lite" : "BasicVCO", sampleRate * normalizedFreq, freq);
+
+    BasicVCO vco;
+    const float pitch = float(std::log2(freq / rack::dsp::FREQ_C4));
+    vco.setPitch(float_4(pitch), 1.f / sampleRate, sampleRate);
+    auto proc = vco.getProcPointer(wf, lite);
+    return testAlias([&vco, proc]() {
+        return ((&vco)->*proc)(1.f / sampleRate)[0];
+        }, freq, numSamples);
+}
+
+/**
+ * Compare the alias of the wavetable "lite" mode to MinBLEP.
+ * total alias / total signal in dB, 64k frame, MinBLEP / lite:
+ *
+ * freq     EV3 saw         EV3 square      Basic saw       Basic even
+ * 844      -15.0 / -162.7  -16.3 / -162.9  -15.0 / -112.0  -17.6 / -110.3
+ * 1688     -13.5 / -163.3  -16.0 / -164.5  -13.5 / -90.3   -15.7 / -90.2
+ * 3377     -10.5 / -168.0  -11.2 / -168.6  -10.5 / -91.3   -15.9 / -91.5
+ *
+ * (Basic can't hit the exact bin frequencies, so it has some leakage).
+ *
+ * CPU, from perfTest, quota used per 1%, MinBLEP / lite:
+ *      Basic, 16 channels at different pitches: saw 45 / 36, square 50 / 51, even 582 / 27
+ *      Sub, 8 voices at different pitches: 180 / 105
+ * Square is about the same, since it takes two table lookups.
+ */
+static void testAliasLite()
+{
+    for (int i = 2; i <= 8; i *= 2) {
+        const double f = 1.0 / (i * 6.53);
+        const double sawBlep = testAliasMinBLEPVCO(f, MinBLEPVCO::Waveform::Saw, false);
+        const double sawLite = testAliasMinBLEPVCO(f, MinBLEPVCO::Waveform::Saw, true);
+        const double sqBlep = testAliasMinBLEPVCO(f, MinBLEPVCO::Waveform::Square, false);
+        const double sqLite = testAliasMinBLEPVCO(f, MinBLEPVCO::Waveform::Square, true);
+        const double basicSawBlep = testAliasBasic(f, BasicVCO::Waveform::SAW, false);
+        const double basicSawLite = testAliasBasic(f, BasicVCO::Waveform::SAW, true);
+        const double basicEvenBlep = testAliasBasic(f, BasicVCO::Waveform::EVEN, false);
+        const double basicEvenLite = testAliasBasic(f, BasicVCO::Waveform::EVEN, true);
+        printf("\n** freq %.0f saw %.1f / %.1f, sq %.1f / %.1f, basic saw %.1f / %.1f, basic even %.1f / %.1f\n",
+            f * sampleRate,
+            sawBlep, sawLite, sqBlep, sqLite,
+            basicSawBlep, basicSawLite, basicEvenBlep, basicEvenLite);
+
+        // the wavetables should never alias more than MinBLEP
+        assertLT(sawLite, sawBlep);
+        assertLT(sqLite, sqBlep);
+        assertLT(basicSawLite, basicSawBlep);
+        assertLT(basicEvenLite, basicEvenBlep);
+    }
+}
+
 /*
 First try:
 desired freq = 844.180682, round 842.486572
@@ -500,6 +577,7 @@ Test passed. Press any key to continue...
 void testVCOAlias()
 {
     testPitchQuantize();
+    testAliasLite();
 
 
     for (int i = 2; i <= 8; i *= 2) {
@@ -294,6 +294,65 @@ static void testVocalFilter()
     }
 }
 
+using VocFilter = VocalFilter<TestComposite>;
+
+static void runVocalFilter(VocFilter& vf, int numChannels, std::vector<float>* outputs)
+{
+    vf.inputs[VocFilter::AUDIO_INPUT].channels = numChannels;
+    vf.outputs[VocFilter::AUDIO_OUTPUT].channels = 1;
+    for (int i = 0; i < 1000; ++i) {
+        for (int ch = 0; ch < numChannels; ++ch) {
+            vf.inputs[VocFilter::AUDIO_INPUT].setVoltage((i & 16) ? 1.f : -1.f, ch);
+        }
+        vf.step();
+        for (int ch = 0; ch < numChannels; ++ch) {
+            outputs[ch].push_back(vf.outputs[VocFilter::AUDIO_OUTPUT].getVoltage(ch));
+        }
+    }
+}
+
+/**
+ * With mono CV, every voice should sound the same as a mono filter.
+ */
+static void testVocalFilterPoly()
+{
+    VocFilter mono;
+    mono.setSampleRate(44100);
+    mono.init();
+    std::vector<float> monoOutput[1];
+    runVocalFilter(mono, 1, monoOutput);
+
+    VocFilter poly;
+    poly.setSampleRate(44100);
+    poly.init();
+    std::vector<float> polyOutput[16];
+    runVocalFilter(poly, 16, polyOutput);
+
+    assertEQ(poly.outputs[VocFilter::AUDIO_OUTPUT].getChannels(), 16);
+    for (int ch = 0; ch < 16; ++ch) {
+        assert(polyOutput[ch] == monoOutput[0]);
+    }
+}
+
+/**
+ * Polyphonic vowel CV should give each voice its own vowel.
+ */
+static void testVocalFilterPolyCV()
+{
+    VocFilter vf;
+    vf.setSampleRate(44100);
+    vf.init();
+
+    vf.params[VocFilter::FILTER_VOWEL_TRIM_PARAM].value = 1;
+    vf.inputs[VocFilter::FILTER_VOWEL_CV_INPUT].channels = 2;
+    vf.inputs[VocFilter::FILTER_VOWEL_CV_INPUT].setVoltage(-4, 0);
+    vf.inputs[VocFilter::FILTER_VOWEL_CV_INPUT].setVoltage(4, 1);
+    std::vector<float> outputs[2];
+    runVocalFilter(vf, 2, outputs);
+
+    assert(outputs[0] != outputs[1]);
+}
+
 static void testInputExtremes()
 {
     VocalAnimator<TestComposite> va;
@@ -363,6 +422,8 @@ void testVocalAnimator()
     testFormantTables2();
 
     testVocalFilter();
+    testVocalFilterPoly();
+    testVocalFilterPolyCV();
 #if defined(_DEBUG) && true
     printf("skipping extremes\n");
 #else
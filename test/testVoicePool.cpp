@@ -0,0 +1,128 @@
+
+#include "VoicePool.h"
+#include "asserts.h"
+
+using Pool = VoicePool<32>;
+
+static void testVoicePool0()
+{
+    Pool p;
+    for (int i = 0; i < 16; ++i) {
+        assertEQ(p.getVoice(i), -1);
+    }
+    for (int i = 0; i < Pool::numVoices; ++i) {
+        assertEQ(p.getChannel(i), -1);
+        assert(!p.isHeld(i));
+    }
+    for (int i = 0; i < Pool::numBanks; ++i) {
+        assertEQ(rack::simd::movemask(p.getGates(i)), 0);
+    }
+}
+
+static void testVoicePoolNoteOn()
+{
+    Pool p;
+    const int v = p.noteOn(5);
+    assertEQ(v, 0);
+    assertEQ(p.getVoice(5), 0);
+    assertEQ(p.getChannel(0), 5);
+    assert(p.isHeld(0));
+    assertEQ(rack::simd::movemask(p.getGates(0)), 1);
+
+    p.noteOff(5);
+    assert(!p.isHeld(0));
+    assertEQ(rack::simd::movemask(p.getGates(0)), 0);
+
+    // the tail still belongs to channel 5
+    assertEQ(p.getVoice(5), 0);
+    assertEQ(p.getChannel(0), 5);
+}
+
+static void testVoicePoolRetrigger()
+{
+    Pool p;
+    p.noteOn(0);
+    p.setLevels(0, float_4(.5f));
+
+    // second note on the same channel gets a new voice, old one is released
+    const int v = p.noteOn(0);
+    assertEQ(v, 1);
+    assert(!p.isHeld(0));
+    assert(p.isHeld(1));
+    assertEQ(p.getChannel(0), 0);
+    assertEQ(p.getChannel(1), 0);
+    assertEQ(p.getVoice(0), 1);
+
+    // once the first tail is silent, it gets re-used
+    p.setLevels(0, float_4(0, .5f, 0, 0));
+    assertEQ(p.noteOn(3), 0);
+    assertEQ(p.getChannel(0), 3);
+}
+
+static void testVoicePoolPacked()
+{
+    Pool p;
+    for (int i = 0; i < 16; ++i) {
+        assertEQ(p.noteOn(i), i);
+    }
+    for (int i = 0; i < 4; ++i) {
+        assertEQ(rack::simd::movemask(p.getGates(i)), 0xf);
+    }
+    for (int i = 4; i < Pool::numBanks; ++i) {
+        assertEQ(rack::simd::movemask(p.getGates(i)), 0);
+    }
+}
+
+static void testVoicePoolSteal()
+{
+    Pool p;
+
+    // fill up the pool with release tails, and one held note
+    for (int i = 0; i < Pool::numVoices; ++i) {
+        const int v = p.noteOn(0);
+        p.setLevels(v / 4, float_4(.5f));
+    }
+    assertEQ(p.getVoice(0), Pool::numVoices - 1);
+
+    // all the same level, steals the oldest
+    assertEQ(p.noteOn(1), 0);
+
+    // steals the quietest
+    p.setLevels(2, float_4(.5f, .1f, .5f, .5f));
+    assertEQ(p.noteOn(2), 9);
+
+    // voices that are held never get stolen
+    p.setLevels(7, float_4(.5f, .5f, .5f, 0.f));
+    assertEQ(p.getVoice(1), 0);
+    assertEQ(p.noteOn(3), 1);
+}
+
+static void testVoicePoolStealClearsOldChannel()
+{
+    Pool p;
+    for (int i = 0; i < Pool::numVoices; ++i) {
+        const int v = p.noteOn(i % 16);
+        p.setLevels(v / 4, float_4(.5f));
+    }
+    for (int i = 0; i < 16; ++i) {
+        p.noteOff(i);
+    }
+
+    // channel 0's most recent voice is 16. Steal every voice, and it is gone.
+    assertEQ(p.getVoice(0), 16);
+    for (int i = 0; i < Pool::numVoices; ++i) {
+        p.noteOn(1);
+        p.noteOff(1);
+    }
+    assertEQ(p.getVoice(0), -1);
+}
+
+void testVoicePool()
+{
+    testVoicePool0();
+    testVoicePoolNoteOn();
+    testVoicePoolRetrigger();
+    testVoicePoolPacked();
+    testVoicePoolSteal();
+    testVoicePoolStealClearsOldChannel();
+}
@@ -1,4 +1,7 @@
+#include <atomic>
+#include <chrono>
 #include <set>
+#include <thread>
 
 #include "AudioMath.h"
 #include "CompiledInstrument.h"
@@ -6,6 +9,7 @@
 #include "FilePath.h"
 #include "InstrumentInfo.h"
 #include "SInstrument.h"
+#include "SamplePrefetcher.h"
 #include "Sampler4vx.h"
 #include "SamplerSchema.h"
 #include "SqLog.h"
@@ -25,6 +29,291 @@ static void testWaveLoader0() {
     assertEQ(w.getProgressPercent(), 0);
 }
 
+/**
+ * Writes a 16 bit mono wave file, DC at value.
+ */
+static void writeTestWave(const char* path, int frames, int16_t value = 0, uint32_t sampleRate = 44100) {
+    FILE* fp = fopen(path, "wb");
+    assert(fp);
+    auto put32 = [fp](uint32_t x) {
+        for (int i = 0; i < 4; ++i) {
+            fputc(int((x >> (8 * i)) & 0xff), fp);
+        }
+    };
+    auto put16 = [fp](uint16_t x) {
+        fputc(x & 0xff, fp);
+        fputc(x >> 8, fp);
+    };
+    const uint32_t dataSize = frames * 2;
+    fwrite("RIFF", 1, 4, fp);
+    put32(36 + dataSize);
+    fwrite("WAVEfmt ", 1, 8, fp);
+    put32(16);
+    put16(1);  // PCM
+    put16(1);  // mono
+    put32(sampleRate);
+    put32(sampleRate * 2);
+    put16(2);
+    put16(16);
+    fwrite("data", 1, 4, fp);
+    put32(dataSize);
+    for (int i = 0; i < frames; ++i) {
+        put16(uint16_t(value));
+    }
+    fclose(fp);
+}
+
+static WaveLoaderPtr loadTestWaves(WaveLoaderPtr previous) {
+    WaveLoaderPtr w = std::make_shared<WaveLoader>();
+    w->addNextSample(FilePath("_test_reuse_a.wav"));
+    w->addNextSample(FilePath("_test_reuse_b.wav"));
+    if (previous) {
+        w->reuseFrom(*previous);
+    }
+    WaveLoader::LoaderState state = WaveLoader::LoaderState::Progress;
+    while (state == WaveLoader::LoaderState::Progress) {
+        state = w->loadNextFile();
+    }
+    assertEQ(int(state), int(WaveLoader::LoaderState::Done));
+    return w;
+}
+
+static void testWaveLoaderReuse() {
+    writeTestWave("_test_reuse_a.wav", 100);
+    writeTestWave("_test_reuse_b.wav", 200);
+
+    WaveLoaderPtr w = loadTestWaves(nullptr);
+    assertEQ(w->getNumReused(), 0);
+    assertEQ(w->getInfo(2)->getTotalFrameCount(), 200u);
+
+    // nothing changed, so nothing gets loaded again
+    WaveLoaderPtr w2 = loadTestWaves(w);
+    assertEQ(w2->getNumReused(), 2);
+    assert(w2->getInfo(1) == w->getInfo(1));
+    assert(w2->getInfo(2) == w->getInfo(2));
+
+    // edit one file
+    writeTestWave("_test_reuse_b.wav", 300);
+    w.reset();
+    WaveLoaderPtr w3 = loadTestWaves(w2);
+    assertEQ(w3->getNumReused(), 1);
+    assert(w3->getInfo(1) == w2->getInfo(1));
+    assert(w3->getInfo(2) != w2->getInfo(2));
+    assertEQ(w3->getInfo(2)->getTotalFrameCount(), 300u);
+
+    remove("_test_reuse_a.wav");
+    remove("_test_reuse_b.wav");
+}
+
+// An edit that keeps the size, saved right after the first load,
+// must still be noticed.
+static void testWaveLoaderReuseSameSize() {
+    writeTestWave("_test_reuse_a.wav", 100);
+    writeTestWave("_test_reuse_b.wav", 200, 1000);
+
+    WaveLoaderPtr w = loadTestWaves(nullptr);
+    const float oldValue = w->getInfo(2)->getData()[0];
+
+    // Long enough for the file system clock to tick, much less than a second.
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    writeTestWave("_test_reuse_b.wav", 200, 2000);
+
+    WaveLoaderPtr w2 = loadTestWaves(w);
+    assertEQ(w2->getNumReused(), 1);
+    assert(w2->getInfo(1) == w->getInfo(1));
+    assert(w2->getInfo(2) != w->getInfo(2));
+    assertEQ(w2->getInfo(2)->getData()[0], 2 * oldValue);
+
+    remove("_test_reuse_a.wav");
+    remove("_test_reuse_b.wav");
+}
+
+static void testWaveLoaderLazy() {
+    const char* files[] = {"_test_lazy_a.wav", "_test_lazy_b.wav", "_test_lazy_c.wav", "_test_lazy_d.wav"};
+    WaveLoader w;
+    w.setLazy(true);
+    for (int i = 0; i < 4; ++i) {
+        writeTestWave(files[i], 100 * (i + 1));
+        w.addNextSample(FilePath(files[i]));
+    }
+
+    // doesn't load anything
+    WaveLoader::LoaderState state = WaveLoader::LoaderState::Progress;
+    while (state == WaveLoader::LoaderState::Progress) {
+        state = w.loadNextFile();
+    }
+    assertEQ(int(state), int(WaveLoader::LoaderState::Done));
+    for (int i = 1; i <= 4; ++i) {
+        assert(!w.isReady(i));
+    }
+
+    // with no requests, loads from middle C out
+    w.startPrefetch({60, 62, 30, 90});
+    w._waitForPrefetch();
+    for (int i = 1; i <= 4; ++i) {
+        assert(w.isReady(i));
+        assertEQ(w.getInfo(i)->getTotalFrameCount(), uint64_t(100 * i));
+    }
+    const std::vector<int> expectedOrder = {1, 2, 3, 4};
+    assert(w._prefetcher()->_loadOrder() == expectedOrder);
+
+    for (auto file : files) {
+        remove(file);
+    }
+}
+
+static void testWaveLoaderLazyMissing() {
+    WaveLoader w;
+    w.setLazy(true);
+    w.addNextSample(FilePath("_test_lazy_not_there.wav"));
+    auto state = w.loadNextFile();
+    assertEQ(int(state), int(WaveLoader::LoaderState::Error));
+    assert(!w.lastError.empty());
+}
+
+/**
+ * A sample that a note asks for jumps ahead of the pitch order.
+ * And a sample that can't be decoded gets reported.
+ */
+static void testWaveLoaderLazyRequest() {
+    const char* files[] = {"_test_lazy_a.wav", "_test_lazy_b.wav", "_test_lazy_c.wav", "_test_lazy_d.wav"};
+    WaveLoader w;
+    w.setLazy(true);
+    for (int i = 0; i < 4; ++i) {
+        writeTestWave(files[i], 100 * (i + 1));
+        w.addNextSample(FilePath(files[i]));
+    }
+    // sample 1 is there, but isn't a wave file.
+    FILE* fp = fopen(files[0], "wb");
+    fputs("not a wave file", fp);
+    fclose(fp);
+    WaveLoader::LoaderState state = WaveLoader::LoaderState::Progress;
+    while (state == WaveLoader::LoaderState::Progress) {
+        state = w.loadNextFile();
+    }
+    assertEQ(int(state), int(WaveLoader::LoaderState::Done));
+
+    // The error callback holds up the prefetch thread after it fails on sample 1,
+    // so the request is sure to be waiting when it picks the next one.
+    std::atomic<int> numErrors(0);
+    std::atomic<bool> requested(false);
+    w.startPrefetch({60, 62, 30, 90}, [&numErrors, &requested](const std::string& err) {
+        assert(!err.empty());
+        ++numErrors;
+        while (!requested) {
+            std::this_thread::yield();
+        }
+    });
+
+    while (numErrors == 0) {
+        std::this_thread::yield();
+    }
+
+    // By pitch, sample 4 would be next after a note at 90.
+    w.requestLoad(3, 90);
+    requested = true;
+    w._waitForPrefetch();
+
+    assertEQ(numErrors, 1);
+    assert(!w.isReady(1));
+    for (int i = 2; i <= 4; ++i) {
+        assert(w.isReady(i));
+    }
+    const std::vector<int> expectedOrder = {1, 3, 4, 2};
+    assert(w._prefetcher()->_loadOrder() == expectedOrder);
+
+    for (auto file : files) {
+        remove(file);
+    }
+}
+
+/**
+ * The first note on a sample that isn't loaded is silent.
+ * After it loads, it plays.
+ */
+static void testSamplerLazy() {
+    writeTestWave("_test_lazy_e.wav", 44100, 10000);
+
+    SInstrumentPtr inst = std::make_shared<SInstrument>();
+    auto err = SParse::go("<region> key=60 sample=_test_lazy_e.wav", inst);
+    assert(err.empty());
+    SamplerErrorContext errc;
+    CompiledInstrumentPtr cinst = CompiledInstrument::make(errc, inst);
+
+    WaveLoaderPtr w = std::make_shared<WaveLoader>();
+    cinst->setWaves(w, FilePath("."));
+    w->setLazy(true);
+    assertEQ(int(w->loadNextFile()), int(WaveLoader::LoaderState::Done));
+
+    Sampler4vx s;
+    s.setPatch(cinst);
+    s.setLoader(w);
+    s.note_on(0, 60, 64, 44100);
+    assert(!s._player().channels[0].canPlay());
+
+    std::vector<int> pitches;
+    cinst->getSamplePitches(pitches);
+    assertEQ(pitches.size(), 1u);
+    assertEQ(pitches[0], 60);
+    w->startPrefetch(pitches);
+    w->_waitForPrefetch();
+
+    s.note_on(0, 60, 64, 44100);
+    assert(s._player().channels[0].canPlay());
+
+    s.setLoader(nullptr);
+    w.reset();
+    remove("_test_lazy_e.wav");
+}
+
+/**
+ * A note that comes in before its sample is loaded starts
+ * when the sample gets here, as long as the gate is still held.
+ */
+static void testSamplerLazyStartsWhenReady() {
+    // a different sample rate, so the pitch has to be fixed up when it loads.
+    writeTestWave("_test_lazy_e.wav", 44100, 10000, 48000);
+
+    SInstrumentPtr inst = std::make_shared<SInstrument>();
+    auto err = SParse::go("<region> key=60 sample=_test_lazy_e.wav", inst);
+    assert(err.empty());
+    SamplerErrorContext errc;
+    CompiledInstrumentPtr cinst = CompiledInstrument::make(errc, inst);
+
+    WaveLoaderPtr w = std::make_shared<WaveLoader>();
+    cinst->setWaves(w, FilePath("."));
+    w->setLazy(true);
+    assertEQ(int(w->loadNextFile()), int(WaveLoader::LoaderState::Done));
+
+    Sampler4vx s;
+    s.setPatch(cinst);
+    s.setLoader(w);
+    s.note_on(0, 60, 64, 44100);
+    s.note_on(1, 60, 64, 44100);
+
+    // channel 0 held, channel 1 released
+    float_4 gates = float_4::zero();
+    gates[0] = SimdBlocks::maskTrue()[0];
+    const float sampleTime = 1.f / 44100.f;
+    s.step(gates, sampleTime, 0, false);
+    assert(!s._player().channels[0].canPlay());
+    assert(!s._player().channels[1].canPlay());
+
+    std::vector<int> pitches;
+    cinst->getSamplePitches(pitches);
+    w->startPrefetch(pitches);
+    w->_waitForPrefetch();
+
+    s.step(gates, sampleTime, 0, false);
+    assert(s._player().channels[0].canPlay());
+    assert(!s._player().channels[1].canPlay());
+    assertClose(s._transAmt(0), 48000.f / 44100.f, .001);
+
+    s.setLoader(nullptr);
+    w.reset();
+    remove("_test_lazy_e.wav");
+}
+
 static void testWaveLoader1Wav() {
     WaveLoader w;
     w.addNextSample(FilePath("D:\\samples\\UprightPianoKW-small-SFZ-20190703\\samples\\A3vH.wav"));
@@ -211,6 +500,57 @@ static void testCIKeysAndValuesNotesSharp() {
     testCIKeysAndValues("d#4", expectedPitch);
 }
 
+static void testCIKeysAndValuesOverwrite() {
+    SKeyValueList l = {
+        std::make_shared<SKeyValuePair>("hikey", "12"),
+        std::make_shared<SKeyValuePair>("sample", "a.wav"),
+        std::make_shared<SKeyValuePair>("hikey", "13")};
+
+    SamplerErrorContext errc;
+    auto output = SamplerSchema::compile(errc, l);
+    assert(errc.empty());
+    assertEQ(output->_size(), 2);
+
+    // last one wins
+    SamplerSchema::ValuePtr vp = output->get(SamplerSchema::Opcode::HI_KEY);
+    assert(vp);
+    assertEQ(vp->numericInt, 13);
+
+    vp = output->get(SamplerSchema::Opcode::SAMPLE);
+    assert(vp);
+    assertEQ(vp->string, "a.wav");
+
+    assert(!output->get(SamplerSchema::Opcode::LO_KEY));
+}
+
+static void testSchemaTranslate() {
+    std::vector<std::string> all = SamplerSchema::_getKnownTextOpcodes();
+    for (auto opcode : all) {
+        assert(SamplerSchema::translate(opcode, true) != SamplerSchema::Opcode::NONE);
+        assert(SamplerSchema::keyTextToType(opcode, true) == SamplerSchema::OpcodeType::String);
+    }
+    std::vector<std::string> knownNot = SamplerSchema::_getKnownNonTextOpcodes();
+    for (auto opcode : knownNot) {
+        assert(SamplerSchema::translate(opcode, true) != SamplerSchema::Opcode::NONE);
+        assert(SamplerSchema::keyTextToType(opcode, true) != SamplerSchema::OpcodeType::String);
+        assert(SamplerSchema::keyTextToType(opcode, true) != SamplerSchema::OpcodeType::Unknown);
+    }
+    all.insert(all.end(), knownNot.begin(), knownNot.end());
+    assertGT(all.size(), 30);
+
+    assert(SamplerSchema::translate("hikey", true) == SamplerSchema::Opcode::HI_KEY);
+    assert(SamplerSchema::translate("loopstart", true) == SamplerSchema::Opcode::LOOP_START);
+    assert(SamplerSchema::translate("loop_start", true) == SamplerSchema::Opcode::LOOP_START);
+    assert(SamplerSchema::keyTextToType("amp_veltrack", true) == SamplerSchema::OpcodeType::Float);
+
+    // things that are close, but not opcodes
+    const char* unknown[] = {"", "hike", "hikeyy", "HIKEY", "label_cc7", "sw_lolast", "amp_velcurve_1"};
+    for (auto x : unknown) {
+        assert(SamplerSchema::translate(x, true) == SamplerSchema::Opcode::NONE);
+        assert(SamplerSchema::keyTextToType(x, true) == SamplerSchema::OpcodeType::Unknown);
+    }
+}
+
 static void testParseHeadingGlobalAndRegionCompiled() {
     printf("start test parse global\n");
     SInstrumentPtr inst = std::make_shared<SInstrument>();
@@ -1562,6 +1902,13 @@ void testx2() {
     assert(compileCount == 0);
    
     testWaveLoader0();
+    testWaveLoaderReuse();
+    testWaveLoaderReuseSameSize();
+    testWaveLoaderLazy();
+    testWaveLoaderLazyMissing();
+    testWaveLoaderLazyRequest();
+    testSamplerLazy();
+    testSamplerLazyStartsWhenReady();
     testWaveLoader1Wav();
     testWaveLoader1Flac();
 
@@ -1574,6 +1921,8 @@ void testx2() {
     testCIKeysAndValuesNotesLC();
     testCIKeysAndValuesNotesUC();
     testCIKeysAndValuesNotesSharp();
+    testCIKeysAndValuesOverwrite();
+    testSchemaTranslate();
 
     testParseHeadingGlobalAndRegionCompiled();
     testParseHeadingGlobalWithKVAndRegionCompiled();
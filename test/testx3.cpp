@@ -667,6 +667,74 @@ static void testPlayOverlapRestore() {
     assert(!info.valid);
 }
 
+/**
+ * velocity layers and round robin over a key range,
+ * so the lookup table shares one row for all the pitches.
+ */
+static void testPlayVelRoundRobin() {
+    static char* patch = R"foo(
+        <group> lokey=40 hikey=60 hivel=63 seq_length=2
+        <region> sample=a seq_position=1
+        <region> sample=b seq_position=2
+        <group> lokey=40 hikey=60 lovel=64 seq_length=2
+        <region> sample=c seq_position=1
+        <region> sample=d seq_position=2
+        )foo";
+
+    SInstrumentPtr inst = std::make_shared<SInstrument>();
+    auto err = SParse::go(patch, inst);
+    assert(err.empty());
+
+    SamplerErrorContext errc;
+    CompiledInstrumentPtr cinst = CompiledInstrument::make(errc, inst);
+    assert(cinst);
+    assert(errc.empty());
+
+    VoicePlayInfo info;
+    VoicePlayParameter params;
+    params.midiPitch = 50;
+    params.midiVelocity = 30;
+    cinst->play(info, params, nullptr, 44100);
+    assert(info.valid);
+    assertEQ(info.sampleIndex, 1);
+
+    // the other layer's counter advanced, too
+    params.midiVelocity = 100;
+    cinst->play(info, params, nullptr, 44100);
+    assert(info.valid);
+    assertEQ(info.sampleIndex, 4);
+
+    params.midiVelocity = 30;
+    cinst->play(info, params, nullptr, 44100);
+    assert(info.valid);
+    assertEQ(info.sampleIndex, 1);
+
+    // the counters belong to the regions, not the pitch
+    params.midiPitch = 40;
+    cinst->play(info, params, nullptr, 44100);
+    assert(info.valid);
+    assertEQ(info.sampleIndex, 2);
+
+    params.midiPitch = 60;
+    params.midiVelocity = 127;
+    cinst->play(info, params, nullptr, 44100);
+    assert(info.valid);
+    assertEQ(info.sampleIndex, 3);
+
+    // out of range doesn't play, or advance the counters
+    params.midiPitch = 61;
+    cinst->play(info, params, nullptr, 44100);
+    assert(!info.valid);
+    params.midiPitch = 39;
+    cinst->play(info, params, nullptr, 44100);
+    assert(!info.valid);
+
+    params.midiPitch = 41;
+    cinst->play(info, params, nullptr, 44100);
+    assert(info.valid);
+    assertEQ(info.sampleIndex, 4);
+}
+
 static void testPlayLoop() {
     const char* data = (R"foo(
           <group>loop_mode=one_shot
@@ -828,6 +896,7 @@ void testx3() {
     testPlayOverlapPitch();
     testPlayOverlapRestore();
     testPlayLoop();
+    testPlayVelRoundRobin();
     //testPlayOsc();
 
     assert(parseCount == 0);